@@ -0,0 +1,63 @@
+//----------------------------------------------------------------------------------------------------
+// AllocationCounter.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Core/AllocationCounter.hpp"
+
+#include <cstdlib>
+#include <new>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    // Plain thread-locals, so they need no construction and are safe to touch from operator new
+    thread_local int       t_numOpenCounters = 0;
+    thread_local long long t_numAllocations  = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+void* operator new(size_t const size)
+{
+    if (t_numOpenCounters > 0)
+    {
+        ++t_numAllocations;
+    }
+
+    if (void* const memory = std::malloc((size == 0) ? 1 : size))
+    {
+        return memory;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* const memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* const memory,
+                     size_t const) noexcept
+{
+    std::free(memory);
+}
+
+//----------------------------------------------------------------------------------------------------
+ScopedAllocationCounter::ScopedAllocationCounter()
+    : m_numAllocationsAtStart(t_numAllocations)
+{
+    ++t_numOpenCounters;
+}
+
+//----------------------------------------------------------------------------------------------------
+ScopedAllocationCounter::~ScopedAllocationCounter()
+{
+    --t_numOpenCounters;
+}
+
+//----------------------------------------------------------------------------------------------------
+long long ScopedAllocationCounter::GetNumAllocations() const
+{
+    return t_numAllocations - m_numAllocationsAtStart;
+}
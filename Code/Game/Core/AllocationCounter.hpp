@@ -0,0 +1,32 @@
+//----------------------------------------------------------------------------------------------------
+// AllocationCounter.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+// Counts the heap allocations a test section makes, including those inside the standard library.
+//
+// That takes replacing the global operator new, and a replacement applies to the whole program, so
+// it lives here, once, rather than in any one test file. It forwards straight to malloc, which is
+// what the default operator new does, and counts only on a thread inside a
+// ScopedAllocationCounter: everything else, on every other thread and in every other test, pays
+// one thread-local load and branch per allocation and is otherwise unaffected.
+//
+// Counters nest; each reports the allocations its own thread made since it was created.
+//
+class ScopedAllocationCounter
+{
+public:
+    ScopedAllocationCounter();
+    ~ScopedAllocationCounter();
+
+    ScopedAllocationCounter(ScopedAllocationCounter const&)            = delete;
+    ScopedAllocationCounter& operator=(ScopedAllocationCounter const&) = delete;
+
+    long long GetNumAllocations() const;
+
+private:
+    long long m_numAllocationsAtStart = 0;
+};
@@ -0,0 +1,166 @@
+//----------------------------------------------------------------------------------------------------
+// EventDispatcher.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Core/EventDispatcher.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    char ToLowerAscii(char const character)
+    {
+        return (character >= 'A' && character <= 'Z') ? static_cast<char>(character - 'A' + 'a') : character;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    bool AreNamesEqualIgnoringCase(std::string_view const nameA,
+                                   std::string_view const nameB)
+    {
+        if (nameA.size() != nameB.size())
+        {
+            return false;
+        }
+
+        for (size_t index = 0; index < nameA.size(); ++index)
+        {
+            if (ToLowerAscii(nameA[index]) != ToLowerAscii(nameB[index]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+int EventDispatcher::RegisterEvent(std::string_view const name)
+{
+    uint64_t const hash          = HashEventName(name);
+    int const      existingIndex = FindEvent(name);
+
+    if (existingIndex >= 0)
+    {
+        // Two names with one hash would share subscribers; refuse the second rather than misroute it
+        return AreNamesEqualIgnoringCase(m_events[existingIndex].m_name, name) ? existingIndex : -1;
+    }
+
+    sEvent newEvent;
+    newEvent.m_name = std::string(name);
+    m_events.push_back(newEvent);
+
+    int const eventIndex     = static_cast<int>(m_events.size()) - 1;
+    m_eventIndexByHash[hash] = eventIndex;
+
+    return eventIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+int EventDispatcher::FindEvent(sHashedName const name) const
+{
+    auto const found = m_eventIndexByHash.find(name.m_hash);
+
+    return (found == m_eventIndexByHash.end()) ? -1 : found->second;
+}
+
+//----------------------------------------------------------------------------------------------------
+int EventDispatcher::GetNumEvents() const
+{
+    return static_cast<int>(m_events.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+std::string const& EventDispatcher::GetEventName(int const eventIndex) const
+{
+    return m_events[eventIndex].m_name;
+}
+
+//----------------------------------------------------------------------------------------------------
+int EventDispatcher::Subscribe(std::string_view const        name,
+                               EventDispatcherCallback const callback)
+{
+    int const eventIndex = RegisterEvent(name);
+
+    if (eventIndex >= 0)
+    {
+        Subscribe(eventIndex, callback);
+    }
+
+    return eventIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+void EventDispatcher::Subscribe(int const                     eventIndex,
+                                EventDispatcherCallback const callback)
+{
+    std::vector<EventDispatcherCallback>& subscribers = m_events[eventIndex].m_subscribers;
+
+    // Drop unsubscribed slots, unless a fire is walking the list
+    if (m_numFiresInProgress == 0)
+    {
+        std::erase(subscribers, nullptr);
+    }
+
+    subscribers.push_back(callback);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EventDispatcher::Unsubscribe(int const                     eventIndex,
+                                  EventDispatcherCallback const callback)
+{
+    // Null the slot instead of erasing, so a fire in progress does not skip the next subscriber
+    for (EventDispatcherCallback& subscriber : m_events[eventIndex].m_subscribers)
+    {
+        if (subscriber == callback)
+        {
+            subscriber = nullptr;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+int EventDispatcher::GetNumSubscribers(int const eventIndex) const
+{
+    int numSubscribers = 0;
+
+    for (EventDispatcherCallback const subscriber : m_events[eventIndex].m_subscribers)
+    {
+        if (subscriber != nullptr)
+        {
+            ++numSubscribers;
+        }
+    }
+
+    return numSubscribers;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool EventDispatcher::Fire(int const        eventIndex,
+                           InlineEventArgs& args)
+{
+    bool isConsumed = false;
+    ++m_numFiresInProgress;
+
+    // By index, since a callback that subscribes may grow the list
+    for (size_t index = 0; index < m_events[eventIndex].m_subscribers.size() && !isConsumed; ++index)
+    {
+        EventDispatcherCallback const subscriber = m_events[eventIndex].m_subscribers[index];
+
+        isConsumed = (subscriber != nullptr) && subscriber(args);
+    }
+
+    --m_numFiresInProgress;
+
+    return isConsumed;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool EventDispatcher::Fire(sHashedName const name,
+                           InlineEventArgs&  args)
+{
+    int const eventIndex = FindEvent(name);
+
+    return (eventIndex >= 0) && Fire(eventIndex, args);
+}
@@ -0,0 +1,55 @@
+//----------------------------------------------------------------------------------------------------
+// EventDispatcher.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Game/Core/InlineEventArgs.hpp"
+
+//----------------------------------------------------------------------------------------------------
+typedef bool (*EventDispatcherCallback)(InlineEventArgs& args);     // Returns true to consume the event
+
+//----------------------------------------------------------------------------------------------------
+// Named events in the style of the engine's EventSystem, without strings on the fire path.
+//
+// Event names are hashed and interned once, when they are registered or subscribed to, and the
+// caller keeps the returned event index; firing by index is then an array lookup and a walk of the
+// subscriber list, with no string built, compared or hashed. Firing by name is still available and
+// costs one hash table lookup on the 64-bit hash. Together with InlineEventArgs, firing an event
+// allocates nothing.
+//
+// As in EventSystem, subscribers are called in subscription order until one returns true.
+// Subscribers may unsubscribe, or subscribe others, from inside a callback.
+//
+class EventDispatcher
+{
+public:
+    int                RegisterEvent(std::string_view name);    // The existing index if already registered, -1 on a hash collision
+    int                FindEvent(sHashedName name) const;       // -1 if not registered
+    int                GetNumEvents() const;
+    std::string const& GetEventName(int eventIndex) const;
+
+    int  Subscribe(std::string_view name, EventDispatcherCallback callback);     // Returns the event index, -1 on a hash collision
+    void Subscribe(int eventIndex, EventDispatcherCallback callback);
+    void Unsubscribe(int eventIndex, EventDispatcherCallback callback);
+    int  GetNumSubscribers(int eventIndex) const;
+
+    bool Fire(int eventIndex, InlineEventArgs& args);           // True if a subscriber consumed the event
+    bool Fire(sHashedName name, InlineEventArgs& args);         // False if the event was never registered
+
+private:
+    struct sEvent
+    {
+        std::string                          m_name;
+        std::vector<EventDispatcherCallback> m_subscribers;     // Unsubscribed slots are null until the next Subscribe
+    };
+
+    std::vector<sEvent>               m_events;
+    std::unordered_map<uint64_t, int> m_eventIndexByHash;
+    int                               m_numFiresInProgress = 0;
+};
@@ -0,0 +1,292 @@
+//----------------------------------------------------------------------------------------------------
+// FrameArena.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Core/FrameArena.hpp"
+
+#include <cstring>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    int constexpr THREAD_STATE_CACHE_SIZE = 4;
+
+    struct sThreadStateCacheEntry
+    {
+        uint64_t m_arenaID     = 0;
+        void*    m_threadState = nullptr;
+    };
+
+    std::atomic<uint64_t> s_nextArenaID = 1;
+
+    // The arenas this thread used last, newest first
+    thread_local sThreadStateCacheEntry t_threadStateCache[THREAD_STATE_CACHE_SIZE];
+
+    //------------------------------------------------------------------------------------------------
+    unsigned char* AlignUp(unsigned char* const pointer,
+                           size_t const         alignment)
+    {
+        uintptr_t const address = reinterpret_cast<uintptr_t>(pointer);
+
+        return reinterpret_cast<unsigned char*>((address + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+FrameArena::FrameArena(size_t const blockSize)
+    : m_blockSize(blockSize),
+      m_arenaID(s_nextArenaID.fetch_add(1, std::memory_order_relaxed))
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+FrameArena::~FrameArena()
+{
+    EndFrame();
+
+    for (std::unique_ptr<sThreadState> const& state : m_threadStates)
+    {
+        for (sBlock* block = state->m_firstBlock; block != nullptr;)
+        {
+            sBlock* const next = block->m_next;
+            ::operator delete(block);
+            block = next;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void* FrameArena::Allocate(size_t const size,
+                           size_t const alignment)
+{
+    sThreadState& state = GetThreadState();
+
+    if (state.m_cursor != nullptr)
+    {
+        unsigned char* const result = AlignUp(state.m_cursor, alignment);
+
+        if (result <= state.m_end && static_cast<size_t>(state.m_end - result) >= size)
+        {
+            state.m_bytesAllocated += static_cast<size_t>(result + size - state.m_cursor);
+            state.m_cursor          = result + size;
+            return result;
+        }
+    }
+
+    return AllocateSlow(state, size, alignment);
+}
+
+//----------------------------------------------------------------------------------------------------
+void FrameArena::EndFrame()
+{
+    std::lock_guard<std::mutex> lock(m_threadStatesMutex);
+
+    size_t bytesAllocated = 0;
+
+    for (std::unique_ptr<sThreadState> const& state : m_threadStates)
+    {
+        bytesAllocated += state->m_bytesAllocated;
+
+#if defined(_DEBUG)
+        // Blocks fill in chain order, so the blocks up to the current one hold everything handed out
+        for (sBlock* block = state->m_firstBlock; block != nullptr; block = block->m_next)
+        {
+            size_t const usedSize = (block == state->m_currentBlock) ? static_cast<size_t>(state->m_cursor - block->GetData()) : block->m_size;
+            memset(block->GetData(), FRAME_ARENA_POISON_BYTE, usedSize);
+
+            if (block == state->m_currentBlock)
+            {
+                break;
+            }
+        }
+#endif
+
+        for (sBlock* block = state->m_oversized; block != nullptr;)
+        {
+            sBlock* const next      = block->m_next;
+            state->m_bytesReserved -= block->m_size;
+            ::operator delete(block);
+            block = next;
+        }
+
+        state->m_oversized      = nullptr;
+        state->m_currentBlock   = state->m_firstBlock;
+        state->m_cursor         = (state->m_firstBlock != nullptr) ? state->m_firstBlock->GetData() : nullptr;
+        state->m_end            = (state->m_firstBlock != nullptr) ? state->m_cursor + state->m_firstBlock->m_size : nullptr;
+        state->m_bytesAllocated = 0;
+    }
+
+    m_peakBytesAllocated = (bytesAllocated > m_peakBytesAllocated) ? bytesAllocated : m_peakBytesAllocated;
+    ++m_frameNumber;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t FrameArena::GetFrameNumber() const
+{
+    return m_frameNumber;
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t FrameArena::GetBytesAllocated() const
+{
+    std::lock_guard<std::mutex> lock(m_threadStatesMutex);
+
+    size_t bytesAllocated = 0;
+
+    for (std::unique_ptr<sThreadState> const& state : m_threadStates)
+    {
+        bytesAllocated += state->m_bytesAllocated;
+    }
+
+    return bytesAllocated;
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t FrameArena::GetPeakBytesAllocated() const
+{
+    size_t const bytesAllocated = GetBytesAllocated();
+
+    return (bytesAllocated > m_peakBytesAllocated) ? bytesAllocated : m_peakBytesAllocated;
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t FrameArena::GetBytesReserved() const
+{
+    std::lock_guard<std::mutex> lock(m_threadStatesMutex);
+
+    size_t bytesReserved = 0;
+
+    for (std::unique_ptr<sThreadState> const& state : m_threadStates)
+    {
+        bytesReserved += state->m_bytesReserved;
+    }
+
+    return bytesReserved;
+}
+
+//----------------------------------------------------------------------------------------------------
+int FrameArena::GetNumThreads() const
+{
+    std::lock_guard<std::mutex> lock(m_threadStatesMutex);
+
+    return static_cast<int>(m_threadStates.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+FrameArena::sThreadState& FrameArena::GetThreadState()
+{
+    if (t_threadStateCache[0].m_arenaID == m_arenaID)
+    {
+        return *static_cast<sThreadState*>(t_threadStateCache[0].m_threadState);
+    }
+
+    sThreadStateCacheEntry entry;
+
+    for (int cacheIndex = 1; cacheIndex < THREAD_STATE_CACHE_SIZE; ++cacheIndex)
+    {
+        if (t_threadStateCache[cacheIndex].m_arenaID == m_arenaID)
+        {
+            entry = t_threadStateCache[cacheIndex];
+            break;
+        }
+    }
+
+    // Not used by this thread lately: find its state, or register it on its first allocation
+    if (entry.m_threadState == nullptr)
+    {
+        std::lock_guard<std::mutex> lock(m_threadStatesMutex);
+        std::thread::id const       threadID = std::this_thread::get_id();
+
+        for (std::unique_ptr<sThreadState> const& state : m_threadStates)
+        {
+            if (state->m_threadID == threadID)
+            {
+                entry.m_threadState = state.get();
+                break;
+            }
+        }
+
+        if (entry.m_threadState == nullptr)
+        {
+            m_threadStates.push_back(std::make_unique<sThreadState>());
+            m_threadStates.back()->m_threadID = threadID;
+            entry.m_threadState               = m_threadStates.back().get();
+        }
+
+        entry.m_arenaID = m_arenaID;
+    }
+
+    // Move to the front, shifting the others back
+    sThreadStateCacheEntry previous = entry;
+
+    for (int cacheIndex = 0; cacheIndex < THREAD_STATE_CACHE_SIZE; ++cacheIndex)
+    {
+        std::swap(previous, t_threadStateCache[cacheIndex]);
+
+        if (previous.m_arenaID == m_arenaID)
+        {
+            break;
+        }
+    }
+
+    return *static_cast<sThreadState*>(entry.m_threadState);
+}
+
+//----------------------------------------------------------------------------------------------------
+void* FrameArena::AllocateSlow(sThreadState& state,
+                               size_t const  size,
+                               size_t const  alignment)
+{
+    // Too big to share a block: it gets one of its own, released at EndFrame
+    if (size + alignment > m_blockSize / 2)
+    {
+        sBlock* const block = AllocateBlock(size + alignment);
+        block->m_next       = state.m_oversized;
+        state.m_oversized   = block;
+
+        state.m_bytesAllocated += size;
+        state.m_bytesReserved  += block->m_size;
+        return AlignUp(block->GetData(), alignment);
+    }
+
+    // On to the next block kept from earlier frames, or a new one at the end of the chain
+    sBlock* next = (state.m_currentBlock != nullptr) ? state.m_currentBlock->m_next : state.m_firstBlock;
+
+    if (next == nullptr)
+    {
+        next                   = AllocateBlock(m_blockSize);
+        state.m_bytesReserved += next->m_size;
+
+        if (state.m_currentBlock != nullptr)
+        {
+            state.m_currentBlock->m_next = next;
+        }
+        else
+        {
+            state.m_firstBlock = next;
+        }
+    }
+
+    // The tail left in the block being abandoned counts as allocated, as padding does
+    state.m_bytesAllocated += static_cast<size_t>(state.m_end - state.m_cursor);
+    state.m_currentBlock    = next;
+    state.m_cursor          = next->GetData();
+    state.m_end             = state.m_cursor + next->m_size;
+
+    unsigned char* const result = AlignUp(state.m_cursor, alignment);
+    state.m_bytesAllocated     += static_cast<size_t>(result + size - state.m_cursor);
+    state.m_cursor              = result + size;
+
+    return result;
+}
+
+//----------------------------------------------------------------------------------------------------
+FrameArena::sBlock* FrameArena::AllocateBlock(size_t const size)
+{
+    sBlock* const block = static_cast<sBlock*>(::operator new(sizeof(sBlock) + size));
+    block->m_next       = nullptr;
+    block->m_size       = size;
+
+    return block;
+}
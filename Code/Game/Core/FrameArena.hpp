@@ -0,0 +1,162 @@
+//----------------------------------------------------------------------------------------------------
+// FrameArena.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+size_t constexpr        FRAME_ARENA_DEFAULT_BLOCK_SIZE = 256 * 1024;
+unsigned char constexpr FRAME_ARENA_POISON_BYTE        = 0xDD;      // Debug builds fill memory with it at EndFrame
+
+//----------------------------------------------------------------------------------------------------
+// Bump allocation for memory that lives until the end of the frame: neighbour lists, query results,
+// event arguments and the like. Allocating moves a pointer; nothing is freed on its own, and
+// EndFrame releases everything at once.
+//
+// Each thread bumps through its own chain of blocks, so allocation takes no lock and threads never
+// share a cache line; a thread's first allocation in an arena registers it under a mutex. Blocks
+// are kept across frames, so once the arena has grown to a frame's peak it stops touching the heap.
+// An allocation too big for a block gets a block of its own, freed at EndFrame.
+//
+// EndFrame must be called while no other thread is allocating from the arena. Destructors are
+// never run, so only trivially destructible types can be created in it. Debug builds fill released
+// memory with FRAME_ARENA_POISON_BYTE, and a FramePtr asserts if it is read after the frame ends.
+//
+class FrameArena
+{
+public:
+    explicit FrameArena(size_t blockSize = FRAME_ARENA_DEFAULT_BLOCK_SIZE);
+    ~FrameArena();
+
+    FrameArena(FrameArena const&)            = delete;
+    FrameArena& operator=(FrameArena const&) = delete;
+
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));     // Never null
+    void  EndFrame();
+
+    template <typename T>
+    T* AllocateArray(size_t count);         // Uninitialized
+
+    template <typename T, typename... Args>
+    T* Create(Args&&... args);
+
+    uint32_t GetFrameNumber() const;        // EndFrames since construction
+    size_t   GetBytesAllocated() const;     // This frame, across threads, padding included
+    size_t   GetPeakBytesAllocated() const; // In any frame so far
+    size_t   GetBytesReserved() const;      // Held in blocks, including this frame's oversized ones
+    int      GetNumThreads() const;         // That have allocated from the arena
+
+private:
+    struct sBlock
+    {
+        sBlock*        m_next = nullptr;
+        size_t         m_size = 0;          // Of the data after the header
+        unsigned char* GetData() { return reinterpret_cast<unsigned char*>(this + 1); }
+    };
+
+    struct alignas(64) sThreadState
+    {
+        sBlock*         m_firstBlock     = nullptr;
+        sBlock*         m_currentBlock   = nullptr;
+        sBlock*         m_oversized      = nullptr;
+        unsigned char*  m_cursor         = nullptr;
+        unsigned char*  m_end            = nullptr;
+        size_t          m_bytesAllocated = 0;
+        size_t          m_bytesReserved  = 0;
+        std::thread::id m_threadID;
+    };
+
+    sThreadState& GetThreadState();
+    void*         AllocateSlow(sThreadState& state, size_t size, size_t alignment);
+    sBlock*       AllocateBlock(size_t size);
+
+    size_t                                     m_blockSize;
+    uint64_t                                   m_arenaID;              // Never reused, unlike addresses
+    uint32_t                                   m_frameNumber        = 0;
+    size_t                                     m_peakBytesAllocated = 0;
+    mutable std::mutex                         m_threadStatesMutex;
+    std::vector<std::unique_ptr<sThreadState>> m_threadStates;
+};
+
+//----------------------------------------------------------------------------------------------------
+// A pointer into a FrameArena that knows which frame it was allocated in. IsValid is false once
+// that frame has ended; in debug builds reading through an expired FramePtr asserts.
+//
+template <typename T>
+class FramePtr
+{
+public:
+    FramePtr() = default;
+    FramePtr(T* pointer, FrameArena const& arena) : m_pointer(pointer), m_arena(&arena), m_frameNumber(arena.GetFrameNumber()) {}
+
+    bool IsValid() const { return m_arena != nullptr && m_arena->GetFrameNumber() == m_frameNumber; }
+
+    T* Get() const
+    {
+        assert(m_pointer == nullptr || IsValid());
+        return m_pointer;
+    }
+
+    T* operator->() const { return Get(); }
+    T& operator*() const { return *Get(); }
+
+private:
+    T*                m_pointer     = nullptr;
+    FrameArena const* m_arena       = nullptr;
+    uint32_t          m_frameNumber = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// STL allocator over a FrameArena, for containers built and dropped within a frame. Deallocation
+// is a no-op, so a vector that grows leaves its old buffers behind until EndFrame; reserve up front.
+//
+template <typename T>
+class FrameAllocator
+{
+public:
+    using value_type = T;
+
+    explicit FrameAllocator(FrameArena& arena) : m_arena(&arena) {}
+
+    template <typename U>
+    FrameAllocator(FrameAllocator<U> const& other) : m_arena(other.GetArena()) {}
+
+    T*   allocate(size_t count) { return m_arena->AllocateArray<T>(count); }
+    void deallocate(T*, size_t) {}
+
+    FrameArena* GetArena() const { return m_arena; }
+
+    template <typename U>
+    bool operator==(FrameAllocator<U> const& other) const { return m_arena == other.GetArena(); }
+
+private:
+    FrameArena* m_arena;
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+T* FrameArena::AllocateArray(size_t const count)
+{
+    return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, typename... Args>
+T* FrameArena::Create(Args&&... args)
+{
+    static_assert(std::is_trivially_destructible_v<T>, "FrameArena never runs destructors");
+
+    return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+}
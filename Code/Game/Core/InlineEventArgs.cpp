@@ -0,0 +1,194 @@
+//----------------------------------------------------------------------------------------------------
+// InlineEventArgs.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Core/InlineEventArgs.hpp"
+
+//----------------------------------------------------------------------------------------------------
+void InlineEventArgs::SetValue(sHashedName const key,
+                               int const         value)
+{
+    sValue& entry = FindOrAdd(key.m_hash);
+    entry.m_type  = eEventArgType::INT;
+    entry.m_int   = value;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InlineEventArgs::SetValue(sHashedName const key,
+                               float const       value)
+{
+    sValue& entry = FindOrAdd(key.m_hash);
+    entry.m_type  = eEventArgType::FLOAT;
+    entry.m_float = value;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InlineEventArgs::SetValue(sHashedName const key,
+                               Vec2 const&       value)
+{
+    sValue& entry   = FindOrAdd(key.m_hash);
+    entry.m_type    = eEventArgType::VEC2;
+    entry.m_vec2[0] = value.x;
+    entry.m_vec2[1] = value.y;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InlineEventArgs::SetValue(sHashedName const      key,
+                               std::string_view const value)
+{
+    sValue& entry  = FindOrAdd(key.m_hash);
+    entry.m_type   = eEventArgType::STRING;
+    entry.m_string = value.data();
+    entry.m_length = static_cast<uint32_t>(value.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+int InlineEventArgs::GetValue(sHashedName const key,
+                              int const         defaultValue) const
+{
+    sValue const* entry = Find(key.m_hash);
+
+    if (entry == nullptr)
+    {
+        return defaultValue;
+    }
+
+    switch (entry->m_type)
+    {
+    case eEventArgType::INT:   return entry->m_int;
+    case eEventArgType::FLOAT: return static_cast<int>(entry->m_float);
+    default:                   return defaultValue;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+float InlineEventArgs::GetValue(sHashedName const key,
+                                float const       defaultValue) const
+{
+    sValue const* entry = Find(key.m_hash);
+
+    if (entry == nullptr)
+    {
+        return defaultValue;
+    }
+
+    switch (entry->m_type)
+    {
+    case eEventArgType::FLOAT: return entry->m_float;
+    case eEventArgType::INT:   return static_cast<float>(entry->m_int);
+    default:                   return defaultValue;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+Vec2 InlineEventArgs::GetValue(sHashedName const key,
+                               Vec2 const&       defaultValue) const
+{
+    sValue const* entry = Find(key.m_hash);
+
+    if (entry == nullptr || entry->m_type != eEventArgType::VEC2)
+    {
+        return defaultValue;
+    }
+
+    return Vec2(entry->m_vec2[0], entry->m_vec2[1]);
+}
+
+//----------------------------------------------------------------------------------------------------
+std::string_view InlineEventArgs::GetValue(sHashedName const      key,
+                                           std::string_view const defaultValue) const
+{
+    sValue const* entry = Find(key.m_hash);
+
+    if (entry == nullptr || entry->m_type != eEventArgType::STRING)
+    {
+        return defaultValue;
+    }
+
+    return std::string_view(entry->m_string, entry->m_length);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InlineEventArgs::HasValue(sHashedName const key) const
+{
+    return Find(key.m_hash) != nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+eEventArgType InlineEventArgs::GetType(sHashedName const key) const
+{
+    sValue const* entry = Find(key.m_hash);
+
+    return (entry == nullptr) ? eEventArgType::NONE : entry->m_type;
+}
+
+//----------------------------------------------------------------------------------------------------
+int InlineEventArgs::GetNumValues() const
+{
+    return m_numValues;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InlineEventArgs::IsSpilled() const
+{
+    return m_numValues > INLINE_CAPACITY;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InlineEventArgs::Clear()
+{
+    m_numValues = 0;
+    m_spilled.clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+InlineEventArgs::sValue const* InlineEventArgs::Find(uint64_t const keyHash) const
+{
+    int const numInline = (m_numValues < INLINE_CAPACITY) ? m_numValues : INLINE_CAPACITY;
+
+    for (int index = 0; index < numInline; ++index)
+    {
+        if (m_inline[index].m_keyHash == keyHash)
+        {
+            return &m_inline[index];
+        }
+    }
+
+    for (sValue const& entry : m_spilled)
+    {
+        if (entry.m_keyHash == keyHash)
+        {
+            return &entry;
+        }
+    }
+
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+InlineEventArgs::sValue& InlineEventArgs::FindOrAdd(uint64_t const keyHash)
+{
+    sValue* entry = const_cast<sValue*>(Find(keyHash));
+
+    if (entry != nullptr)
+    {
+        return *entry;
+    }
+
+    if (m_numValues < INLINE_CAPACITY)
+    {
+        entry = &m_inline[m_numValues];
+    }
+    else
+    {
+        m_spilled.emplace_back();
+        entry = &m_spilled.back();
+    }
+
+    ++m_numValues;
+    entry->m_keyHash = keyHash;
+    entry->m_length  = 0;
+
+    return *entry;
+}
@@ -0,0 +1,115 @@
+//----------------------------------------------------------------------------------------------------
+// InlineEventArgs.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Engine/Math/Vec2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// 64-bit FNV-1a of the name with ASCII letters folded to lower case, so "KeyPressed" and
+// "keypressed" are the same name, as they are in the engine's EventSystem
+//
+constexpr uint64_t HashEventName(std::string_view const name)
+{
+    uint64_t hash = 14695981039346656037ull;
+
+    for (char character : name)
+    {
+        if (character >= 'A' && character <= 'Z')
+        {
+            character = static_cast<char>(character - 'A' + 'a');
+        }
+
+        hash ^= static_cast<unsigned char>(character);
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+//----------------------------------------------------------------------------------------------------
+// An event name or argument key, hashed once where it is written. String literals always hash at
+// compile time; other names go through std::string_view or std::string and hash at runtime.
+//
+struct sHashedName
+{
+    uint64_t m_hash = 0;
+
+    consteval sHashedName(char const* name) : m_hash(HashEventName(name)) {}
+    constexpr sHashedName(std::string_view const name) : m_hash(HashEventName(name)) {}
+    sHashedName(std::string const& name) : m_hash(HashEventName(name)) {}
+
+    constexpr bool operator==(sHashedName const& compare) const { return m_hash == compare.m_hash; }
+};
+
+//----------------------------------------------------------------------------------------------------
+enum class eEventArgType : unsigned char
+{
+    NONE,
+    INT,
+    FLOAT,
+    VEC2,
+    STRING
+};
+
+//----------------------------------------------------------------------------------------------------
+// Event arguments for EventDispatcher: typed values under hashed keys, in place of the string to
+// string map that EventArgs builds on every fire.
+//
+// The first INLINE_CAPACITY values live inside the object, so filling and firing a stack instance
+// allocates nothing; only further values spill to a heap array, which Clear keeps for reuse.
+// String values are views and are not copied: the string must outlive the fire, which holds for
+// the usual case of a literal or a caller's local.
+//
+class InlineEventArgs
+{
+public:
+    static int constexpr INLINE_CAPACITY = 6;
+
+    void SetValue(sHashedName key, int value);
+    void SetValue(sHashedName key, float value);
+    void SetValue(sHashedName key, Vec2 const& value);
+    void SetValue(sHashedName key, std::string_view value);
+
+    // The default when the key is missing or holds another type; ints and floats convert
+    int              GetValue(sHashedName key, int defaultValue) const;
+    float            GetValue(sHashedName key, float defaultValue) const;
+    Vec2             GetValue(sHashedName key, Vec2 const& defaultValue) const;
+    std::string_view GetValue(sHashedName key, std::string_view defaultValue) const;
+
+    bool          HasValue(sHashedName key) const;
+    eEventArgType GetType(sHashedName key) const;      // NONE if missing
+    int           GetNumValues() const;
+    bool          IsSpilled() const;                   // More values than fit inline
+
+    void Clear();
+
+private:
+    struct sValue
+    {
+        uint64_t      m_keyHash = 0;
+        eEventArgType m_type    = eEventArgType::NONE;
+        uint32_t      m_length  = 0;                   // STRING only
+
+        union
+        {
+            int         m_int;
+            float       m_float;
+            float       m_vec2[2];
+            char const* m_string;
+        };
+    };
+
+    sValue const* Find(uint64_t keyHash) const;
+    sValue&       FindOrAdd(uint64_t keyHash);
+
+    sValue              m_inline[INLINE_CAPACITY];
+    int                 m_numValues = 0;
+    std::vector<sValue> m_spilled;
+};
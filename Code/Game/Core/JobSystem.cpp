@@ -0,0 +1,351 @@
+//----------------------------------------------------------------------------------------------------
+// JobSystem.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Core/JobSystem.hpp"
+
+#include <emmintrin.h>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    int constexpr SPINS_BEFORE_YIELD  = 64;
+    int constexpr YIELDS_BEFORE_SLEEP = 256;
+    int constexpr SHORT_DEQUE_SIZE    = 2;
+
+    thread_local JobSystem const* t_jobSystem   = nullptr;
+    thread_local int              t_workerIndex = -1;
+
+    //------------------------------------------------------------------------------------------------
+    uint32_t GetNextRandom(uint32_t& state)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool JobDeque::Push(sJob* const job)
+{
+    int64_t const bottom = m_bottom.load(std::memory_order_relaxed);
+    int64_t const top    = m_top.load(std::memory_order_acquire);
+
+    if (bottom - top >= JOB_DEQUE_CAPACITY)
+    {
+        return false;
+    }
+
+    m_jobs[bottom & INDEX_MASK].store(job, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+sJob* JobDeque::Pop()
+{
+    int64_t const bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+    m_bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = m_top.load(std::memory_order_relaxed);
+
+    if (top > bottom)
+    {
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    sJob* job = m_jobs[bottom & INDEX_MASK].load(std::memory_order_relaxed);
+
+    // The last job can also be taken by a thief; whoever moves top first gets it
+    if (top == bottom)
+    {
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            job = nullptr;
+        }
+
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    return job;
+}
+
+//----------------------------------------------------------------------------------------------------
+sJob* JobDeque::Steal()
+{
+    int64_t top = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t const bottom = m_bottom.load(std::memory_order_acquire);
+
+    if (top >= bottom)
+    {
+        return nullptr;
+    }
+
+    sJob* const job = m_jobs[top & INDEX_MASK].load(std::memory_order_relaxed);
+
+    if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    {
+        return nullptr;
+    }
+
+    return job;
+}
+
+//----------------------------------------------------------------------------------------------------
+int JobDeque::GetSize() const
+{
+    int64_t const size = m_bottom.load(std::memory_order_relaxed) - m_top.load(std::memory_order_relaxed);
+
+    return (size > 0) ? static_cast<int>(size) : 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+JobSystem::~JobSystem()
+{
+    Shutdown();
+}
+
+//----------------------------------------------------------------------------------------------------
+void JobSystem::Startup(int numThreads)
+{
+    Shutdown();
+
+    if (numThreads <= 0)
+    {
+        numThreads = static_cast<int>(std::thread::hardware_concurrency());
+        numThreads = (numThreads > 0) ? numThreads : 1;
+    }
+
+    for (int workerIndex = 0; workerIndex < numThreads; ++workerIndex)
+    {
+        m_workers.push_back(std::make_unique<sWorker>());
+        m_workers.back()->m_randomState = 0x9E3779B9u * static_cast<uint32_t>(workerIndex + 1);
+    }
+
+    t_jobSystem   = this;
+    t_workerIndex = 0;
+    m_isRunning.store(true, std::memory_order_release);
+
+    for (int workerIndex = 1; workerIndex < numThreads; ++workerIndex)
+    {
+        m_threads.emplace_back(&JobSystem::RunWorker, this, workerIndex);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void JobSystem::Shutdown()
+{
+    if (m_workers.empty())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_isRunning.store(false, std::memory_order_release);
+    }
+    m_sleepCondition.notify_all();
+
+    for (std::thread& thread : m_threads)
+    {
+        thread.join();
+    }
+
+    m_threads.clear();
+    m_workers.clear();
+
+    if (t_jobSystem == this)
+    {
+        t_jobSystem   = nullptr;
+        t_workerIndex = -1;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+int JobSystem::GetNumThreads() const
+{
+    return static_cast<int>(m_workers.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+int JobSystem::GetCurrentWorkerIndex() const
+{
+    return (t_jobSystem == this) ? t_workerIndex : -1;
+}
+
+//----------------------------------------------------------------------------------------------------
+void JobSystem::Wait(JobCounter& counter)
+{
+    int const workerIndex = GetCurrentWorkerIndex();
+    int       numMisses   = 0;
+
+    while (!counter.IsDone())
+    {
+        sJob* const job = (workerIndex >= 0) ? FindJob(workerIndex) : nullptr;
+
+        if (job != nullptr)
+        {
+            Execute(job);
+            numMisses = 0;
+        }
+        else if (++numMisses < SPINS_BEFORE_YIELD)
+        {
+            _mm_pause();
+        }
+        else
+        {
+            // The jobs left are running on other threads
+            std::this_thread::yield();
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+sJob* JobSystem::AllocateJob(int const workerIndex)
+{
+    sWorker& worker = *m_workers[workerIndex];
+
+    // Jobs mostly finish in the order they were submitted, so the next slot is almost always free
+    for (int attempt = 0; attempt < JOB_POOL_SIZE; ++attempt)
+    {
+        sJob& job = worker.m_pool[worker.m_nextPoolIndex++ & (JOB_POOL_SIZE - 1)];
+
+        if (!job.m_isInUse.load(std::memory_order_acquire))
+        {
+            job.m_isInUse.store(true, std::memory_order_relaxed);
+            return &job;
+        }
+    }
+
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+void JobSystem::Enqueue(int const   workerIndex,
+                        sJob* const job)
+{
+    if (!m_workers[workerIndex]->m_deque.Push(job))
+    {
+        Execute(job);
+        return;
+    }
+
+    m_workEpoch.fetch_add(1, std::memory_order_seq_cst);
+
+    if (m_numSleepingWorkers.load(std::memory_order_seq_cst) > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_sleepCondition.notify_one();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+sJob* JobSystem::FindJob(int const workerIndex)
+{
+    sWorker& worker = *m_workers[workerIndex];
+
+    if (sJob* const job = worker.m_deque.Pop())
+    {
+        return job;
+    }
+
+    int const numWorkers = GetNumThreads();
+
+    if (numWorkers <= 1)
+    {
+        return nullptr;
+    }
+
+    // Start at a random victim so thieves spread out instead of all hitting the same deque
+    int const firstVictim = static_cast<int>(GetNextRandom(worker.m_randomState) % static_cast<uint32_t>(numWorkers));
+
+    for (int offset = 0; offset < numWorkers; ++offset)
+    {
+        int const victimIndex = (firstVictim + offset) % numWorkers;
+
+        if (victimIndex == workerIndex)
+        {
+            continue;
+        }
+
+        if (sJob* const job = m_workers[victimIndex]->m_deque.Steal())
+        {
+            return job;
+        }
+    }
+
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+void JobSystem::Execute(sJob* const job)
+{
+    JobCounter* const counter = job->m_counter;
+
+    job->m_function(job->m_data);
+    job->m_isInUse.store(false, std::memory_order_release);
+
+    if (counter != nullptr)
+    {
+        counter->m_numPending.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void JobSystem::RunWorker(int const workerIndex)
+{
+    t_jobSystem   = this;
+    t_workerIndex = workerIndex;
+
+    int numMisses = 0;
+
+    while (m_isRunning.load(std::memory_order_acquire))
+    {
+        uint64_t const epoch = m_workEpoch.load(std::memory_order_seq_cst);
+
+        if (sJob* const job = FindJob(workerIndex))
+        {
+            Execute(job);
+            numMisses = 0;
+            continue;
+        }
+
+        ++numMisses;
+
+        if (numMisses < SPINS_BEFORE_YIELD)
+        {
+            _mm_pause();
+        }
+        else if (numMisses < SPINS_BEFORE_YIELD + YIELDS_BEFORE_SLEEP)
+        {
+            std::this_thread::yield();
+        }
+        else
+        {
+            // Anything enqueued since the epoch was read bumps it, so the wait cannot miss it
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_numSleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+            m_sleepCondition.wait(lock, [this, epoch]()
+            {
+                return !m_isRunning.load(std::memory_order_acquire) || m_workEpoch.load(std::memory_order_seq_cst) != epoch;
+            });
+            m_numSleepingWorkers.fetch_sub(1, std::memory_order_seq_cst);
+            numMisses = 0;
+        }
+    }
+
+    t_jobSystem   = nullptr;
+    t_workerIndex = -1;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool JobSystem::IsDequeShort(int const workerIndex) const
+{
+    return workerIndex >= 0 && m_workers[workerIndex]->m_deque.GetSize() < SHORT_DEQUE_SIZE;
+}
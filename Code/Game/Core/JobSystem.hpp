@@ -0,0 +1,245 @@
+//----------------------------------------------------------------------------------------------------
+// JobSystem.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+int constexpr JOB_DEQUE_CAPACITY = 4096;                        // Jobs queued per worker before Submit runs them inline
+int constexpr JOB_POOL_SIZE      = 2 * JOB_DEQUE_CAPACITY;      // Jobs in flight per submitting worker before Submit runs them inline
+int constexpr JOB_DATA_SIZE      = 40;
+
+//----------------------------------------------------------------------------------------------------
+// Counts the jobs submitted against it that have not finished; Wait on it to join them, or to make
+// later work depend on them.
+//
+class JobCounter
+{
+public:
+    bool IsDone() const { return m_numPending.load(std::memory_order_acquire) == 0; }
+    int  GetNumPending() const { return m_numPending.load(std::memory_order_acquire); }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<int> m_numPending = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct alignas(64) sJob
+{
+    void (*m_function)(void* data) = nullptr;
+    JobCounter*       m_counter    = nullptr;
+    unsigned char     m_data[JOB_DATA_SIZE];    // The job's callable, copied in
+    std::atomic<bool> m_isInUse    = false;     // Until the job has run, so its pool slot is not reused
+};
+
+static_assert(sizeof(sJob) == 64, "A job should fill one cache line");
+
+//----------------------------------------------------------------------------------------------------
+// Chase-Lev work-stealing deque of fixed capacity. The owning worker pushes and pops at the bottom,
+// newest first; any other thread steals from the top, oldest first, which for split ranges is the
+// largest piece of work left.
+//
+class JobDeque
+{
+public:
+    bool  Push(sJob* job);      // Owner only; false if full
+    sJob* Pop();                // Owner only
+    sJob* Steal();              // Any thread
+    int   GetSize() const;      // Approximate when other threads are stealing
+
+private:
+    static int64_t constexpr INDEX_MASK = JOB_DEQUE_CAPACITY - 1;
+
+    alignas(64) std::atomic<int64_t> m_top    = 0;
+    alignas(64) std::atomic<int64_t> m_bottom = 0;
+    std::atomic<sJob*>               m_jobs[JOB_DEQUE_CAPACITY] = {};
+};
+
+static_assert((JOB_DEQUE_CAPACITY & (JOB_DEQUE_CAPACITY - 1)) == 0, "JobDeque indexes with a mask");
+
+//----------------------------------------------------------------------------------------------------
+// A fixed set of worker threads that share work by stealing: each worker runs jobs from its own
+// deque and, when that is empty, steals from the others, so load balances without a shared queue
+// every submit contends on.
+//
+// The thread that calls Startup is worker 0 and runs jobs while it waits, so a system of one
+// thread starts no threads at all. Submit and ParallelFor may be called from any worker, including
+// from inside a job; on any other thread they run the work immediately. A job is a trivially
+// copyable callable of up to JOB_DATA_SIZE bytes, usually a lambda capturing pointers, copied into
+// a per-worker pool slot that is reused once the job has run; with the deque or the pool full,
+// Submit runs the job itself.
+//
+// ParallelFor splits its range lazily: a job halves its range and queues the upper half only while
+// its own deque is short of work, so ranges are cut finely where threads are stealing and left
+// whole where they are not, down to a grain sized from the range and the thread count.
+//
+class JobSystem
+{
+public:
+    JobSystem() = default;
+    ~JobSystem();
+
+    JobSystem(JobSystem const&)            = delete;
+    JobSystem& operator=(JobSystem const&) = delete;
+
+    void Startup(int numThreads = 0);       // 0 = hardware concurrency; the calling thread is one of them
+    void Shutdown();
+
+    int GetNumThreads() const;
+    int GetCurrentWorkerIndex() const;      // -1 on a thread that is not one of this system's
+
+    template <typename JobFunction>
+    void Submit(JobFunction const& function, JobCounter& counter);
+
+    void Wait(JobCounter& counter);         // Runs other jobs until the counter's jobs are all done
+
+    // Calls function(begin, end) on subranges covering [begin, end) exactly once, and returns when
+    // all have finished. minGrain is the smallest subrange worth a job of its own.
+    template <typename RangeFunction>
+    void ParallelFor(int begin, int end, RangeFunction const& function, int minGrain = 1);
+
+private:
+    struct alignas(64) sWorker
+    {
+        JobDeque     m_deque;
+        sJob         m_pool[JOB_POOL_SIZE];
+        unsigned int m_nextPoolIndex = 0;
+        uint32_t     m_randomState   = 1;     // Picks steal victims
+    };
+
+    template <typename RangeFunction>
+    struct sParallelForRange
+    {
+        JobSystem*           m_jobSystem;
+        RangeFunction const* m_function;
+        JobCounter*          m_counter;
+        int                  m_begin;
+        int                  m_end;
+        int                  m_grain;
+
+        void operator()() const;
+    };
+
+    template <typename JobFunction>
+    static void CallJob(void* data);
+
+    sJob* AllocateJob(int workerIndex);    // Null if every slot holds a job that has not run
+    void  Enqueue(int workerIndex, sJob* job);
+    sJob* FindJob(int workerIndex);
+    void  Execute(sJob* job);
+    void  RunWorker(int workerIndex);
+    bool  IsDequeShort(int workerIndex) const;
+
+    std::vector<std::unique_ptr<sWorker>> m_workers;
+    std::vector<std::thread>              m_threads;
+    std::atomic<bool>                     m_isRunning          = false;
+    std::atomic<uint64_t>                 m_workEpoch          = 0;     // Bumped on every enqueue, so sleepers miss no work
+    std::atomic<int>                      m_numSleepingWorkers = 0;
+    std::mutex                            m_sleepMutex;
+    std::condition_variable               m_sleepCondition;
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename JobFunction>
+void JobSystem::CallJob(void* const data)
+{
+    (*static_cast<JobFunction*>(data))();
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename JobFunction>
+void JobSystem::Submit(JobFunction const& function,
+                       JobCounter&        counter)
+{
+    static_assert(std::is_trivially_copyable_v<JobFunction>, "Jobs are copied into the pool as raw bytes");
+    static_assert(sizeof(JobFunction) <= JOB_DATA_SIZE, "Job callables are limited to JOB_DATA_SIZE bytes; capture by pointer");
+
+    int const workerIndex = GetCurrentWorkerIndex();
+
+    if (workerIndex < 0)
+    {
+        function();
+        return;
+    }
+
+    sJob* const job = AllocateJob(workerIndex);
+
+    if (job == nullptr)
+    {
+        function();
+        return;
+    }
+
+    job->m_function = &CallJob<JobFunction>;
+    job->m_counter  = &counter;
+    memcpy(job->m_data, &function, sizeof(JobFunction));
+
+    counter.m_numPending.fetch_add(1, std::memory_order_relaxed);
+    Enqueue(workerIndex, job);
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename RangeFunction>
+void JobSystem::sParallelForRange<RangeFunction>::operator()() const
+{
+    int const workerIndex = m_jobSystem->GetCurrentWorkerIndex();
+    int       end         = m_end;
+
+    // Give away the upper half while this worker has little queued for thieves to take
+    while (end - m_begin >= 2 * m_grain && m_jobSystem->IsDequeShort(workerIndex))
+    {
+        int const middle = m_begin + (end - m_begin) / 2;
+
+        sParallelForRange upperHalf = *this;
+        upperHalf.m_begin           = middle;
+        upperHalf.m_end             = end;
+        m_jobSystem->Submit(upperHalf, *m_counter);
+
+        end = middle;
+    }
+
+    (*m_function)(m_begin, end);
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename RangeFunction>
+void JobSystem::ParallelFor(int const            begin,
+                            int const            end,
+                            RangeFunction const& function,
+                            int const            minGrain)
+{
+    if (end <= begin)
+    {
+        return;
+    }
+
+    int const workerIndex = GetCurrentWorkerIndex();
+    int const numThreads  = GetNumThreads();
+
+    if (workerIndex < 0 || numThreads <= 1)
+    {
+        function(begin, end);
+        return;
+    }
+
+    // Eight pieces per thread at the finest, so stealing can even out uneven work
+    int const adaptiveGrain = (end - begin) / (numThreads * 8);
+
+    JobCounter                             counter;
+    sParallelForRange<RangeFunction> const root = {this, &function, &counter, begin, end, (adaptiveGrain > minGrain) ? adaptiveGrain : ((minGrain > 1) ? minGrain : 1)};
+
+    root();
+    Wait(counter);
+}
@@ -0,0 +1,212 @@
+//----------------------------------------------------------------------------------------------------
+// PoolAllocator.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Core/PoolAllocator.hpp"
+
+#include <cassert>
+#include <cstring>
+
+//----------------------------------------------------------------------------------------------------
+FixedSizePool::FixedSizePool(size_t const blockSize,
+                             size_t const blockAlignment,
+                             int const    blocksPerChunk)
+    : m_blockAlignment((blockAlignment > alignof(sFreeBlock)) ? blockAlignment : alignof(sFreeBlock)),
+      m_blocksPerChunk((blocksPerChunk > 0) ? blocksPerChunk : 1)
+{
+    // Every block must hold a free list link and keep the next block aligned
+    size_t const minimumSize = (blockSize > sizeof(sFreeBlock)) ? blockSize : sizeof(sFreeBlock);
+    m_blockSize              = (minimumSize + m_blockAlignment - 1) & ~(m_blockAlignment - 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+FixedSizePool::~FixedSizePool()
+{
+    Clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+void* FixedSizePool::Allocate()
+{
+    if (m_freeList == nullptr)
+    {
+        AddChunk();
+    }
+
+    sFreeBlock* const block = m_freeList;
+    m_freeList              = block->m_next;
+    ++m_numAllocated;
+
+    return block;
+}
+
+//----------------------------------------------------------------------------------------------------
+void FixedSizePool::Free(void* const block)
+{
+    if (block == nullptr)
+    {
+        return;
+    }
+
+#if defined(_DEBUG)
+    // A block already on the free list still has the poison after its link; only then is the free
+    // list walked, so the check stays cheap for blocks that were written to
+    unsigned char const* const bytes      = static_cast<unsigned char const*>(block);
+    bool                       isPoisoned = true;
+
+    for (size_t byteIndex = sizeof(sFreeBlock); byteIndex < m_blockSize && isPoisoned; ++byteIndex)
+    {
+        isPoisoned = bytes[byteIndex] == POOL_POISON_BYTE;
+    }
+
+    if (isPoisoned)
+    {
+        for (sFreeBlock const* freeBlock = m_freeList; freeBlock != nullptr; freeBlock = freeBlock->m_next)
+        {
+            assert(freeBlock != block && "FixedSizePool block freed twice");
+        }
+    }
+
+    memset(static_cast<unsigned char*>(block) + sizeof(sFreeBlock), POOL_POISON_BYTE, m_blockSize - sizeof(sFreeBlock));
+#endif
+
+    sFreeBlock* const freeBlock = static_cast<sFreeBlock*>(block);
+    freeBlock->m_next           = m_freeList;
+    m_freeList                  = freeBlock;
+    --m_numAllocated;
+}
+
+//----------------------------------------------------------------------------------------------------
+void FixedSizePool::Clear()
+{
+    for (void* const chunk : m_chunks)
+    {
+        ::operator delete(chunk, std::align_val_t(m_blockAlignment));
+    }
+
+    m_chunks.clear();
+    m_freeList     = nullptr;
+    m_numAllocated = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t FixedSizePool::GetBlockSize() const
+{
+    return m_blockSize;
+}
+
+//----------------------------------------------------------------------------------------------------
+int FixedSizePool::GetNumAllocated() const
+{
+    return m_numAllocated;
+}
+
+//----------------------------------------------------------------------------------------------------
+int FixedSizePool::GetCapacity() const
+{
+    return static_cast<int>(m_chunks.size()) * m_blocksPerChunk;
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t FixedSizePool::GetBytesReserved() const
+{
+    return m_chunks.size() * m_blocksPerChunk * m_blockSize;
+}
+
+//----------------------------------------------------------------------------------------------------
+void FixedSizePool::AddChunk()
+{
+    unsigned char* const chunk = static_cast<unsigned char*>(::operator new(m_blockSize * m_blocksPerChunk, std::align_val_t(m_blockAlignment)));
+    m_chunks.push_back(chunk);
+
+#if defined(_DEBUG)
+    memset(chunk, POOL_POISON_BYTE, m_blockSize * m_blocksPerChunk);
+#endif
+
+    // Linked back to front, so the chunk is handed out in address order
+    for (int blockIndex = m_blocksPerChunk - 1; blockIndex >= 0; --blockIndex)
+    {
+        sFreeBlock* const block = reinterpret_cast<sFreeBlock*>(chunk + blockIndex * m_blockSize);
+        block->m_next           = m_freeList;
+        m_freeList              = block;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void* PoolResource::Allocate(size_t const size,
+                             size_t const alignment)
+{
+    if (FixedSizePool* const pool = GetPool(size, alignment))
+    {
+        return pool->Allocate();
+    }
+
+    return ::operator new(size, std::align_val_t(alignment));
+}
+
+//----------------------------------------------------------------------------------------------------
+void PoolResource::Deallocate(void* const  memory,
+                              size_t const size,
+                              size_t const alignment)
+{
+    if (FixedSizePool* const pool = GetPool(size, alignment))
+    {
+        pool->Free(memory);
+        return;
+    }
+
+    ::operator delete(memory, std::align_val_t(alignment));
+}
+
+//----------------------------------------------------------------------------------------------------
+int PoolResource::GetNumAllocated() const
+{
+    int numAllocated = 0;
+
+    for (std::unique_ptr<FixedSizePool> const& pool : m_pools)
+    {
+        numAllocated += (pool != nullptr) ? pool->GetNumAllocated() : 0;
+    }
+
+    return numAllocated;
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t PoolResource::GetBytesReserved() const
+{
+    size_t bytesReserved = 0;
+
+    for (std::unique_ptr<FixedSizePool> const& pool : m_pools)
+    {
+        bytesReserved += (pool != nullptr) ? pool->GetBytesReserved() : 0;
+    }
+
+    return bytesReserved;
+}
+
+//----------------------------------------------------------------------------------------------------
+FixedSizePool* PoolResource::GetPool(size_t const size,
+                                     size_t const alignment)
+{
+    if (size == 0 || alignment > POOL_SIZE_CLASS_STEP)
+    {
+        return nullptr;
+    }
+
+    size_t const sizeClass = (size - 1) / POOL_SIZE_CLASS_STEP;
+
+    if (sizeClass >= POOL_NUM_SIZE_CLASSES)
+    {
+        return nullptr;
+    }
+
+    std::unique_ptr<FixedSizePool>& pool = m_pools[sizeClass];
+
+    if (pool == nullptr)
+    {
+        pool = std::make_unique<FixedSizePool>((sizeClass + 1) * POOL_SIZE_CLASS_STEP, POOL_SIZE_CLASS_STEP);
+    }
+
+    return pool.get();
+}
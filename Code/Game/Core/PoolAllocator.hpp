@@ -0,0 +1,144 @@
+//----------------------------------------------------------------------------------------------------
+// PoolAllocator.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+unsigned char constexpr POOL_POISON_BYTE         = 0xDD;        // Debug builds fill freed blocks with it
+int constexpr           POOL_DEFAULT_CHUNK_SIZE  = 256;         // Blocks per chunk
+size_t constexpr        POOL_SIZE_CLASS_STEP     = 16;
+int constexpr           POOL_NUM_SIZE_CLASSES    = 16;          // Up to 256 bytes
+
+//----------------------------------------------------------------------------------------------------
+// Fixed-size blocks carved from chunks, for the nodes of linked structures: allocating and freeing
+// pop and push an intrusive free list. Chunks are never returned until Clear or destruction, so a
+// pool that has reached its peak stops touching the heap, and nodes freed and reallocated in any
+// order never fragment anything but the pool itself.
+//
+// Not thread safe; a pool belongs to the structure, and the thread, that uses it. Debug builds fill
+// freed blocks with POOL_POISON_BYTE after the free list link, and catch freeing a block twice.
+//
+class FixedSizePool
+{
+public:
+    explicit FixedSizePool(size_t blockSize, size_t blockAlignment = alignof(std::max_align_t), int blocksPerChunk = POOL_DEFAULT_CHUNK_SIZE);
+    ~FixedSizePool();
+
+    FixedSizePool(FixedSizePool const&)            = delete;
+    FixedSizePool& operator=(FixedSizePool const&) = delete;
+
+    void* Allocate();
+    void  Free(void* block);        // Null is ignored
+    void  Clear();                  // Releases every chunk; all blocks must have been freed or abandoned
+
+    size_t GetBlockSize() const;
+    int    GetNumAllocated() const;
+    int    GetCapacity() const;     // Blocks in all chunks
+    size_t GetBytesReserved() const;
+
+private:
+    struct sFreeBlock
+    {
+        sFreeBlock* m_next;
+    };
+
+    void AddChunk();
+
+    size_t             m_blockSize;
+    size_t             m_blockAlignment;
+    int                m_blocksPerChunk;
+    sFreeBlock*        m_freeList     = nullptr;
+    std::vector<void*> m_chunks;
+    int                m_numAllocated = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// A FixedSizePool typed for T, constructing and destroying in place
+//
+template <typename T>
+class ObjectPool
+{
+public:
+    explicit ObjectPool(int blocksPerChunk = POOL_DEFAULT_CHUNK_SIZE)
+        : m_pool(sizeof(T), alignof(T), blocksPerChunk)
+    {
+    }
+
+    template <typename... Args>
+    T* Create(Args&&... args) { return new (m_pool.Allocate()) T(std::forward<Args>(args)...); }
+
+    void Destroy(T* object)
+    {
+        if (object != nullptr)
+        {
+            object->~T();
+            m_pool.Free(object);
+        }
+    }
+
+    int GetNumAllocated() const { return m_pool.GetNumAllocated(); }
+    int GetCapacity() const { return m_pool.GetCapacity(); }
+
+private:
+    FixedSizePool m_pool;
+};
+
+//----------------------------------------------------------------------------------------------------
+// FixedSizePools for sizes in POOL_SIZE_CLASS_STEP steps up to POOL_NUM_SIZE_CLASSES steps, created
+// on first use. Larger or more aligned requests go to the heap. This is what PoolAllocator draws
+// from, so node containers of different node types can share one set of pools.
+//
+class PoolResource
+{
+public:
+    PoolResource() = default;
+
+    PoolResource(PoolResource const&)            = delete;
+    PoolResource& operator=(PoolResource const&) = delete;
+
+    void* Allocate(size_t size, size_t alignment);
+    void  Deallocate(void* memory, size_t size, size_t alignment);
+
+    int    GetNumAllocated() const;     // From the pools, not the heap
+    size_t GetBytesReserved() const;
+
+private:
+    FixedSizePool* GetPool(size_t size, size_t alignment);     // Null if the request is for the heap
+
+    std::unique_ptr<FixedSizePool> m_pools[POOL_NUM_SIZE_CLASSES];
+};
+
+//----------------------------------------------------------------------------------------------------
+// STL allocator over a PoolResource, for node-based containers (std::list, std::map, std::set and
+// the unordered ones' nodes). Not thread safe, like the pools behind it.
+//
+template <typename T>
+class PoolAllocator
+{
+public:
+    using value_type = T;
+
+    explicit PoolAllocator(PoolResource& resource) : m_resource(&resource) {}
+
+    template <typename U>
+    PoolAllocator(PoolAllocator<U> const& other) : m_resource(other.GetResource()) {}
+
+    T*   allocate(size_t count) { return static_cast<T*>(m_resource->Allocate(count * sizeof(T), alignof(T))); }
+    void deallocate(T* memory, size_t count) { m_resource->Deallocate(memory, count * sizeof(T), alignof(T)); }
+
+    PoolResource* GetResource() const { return m_resource; }
+
+    template <typename U>
+    bool operator==(PoolAllocator<U> const& other) const { return m_resource == other.GetResource(); }
+
+private:
+    PoolResource* m_resource;
+};
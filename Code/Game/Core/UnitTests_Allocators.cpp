@@ -0,0 +1,855 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_Allocators.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Core/UnitTests_Allocators.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <map>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "Game/Core/FrameArena.hpp"
+#include "Game/Core/PoolAllocator.hpp"
+#include "Game/GameCommon.hpp"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <psapi.h>
+#endif
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    struct sProcessMemory
+    {
+        size_t m_residentBytes     = 0;
+        size_t m_peakResidentBytes = 0;
+    };
+
+    //------------------------------------------------------------------------------------------------
+    // Resident set size now and at its peak; zero where the platform does not report it
+    //
+    sProcessMemory GetProcessMemory()
+    {
+        sProcessMemory memory;
+
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS counters = {};
+
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        {
+            memory.m_residentBytes     = counters.WorkingSetSize;
+            memory.m_peakResidentBytes = counters.PeakWorkingSetSize;
+        }
+#else
+        FILE* const file = fopen("/proc/self/status", "r");
+
+        if (file != nullptr)
+        {
+            char line[256];
+
+            while (fgets(line, sizeof(line), file) != nullptr)
+            {
+                unsigned long kilobytes = 0;
+
+                if (sscanf(line, "VmRSS: %lu kB", &kilobytes) == 1)
+                {
+                    memory.m_residentBytes = kilobytes * 1024;
+                }
+                else if (sscanf(line, "VmHWM: %lu kB", &kilobytes) == 1)
+                {
+                    memory.m_peakResidentBytes = kilobytes * 1024;
+                }
+            }
+
+            fclose(file);
+        }
+#endif
+
+        return memory;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    bool IsAligned(void const* const pointer,
+                   size_t const      alignment)
+    {
+        return (reinterpret_cast<uintptr_t>(pointer) & (alignment - 1)) == 0;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    struct sCountedNode
+    {
+        explicit sCountedNode(int const value) : m_value(value) { ++s_numAlive; }
+        ~sCountedNode() { --s_numAlive; }
+
+        sCountedNode* m_next  = nullptr;
+        int           m_value = 0;
+
+        static inline int s_numAlive = 0;
+    };
+
+    //------------------------------------------------------------------------------------------------
+    struct alignas(64) sCacheLineNode
+    {
+        float m_values[4] = {};
+    };
+
+    //------------------------------------------------------------------------------------------------
+    // Where the soak run gets its memory from: the heap, or a PoolResource for long-lived objects
+    // and a FrameArena for per-frame scratch
+    //
+    struct sSoakAllocators
+    {
+        PoolResource* m_pools = nullptr;
+        FrameArena*   m_arena = nullptr;
+
+        void* AllocateObject(size_t const size) { return (m_pools != nullptr) ? m_pools->Allocate(size, 16) : malloc(size); }
+        void* AllocateScratch(size_t const size) { return (m_arena != nullptr) ? m_arena->Allocate(size, 16) : malloc(size); }
+
+        void FreeObject(void* const object,
+                        size_t const size)
+        {
+            if (m_pools != nullptr)
+            {
+                m_pools->Deallocate(object, size, 16);
+            }
+            else
+            {
+                free(object);
+            }
+        }
+    };
+
+    //------------------------------------------------------------------------------------------------
+    struct sSoakResult
+    {
+        double m_milliseconds   = 0.0;
+        size_t m_liveBytes      = 0;
+        size_t m_residentBefore = 0;
+        size_t m_residentAfter  = 0;
+        float  m_checksum       = 0.0f;
+    };
+
+    //------------------------------------------------------------------------------------------------
+    // A synthetic game loop: a population of long-lived objects of mixed sizes, some replaced every
+    // frame in random order, plus scratch buffers of mixed sizes that live for one frame
+    //
+    sSoakResult RunSoak(sSoakAllocators allocators,
+                        unsigned const  seed)
+    {
+        struct sLiveObject
+        {
+            void*  m_memory = nullptr;
+            size_t m_size   = 0;
+        };
+
+        std::mt19937                          random(seed);
+        std::uniform_int_distribution<size_t> objectSize(8, 256);
+        std::uniform_int_distribution<size_t> scratchSize(16, 4096);
+        std::uniform_int_distribution<int>    objectIndex(0, ALLOCATORS_SOAK_NUM_LIVE_OBJECTS - 1);
+
+        sSoakResult              result;
+        std::vector<sLiveObject> objects(ALLOCATORS_SOAK_NUM_LIVE_OBJECTS);
+        std::vector<void*>       scratch(ALLOCATORS_SOAK_SCRATCH_PER_FRAME);
+
+        result.m_residentBefore = GetProcessMemory().m_residentBytes;
+
+        PerformanceTimer timer;
+        timer.Start();
+
+        for (sLiveObject& object : objects)
+        {
+            object.m_size   = objectSize(random);
+            object.m_memory = allocators.AllocateObject(object.m_size);
+            memset(object.m_memory, 1, object.m_size);
+        }
+
+        for (int frame = 0; frame < ALLOCATORS_SOAK_NUM_FRAMES; ++frame)
+        {
+            for (int churn = 0; churn < ALLOCATORS_SOAK_CHURN_PER_FRAME; ++churn)
+            {
+                sLiveObject& object = objects[objectIndex(random)];
+                allocators.FreeObject(object.m_memory, object.m_size);
+
+                object.m_size   = objectSize(random);
+                object.m_memory = allocators.AllocateObject(object.m_size);
+                memset(object.m_memory, frame & 0xFF, object.m_size);
+            }
+
+            for (void*& buffer : scratch)
+            {
+                size_t const size = scratchSize(random);
+                buffer            = allocators.AllocateScratch(size);
+                memset(buffer, frame & 0xFF, size);
+            }
+
+            result.m_checksum += static_cast<float>(static_cast<unsigned char*>(scratch[frame % scratch.size()])[0]);
+
+            if (allocators.m_arena != nullptr)
+            {
+                allocators.m_arena->EndFrame();
+            }
+            else
+            {
+                for (void* const buffer : scratch)
+                {
+                    free(buffer);
+                }
+            }
+        }
+
+        timer.Stop();
+
+        result.m_milliseconds  = timer.GetElapsedMicroseconds() / 1000.0;
+        result.m_residentAfter = GetProcessMemory().m_residentBytes;
+
+        for (sLiveObject const& object : objects)
+        {
+            result.m_liveBytes += object.m_size;
+            allocators.FreeObject(object.m_memory, object.m_size);
+        }
+
+        return result;
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Allocators_FrameArena()
+{
+#if defined(ENABLE_TestSet_Allocators_FrameArena)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_Allocators_FrameArena)(start)\n");
+    printf("####################################################################################################\n");
+
+    {
+        FrameArena arena(4096);
+        bool       allAligned = true;
+
+        for (size_t alignment = 1; alignment <= 256; alignment *= 2)
+        {
+            allAligned = IsAligned(arena.Allocate(3, alignment), alignment) && allAligned;
+        }
+
+        int* const   values = arena.AllocateArray<int>(3);
+        double* const other = arena.Create<double>(2.5);
+        values[0]           = 1;
+        values[1]           = 2;
+        values[2]           = 3;
+
+        VerifyTestResult(allAligned, "Every allocation should have the alignment asked for");
+        VerifyTestResult(values[0] + values[1] + values[2] == 6 && *other == 2.5 && IsAligned(other, alignof(double)), "Allocations should not overlap, and Create should construct in place");
+    }
+
+    // The same frame twice: the second reuses the first's blocks from the start
+    {
+        FrameArena arena(4096);
+        void*      firstAllocation = nullptr;
+        size_t     firstReserved   = 0;
+        bool       isStable        = true;
+
+        for (int frame = 0; frame < 10; ++frame)
+        {
+            void* const first = arena.Allocate(64);
+
+            for (int allocation = 0; allocation < 200; ++allocation)
+            {
+                arena.Allocate(48);
+            }
+
+            if (frame == 0)
+            {
+                firstAllocation = first;
+                firstReserved   = arena.GetBytesReserved();
+            }
+            else
+            {
+                isStable = isStable && first == firstAllocation && arena.GetBytesReserved() == firstReserved;
+            }
+
+            arena.EndFrame();
+        }
+
+        VerifyTestResult(isStable && firstReserved >= 201 * 48, "Repeating a frame should reuse the same blocks without reserving more");
+        VerifyTestResult(arena.GetBytesAllocated() == 0 && arena.GetPeakBytesAllocated() >= 201 * 48 && arena.GetFrameNumber() == 10, "EndFrame should release the frame and keep the peak");
+    }
+
+    {
+        FrameArena   arena(4096);
+        void* const  small          = arena.Allocate(16);
+        size_t const reservedBefore = arena.GetBytesReserved();
+        void* const  large          = arena.Allocate(100000, 64);
+        memset(large, 7, 100000);
+        size_t const reservedDuring = arena.GetBytesReserved();
+        arena.EndFrame();
+
+        VerifyTestResult(small != nullptr && IsAligned(large, 64) && reservedDuring >= reservedBefore + 100000 && arena.GetBytesReserved() == reservedBefore,
+                         "An allocation bigger than a block should get its own block, released at EndFrame");
+    }
+
+    {
+        FrameArena     arena;
+        FramePtr<int>  pointer(arena.Create<int>(42), arena);
+        FramePtr<int>  empty;
+        bool const     wasValid = pointer.IsValid() && *pointer == 42;
+        arena.EndFrame();
+
+        VerifyTestResult(wasValid && !pointer.IsValid() && !empty.IsValid() && empty.Get() == nullptr, "A FramePtr should expire when its frame ends");
+    }
+
+#if defined(_DEBUG)
+    {
+        FrameArena           arena;
+        unsigned char* const bytes = arena.AllocateArray<unsigned char>(64);
+        memset(bytes, 0, 64);
+        arena.EndFrame();
+
+        bool isPoisoned = true;
+        for (int byteIndex = 0; byteIndex < 64; ++byteIndex)
+        {
+            isPoisoned = isPoisoned && bytes[byteIndex] == FRAME_ARENA_POISON_BYTE;
+        }
+
+        VerifyTestResult(isPoisoned, "Debug builds should poison memory released at EndFrame");
+    }
+#endif
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_Allocators_FrameArena)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+#if defined(_DEBUG)
+    return 7; // Number of tests expected
+#else
+    return 6; // Number of tests expected
+#endif
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Allocators_Threads()
+{
+#if defined(ENABLE_TestSet_Allocators_Threads)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_Allocators_Threads)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numThreads     = 4;
+    int constexpr numAllocations = 1000;
+
+    {
+        FrameArena                     arena;
+        std::vector<std::vector<int*>> allocations(numThreads);
+        std::vector<std::thread>       threads;
+
+        for (int threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads.emplace_back([&arena, &allocations, threadIndex]()
+            {
+                for (int allocation = 0; allocation < numAllocations; ++allocation)
+                {
+                    int* const values = arena.AllocateArray<int>(4);
+                    std::fill(values, values + 4, threadIndex * numAllocations + allocation);
+                    allocations[threadIndex].push_back(values);
+                }
+            });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        bool isIntact = true;
+        for (int threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            for (int allocation = 0; allocation < numAllocations; ++allocation)
+            {
+                int const* const values = allocations[threadIndex][allocation];
+                isIntact                = isIntact && values[0] == threadIndex * numAllocations + allocation && values[3] == values[0];
+            }
+        }
+
+        size_t const bytesAllocated = arena.GetBytesAllocated();
+        arena.EndFrame();
+
+        VerifyTestResult(isIntact, "Threads allocating at once should never be handed the same memory");
+        VerifyTestResult(arena.GetNumThreads() == numThreads, "Each allocating thread should get its own state in the arena");
+        VerifyTestResult(bytesAllocated == numThreads * numAllocations * 4 * sizeof(int) && arena.GetPeakBytesAllocated() == bytesAllocated,
+                         "Bytes allocated should add up across threads");
+    }
+
+    // More arenas than the per-thread cache holds, used in turn, must still find their states
+    {
+        std::vector<std::unique_ptr<FrameArena>> arenas;
+        for (int arenaIndex = 0; arenaIndex < 6; ++arenaIndex)
+        {
+            arenas.push_back(std::make_unique<FrameArena>());
+        }
+
+        for (int round = 0; round < 20; ++round)
+        {
+            for (std::unique_ptr<FrameArena> const& arena : arenas)
+            {
+                arena->Allocate(32);
+            }
+        }
+
+        bool isOneStateEach = true;
+        for (std::unique_ptr<FrameArena> const& arena : arenas)
+        {
+            isOneStateEach = isOneStateEach && arena->GetNumThreads() == 1 && arena->GetBytesAllocated() == 20 * 32;
+        }
+
+        VerifyTestResult(isOneStateEach, "A thread cycling through many arenas should keep one state in each");
+    }
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_Allocators_Threads)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 4; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Allocators_Pools()
+{
+#if defined(ENABLE_TestSet_Allocators_Pools)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_Allocators_Pools)(start)\n");
+    printf("####################################################################################################\n");
+
+    {
+        FixedSizePool pool(3);
+        void* const   first  = pool.Allocate();
+        void* const   second = pool.Allocate();
+
+        VerifyTestResult(pool.GetBlockSize() >= sizeof(void*) && pool.GetBlockSize() % alignof(std::max_align_t) == 0 && IsAligned(first, alignof(std::max_align_t)) &&
+                         static_cast<unsigned char*>(second) - static_cast<unsigned char*>(first) == static_cast<ptrdiff_t>(pool.GetBlockSize()),
+                         "Blocks should hold a free list link, keep their alignment and come out of a chunk in order");
+    }
+
+    {
+        FixedSizePool      pool(32, 16, 256);
+        std::vector<void*> blocks;
+
+        for (int blockIndex = 0; blockIndex < 1000; ++blockIndex)
+        {
+            blocks.push_back(pool.Allocate());
+        }
+
+        bool const isCounted = pool.GetNumAllocated() == 1000 && pool.GetCapacity() == 1024 && pool.GetBytesReserved() == 1024 * 32;
+
+        std::vector<void*> sortedBlocks = blocks;
+        std::sort(sortedBlocks.begin(), sortedBlocks.end());
+
+        for (void* const block : blocks)
+        {
+            pool.Free(block);
+        }
+        pool.Free(nullptr);
+
+        std::vector<void*> reusedBlocks;
+        for (int blockIndex = 0; blockIndex < 1000; ++blockIndex)
+        {
+            reusedBlocks.push_back(pool.Allocate());
+        }
+        std::sort(reusedBlocks.begin(), reusedBlocks.end());
+
+        VerifyTestResult(isCounted, "Capacity should grow a chunk at a time");
+        VerifyTestResult(reusedBlocks == sortedBlocks && pool.GetCapacity() == 1024, "Freed blocks should be handed out again before the pool grows");
+
+        pool.Clear();
+        VerifyTestResult(pool.GetCapacity() == 0 && pool.GetNumAllocated() == 0 && pool.GetBytesReserved() == 0, "Clear should release every chunk");
+    }
+
+    {
+        ObjectPool<sCountedNode> pool(64);
+        sCountedNode*            head = nullptr;
+
+        for (int value = 0; value < 100; ++value)
+        {
+            sCountedNode* const node = pool.Create(value);
+            node->m_next             = head;
+            head                     = node;
+        }
+
+        int  sum        = 0;
+        bool wasCreated = sCountedNode::s_numAlive == 100 && pool.GetNumAllocated() == 100 && pool.GetCapacity() == 128;
+
+        while (head != nullptr)
+        {
+            sCountedNode* const next = head->m_next;
+            sum                     += head->m_value;
+            pool.Destroy(head);
+            head = next;
+        }
+
+        VerifyTestResult(wasCreated && sum == 4950 && sCountedNode::s_numAlive == 0 && pool.GetNumAllocated() == 0, "An ObjectPool should construct and destroy its objects");
+    }
+
+    {
+        ObjectPool<sCacheLineNode> pool;
+        bool                       allAligned = true;
+
+        for (int nodeIndex = 0; nodeIndex < 10; ++nodeIndex)
+        {
+            allAligned = IsAligned(pool.Create(), 64) && allAligned;
+        }
+
+        VerifyTestResult(allAligned, "An ObjectPool should honour its type's alignment");
+    }
+
+    {
+        PoolResource resource;
+        void* const  small     = resource.Allocate(24, 8);
+        void* const  large     = resource.Allocate(1000, 8);
+        void* const  aligned   = resource.Allocate(32, 64);
+        int const    numPooled = resource.GetNumAllocated();
+
+        resource.Deallocate(small, 24, 8);
+        resource.Deallocate(large, 1000, 8);
+        resource.Deallocate(aligned, 32, 64);
+
+        VerifyTestResult(numPooled == 1 && IsAligned(aligned, 64) && resource.GetNumAllocated() == 0,
+                         "A PoolResource should pool small requests and pass large or overaligned ones to the heap");
+    }
+
+#if defined(_DEBUG)
+    {
+        FixedSizePool        pool(64);
+        unsigned char* const block = static_cast<unsigned char*>(pool.Allocate());
+        memset(block, 0, 64);
+        pool.Free(block);
+
+        VerifyTestResult(block[sizeof(void*)] == POOL_POISON_BYTE && block[63] == POOL_POISON_BYTE, "Debug builds should poison freed blocks");
+    }
+#endif
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_Allocators_Pools)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+#if defined(_DEBUG)
+    return 8; // Number of tests expected
+#else
+    return 7; // Number of tests expected
+#endif
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Allocators_StlAdapters()
+{
+#if defined(ENABLE_TestSet_Allocators_StlAdapters)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_Allocators_StlAdapters)(start)\n");
+    printf("####################################################################################################\n");
+
+    {
+        FrameArena                             arena;
+        std::vector<int, FrameAllocator<int>> values{FrameAllocator<int>(arena)};
+        values.reserve(1000);
+
+        for (int value = 0; value < 1000; ++value)
+        {
+            values.push_back(value);
+        }
+
+        int sum = 0;
+        for (int const value : values)
+        {
+            sum += value;
+        }
+
+        VerifyTestResult(sum == 499500 && arena.GetBytesAllocated() >= 1000 * sizeof(int), "A vector should draw its buffer from the FrameArena");
+    }
+
+    {
+        PoolResource resource;
+
+        {
+            std::list<int, PoolAllocator<int>> values{PoolAllocator<int>(resource)};
+
+            for (int value = 0; value < 1000; ++value)
+            {
+                values.push_back(value);
+            }
+
+            VerifyTestResult(resource.GetNumAllocated() >= 1000 && values.back() == 999, "A list should draw its nodes from the pools");
+        }
+
+        using PooledMap = std::map<int, int, std::less<int>, PoolAllocator<std::pair<int const, int>>>;
+
+        {
+            PooledMap map{PoolAllocator<std::pair<int const, int>>(resource)};
+
+            for (int key = 0; key < 1000; ++key)
+            {
+                map[key] = key * 2;
+            }
+
+            size_t const reservedBefore = resource.GetBytesReserved();
+
+            // Erase and reinsert half the keys several times; the nodes come back from the free lists
+            for (int round = 0; round < 10; ++round)
+            {
+                for (int key = round % 2; key < 1000; key += 2)
+                {
+                    map.erase(key);
+                }
+                for (int key = round % 2; key < 1000; key += 2)
+                {
+                    map[key] = key * 2;
+                }
+            }
+
+            VerifyTestResult(map.size() == 1000 && map[500] == 1000 && resource.GetBytesReserved() == reservedBefore, "Churning a map's nodes should not grow the pools");
+        }
+
+        VerifyTestResult(resource.GetNumAllocated() == 0, "Destroyed containers should return every node");
+    }
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_Allocators_StlAdapters)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 4; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Allocators_Performance()
+{
+#if defined(ENABLE_TestSet_Allocators_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_Allocators_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numIterations  = ALLOCATORS_PERFORMANCE_NUM_ITERATIONS;
+    int constexpr numAllocations = ALLOCATORS_PERFORMANCE_NUM_ALLOCATIONS;
+    int constexpr numTotal       = numIterations * numAllocations;
+
+    struct sNode
+    {
+        sNode* m_next;
+        float  m_values[6];
+    };
+
+    std::vector<void*> pointers(numAllocations);
+    PerformanceTimer   timer;
+    unsigned           checksum = 0;
+
+    printf("  %d iterations of %d %d-byte allocations, all freed after each iteration...\n", numIterations, numAllocations, static_cast<int>(sizeof(sNode)));
+
+    timer.Start();
+    for (int iteration = 0; iteration < numIterations; ++iteration)
+    {
+        for (void*& pointer : pointers)
+        {
+            pointer                              = malloc(sizeof(sNode));
+            static_cast<sNode*>(pointer)->m_next = nullptr;
+        }
+        checksum += static_cast<unsigned>(reinterpret_cast<uintptr_t>(pointers.back()) & 0xFF);
+        for (void* const pointer : pointers)
+        {
+            free(pointer);
+        }
+    }
+    timer.Stop();
+    double const mallocTime = timer.GetElapsedMicroseconds() * 1000.0 / numTotal;
+
+    timer.Start();
+    for (int iteration = 0; iteration < numIterations; ++iteration)
+    {
+        for (void*& pointer : pointers)
+        {
+            pointer = new sNode{nullptr, {}};
+        }
+        checksum += static_cast<unsigned>(reinterpret_cast<uintptr_t>(pointers.back()) & 0xFF);
+        for (void* const pointer : pointers)
+        {
+            delete static_cast<sNode*>(pointer);
+        }
+    }
+    timer.Stop();
+    double const newTime = timer.GetElapsedMicroseconds() * 1000.0 / numTotal;
+
+    FrameArena arena;
+    timer.Start();
+    for (int iteration = 0; iteration < numIterations; ++iteration)
+    {
+        for (void*& pointer : pointers)
+        {
+            pointer = arena.Create<sNode>(sNode{nullptr, {}});
+        }
+        checksum += static_cast<unsigned>(reinterpret_cast<uintptr_t>(pointers.back()) & 0xFF);
+        arena.EndFrame();
+    }
+    timer.Stop();
+    double const arenaTime = timer.GetElapsedMicroseconds() * 1000.0 / numTotal;
+
+    ObjectPool<sNode> pool;
+    timer.Start();
+    for (int iteration = 0; iteration < numIterations; ++iteration)
+    {
+        for (void*& pointer : pointers)
+        {
+            pointer = pool.Create(sNode{nullptr, {}});
+        }
+        for (void* const pointer : pointers)
+        {
+            pool.Destroy(static_cast<sNode*>(pointer));
+        }
+    }
+    timer.Stop();
+    double const poolTime = timer.GetElapsedMicroseconds() * 1000.0 / numTotal;
+
+    printf("    malloc/free:          %6.2f ns per allocation\n", mallocTime);
+    printf("    new/delete:           %6.2f ns per allocation\n", newTime);
+    printf("    FrameArena:           %6.2f ns per allocation (%.1fx vs new)\n", arenaTime, newTime / arenaTime);
+    printf("    ObjectPool:           %6.2f ns per allocation (%.1fx vs new)\n", poolTime, newTime / poolTime);
+
+    // Node containers, filled and emptied
+    timer.Start();
+    for (int iteration = 0; iteration < numIterations; ++iteration)
+    {
+        std::list<int> values;
+        for (int value = 0; value < numAllocations; ++value)
+        {
+            values.push_back(value);
+        }
+        checksum += static_cast<unsigned>(values.back());
+    }
+    timer.Stop();
+    double const listTime = timer.GetElapsedMicroseconds() * 1000.0 / numTotal;
+
+    PoolResource resource;
+    timer.Start();
+    for (int iteration = 0; iteration < numIterations; ++iteration)
+    {
+        std::list<int, PoolAllocator<int>> values{PoolAllocator<int>(resource)};
+        for (int value = 0; value < numAllocations; ++value)
+        {
+            values.push_back(value);
+        }
+        checksum += static_cast<unsigned>(values.back());
+    }
+    timer.Stop();
+    double const pooledListTime = timer.GetElapsedMicroseconds() * 1000.0 / numTotal;
+
+    timer.Start();
+    for (int iteration = 0; iteration < numIterations; ++iteration)
+    {
+        std::map<int, int> map;
+        for (int key = 0; key < numAllocations; ++key)
+        {
+            map.emplace((key * 7919) % numAllocations, key);
+        }
+        checksum += static_cast<unsigned>(map.size());
+    }
+    timer.Stop();
+    double const mapTime = timer.GetElapsedMicroseconds() * 1000.0 / numTotal;
+
+    timer.Start();
+    for (int iteration = 0; iteration < numIterations; ++iteration)
+    {
+        std::map<int, int, std::less<int>, PoolAllocator<std::pair<int const, int>>> map{PoolAllocator<std::pair<int const, int>>(resource)};
+        for (int key = 0; key < numAllocations; ++key)
+        {
+            map.emplace((key * 7919) % numAllocations, key);
+        }
+        checksum += static_cast<unsigned>(map.size());
+    }
+    timer.Stop();
+    double const pooledMapTime = timer.GetElapsedMicroseconds() * 1000.0 / numTotal;
+
+    printf("    std::list push_back:  %6.2f ns per node, %6.2f ns pooled (%.1fx)\n", listTime, pooledListTime, listTime / pooledListTime);
+    printf("    std::map emplace:     %6.2f ns per node, %6.2f ns pooled (%.1fx)\n", mapTime, pooledMapTime, mapTime / pooledMapTime);
+    printf("    (checksum %u)\n", checksum);
+
+    VerifyTestResult(true, "Allocator performance tests completed");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_Allocators_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_Allocators_Soak()
+{
+#if defined(ENABLE_TestSet_Allocators_Soak)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_Allocators_Soak)(start)\n");
+    printf("####################################################################################################\n");
+
+    printf("  %d frames, %d live objects of 8-256 bytes with %d replaced per frame, %d scratch buffers of 16-4096 bytes per frame...\n",
+           ALLOCATORS_SOAK_NUM_FRAMES, ALLOCATORS_SOAK_NUM_LIVE_OBJECTS, ALLOCATORS_SOAK_CHURN_PER_FRAME, ALLOCATORS_SOAK_SCRATCH_PER_FRAME);
+
+    // Resident memory is only comparable between runs as growth, and the peak covers the whole process
+    sSoakResult const heapResult = RunSoak(sSoakAllocators{}, 29);
+
+    PoolResource      pools;
+    FrameArena        arena;
+    sSoakResult const pooledResult = RunSoak(sSoakAllocators{&pools, &arena}, 29);
+
+    double constexpr megabyte = 1024.0 * 1024.0;
+
+    printf("    heap:          %8.1f ms, resident %+7.2f MB\n", heapResult.m_milliseconds,
+           (static_cast<double>(heapResult.m_residentAfter) - static_cast<double>(heapResult.m_residentBefore)) / megabyte);
+    printf("    arena + pools: %8.1f ms, resident %+7.2f MB\n", pooledResult.m_milliseconds,
+           (static_cast<double>(pooledResult.m_residentAfter) - static_cast<double>(pooledResult.m_residentBefore)) / megabyte);
+    printf("    live object bytes at the end: %.2f MB; pools reserved %.2f MB (%.0f%% used, the rest lost to size classes and free blocks)\n",
+           pooledResult.m_liveBytes / megabyte, pools.GetBytesReserved() / megabyte, 100.0 * pooledResult.m_liveBytes / pools.GetBytesReserved());
+    printf("    arena reserved %.2f MB for a peak frame of %.2f MB\n", arena.GetBytesReserved() / megabyte, arena.GetPeakBytesAllocated() / megabyte);
+    printf("    peak resident for the process: %.2f MB\n", GetProcessMemory().m_peakResidentBytes / megabyte);
+    printf("    (checksum %.1f)\n", heapResult.m_checksum + pooledResult.m_checksum);
+
+    VerifyTestResult(heapResult.m_checksum == pooledResult.m_checksum && pools.GetNumAllocated() == 0, "Both soak runs should do the same work and free every object");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_Allocators_Soak)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_Allocators()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_Allocators)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_Allocators_FrameArena, "Allocators - FrameArena");
+    RunTestSet(true, TestSet_Allocators_Threads, "Allocators - Threads");
+    RunTestSet(true, TestSet_Allocators_Pools, "Allocators - Pools");
+    RunTestSet(true, TestSet_Allocators_StlAdapters, "Allocators - STL Adapters");
+    RunTestSet(false, TestSet_Allocators_Performance, "Allocators - Performance Tests");
+    RunTestSet(false, TestSet_Allocators_Soak, "Allocators - Soak Test");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_Allocators)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
@@ -0,0 +1,40 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_Allocators.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_Allocators();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_Allocators_FrameArena();
+int TestSet_Allocators_Threads();
+int TestSet_Allocators_Pools();
+int TestSet_Allocators_StlAdapters();
+int TestSet_Allocators_Performance();
+int TestSet_Allocators_Soak();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_Allocators_FrameArena
+#define ENABLE_TestSet_Allocators_Threads
+#define ENABLE_TestSet_Allocators_Pools
+#define ENABLE_TestSet_Allocators_StlAdapters
+#define ENABLE_TestSet_Allocators_Performance
+#define ENABLE_TestSet_Allocators_Soak
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define ALLOCATORS_PERFORMANCE_NUM_ITERATIONS    20
+#define ALLOCATORS_PERFORMANCE_NUM_ALLOCATIONS   100000
+#define ALLOCATORS_SOAK_NUM_FRAMES               2000
+#define ALLOCATORS_SOAK_NUM_LIVE_OBJECTS         20000
+#define ALLOCATORS_SOAK_CHURN_PER_FRAME          2000
+#define ALLOCATORS_SOAK_SCRATCH_PER_FRAME        500
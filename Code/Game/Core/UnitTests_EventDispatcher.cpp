@@ -0,0 +1,358 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_EventDispatcher.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Core/UnitTests_EventDispatcher.hpp"
+
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Engine/Core/EventSystem.hpp"
+#include "Game/Core/AllocationCounter.hpp"
+#include "Game/Core/EventDispatcher.hpp"
+#include "Game/GameCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    int s_numCalls = 0;
+    int s_checksum = 0;
+
+    //------------------------------------------------------------------------------------------------
+    // The engine's EventSystem, reduced to what a fire does: a string-keyed subscription map and
+    // string-to-string arguments
+    //
+    struct sStringEventSystem
+    {
+        std::map<std::string, std::vector<EventCallbackFunction>> m_subscriptionsByName;
+
+        void SubscribeEventCallbackFunction(std::string const&          name,
+                                            EventCallbackFunction const callback)
+        {
+            m_subscriptionsByName[name].push_back(callback);
+        }
+
+        void FireEvent(std::string const& name,
+                       EventArgs&         args)
+        {
+            auto const found = m_subscriptionsByName.find(name);
+
+            if (found == m_subscriptionsByName.end())
+            {
+                return;
+            }
+
+            for (EventCallbackFunction const callback : found->second)
+            {
+                if (callback(args))
+                {
+                    return;
+                }
+            }
+        }
+    };
+
+    //------------------------------------------------------------------------------------------------
+    bool OnKeyPressedString(EventArgs& args)
+    {
+        s_checksum += args.GetValue("KeyCode", -1);
+        return false;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    bool OnKeyPressed(InlineEventArgs& args)
+    {
+        s_checksum += args.GetValue("KeyCode", -1);
+        ++s_numCalls;
+        return false;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    bool OnKeyPressedConsume(InlineEventArgs& args)
+    {
+        (void)args;
+        ++s_numCalls;
+        return true;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    EventDispatcher* s_dispatcherForUnsubscribe = nullptr;
+
+    bool OnKeyPressedOnce(InlineEventArgs& args)
+    {
+        (void)args;
+        ++s_numCalls;
+        s_dispatcherForUnsubscribe->Unsubscribe(s_dispatcherForUnsubscribe->FindEvent("KeyPressed"), OnKeyPressedOnce);
+        return false;
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_EventDispatcher_InlineEventArgs()
+{
+#if defined(ENABLE_TestSet_EventDispatcher_InlineEventArgs)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_EventDispatcher_InlineEventArgs)(start)\n");
+    printf("####################################################################################################\n");
+
+    static_assert(HashEventName("KeyPressed") == HashEventName("keypressed"), "Event names should hash without regard to case");
+
+    InlineEventArgs args;
+    args.SetValue("KeyCode", 65);
+    args.SetValue("Scale", 0.5f);
+    args.SetValue("CursorPosition", Vector2Class(3.0f, 4.0f));
+    args.SetValue("Source", "Keyboard");
+
+    VerifyTestResult(args.GetValue("KeyCode", -1) == 65 && args.GetValue("Scale", 0.0f) == 0.5f &&
+                     args.GetValue("CursorPosition", Vector2Class(0.0f, 0.0f)) == Vector2Class(3.0f, 4.0f) &&
+                     args.GetValue("Source", std::string_view()) == "Keyboard" && args.GetType("CursorPosition") == eEventArgType::VEC2,
+                     "Each value type should read back as written");
+
+    args.SetValue("keycode", 66);
+    VerifyTestResult(args.GetValue("KEYCODE", -1) == 66 && args.GetNumValues() == 4 && sHashedName(std::string("keyCode")) == sHashedName("KeyCode"),
+                     "Keys should ignore case, and setting a key again should replace its value");
+
+    VerifyTestResult(args.GetValue("Missing", 7) == 7 && args.GetValue("Source", 7) == 7 && args.GetValue("Scale", -1) == 0 &&
+                     args.GetValue("KeyCode", 0.0f) == 66.0f && args.GetType("Missing") == eEventArgType::NONE,
+                     "Missing or mismatched keys should give the default, with ints and floats converting");
+
+    VerifyTestResult(!args.IsSpilled(), "Values within the inline capacity should not spill");
+
+    for (int index = 0; index < InlineEventArgs::INLINE_CAPACITY; ++index)
+    {
+        std::string const key = "Extra" + std::to_string(index);
+        args.SetValue(key, index);
+    }
+
+    bool bAllFound = true;
+
+    for (int index = 0; index < InlineEventArgs::INLINE_CAPACITY; ++index)
+    {
+        std::string const key = "Extra" + std::to_string(index);
+        bAllFound             = bAllFound && args.GetValue(key, -1) == index;
+    }
+
+    bool const bSpilled = args.IsSpilled() && args.GetNumValues() == 4 + InlineEventArgs::INLINE_CAPACITY;
+    args.Clear();
+    VerifyTestResult(bAllFound && bSpilled && args.GetNumValues() == 0 && !args.HasValue("KeyCode"),
+                     "Values past the inline capacity should spill and still be found, and Clear should remove all");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_EventDispatcher_InlineEventArgs)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 5; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_EventDispatcher_Dispatch()
+{
+#if defined(ENABLE_TestSet_EventDispatcher_Dispatch)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_EventDispatcher_Dispatch)(start)\n");
+    printf("####################################################################################################\n");
+
+    EventDispatcher dispatcher;
+    int const       keyPressed = dispatcher.RegisterEvent("KeyPressed");
+
+    VerifyTestResult(dispatcher.RegisterEvent("keypressed") == keyPressed && dispatcher.FindEvent("KEYPRESSED") == keyPressed &&
+                     dispatcher.FindEvent("KeyReleased") == -1 && dispatcher.GetEventName(keyPressed) == "KeyPressed" && dispatcher.GetNumEvents() == 1,
+                     "Event names should be interned once, ignoring case");
+
+    dispatcher.Subscribe(keyPressed, OnKeyPressed);
+    dispatcher.Subscribe("KeyPressed", OnKeyPressed);
+
+    InlineEventArgs args;
+    args.SetValue("KeyCode", 10);
+    s_numCalls = 0;
+    s_checksum = 0;
+
+    bool const bConsumedByIndex = dispatcher.Fire(keyPressed, args);
+    bool const bConsumedByName  = dispatcher.Fire("KeyPressed", args);
+    VerifyTestResult(!bConsumedByIndex && !bConsumedByName && s_numCalls == 4 && s_checksum == 40,
+                     "Firing by index or by name should call every subscriber with the arguments");
+
+    dispatcher.Subscribe(keyPressed, OnKeyPressedConsume);
+    dispatcher.Subscribe(keyPressed, OnKeyPressed);
+    s_numCalls = 0;
+    VerifyTestResult(dispatcher.Fire(keyPressed, args) && s_numCalls == 3, "A subscriber returning true should stop the fire");
+
+    EventDispatcher onceDispatcher;
+    s_dispatcherForUnsubscribe = &onceDispatcher;
+    onceDispatcher.Subscribe("KeyPressed", OnKeyPressedOnce);
+    onceDispatcher.Subscribe("KeyPressed", OnKeyPressed);
+    s_numCalls = 0;
+    onceDispatcher.Fire("KeyPressed", args);
+    onceDispatcher.Fire("KeyPressed", args);
+    VerifyTestResult(s_numCalls == 3 && onceDispatcher.GetNumSubscribers(0) == 1,
+                     "A subscriber unsubscribing itself mid-fire should not skip the next one");
+
+    VerifyTestResult(!dispatcher.Fire("KeyReleased", args) && !dispatcher.Fire(dispatcher.RegisterEvent("KeyReleased"), args),
+                     "Firing an unregistered event or one without subscribers should do nothing");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_EventDispatcher_Dispatch)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 5; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_EventDispatcher_Allocations()
+{
+#if defined(ENABLE_TestSet_EventDispatcher_Allocations)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_EventDispatcher_Allocations)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numFires = 1000;
+
+    EventDispatcher dispatcher;
+    int const       keyPressed = dispatcher.Subscribe("KeyPressed", OnKeyPressed);
+    dispatcher.Subscribe(keyPressed, OnKeyPressed);
+
+    ScopedAllocationCounter byIndexCounter;
+    for (int fire = 0; fire < numFires; ++fire)
+    {
+        InlineEventArgs args;
+        args.SetValue("KeyCode", fire & 0xFF);
+        args.SetValue("CursorPosition", Vector2Class(1.0f, 2.0f));
+        args.SetValue("Source", "Keyboard");
+        dispatcher.Fire(keyPressed, args);
+    }
+    long long const byIndexAllocations = byIndexCounter.GetNumAllocations();
+
+    ScopedAllocationCounter byNameCounter;
+    for (int fire = 0; fire < numFires; ++fire)
+    {
+        InlineEventArgs args;
+        args.SetValue("KeyCode", fire & 0xFF);
+        dispatcher.Fire("KeyPressed", args);
+    }
+    long long const byNameAllocations = byNameCounter.GetNumAllocations();
+
+    VerifyTestResult(byIndexAllocations == 0, "Firing by index with inline arguments should not allocate");
+    VerifyTestResult(byNameAllocations == 0, "Firing by name with inline arguments should not allocate");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_EventDispatcher_Allocations)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 2; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_EventDispatcher_Performance()
+{
+#if defined(ENABLE_TestSet_EventDispatcher_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_EventDispatcher_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numFires = EVENT_DISPATCHER_PERFORMANCE_NUM_FIRES;
+
+    sStringEventSystem stringSystem;
+    EventDispatcher    dispatcher;
+
+    for (int subscriber = 0; subscriber < EVENT_DISPATCHER_NUM_SUBSCRIBERS; ++subscriber)
+    {
+        stringSystem.SubscribeEventCallbackFunction("KeyPressed", OnKeyPressedString);
+        dispatcher.Subscribe("KeyPressed", OnKeyPressed);
+    }
+
+    // Unrelated events, so lookups by name are not into a one-entry map
+    for (int event = 0; event < 32; ++event)
+    {
+        std::string const name = "UnrelatedEvent" + std::to_string(event);
+        stringSystem.SubscribeEventCallbackFunction(name, OnKeyPressedString);
+        dispatcher.Subscribe(name, OnKeyPressed);
+    }
+
+    int const        keyPressed = dispatcher.FindEvent("KeyPressed");
+    PerformanceTimer timer;
+    s_checksum = 0;
+
+    printf("  %d fires of a key event with 3 arguments to %d subscribers...\n", numFires, EVENT_DISPATCHER_NUM_SUBSCRIBERS);
+
+    ScopedAllocationCounter stringCounter;
+    timer.Start();
+    for (int fire = 0; fire < numFires; ++fire)
+    {
+        EventArgs args;
+        args.SetValue("KeyCode", std::to_string(fire & 0xFF));
+        args.SetValue("CursorPosition", "1.0,2.0");
+        args.SetValue("Source", "Keyboard");
+        stringSystem.FireEvent("KeyPressed", args);
+    }
+    timer.Stop();
+    double const    stringTime        = timer.GetElapsedMicroseconds();
+    long long const stringAllocations = stringCounter.GetNumAllocations();
+
+    ScopedAllocationCounter byNameCounter;
+    timer.Start();
+    for (int fire = 0; fire < numFires; ++fire)
+    {
+        InlineEventArgs args;
+        args.SetValue("KeyCode", fire & 0xFF);
+        args.SetValue("CursorPosition", Vector2Class(1.0f, 2.0f));
+        args.SetValue("Source", "Keyboard");
+        dispatcher.Fire("KeyPressed", args);
+    }
+    timer.Stop();
+    double const    byNameTime        = timer.GetElapsedMicroseconds();
+    long long const byNameAllocations = byNameCounter.GetNumAllocations();
+
+    ScopedAllocationCounter byIndexCounter;
+    timer.Start();
+    for (int fire = 0; fire < numFires; ++fire)
+    {
+        InlineEventArgs args;
+        args.SetValue("KeyCode", fire & 0xFF);
+        args.SetValue("CursorPosition", Vector2Class(1.0f, 2.0f));
+        args.SetValue("Source", "Keyboard");
+        dispatcher.Fire(keyPressed, args);
+    }
+    timer.Stop();
+    double const    byIndexTime        = timer.GetElapsedMicroseconds();
+    long long const byIndexAllocations = byIndexCounter.GetNumAllocations();
+
+    printf("    EventSystem, string args:        %7.1f ns/fire, %.2f allocations/fire\n", stringTime * 1000.0 / numFires, static_cast<double>(stringAllocations) / numFires);
+    printf("    EventDispatcher, fire by name:   %7.1f ns/fire, %.2f allocations/fire (%.1fx)\n", byNameTime * 1000.0 / numFires, static_cast<double>(byNameAllocations) / numFires, stringTime / byNameTime);
+    printf("    EventDispatcher, fire by index:  %7.1f ns/fire, %.2f allocations/fire (%.1fx)   (checksum %d)\n", byIndexTime * 1000.0 / numFires, static_cast<double>(byIndexAllocations) / numFires, stringTime / byIndexTime, s_checksum);
+
+    VerifyTestResult(true, "EventDispatcher performance tests completed");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_EventDispatcher_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_EventDispatcher()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_EventDispatcher)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_EventDispatcher_InlineEventArgs, "EventDispatcher - InlineEventArgs");
+    RunTestSet(true, TestSet_EventDispatcher_Dispatch, "EventDispatcher - Dispatch");
+    RunTestSet(true, TestSet_EventDispatcher_Allocations, "EventDispatcher - Allocations");
+    RunTestSet(false, TestSet_EventDispatcher_Performance, "EventDispatcher - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_EventDispatcher)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
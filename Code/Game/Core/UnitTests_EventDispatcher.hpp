@@ -0,0 +1,32 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_EventDispatcher.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_EventDispatcher();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_EventDispatcher_InlineEventArgs();
+int TestSet_EventDispatcher_Dispatch();
+int TestSet_EventDispatcher_Allocations();
+int TestSet_EventDispatcher_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_EventDispatcher_InlineEventArgs
+#define ENABLE_TestSet_EventDispatcher_Dispatch
+#define ENABLE_TestSet_EventDispatcher_Allocations
+#define ENABLE_TestSet_EventDispatcher_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define EVENT_DISPATCHER_PERFORMANCE_NUM_FIRES    1000000
+#define EVENT_DISPATCHER_NUM_SUBSCRIBERS          4
@@ -0,0 +1,642 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_JobSystem.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Core/UnitTests_JobSystem.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "Game/Core/JobSystem.hpp"
+#include "Game/GameCommon.hpp"
+#include "Game/Math/AABB2BoundsReduction.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    std::vector<Vector2Class> MakeRandomPoints(int const      numPoints,
+                                               unsigned const seed)
+    {
+        std::mt19937                          random(seed);
+        std::uniform_real_distribution<float> coordinate(-1000.0f, 1000.0f);
+        std::vector<Vector2Class>             points(numPoints);
+
+        for (Vector2Class& point : points)
+        {
+            point = Vector2Class(coordinate(random), coordinate(random));
+        }
+
+        return points;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void NormalizeRange(Vector2Class const* const source,
+                        Vector2Class* const       destination,
+                        int const                 begin,
+                        int const                 end)
+    {
+        for (int index = begin; index < end; ++index)
+        {
+            destination[index] = source[index].GetNormalized();
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Bounds of fixed chunks, combined in chunk order, so the result does not depend on scheduling
+    //
+    AABB2Class MakeBoundsWithJobs(JobSystem&                       jobSystem,
+                                  std::vector<Vector2Class> const& points)
+    {
+        int const numPoints = static_cast<int>(points.size());
+        int const numChunks = std::max(1, std::min(jobSystem.GetNumThreads() * 8, numPoints / 4096));
+        int const chunkSize = (numPoints + numChunks - 1) / numChunks;
+
+        std::vector<AABB2Class> chunkBounds(numChunks);
+
+        jobSystem.ParallelFor(0, numChunks, [&](int const beginChunk, int const endChunk)
+        {
+            for (int chunkIndex = beginChunk; chunkIndex < endChunk; ++chunkIndex)
+            {
+                int const begin = chunkIndex * chunkSize;
+                int const end   = std::min(numPoints, begin + chunkSize);
+
+                chunkBounds[chunkIndex] = MakeAABB2BoundsOf(std::span<Vector2Class const>(points.data() + begin, end - begin));
+            }
+        });
+
+        AABB2Class bounds = chunkBounds[0];
+
+        for (int chunkIndex = 1; chunkIndex < numChunks; ++chunkIndex)
+        {
+            bounds.StretchToIncludePoint(chunkBounds[chunkIndex].m_mins);
+            bounds.StretchToIncludePoint(chunkBounds[chunkIndex].m_maxs);
+        }
+
+        return bounds;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // A square grid with about a quarter of its cells walls, the corners kept open
+    //
+    std::vector<unsigned char> MakeRandomGrid(int const      gridSize,
+                                              unsigned const seed)
+    {
+        std::mt19937                       random(seed);
+        std::uniform_int_distribution<int> percent(0, 99);
+        std::vector<unsigned char>         isWall(gridSize * gridSize);
+
+        for (unsigned char& cell : isWall)
+        {
+            cell = (percent(random) < 25) ? 1 : 0;
+        }
+
+        isWall[0]                       = 0;
+        isWall[gridSize * gridSize - 1] = 0;
+
+        return isWall;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    std::vector<int> RunGridBFS(std::vector<unsigned char> const& isWall,
+                                int const                         gridSize)
+    {
+        std::vector<int> distances(isWall.size(), -1);
+        std::vector<int> frontier  = {0};
+        std::vector<int> nextFrontier;
+        distances[0]               = 0;
+
+        for (int distance = 1; !frontier.empty(); ++distance)
+        {
+            nextFrontier.clear();
+
+            for (int const cell : frontier)
+            {
+                int const x                = cell % gridSize;
+                int const neighbors[4]     = {cell - 1, cell + 1, cell - gridSize, cell + gridSize};
+                bool const isNeighborOn[4] = {x > 0, x < gridSize - 1, cell >= gridSize, cell < gridSize * (gridSize - 1)};
+
+                for (int side = 0; side < 4; ++side)
+                {
+                    if (isNeighborOn[side] && isWall[neighbors[side]] == 0 && distances[neighbors[side]] < 0)
+                    {
+                        distances[neighbors[side]] = distance;
+                        nextFrontier.push_back(neighbors[side]);
+                    }
+                }
+            }
+
+            frontier.swap(nextFrontier);
+        }
+
+        return distances;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Level by level: the frontier is split across jobs, each cell claimed by whichever job marks it
+    // first, and each worker collects the cells it claimed for the next level
+    //
+    std::vector<int> RunGridBFSWithJobs(JobSystem&                        jobSystem,
+                                        std::vector<unsigned char> const& isWall,
+                                        int const                         gridSize)
+    {
+        std::vector<std::atomic<int>> distances(isWall.size());
+        for (std::atomic<int>& distance : distances)
+        {
+            distance.store(-1, std::memory_order_relaxed);
+        }
+
+        std::vector<std::vector<int>> workerFrontiers(jobSystem.GetNumThreads());
+        std::vector<int>              frontier = {0};
+        distances[0].store(0, std::memory_order_relaxed);
+
+        for (int distance = 1; !frontier.empty(); ++distance)
+        {
+            for (std::vector<int>& workerFrontier : workerFrontiers)
+            {
+                workerFrontier.clear();
+            }
+
+            jobSystem.ParallelFor(0, static_cast<int>(frontier.size()), [&](int const begin, int const end)
+            {
+                int const         workerIndex    = jobSystem.GetCurrentWorkerIndex();
+                std::vector<int>& workerFrontier = workerFrontiers[(workerIndex >= 0) ? workerIndex : 0];
+
+                for (int frontierIndex = begin; frontierIndex < end; ++frontierIndex)
+                {
+                    int const  cell            = frontier[frontierIndex];
+                    int const  x               = cell % gridSize;
+                    int const  neighbors[4]    = {cell - 1, cell + 1, cell - gridSize, cell + gridSize};
+                    bool const isNeighborOn[4] = {x > 0, x < gridSize - 1, cell >= gridSize, cell < gridSize * (gridSize - 1)};
+
+                    for (int side = 0; side < 4; ++side)
+                    {
+                        int unvisited = -1;
+
+                        if (isNeighborOn[side] && isWall[neighbors[side]] == 0 && distances[neighbors[side]].load(std::memory_order_relaxed) < 0 &&
+                            distances[neighbors[side]].compare_exchange_strong(unvisited, distance, std::memory_order_relaxed))
+                        {
+                            workerFrontier.push_back(neighbors[side]);
+                        }
+                    }
+                }
+            }, 256);
+
+            frontier.clear();
+            for (std::vector<int> const& workerFrontier : workerFrontiers)
+            {
+                frontier.insert(frontier.end(), workerFrontier.begin(), workerFrontier.end());
+            }
+        }
+
+        std::vector<int> result(isWall.size());
+        for (size_t cell = 0; cell < isWall.size(); ++cell)
+        {
+            result[cell] = distances[cell].load(std::memory_order_relaxed);
+        }
+
+        return result;
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_JobSystem_Deque()
+{
+#if defined(ENABLE_TestSet_JobSystem_Deque)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_JobSystem_Deque)(start)\n");
+    printf("####################################################################################################\n");
+
+    std::vector<sJob> jobs(JOB_DEQUE_CAPACITY + 1);
+
+    {
+        JobDeque deque;
+        deque.Push(&jobs[0]);
+        deque.Push(&jobs[1]);
+        deque.Push(&jobs[2]);
+
+        sJob* const popped = deque.Pop();
+        sJob* const stolen = deque.Steal();
+
+        VerifyTestResult(popped == &jobs[2] && stolen == &jobs[0] && deque.GetSize() == 1, "The owner should pop the newest job and a thief should steal the oldest");
+        VerifyTestResult(deque.Pop() == &jobs[1] && deque.Pop() == nullptr && deque.Steal() == nullptr, "An emptied deque should give nothing to the owner or a thief");
+    }
+
+    {
+        JobDeque deque;
+        bool     allPushed = true;
+
+        for (int jobIndex = 0; jobIndex < JOB_DEQUE_CAPACITY; ++jobIndex)
+        {
+            allPushed = deque.Push(&jobs[jobIndex]) && allPushed;
+        }
+
+        VerifyTestResult(allPushed && !deque.Push(&jobs[JOB_DEQUE_CAPACITY]), "A full deque should refuse another job");
+    }
+
+    // The owner pushes and pops while thieves steal; every job must be taken exactly once
+    {
+        int constexpr numJobs    = 200000;
+        int constexpr numThieves = 3;
+
+        JobDeque                      deque;
+        std::vector<sJob>             stressJobs(numJobs);
+        std::vector<std::atomic<int>> timesTaken(numJobs);
+        std::atomic<bool>             isOwnerDone = false;
+        std::vector<std::thread>      thieves;
+
+        auto const take = [&](sJob const* const job)
+        {
+            timesTaken[job - stressJobs.data()].fetch_add(1, std::memory_order_relaxed);
+        };
+
+        for (int thiefIndex = 0; thiefIndex < numThieves; ++thiefIndex)
+        {
+            thieves.emplace_back([&]()
+            {
+                while (!isOwnerDone.load(std::memory_order_acquire) || deque.GetSize() > 0)
+                {
+                    if (sJob const* const job = deque.Steal())
+                    {
+                        take(job);
+                    }
+                }
+            });
+        }
+
+        for (int jobIndex = 0; jobIndex < numJobs; ++jobIndex)
+        {
+            while (!deque.Push(&stressJobs[jobIndex]))
+            {
+                std::this_thread::yield();
+            }
+
+            if (jobIndex % 3 == 0)
+            {
+                if (sJob const* const job = deque.Pop())
+                {
+                    take(job);
+                }
+            }
+        }
+
+        while (sJob const* const job = deque.Pop())
+        {
+            take(job);
+        }
+
+        isOwnerDone.store(true, std::memory_order_release);
+
+        for (std::thread& thief : thieves)
+        {
+            thief.join();
+        }
+
+        bool allTakenOnce = true;
+        for (std::atomic<int> const& count : timesTaken)
+        {
+            allTakenOnce = allTakenOnce && count.load() == 1;
+        }
+
+        VerifyTestResult(allTakenOnce, "With thieves racing the owner, every job should be taken exactly once");
+    }
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_JobSystem_Deque)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 4; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_JobSystem_Jobs()
+{
+#if defined(ENABLE_TestSet_JobSystem_Jobs)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_JobSystem_Jobs)(start)\n");
+    printf("####################################################################################################\n");
+
+    JobSystem jobSystem;
+    jobSystem.Startup(JOB_SYSTEM_TEST_NUM_THREADS);
+
+    VerifyTestResult(jobSystem.GetNumThreads() == JOB_SYSTEM_TEST_NUM_THREADS && jobSystem.GetCurrentWorkerIndex() == 0, "The thread that starts the system should be worker 0");
+
+    int constexpr    numJobs = 10000;
+    std::atomic<int> timesRun[numJobs] = {};
+    JobCounter       counter;
+
+    for (int jobIndex = 0; jobIndex < numJobs; ++jobIndex)
+    {
+        std::atomic<int>* const runCount = &timesRun[jobIndex];
+        jobSystem.Submit([runCount]() { runCount->fetch_add(1, std::memory_order_relaxed); }, counter);
+    }
+
+    jobSystem.Wait(counter);
+
+    bool allRunOnce = true;
+    for (std::atomic<int> const& count : timesRun)
+    {
+        allRunOnce = allRunOnce && count.load() == 1;
+    }
+
+    VerifyTestResult(allRunOnce && counter.IsDone(), "Wait should return once every submitted job has run exactly once");
+
+    // Jobs that submit more jobs against the same counter, three levels deep
+    struct sSpawnJob
+    {
+        JobSystem*        m_jobSystem;
+        JobCounter*       m_counter;
+        std::atomic<int>* m_numRun;
+        int               m_depth;
+
+        void operator()() const
+        {
+            m_numRun->fetch_add(1, std::memory_order_relaxed);
+
+            if (m_depth > 0)
+            {
+                for (int childIndex = 0; childIndex < 8; ++childIndex)
+                {
+                    m_jobSystem->Submit(sSpawnJob{m_jobSystem, m_counter, m_numRun, m_depth - 1}, *m_counter);
+                }
+            }
+        }
+    };
+
+    std::atomic<int> numSpawnedRun = 0;
+    JobCounter       spawnCounter;
+    jobSystem.Submit(sSpawnJob{&jobSystem, &spawnCounter, &numSpawnedRun, 3}, spawnCounter);
+    jobSystem.Wait(spawnCounter);
+
+    VerifyTestResult(numSpawnedRun.load() == 1 + 8 + 64 + 512, "Jobs submitted from inside jobs should be waited for too");
+
+    std::atomic<int> ranOnThread = 0;
+    JobCounter       outsideCounter;
+    std::thread      outsider([&]()
+    {
+        jobSystem.Submit([&ranOnThread, &jobSystem]() { ranOnThread.store(jobSystem.GetCurrentWorkerIndex() == -1 ? 1 : 2); }, outsideCounter);
+    });
+    outsider.join();
+
+    VerifyTestResult(ranOnThread.load() == 1 && outsideCounter.IsDone(), "A thread that is not a worker should run its job immediately");
+
+    jobSystem.Shutdown();
+
+    VerifyTestResult(jobSystem.GetCurrentWorkerIndex() == -1 && jobSystem.GetNumThreads() == 0, "Shutdown should stop every worker");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_JobSystem_Jobs)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 5; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_JobSystem_ParallelFor()
+{
+#if defined(ENABLE_TestSet_JobSystem_ParallelFor)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_JobSystem_ParallelFor)(start)\n");
+    printf("####################################################################################################\n");
+
+    JobSystem jobSystem;
+    jobSystem.Startup(JOB_SYSTEM_TEST_NUM_THREADS);
+
+    bool allCovered = true;
+
+    for (int const count : {0, 1, 7, 1000, 100003})
+    {
+        std::vector<std::atomic<int>> timesVisited(count);
+
+        jobSystem.ParallelFor(0, count, [&timesVisited](int const begin, int const end)
+        {
+            for (int index = begin; index < end; ++index)
+            {
+                timesVisited[index].fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+
+        for (std::atomic<int> const& visits : timesVisited)
+        {
+            allCovered = allCovered && visits.load() == 1;
+        }
+    }
+
+    VerifyTestResult(allCovered, "ParallelFor should visit every index of the range exactly once");
+
+    std::atomic<int> shortestRange = 1 << 30;
+    std::atomic<int> numRanges     = 0;
+
+    jobSystem.ParallelFor(-5000, 5000, [&](int const begin, int const end)
+    {
+        int shortest = shortestRange.load();
+        while (end - begin < shortest && !shortestRange.compare_exchange_weak(shortest, end - begin))
+        {
+        }
+        numRanges.fetch_add(1);
+    }, 1000);
+
+    VerifyTestResult(shortestRange.load() >= 1000 && numRanges.load() <= 10, "No subrange should be shorter than the minimum grain");
+
+    std::atomic<int64_t> sum = 0;
+
+    jobSystem.ParallelFor(0, 64, [&](int const outerBegin, int const outerEnd)
+    {
+        for (int outer = outerBegin; outer < outerEnd; ++outer)
+        {
+            jobSystem.ParallelFor(0, 1000, [&sum, outer](int const begin, int const end)
+            {
+                int64_t partial = 0;
+                for (int inner = begin; inner < end; ++inner)
+                {
+                    partial += outer * 1000 + inner;
+                }
+                sum.fetch_add(partial);
+            });
+        }
+    });
+
+    VerifyTestResult(sum.load() == 63999LL * 64000LL / 2, "ParallelFor should nest inside ParallelFor");
+
+    jobSystem.Shutdown();
+
+    int numSerialRanges = 0;
+    jobSystem.ParallelFor(0, 100, [&numSerialRanges](int const begin, int const end)
+    {
+        numSerialRanges += (begin == 0 && end == 100) ? 1 : 100;
+    });
+
+    VerifyTestResult(numSerialRanges == 1, "Without workers ParallelFor should call the function once on the whole range");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_JobSystem_ParallelFor)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 4; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_JobSystem_Workloads()
+{
+#if defined(ENABLE_TestSet_JobSystem_Workloads)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_JobSystem_Workloads)(start)\n");
+    printf("####################################################################################################\n");
+
+    JobSystem jobSystem;
+    jobSystem.Startup(JOB_SYSTEM_TEST_NUM_THREADS);
+
+    std::vector<Vector2Class> const points = MakeRandomPoints(100003, 5);
+    std::vector<Vector2Class>       serialNormals(points.size());
+    std::vector<Vector2Class>       jobNormals(points.size());
+
+    NormalizeRange(points.data(), serialNormals.data(), 0, static_cast<int>(points.size()));
+    jobSystem.ParallelFor(0, static_cast<int>(points.size()), [&](int const begin, int const end)
+    {
+        NormalizeRange(points.data(), jobNormals.data(), begin, end);
+    }, 1024);
+
+    VerifyTestResult(std::equal(serialNormals.begin(), serialNormals.end(), jobNormals.begin(), [](Vector2Class const& a, Vector2Class const& b) { return a.x == b.x && a.y == b.y; }),
+                     "Normalizing with jobs should match normalizing serially");
+
+    AABB2Class const serialBounds = MakeAABB2BoundsOf(points);
+    AABB2Class const jobBounds    = MakeBoundsWithJobs(jobSystem, points);
+
+    VerifyTestResult(serialBounds.m_mins == jobBounds.m_mins && serialBounds.m_maxs == jobBounds.m_maxs, "Bounds reduced with jobs should match the serial bounds exactly");
+
+    int constexpr                    gridSize = 200;
+    std::vector<unsigned char> const isWall   = MakeRandomGrid(gridSize, 9);
+
+    VerifyTestResult(RunGridBFS(isWall, gridSize) == RunGridBFSWithJobs(jobSystem, isWall, gridSize), "A grid BFS with jobs should find the same distances as a serial one");
+
+    jobSystem.Shutdown();
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_JobSystem_Workloads)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 3; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_JobSystem_Performance()
+{
+#if defined(ENABLE_TestSet_JobSystem_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_JobSystem_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numIterations = JOB_SYSTEM_PERFORMANCE_NUM_ITERATIONS;
+    int constexpr gridSize      = JOB_SYSTEM_PERFORMANCE_GRID_SIZE;
+
+    std::vector<Vector2Class> const  points = MakeRandomPoints(JOB_SYSTEM_PERFORMANCE_NUM_POINTS, 13);
+    std::vector<Vector2Class>        normals(points.size());
+    std::vector<unsigned char> const isWall = MakeRandomGrid(gridSize, 17);
+
+    int const hardwareThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    int const maxThreads      = (JOB_SYSTEM_SCALING_MAX_THREADS > 0) ? JOB_SYSTEM_SCALING_MAX_THREADS : hardwareThreads;
+
+    printf("  %d points, %dx%d grid, %d iterations, %d hardware threads...\n", static_cast<int>(points.size()), gridSize, gridSize, numIterations, hardwareThreads);
+    printf("    threads    Vec2 normalize         AABB2 bounds           Grid BFS\n");
+
+    // Powers of two, and the maximum
+    std::vector<int> threadCounts;
+    for (int numThreads = 1; numThreads < maxThreads; numThreads *= 2)
+    {
+        threadCounts.push_back(numThreads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    double baseTimes[3] = {};
+    float  checksum     = 0.0f;
+
+    for (int const numThreads : threadCounts)
+    {
+        JobSystem jobSystem;
+        jobSystem.Startup(numThreads);
+
+        PerformanceTimer timer;
+        double           times[3] = {};
+
+        timer.Start();
+        for (int iteration = 0; iteration < numIterations; ++iteration)
+        {
+            jobSystem.ParallelFor(0, static_cast<int>(points.size()), [&](int const begin, int const end)
+            {
+                NormalizeRange(points.data(), normals.data(), begin, end);
+            }, 4096);
+            checksum += normals[iteration].x;
+        }
+        timer.Stop();
+        times[0] = timer.GetElapsedMicroseconds() / numIterations;
+
+        timer.Start();
+        for (int iteration = 0; iteration < numIterations; ++iteration)
+        {
+            checksum += MakeBoundsWithJobs(jobSystem, points).m_maxs.x;
+        }
+        timer.Stop();
+        times[1] = timer.GetElapsedMicroseconds() / numIterations;
+
+        timer.Start();
+        for (int iteration = 0; iteration < numIterations; ++iteration)
+        {
+            checksum += static_cast<float>(RunGridBFSWithJobs(jobSystem, isWall, gridSize).back());
+        }
+        timer.Stop();
+        times[2] = timer.GetElapsedMicroseconds() / numIterations;
+
+        if (numThreads == 1)
+        {
+            std::copy(times, times + 3, baseTimes);
+        }
+
+        printf("    %4d     %9.1f us (%.2fx)   %9.1f us (%.2fx)   %9.1f us (%.2fx)\n", numThreads,
+               times[0], baseTimes[0] / times[0], times[1], baseTimes[1] / times[1], times[2], baseTimes[2] / times[2]);
+
+        jobSystem.Shutdown();
+    }
+
+    printf("    (checksum %.1f)\n", checksum);
+
+    VerifyTestResult(true, "JobSystem performance tests completed");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_JobSystem_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_JobSystem()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_JobSystem)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_JobSystem_Deque, "JobSystem - Deque");
+    RunTestSet(true, TestSet_JobSystem_Jobs, "JobSystem - Jobs");
+    RunTestSet(true, TestSet_JobSystem_ParallelFor, "JobSystem - ParallelFor");
+    RunTestSet(true, TestSet_JobSystem_Workloads, "JobSystem - Workloads");
+    RunTestSet(false, TestSet_JobSystem_Performance, "JobSystem - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_JobSystem)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
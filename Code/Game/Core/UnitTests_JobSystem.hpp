@@ -0,0 +1,37 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_JobSystem.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_JobSystem();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_JobSystem_Deque();
+int TestSet_JobSystem_Jobs();
+int TestSet_JobSystem_ParallelFor();
+int TestSet_JobSystem_Workloads();
+int TestSet_JobSystem_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_JobSystem_Deque
+#define ENABLE_TestSet_JobSystem_Jobs
+#define ENABLE_TestSet_JobSystem_ParallelFor
+#define ENABLE_TestSet_JobSystem_Workloads
+#define ENABLE_TestSet_JobSystem_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define JOB_SYSTEM_TEST_NUM_THREADS              4
+#define JOB_SYSTEM_SCALING_MAX_THREADS           0          // 0 = hardware concurrency
+#define JOB_SYSTEM_PERFORMANCE_NUM_ITERATIONS    20
+#define JOB_SYSTEM_PERFORMANCE_NUM_POINTS        (1 << 21)
+#define JOB_SYSTEM_PERFORMANCE_GRID_SIZE         1024
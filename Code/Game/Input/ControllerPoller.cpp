@@ -0,0 +1,189 @@
+//----------------------------------------------------------------------------------------------------
+// ControllerPoller.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/ControllerPoller.hpp"
+
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------
+ControllerPoller::ControllerPoller(InputBackend&                  backend,
+                                   sControllerPollerConfig const& config)
+    : m_backend(backend),
+      m_config(config),
+      m_nextPollTime(std::max(config.m_numControllers, 0)),
+      m_backoffSeconds(std::max(config.m_numControllers, 0)),
+      m_numPolls(std::max(config.m_numControllers, 0))
+{
+    m_config.m_numControllers = std::max(config.m_numControllers, 0);
+
+    // Sized once here, so neither thread ever reallocates a buffer
+    for (sControllerSnapshot& buffer : m_buffers)
+    {
+        buffer.m_controllers.resize(m_config.m_numControllers);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ControllerPoller::~ControllerPoller()
+{
+    Stop();
+}
+
+//----------------------------------------------------------------------------------------------------
+void ControllerPoller::Start()
+{
+    if (m_isRunning.load())
+    {
+        return;
+    }
+
+    Clock::time_point const now = Clock::now();
+
+    for (sControllerSnapshot& buffer : m_buffers)
+    {
+        std::fill(buffer.m_controllers.begin(), buffer.m_controllers.end(), sControllerSample());
+        buffer.m_pollCycle = 0;
+    }
+
+    m_backIndex  = 0;
+    m_frontIndex = 1;
+    m_middleIndex.store(2);
+
+    for (int controllerIndex = 0; controllerIndex < m_config.m_numControllers; ++controllerIndex)
+    {
+        m_nextPollTime[controllerIndex]   = now;
+        m_backoffSeconds[controllerIndex] = 0.0;
+        m_numPolls[controllerIndex].store(0);
+    }
+
+    m_numPollCycles.store(0);
+    m_isRunning.store(true);
+    m_thread = std::thread(&ControllerPoller::RunPollingThread, this);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ControllerPoller::Stop()
+{
+    m_isRunning.store(false);
+
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ControllerPoller::IsRunning() const
+{
+    return m_isRunning.load();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ControllerPoller::AcquireLatest()
+{
+    if ((m_middleIndex.load(std::memory_order_relaxed) & NEW_SNAPSHOT_BIT) == 0)
+    {
+        return false;
+    }
+
+    // Hand the front buffer back as the new middle one, without the bit, and take what was published
+    int const publishedIndex = m_middleIndex.exchange(m_frontIndex, std::memory_order_acq_rel);
+    m_frontIndex             = publishedIndex & BUFFER_INDEX_MASK;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+sControllerSnapshot const& ControllerPoller::GetSnapshot() const
+{
+    return m_buffers[m_frontIndex];
+}
+
+//----------------------------------------------------------------------------------------------------
+int ControllerPoller::GetNumControllers() const
+{
+    return m_config.m_numControllers;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint64_t ControllerPoller::GetNumPollCycles() const
+{
+    return m_numPollCycles.load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------
+int ControllerPoller::GetNumPolls(int const controllerIndex) const
+{
+    if (controllerIndex < 0 || controllerIndex >= m_config.m_numControllers)
+    {
+        return 0;
+    }
+
+    return m_numPolls[controllerIndex].load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ControllerPoller::PollOnce(Clock::time_point const now)
+{
+    if (m_isRunning.load())
+    {
+        return;
+    }
+
+    RunPollCycle(now);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ControllerPoller::RunPollingThread()
+{
+    Clock::duration const period    = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / m_config.m_pollRateHz));
+    Clock::time_point     nextCycle = Clock::now();
+
+    while (m_isRunning.load(std::memory_order_relaxed))
+    {
+        RunPollCycle(Clock::now());
+
+        // A cycle that overran starts the next one right away rather than trying to catch up
+        nextCycle = std::max(nextCycle + period, Clock::now());
+        std::this_thread::sleep_until(nextCycle);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void ControllerPoller::RunPollCycle(Clock::time_point const now)
+{
+    sControllerSnapshot& snapshot = m_buffers[m_backIndex];
+
+    for (int controllerIndex = 0; controllerIndex < m_config.m_numControllers; ++controllerIndex)
+    {
+        // A slot still backing off stays disconnected
+        if (now < m_nextPollTime[controllerIndex])
+        {
+            snapshot.m_controllers[controllerIndex] = sControllerSample();
+            continue;
+        }
+
+        sControllerSample const sample = m_backend.PollController(controllerIndex);
+        m_numPolls[controllerIndex].fetch_add(1, std::memory_order_relaxed);
+        snapshot.m_controllers[controllerIndex] = sample;
+
+        if (sample.m_isConnected)
+        {
+            m_backoffSeconds[controllerIndex] = 0.0;
+        }
+        else
+        {
+            double& backoff = m_backoffSeconds[controllerIndex];
+            backoff         = (backoff == 0.0) ? m_config.m_disconnectedBackoffSeconds : std::min(backoff * 2.0, m_config.m_maxBackoffSeconds);
+
+            m_nextPollTime[controllerIndex] = now + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(backoff));
+        }
+    }
+
+    snapshot.m_pollCycle = m_numPollCycles.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    int const previousMiddle = m_middleIndex.exchange(m_backIndex | NEW_SNAPSHOT_BIT, std::memory_order_acq_rel);
+    m_backIndex              = previousMiddle & BUFFER_INDEX_MASK;
+}
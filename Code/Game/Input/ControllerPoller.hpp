@@ -0,0 +1,94 @@
+//----------------------------------------------------------------------------------------------------
+// ControllerPoller.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "Engine/Input/InputSystem.hpp"
+#include "Game/Input/InputBackend.hpp"
+
+//----------------------------------------------------------------------------------------------------
+struct sControllerPollerConfig
+{
+    int    m_numControllers             = NUM_XBOX_CONTROLLERS;    // Slots polled from 0, more for a ControllerStateArray
+    double m_pollRateHz                 = 250.0;
+    double m_disconnectedBackoffSeconds = 0.05;    // Wait before re-polling a slot found disconnected...
+    double m_maxBackoffSeconds          = 1.0;     // ...doubling on every miss up to this
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sControllerSnapshot
+{
+    std::vector<sControllerSample> m_controllers;       // One per polled slot
+    uint64_t                       m_pollCycle = 0;     // The polling thread's cycle that produced this snapshot
+};
+
+//----------------------------------------------------------------------------------------------------
+// Polls the first m_numControllers controller slots of an InputBackend on a background thread at a fixed rate, so the
+// game thread never waits on the controller API. Polling an empty slot can stall for milliseconds,
+// so a slot found disconnected is polled again only after a backoff that doubles on each miss.
+//
+// Each poll cycle is published through a lock-free triple buffer: the polling thread fills its
+// back buffer and swaps it with the shared middle one; AcquireLatest on the game thread (once per
+// frame, from InputFrameDriver::BeginFrame) swaps the middle one into the front if it is newer.
+// Neither side ever waits on the other, and the front snapshot stays put until the next acquire.
+//
+// The backend's PollController is called from the polling thread only while the poller runs.
+// While it is stopped, PollOnce runs single cycles on the caller's thread at times the caller
+// chooses, so the backoff can be driven on a simulated clock.
+//
+class ControllerPoller
+{
+public:
+    explicit ControllerPoller(InputBackend& backend, sControllerPollerConfig const& config = sControllerPollerConfig());
+    ~ControllerPoller();
+
+    ControllerPoller(ControllerPoller const&)            = delete;
+    ControllerPoller& operator=(ControllerPoller const&) = delete;
+
+    void Start();
+    void Stop();
+    bool IsRunning() const;
+    void PollOnce(std::chrono::steady_clock::time_point now);     // One cycle on the calling thread as of now; only while stopped
+
+    // Game thread only
+    bool                       AcquireLatest();         // True if a newer snapshot was published since the last acquire
+    sControllerSnapshot const& GetSnapshot() const;     // The snapshot last acquired
+
+    int      GetNumControllers() const;
+    uint64_t GetNumPollCycles() const;
+    int      GetNumPolls(int controllerIndex) const;    // Backend polls of one slot since Start
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static int constexpr BUFFER_INDEX_MASK = 0x3;
+    static int constexpr NEW_SNAPSHOT_BIT  = 0x4;
+
+    void RunPollingThread();
+    void RunPollCycle(Clock::time_point now);
+
+    InputBackend&           m_backend;
+    sControllerPollerConfig m_config;
+    std::thread             m_thread;
+    std::atomic<bool>       m_isRunning{false};
+
+    // Triple buffer: the polling thread owns m_backIndex, the game thread m_frontIndex, and the
+    // middle buffer's index plus NEW_SNAPSHOT_BIT is swapped through m_middleIndex
+    sControllerSnapshot m_buffers[3];
+    int                 m_backIndex  = 0;
+    int                 m_frontIndex = 1;
+    alignas(64) std::atomic<int> m_middleIndex{2};
+
+    // Polling thread only, apart from the counters
+    std::vector<Clock::time_point> m_nextPollTime;
+    std::vector<double>            m_backoffSeconds;
+    std::vector<std::atomic<int>>  m_numPolls;
+    std::atomic<uint64_t>          m_numPollCycles{0};
+};
@@ -0,0 +1,217 @@
+//----------------------------------------------------------------------------------------------------
+// ControllerStateArray.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/ControllerStateArray.hpp"
+
+#include <bit>
+
+#include "Game/Input/InputBackend.hpp"
+
+//----------------------------------------------------------------------------------------------------
+ControllerView::ControllerView(ControllerStateArray const* const states,
+                               int const                         controllerIndex)
+    : m_states(states),
+      m_controllerIndex(controllerIndex)
+{
+    if (m_states == nullptr || controllerIndex < 0 || controllerIndex >= m_states->GetNumControllers())
+    {
+        m_states          = nullptr;
+        m_controllerIndex = -1;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ControllerView::IsConnected() const
+{
+    return m_states != nullptr && m_states->IsConnected(m_controllerIndex);
+}
+
+//----------------------------------------------------------------------------------------------------
+int ControllerView::GetControllerID() const
+{
+    return m_controllerIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ControllerView::IsButtonDown(XboxButtonID const button) const
+{
+    return m_states != nullptr && ((m_states->GetButtonsDown(m_controllerIndex) >> button) & 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ControllerView::WasButtonJustPressed(XboxButtonID const button) const
+{
+    if (m_states == nullptr)
+    {
+        return false;
+    }
+
+    uint16_t const pressed = m_states->GetButtonsDown(m_controllerIndex) & ~m_states->GetButtonsDownLastFrame(m_controllerIndex);
+
+    return (pressed >> button) & 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ControllerView::WasButtonJustReleased(XboxButtonID const button) const
+{
+    if (m_states == nullptr)
+    {
+        return false;
+    }
+
+    uint16_t const released = ~m_states->GetButtonsDown(m_controllerIndex) & m_states->GetButtonsDownLastFrame(m_controllerIndex);
+
+    return (released >> button) & 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+Vec2 ControllerView::GetLeftStickPosition() const
+{
+    return (m_states != nullptr) ? m_states->GetLeftStickPosition(m_controllerIndex) : Vec2(0.f, 0.f);
+}
+
+//----------------------------------------------------------------------------------------------------
+Vec2 ControllerView::GetRightStickPosition() const
+{
+    return (m_states != nullptr) ? m_states->GetRightStickPosition(m_controllerIndex) : Vec2(0.f, 0.f);
+}
+
+//----------------------------------------------------------------------------------------------------
+Vec2 ControllerView::GetLeftStickRawPosition() const
+{
+    return (m_states != nullptr) ? m_states->GetLeftStickRawPosition(m_controllerIndex) : Vec2(0.f, 0.f);
+}
+
+//----------------------------------------------------------------------------------------------------
+Vec2 ControllerView::GetRightStickRawPosition() const
+{
+    return (m_states != nullptr) ? m_states->GetRightStickRawPosition(m_controllerIndex) : Vec2(0.f, 0.f);
+}
+
+//----------------------------------------------------------------------------------------------------
+float ControllerView::GetLeftTrigger() const
+{
+    return (m_states != nullptr) ? m_states->GetLeftTrigger(m_controllerIndex) : 0.f;
+}
+
+//----------------------------------------------------------------------------------------------------
+float ControllerView::GetRightTrigger() const
+{
+    return (m_states != nullptr) ? m_states->GetRightTrigger(m_controllerIndex) : 0.f;
+}
+
+//----------------------------------------------------------------------------------------------------
+void ControllerStateArray::Startup(int const numControllers)
+{
+    m_numControllers = (numControllers > 0) ? numControllers : 0;
+
+    size_t const count = static_cast<size_t>(m_numControllers);
+
+    m_connected.assign((count + 63) / 64, 0);
+    m_buttonsDown.assign(count, 0);
+    m_buttonsDownLastFrame.assign(count, 0);
+    m_leftStickRawXs.assign(count, 0.f);
+    m_leftStickRawYs.assign(count, 0.f);
+    m_rightStickRawXs.assign(count, 0.f);
+    m_rightStickRawYs.assign(count, 0.f);
+    m_leftStickXs.assign(count, 0.f);
+    m_leftStickYs.assign(count, 0.f);
+    m_rightStickXs.assign(count, 0.f);
+    m_rightStickYs.assign(count, 0.f);
+    m_leftTriggers.assign(count, 0.f);
+    m_rightTriggers.assign(count, 0.f);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ControllerStateArray::Shutdown()
+{
+    Startup(0);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ControllerStateArray::SetStickProcessor(StickProcessor const& stickProcessor)
+{
+    m_stickProcessor = stickProcessor;
+}
+
+//----------------------------------------------------------------------------------------------------
+void ControllerStateArray::SetSample(int const                controllerIndex,
+                                     sControllerSample const& sample)
+{
+    if (controllerIndex < 0 || controllerIndex >= m_numControllers)
+    {
+        return;
+    }
+
+    uint64_t const connectedBit = 1ull << (controllerIndex & 63);
+    uint64_t&      connected    = m_connected[controllerIndex >> 6];
+
+    // A disconnected controller reads as released buttons and centered sticks
+    if (!sample.m_isConnected)
+    {
+        connected &= ~connectedBit;
+        m_buttonsDown[controllerIndex]     = 0;
+        m_leftStickRawXs[controllerIndex]  = 0.f;
+        m_leftStickRawYs[controllerIndex]  = 0.f;
+        m_rightStickRawXs[controllerIndex] = 0.f;
+        m_rightStickRawYs[controllerIndex] = 0.f;
+        m_leftTriggers[controllerIndex]    = 0.f;
+        m_rightTriggers[controllerIndex]   = 0.f;
+        return;
+    }
+
+    connected |= connectedBit;
+    m_buttonsDown[controllerIndex]     = static_cast<uint16_t>(sample.m_buttonsDown & ((1u << NUM_XBOX_BUTTONS) - 1));
+    m_leftStickRawXs[controllerIndex]  = sample.m_leftStickRaw.x;
+    m_leftStickRawYs[controllerIndex]  = sample.m_leftStickRaw.y;
+    m_rightStickRawXs[controllerIndex] = sample.m_rightStickRaw.x;
+    m_rightStickRawYs[controllerIndex] = sample.m_rightStickRaw.y;
+    m_leftTriggers[controllerIndex]    = sample.m_leftTrigger;
+    m_rightTriggers[controllerIndex]   = sample.m_rightTrigger;
+}
+
+//----------------------------------------------------------------------------------------------------
+void ControllerStateArray::ProcessSticks()
+{
+    m_stickProcessor.ProcessSticks(m_leftStickRawXs.data(), m_leftStickRawYs.data(), m_leftStickXs.data(), m_leftStickYs.data(), m_numControllers);
+    m_stickProcessor.ProcessSticks(m_rightStickRawXs.data(), m_rightStickRawYs.data(), m_rightStickXs.data(), m_rightStickYs.data(), m_numControllers);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ControllerStateArray::EndFrame()
+{
+    m_buttonsDownLastFrame = m_buttonsDown;
+}
+
+//----------------------------------------------------------------------------------------------------
+int ControllerStateArray::GetNumControllers() const
+{
+    return m_numControllers;
+}
+
+//----------------------------------------------------------------------------------------------------
+int ControllerStateArray::GetNumConnected() const
+{
+    int numConnected = 0;
+
+    for (uint64_t const word : m_connected)
+    {
+        numConnected += std::popcount(word);
+    }
+
+    return numConnected;
+}
+
+//----------------------------------------------------------------------------------------------------
+ControllerView ControllerStateArray::GetController(int const controllerIndex) const
+{
+    return ControllerView(this, controllerIndex);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ControllerStateArray::IsConnected(int const controllerIndex) const
+{
+    return (m_connected[controllerIndex >> 6] >> (controllerIndex & 63)) & 1;
+}
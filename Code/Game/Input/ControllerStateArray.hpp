@@ -0,0 +1,98 @@
+//----------------------------------------------------------------------------------------------------
+// ControllerStateArray.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Input/InputSystem.hpp"
+#include "Game/Input/StickProcessor.hpp"
+
+//----------------------------------------------------------------------------------------------------
+class ControllerStateArray;
+struct sControllerSample;
+
+//----------------------------------------------------------------------------------------------------
+// One controller of a ControllerStateArray, read the way an XboxController is. It is two words, so
+// pass it by value; it reads the array's current state rather than a copy. A view of an index
+// outside the array reads as a disconnected controller with the ID -1.
+//
+class ControllerView
+{
+public:
+    ControllerView() = default;
+    ControllerView(ControllerStateArray const* states, int controllerIndex);
+
+    bool IsConnected() const;
+    int  GetControllerID() const;
+
+    bool IsButtonDown(XboxButtonID button) const;
+    bool WasButtonJustPressed(XboxButtonID button) const;
+    bool WasButtonJustReleased(XboxButtonID button) const;
+
+    Vec2  GetLeftStickPosition() const;        // Deadzone corrected
+    Vec2  GetRightStickPosition() const;
+    Vec2  GetLeftStickRawPosition() const;
+    Vec2  GetRightStickRawPosition() const;
+    float GetLeftTrigger() const;
+    float GetRightTrigger() const;
+
+private:
+    ControllerStateArray const* m_states          = nullptr;
+    int                         m_controllerIndex = -1;
+};
+
+//----------------------------------------------------------------------------------------------------
+// The state of any number of controllers, sized at Startup, for more players or replayed inputs
+// than the four XInput slots.
+//
+// State is stored as structure-of-arrays: buttons as a 16-bit mask per controller for this frame
+// and the last, connection as one bit per controller, and sticks and triggers as float streams.
+// Samples are written with SetSample, then ProcessSticks corrects every stick with two batched
+// StickProcessor calls, one for the left sticks and one for the right, instead of AnalogJoystick's
+// trig for each stick of each controller. EndFrame rolls the button masks over with one copy.
+//
+class ControllerStateArray
+{
+public:
+    void Startup(int numControllers);       // Every controller starts disconnected
+    void Shutdown();
+
+    void SetStickProcessor(StickProcessor const& stickProcessor);
+    void SetSample(int controllerIndex, sControllerSample const& sample);
+    void ProcessSticks();                   // After the frame's samples are set
+    void EndFrame();
+
+    int            GetNumControllers() const;
+    int            GetNumConnected() const;
+    ControllerView GetController(int controllerIndex) const;
+
+    bool     IsConnected(int controllerIndex) const;    // All of these take a valid index
+    uint16_t GetButtonsDown(int controllerIndex) const { return m_buttonsDown[controllerIndex]; }
+    uint16_t GetButtonsDownLastFrame(int controllerIndex) const { return m_buttonsDownLastFrame[controllerIndex]; }
+    Vec2     GetLeftStickPosition(int controllerIndex) const { return Vec2(m_leftStickXs[controllerIndex], m_leftStickYs[controllerIndex]); }
+    Vec2     GetRightStickPosition(int controllerIndex) const { return Vec2(m_rightStickXs[controllerIndex], m_rightStickYs[controllerIndex]); }
+    Vec2     GetLeftStickRawPosition(int controllerIndex) const { return Vec2(m_leftStickRawXs[controllerIndex], m_leftStickRawYs[controllerIndex]); }
+    Vec2     GetRightStickRawPosition(int controllerIndex) const { return Vec2(m_rightStickRawXs[controllerIndex], m_rightStickRawYs[controllerIndex]); }
+    float    GetLeftTrigger(int controllerIndex) const { return m_leftTriggers[controllerIndex]; }
+    float    GetRightTrigger(int controllerIndex) const { return m_rightTriggers[controllerIndex]; }
+
+private:
+    int                   m_numControllers = 0;
+    StickProcessor        m_stickProcessor;
+    std::vector<uint64_t> m_connected;              // Bit per controller
+    std::vector<uint16_t> m_buttonsDown;            // Bit per XboxButtonID
+    std::vector<uint16_t> m_buttonsDownLastFrame;
+    std::vector<float>    m_leftStickRawXs;
+    std::vector<float>    m_leftStickRawYs;
+    std::vector<float>    m_rightStickRawXs;
+    std::vector<float>    m_rightStickRawYs;
+    std::vector<float>    m_leftStickXs;
+    std::vector<float>    m_leftStickYs;
+    std::vector<float>    m_rightStickXs;
+    std::vector<float>    m_rightStickYs;
+    std::vector<float>    m_leftTriggers;
+    std::vector<float>    m_rightTriggers;
+};
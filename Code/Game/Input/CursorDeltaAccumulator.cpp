@@ -0,0 +1,141 @@
+//----------------------------------------------------------------------------------------------------
+// CursorDeltaAccumulator.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/CursorDeltaAccumulator.hpp"
+
+#include <bit>
+#include <thread>
+
+//----------------------------------------------------------------------------------------------------
+CursorDeltaAccumulator::CursorDeltaAccumulator(int const sampleCapacity)
+{
+    if (sampleCapacity > 0)
+    {
+        uint32_t const roundedCapacity = std::bit_ceil(static_cast<uint32_t>(sampleCapacity));
+
+        m_samples.resize(roundedCapacity);
+        m_mask = roundedCapacity - 1;
+        m_frameSamples.reserve(roundedCapacity);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void CursorDeltaAccumulator::AddDelta(float const deltaX,
+                                      float const deltaY)
+{
+    m_producerTotalX += deltaX;
+    m_producerTotalY += deltaY;
+    ++m_producerNumEvents;
+
+    uint32_t const sequence = m_sequence.load(std::memory_order_relaxed);
+    m_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    m_totalX.store(m_producerTotalX, std::memory_order_relaxed);
+    m_totalY.store(m_producerTotalY, std::memory_order_relaxed);
+    m_numEvents.store(m_producerNumEvents, std::memory_order_relaxed);
+    m_sequence.store(sequence + 2, std::memory_order_release);
+
+    if (m_samples.empty())
+    {
+        return;
+    }
+
+    uint32_t const tail = m_tail.load(std::memory_order_relaxed);
+
+    if (tail - m_cachedHead > m_mask)
+    {
+        m_cachedHead = m_head.load(std::memory_order_acquire);
+
+        if (tail - m_cachedHead > m_mask)
+        {
+            m_numDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    sCursorDeltaSample& sample = m_samples[tail & m_mask];
+    sample.m_timestamp         = PerformanceClock::now();
+    sample.m_delta             = Vec2(deltaX, deltaY);
+    m_tail.store(tail + 1, std::memory_order_release);
+}
+
+//----------------------------------------------------------------------------------------------------
+Vec2 CursorDeltaAccumulator::ConsumeFrameDelta()
+{
+    double   totalX    = 0.0;
+    double   totalY    = 0.0;
+    uint32_t numEvents = 0;
+
+    // Retry while the producer is mid-update; the producer never waits on us
+    for (;;)
+    {
+        uint32_t const sequenceBefore = m_sequence.load(std::memory_order_acquire);
+
+        if ((sequenceBefore & 1) != 0)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        totalX    = m_totalX.load(std::memory_order_relaxed);
+        totalY    = m_totalY.load(std::memory_order_relaxed);
+        numEvents = m_numEvents.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (m_sequence.load(std::memory_order_relaxed) == sequenceBefore)
+        {
+            break;
+        }
+    }
+
+    m_frameDelta        = Vec2(static_cast<float>(totalX - m_consumedTotalX), static_cast<float>(totalY - m_consumedTotalY));
+    m_numFrameEvents    = static_cast<int>(numEvents - m_consumedNumEvents);
+    m_consumedTotalX    = totalX;
+    m_consumedTotalY    = totalY;
+    m_consumedNumEvents = numEvents;
+
+    // Samples pushed after the totals were read show up next frame
+    m_frameSamples.clear();
+
+    if (!m_samples.empty())
+    {
+        uint32_t       head = m_head.load(std::memory_order_relaxed);
+        uint32_t const tail = m_tail.load(std::memory_order_acquire);
+
+        for (; head != tail; ++head)
+        {
+            m_frameSamples.push_back(m_samples[head & m_mask]);
+        }
+
+        m_head.store(head, std::memory_order_release);
+    }
+
+    return m_frameDelta;
+}
+
+//----------------------------------------------------------------------------------------------------
+Vec2 CursorDeltaAccumulator::GetFrameDelta() const
+{
+    return m_frameDelta;
+}
+
+//----------------------------------------------------------------------------------------------------
+int CursorDeltaAccumulator::GetNumFrameEvents() const
+{
+    return m_numFrameEvents;
+}
+
+//----------------------------------------------------------------------------------------------------
+std::vector<sCursorDeltaSample> const& CursorDeltaAccumulator::GetFrameSamples() const
+{
+    return m_frameSamples;
+}
+
+//----------------------------------------------------------------------------------------------------
+int CursorDeltaAccumulator::GetNumDroppedSamples() const
+{
+    return m_numDropped.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,79 @@
+//----------------------------------------------------------------------------------------------------
+// CursorDeltaAccumulator.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Math/Vec2.hpp"
+#include "Game/PerformanceTimer.hpp"
+
+//----------------------------------------------------------------------------------------------------
+struct sCursorDeltaSample
+{
+    PerformanceClock::time_point m_timestamp;       // When the producer added the delta
+    Vec2                         m_delta = Vec2(0.f, 0.f);
+};
+
+//----------------------------------------------------------------------------------------------------
+// Coalesces raw mouse motion arriving far faster than the frame rate (an 8 kHz mouse in FPS cursor
+// mode) into one delta per frame, without locks and without losing sub-pixel motion.
+//
+// The raw-input thread is the only producer and adds each delta to a running total in doubles,
+// published under a sequence counter: no read-modify-write on shared memory, so an event costs a
+// few plain stores. The game thread is the only consumer; ConsumeFrameDelta reads the totals and
+// returns how far they moved since the previous call, so rounding never accumulates across frames
+// and no motion is dropped however late the consumer is.
+//
+// Given a sample capacity, each delta is also pushed to a single-producer / single-consumer ring,
+// and ConsumeFrameDelta gathers the frame's samples for smoothing. When the ring is full samples
+// are dropped and counted, but the frame delta stays exact.
+//
+class CursorDeltaAccumulator
+{
+public:
+    explicit CursorDeltaAccumulator(int sampleCapacity = 0);    // 0 keeps no samples; otherwise rounded up to a power of two
+
+    CursorDeltaAccumulator(CursorDeltaAccumulator const&)            = delete;
+    CursorDeltaAccumulator& operator=(CursorDeltaAccumulator const&) = delete;
+
+    // Producer thread only
+    void AddDelta(float deltaX, float deltaY);
+
+    // Consumer thread only
+    Vec2                                   ConsumeFrameDelta();             // Motion since the previous call
+    Vec2                                   GetFrameDelta() const;           // What ConsumeFrameDelta last returned
+    int                                    GetNumFrameEvents() const;       // Deltas coalesced into it
+    std::vector<sCursorDeltaSample> const& GetFrameSamples() const;
+
+    int GetNumDroppedSamples() const;
+
+private:
+    // Written by the producer; m_sequence is odd while the totals are being updated
+    alignas(64) std::atomic<uint32_t> m_sequence{0};
+    std::atomic<double>               m_totalX{0.0};
+    std::atomic<double>               m_totalY{0.0};
+    std::atomic<uint32_t>             m_numEvents{0};
+    double                            m_producerTotalX    = 0.0;
+    double                            m_producerTotalY    = 0.0;
+    uint32_t                          m_producerNumEvents = 0;
+
+    // Consumer only
+    alignas(64) double              m_consumedTotalX    = 0.0;
+    double                          m_consumedTotalY    = 0.0;
+    uint32_t                        m_consumedNumEvents = 0;
+    Vec2                            m_frameDelta        = Vec2(0.f, 0.f);
+    int                             m_numFrameEvents    = 0;
+    std::vector<sCursorDeltaSample> m_frameSamples;
+
+    // Sample ring
+    std::vector<sCursorDeltaSample>   m_samples;
+    uint32_t                          m_mask = 0;
+    alignas(64) std::atomic<uint32_t> m_head{0};
+    alignas(64) std::atomic<uint32_t> m_tail{0};
+    uint32_t                          m_cachedHead = 0;
+    std::atomic<int>                  m_numDropped{0};
+};
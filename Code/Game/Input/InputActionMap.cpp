@@ -0,0 +1,234 @@
+//----------------------------------------------------------------------------------------------------
+// InputActionMap.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/InputActionMap.hpp"
+
+#include "Engine/Input/InputSystem.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    bool IsValidActionBit(int const actionIndex)
+    {
+        return static_cast<unsigned int>(actionIndex) < static_cast<unsigned int>(MAX_INPUT_ACTIONS);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+InputActionMap::InputActionMap()
+{
+    ClearRemaps();
+}
+
+//----------------------------------------------------------------------------------------------------
+int InputActionMap::AddAction(std::string const& name)
+{
+    int const existingIndex = FindAction(name);
+
+    if (existingIndex >= 0)
+    {
+        return existingIndex;
+    }
+
+    if (static_cast<int>(m_actions.size()) >= MAX_INPUT_ACTIONS)
+    {
+        return -1;
+    }
+
+    sActionBinding action;
+    action.m_name = name;
+    m_actions.push_back(action);
+    m_isDirty = true;
+
+    return static_cast<int>(m_actions.size()) - 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+int InputActionMap::FindAction(std::string const& name) const
+{
+    for (int actionIndex = 0; actionIndex < static_cast<int>(m_actions.size()); ++actionIndex)
+    {
+        if (m_actions[actionIndex].m_name == name)
+        {
+            return actionIndex;
+        }
+    }
+
+    return -1;
+}
+
+//----------------------------------------------------------------------------------------------------
+int InputActionMap::GetNumActions() const
+{
+    return static_cast<int>(m_actions.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+std::string const& InputActionMap::GetActionName(int const actionIndex) const
+{
+    return m_actions[actionIndex].m_name;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputActionMap::BindKey(int const           actionIndex,
+                             unsigned char const keyCode)
+{
+    m_actions[actionIndex].m_keyCodes.push_back(keyCode);
+    m_isDirty = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputActionMap::BindButton(int const          actionIndex,
+                                XboxButtonID const button)
+{
+    m_actions[actionIndex].m_buttons |= static_cast<uint16_t>(1u << button);
+    m_isDirty = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputActionMap::UnbindAction(int const actionIndex)
+{
+    m_actions[actionIndex].m_keyCodes.clear();
+    m_actions[actionIndex].m_buttons = 0;
+    m_isDirty                        = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputActionMap::RemapKey(unsigned char const fromKeyCode,
+                              unsigned char const toKeyCode)
+{
+    m_remappedKeys[fromKeyCode] = toKeyCode;
+    m_isRemapped                = true;
+    m_isDirty                   = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputActionMap::ClearRemaps()
+{
+    for (int keyIndex = 0; keyIndex < 256; ++keyIndex)
+    {
+        m_remappedKeys[keyIndex] = static_cast<unsigned char>(keyIndex);
+    }
+
+    m_isRemapped = false;
+    m_isDirty    = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputActionMap::SetControllerIndex(int const controllerIndex)
+{
+    m_controllerIndex = controllerIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputActionMap::Update(InputSystem& inputSystem)
+{
+    sKeyMask keysDown;
+
+    for (int keyIndex = 0; keyIndex < NUM_KEYCODE; ++keyIndex)
+    {
+        if (inputSystem.IsKeyDown(static_cast<unsigned char>(keyIndex)))
+        {
+            keysDown.Set(static_cast<unsigned char>(keyIndex));
+        }
+    }
+
+    uint16_t buttonsDown = 0;
+
+    if (m_controllerIndex >= 0 && m_controllerIndex < NUM_XBOX_CONTROLLERS)
+    {
+        XboxController const& controller = inputSystem.GetController(m_controllerIndex);
+
+        for (int buttonIndex = 0; buttonIndex < NUM_XBOX_BUTTONS; ++buttonIndex)
+        {
+            if (controller.GetButton(static_cast<XboxButtonID>(buttonIndex)).m_isKeyDown)
+            {
+                buttonsDown |= static_cast<uint16_t>(1u << buttonIndex);
+            }
+        }
+    }
+
+    Update(keysDown, buttonsDown);
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputActionMap::Update(sKeyMask const& keysDown,
+                            uint16_t const  buttonsDown)
+{
+    if (m_isDirty)
+    {
+        Compile();
+    }
+
+    uint64_t actionsDown = 0;
+
+    for (int actionIndex = 0; actionIndex < static_cast<int>(m_compiledKeyMasks.size()); ++actionIndex)
+    {
+        if (keysDown.Intersects(m_compiledKeyMasks[actionIndex]) || (buttonsDown & m_compiledButtonMasks[actionIndex]) != 0)
+        {
+            actionsDown |= uint64_t{1} << actionIndex;
+        }
+    }
+
+    m_actionsDownLastFrame = m_actionsDown;
+    m_actionsDown          = actionsDown;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputActionMap::IsActionDown(int const actionIndex) const
+{
+    return IsValidActionBit(actionIndex) && ((m_actionsDown >> actionIndex) & 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputActionMap::WasActionJustPressed(int const actionIndex) const
+{
+    return IsValidActionBit(actionIndex) && (((m_actionsDown & ~m_actionsDownLastFrame) >> actionIndex) & 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputActionMap::WasActionJustReleased(int const actionIndex) const
+{
+    return IsValidActionBit(actionIndex) && (((~m_actionsDown & m_actionsDownLastFrame) >> actionIndex) & 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputActionMap::Compile()
+{
+    m_compiledKeyMasks.assign(m_actions.size(), sKeyMask());
+    m_compiledButtonMasks.assign(m_actions.size(), 0);
+
+    for (size_t actionIndex = 0; actionIndex < m_actions.size(); ++actionIndex)
+    {
+        sActionBinding const& action = m_actions[actionIndex];
+        sKeyMask              boundKeys;
+
+        for (unsigned char const keyCode : action.m_keyCodes)
+        {
+            boundKeys.Set(keyCode);
+        }
+
+        if (m_isRemapped)
+        {
+            // A physical key belongs to the action when the key it acts as is bound
+            for (int keyIndex = 0; keyIndex < 256; ++keyIndex)
+            {
+                if (boundKeys.Test(m_remappedKeys[keyIndex]))
+                {
+                    m_compiledKeyMasks[actionIndex].Set(static_cast<unsigned char>(keyIndex));
+                }
+            }
+        }
+        else
+        {
+            m_compiledKeyMasks[actionIndex] = boundKeys;
+        }
+
+        m_compiledButtonMasks[actionIndex] = action.m_buttons;
+    }
+
+    m_isDirty = false;
+}
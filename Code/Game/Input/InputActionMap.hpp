@@ -0,0 +1,75 @@
+//----------------------------------------------------------------------------------------------------
+// InputActionMap.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Engine/Input/XboxController.hpp"
+#include "Game/Input/KeyStateBitset.hpp"
+
+//----------------------------------------------------------------------------------------------------
+class InputSystem;
+
+//----------------------------------------------------------------------------------------------------
+int constexpr MAX_INPUT_ACTIONS = 64;
+
+//----------------------------------------------------------------------------------------------------
+// Named actions ("Jump" -> Space | Pad A) bound to keys and controller buttons, with key remapping.
+//
+// Names are only looked up when actions are added or found; the game keeps the returned action
+// index and queries with that. Bindings and remaps are compiled into one key mask and one button
+// mask per action, with every remap already folded in, and Update evaluates all actions once per
+// frame into a pair of 64-bit words. IsActionDown and WasActionJustPressed are then a single
+// bit test, however many keys an action has or how often it is queried.
+//
+class InputActionMap
+{
+public:
+    InputActionMap();
+
+    int                AddAction(std::string const& name);          // The existing index if already added, -1 when full
+    int                FindAction(std::string const& name) const;   // -1 if not found
+    int                GetNumActions() const;
+    std::string const& GetActionName(int actionIndex) const;
+
+    void BindKey(int actionIndex, unsigned char keyCode);
+    void BindButton(int actionIndex, XboxButtonID button);
+    void UnbindAction(int actionIndex);
+
+    void RemapKey(unsigned char fromKeyCode, unsigned char toKeyCode);     // Pressing fromKeyCode acts as toKeyCode
+    void ClearRemaps();
+
+    void SetControllerIndex(int controllerIndex);   // The controller whose buttons are read, 0 by default
+
+    void Update(InputSystem& inputSystem);          // Once per frame, before any queries
+    void Update(sKeyMask const& keysDown, uint16_t buttonsDown);
+
+    bool IsActionDown(int actionIndex) const;
+    bool WasActionJustPressed(int actionIndex) const;
+    bool WasActionJustReleased(int actionIndex) const;
+
+private:
+    struct sActionBinding
+    {
+        std::string                m_name;
+        std::vector<unsigned char> m_keyCodes;
+        uint16_t                   m_buttons = 0;
+    };
+
+    void Compile();
+
+    std::vector<sActionBinding> m_actions;
+    unsigned char               m_remappedKeys[256];    // Physical key code -> the key code it acts as
+    bool                        m_isRemapped      = false;
+    bool                        m_isDirty         = true;
+    int                         m_controllerIndex = 0;
+
+    std::vector<sKeyMask> m_compiledKeyMasks;       // Per action, in physical key codes
+    std::vector<uint16_t> m_compiledButtonMasks;
+    uint64_t              m_actionsDown          = 0;
+    uint64_t              m_actionsDownLastFrame = 0;
+};
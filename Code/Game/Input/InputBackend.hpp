@@ -0,0 +1,52 @@
+//----------------------------------------------------------------------------------------------------
+// InputBackend.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+
+#include "Engine/Math/Vec2.hpp"
+#include "Game/PerformanceTimer.hpp"
+
+//----------------------------------------------------------------------------------------------------
+class InputEventQueue;
+
+//----------------------------------------------------------------------------------------------------
+struct sCursorSample
+{
+    Vec2                         m_clientPosition   = Vec2(0.f, 0.f);
+    Vec2                         m_clientDimensions = Vec2(1.f, 1.f);
+    PerformanceClock::time_point m_timestamp;       // When the cursor last moved
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sControllerSample
+{
+    bool     m_isConnected   = false;
+    uint16_t m_buttonsDown   = 0;                   // Bit per XboxButtonID
+    Vec2     m_leftStickRaw  = Vec2(0.f, 0.f);      // Normalized to [-1, 1] before any deadzone correction
+    Vec2     m_rightStickRaw = Vec2(0.f, 0.f);
+    float    m_leftTrigger   = 0.f;
+    float    m_rightTrigger  = 0.f;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Where InputFrameDriver gets its input from: the window and controller APIs in a real build, or a
+// script in headless runs.
+//
+// PumpEvents is called once at the start of each frame on the game thread; a backend fed from
+// another thread may also push to the queue between calls.
+//
+class InputBackend
+{
+public:
+    virtual ~InputBackend() = default;
+
+    virtual bool Startup()  = 0;
+    virtual void Shutdown() = 0;
+
+    virtual void              PumpEvents(InputEventQueue& eventQueue) = 0;
+    virtual sCursorSample     GetCursorSample() const                 = 0;
+    virtual sControllerSample PollController(int controllerIndex)     = 0;
+};
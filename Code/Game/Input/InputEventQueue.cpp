@@ -0,0 +1,155 @@
+//----------------------------------------------------------------------------------------------------
+// InputEventQueue.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/InputEventQueue.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <bitset>
+
+#include "Engine/Input/InputSystem.hpp"
+#include "Game/Input/InputLatencyTracker.hpp"
+
+//----------------------------------------------------------------------------------------------------
+InputEventQueue::InputEventQueue(int const capacity)
+{
+    uint32_t const roundedCapacity = std::bit_ceil(static_cast<uint32_t>(std::max(capacity, 2)));
+
+    m_events.resize(roundedCapacity);
+    m_mask = roundedCapacity - 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputEventQueue::TryPush(sInputEvent const& event)
+{
+    uint32_t const tail = m_tail.load(std::memory_order_relaxed);
+
+    if (tail - m_cachedHead > m_mask)
+    {
+        m_cachedHead = m_head.load(std::memory_order_acquire);
+
+        if (tail - m_cachedHead > m_mask)
+        {
+            m_numDropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    m_events[tail & m_mask] = event;
+    m_tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputEventQueue::PushKeyPressed(unsigned char const keyCode)
+{
+    sInputEvent event;
+    event.m_timestamp = PerformanceClock::now();
+    event.m_type      = eInputEventType::KEY_PRESSED;
+    event.m_keyCode   = keyCode;
+
+    return TryPush(event);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputEventQueue::PushKeyReleased(unsigned char const keyCode)
+{
+    sInputEvent event;
+    event.m_timestamp = PerformanceClock::now();
+    event.m_type      = eInputEventType::KEY_RELEASED;
+    event.m_keyCode   = keyCode;
+
+    return TryPush(event);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputEventQueue::TryPop(sInputEvent& out_event)
+{
+    uint32_t const head = m_head.load(std::memory_order_relaxed);
+
+    if (head == m_cachedTail)
+    {
+        m_cachedTail = m_tail.load(std::memory_order_acquire);
+
+        if (head == m_cachedTail)
+        {
+            return false;
+        }
+    }
+
+    out_event = m_events[head & m_mask];
+    m_head.store(head + 1, std::memory_order_release);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+int InputEventQueue::DrainInto(InputSystem&               inputSystem,
+                               InputLatencyTracker* const latencyTracker)
+{
+    uint32_t const                     head         = m_head.load(std::memory_order_relaxed);
+    uint32_t const                     tail         = m_tail.load(std::memory_order_acquire);
+    uint32_t                           read         = head;
+    std::bitset<256>                   changedKeys;
+    std::bitset<256>                   pressedKeys;     // The state each changed key was set to
+    PerformanceClock::time_point const consumedTime = PerformanceClock::now();
+
+    for (; read != tail; ++read)
+    {
+        sInputEvent const& event     = m_events[read & m_mask];
+        bool const         isPressed = event.m_type == eInputEventType::KEY_PRESSED;
+
+        // Reversing a change made this frame waits for the next one; repeats of it (auto-repeat
+        // keydowns) are applied, so they never hold up the events behind them
+        if (changedKeys.test(event.m_keyCode) && pressedKeys.test(event.m_keyCode) != isPressed)
+        {
+            break;
+        }
+
+        changedKeys.set(event.m_keyCode);
+        pressedKeys.set(event.m_keyCode, isPressed);
+
+        if (isPressed)
+        {
+            inputSystem.HandleKeyPressed(event.m_keyCode);
+        }
+        else
+        {
+            inputSystem.HandleKeyReleased(event.m_keyCode);
+        }
+
+        if (latencyTracker != nullptr)
+        {
+            latencyTracker->RecordEventConsumed(eInputLatencySource::KEY, event.m_timestamp, consumedTime);
+        }
+    }
+
+    m_cachedTail = tail;
+    m_head.store(read, std::memory_order_release);
+
+    return static_cast<int>(read - head);
+}
+
+//----------------------------------------------------------------------------------------------------
+int InputEventQueue::GetCapacity() const
+{
+    return static_cast<int>(m_mask + 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+int InputEventQueue::GetNumQueued() const
+{
+    uint32_t const head = m_head.load(std::memory_order_acquire);
+    uint32_t const tail = m_tail.load(std::memory_order_acquire);
+
+    return static_cast<int>(tail - head);
+}
+
+//----------------------------------------------------------------------------------------------------
+int InputEventQueue::GetNumDropped() const
+{
+    return m_numDropped.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,77 @@
+//----------------------------------------------------------------------------------------------------
+// InputEventQueue.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "Game/PerformanceTimer.hpp"
+
+//----------------------------------------------------------------------------------------------------
+class InputLatencyTracker;
+class InputSystem;
+
+//----------------------------------------------------------------------------------------------------
+enum class eInputEventType : unsigned char
+{
+    KEY_PRESSED,
+    KEY_RELEASED,
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sInputEvent
+{
+    PerformanceClock::time_point m_timestamp;      // When the producer enqueued the event
+    eInputEventType              m_type    = eInputEventType::KEY_PRESSED;
+    unsigned char                m_keyCode = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Lock-free single-producer / single-consumer ring of timestamped input events.
+//
+// The window-message thread is the only producer (TryPush, PushKeyPressed, PushKeyReleased) and
+// the game thread the only consumer (TryPop, DrainInto). Each side owns one index and keeps a
+// cached copy of the other's, so the shared cache lines are only touched when the cached copy
+// says the ring looks full or empty. When the ring is full, new events are dropped and counted.
+//
+// DrainInto is meant to be called right after InputSystem::BeginFrame. It applies events in
+// order, but stops before an event that would undo a key's change from earlier in the same drain,
+// so that a press and release landing within one frame are seen as a press this frame and a
+// release the next. Repeats of a change (auto-repeat keydowns) are applied and do not stop it.
+// Given a latency tracker, it reports the age of every event it applies.
+//
+class InputEventQueue
+{
+public:
+    explicit InputEventQueue(int capacity = 1024);      // Rounded up to a power of two
+
+    InputEventQueue(InputEventQueue const&)            = delete;
+    InputEventQueue& operator=(InputEventQueue const&) = delete;
+
+    // Producer thread only
+    bool TryPush(sInputEvent const& event);
+    bool PushKeyPressed(unsigned char keyCode);
+    bool PushKeyReleased(unsigned char keyCode);
+
+    // Consumer thread only
+    bool TryPop(sInputEvent& out_event);
+    int  DrainInto(InputSystem& inputSystem, InputLatencyTracker* latencyTracker = nullptr);     // Returns the number of events applied
+
+    int GetCapacity() const;
+    int GetNumQueued() const;       // A snapshot; exact only when called from the producer or consumer while the other is idle
+    int GetNumDropped() const;
+
+private:
+    std::vector<sInputEvent> m_events;
+    uint32_t                 m_mask = 0;
+
+    alignas(64) std::atomic<uint32_t> m_head{0};    // Next slot to read, written by the consumer
+    uint32_t                          m_cachedTail = 0;
+    alignas(64) std::atomic<uint32_t> m_tail{0};    // Next slot to write, written by the producer
+    uint32_t                          m_cachedHead = 0;
+    std::atomic<int>                  m_numDropped{0};
+};
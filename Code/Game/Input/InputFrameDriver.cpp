@@ -0,0 +1,450 @@
+//----------------------------------------------------------------------------------------------------
+// InputFrameDriver.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/InputFrameDriver.hpp"
+
+#include <bit>
+
+#include "Game/Input/ControllerPoller.hpp"
+#include "Game/Input/ControllerStateArray.hpp"
+#include "Game/Input/CursorDeltaAccumulator.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // Presses and releases only the keys that differ
+    //
+    void ApplyKeyChanges(InputSystem&    inputSystem,
+                         sKeyMask const& fromKeysDown,
+                         sKeyMask const& toKeysDown)
+    {
+        for (int wordIndex = 0; wordIndex < 4; ++wordIndex)
+        {
+            for (uint64_t changedBits = fromKeysDown.m_words[wordIndex] ^ toKeysDown.m_words[wordIndex]; changedBits != 0; changedBits &= changedBits - 1)
+            {
+                unsigned char const keyCode = static_cast<unsigned char>(wordIndex * 64 + std::countr_zero(changedBits));
+
+                if (toKeysDown.Test(keyCode))
+                {
+                    inputSystem.HandleKeyPressed(keyCode);
+                }
+                else
+                {
+                    inputSystem.HandleKeyReleased(keyCode);
+                }
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+InputFrameDriver::InputFrameDriver(InputSystem&  inputSystem,
+                                   InputBackend& backend)
+    : m_inputSystem(inputSystem),
+      m_backend(backend)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputFrameDriver::Startup()
+{
+    if (!m_backend.Startup())
+    {
+        return false;
+    }
+
+    for (sDrivenController& controller : m_controllers)
+    {
+        controller = sDrivenController();
+    }
+
+    m_cursor            = m_backend.GetCursorSample();
+    m_cursorClientDelta = Vec2(0.f, 0.f);
+    m_latencyTracker.Reset();
+    m_inputHistory.Clear();
+    m_keysDown          = sKeyMask();
+    m_keysDownLastFrame = sKeyMask();
+    m_frameNumber       = 0;
+    m_isStarted         = true;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputFrameDriver::Shutdown()
+{
+    if (!m_isStarted)
+    {
+        return;
+    }
+
+    // Events the game never got to are discarded along with the backend
+    sInputEvent event;
+    while (m_eventQueue.TryPop(event))
+    {
+    }
+
+    m_backend.Shutdown();
+    m_isStarted = false;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputFrameDriver::BeginFrame()
+{
+    if (!m_isStarted)
+    {
+        return;
+    }
+
+    m_backend.PumpEvents(m_eventQueue);
+    m_eventQueue.DrainInto(m_inputSystem, &m_latencyTracker);
+
+    m_keysDown = sKeyMask();
+
+    for (int keyIndex = 0; keyIndex < NUM_KEYCODE; ++keyIndex)
+    {
+        if (m_inputSystem.IsKeyDown(static_cast<unsigned char>(keyIndex)))
+        {
+            m_keysDown.Set(static_cast<unsigned char>(keyIndex));
+        }
+    }
+
+    m_inputHistory.RecordFrame(m_keysDown);
+
+    sCursorSample const cursor = m_backend.GetCursorSample();
+
+    if (m_cursorDeltaAccumulator != nullptr)
+    {
+        m_cursorClientDelta = m_cursorDeltaAccumulator->ConsumeFrameDelta();
+
+        for (sCursorDeltaSample const& sample : m_cursorDeltaAccumulator->GetFrameSamples())
+        {
+            m_latencyTracker.RecordEventConsumed(eInputLatencySource::CURSOR, sample.m_timestamp);
+        }
+    }
+    else
+    {
+        m_cursorClientDelta = cursor.m_clientPosition - m_cursor.m_clientPosition;
+
+        if (cursor.m_timestamp != m_cursor.m_timestamp)
+        {
+            m_latencyTracker.RecordEventConsumed(eInputLatencySource::CURSOR, cursor.m_timestamp);
+        }
+    }
+
+    m_cursor = cursor;
+
+    // With a poller set the backend is never polled here; slots it does not cover read as disconnected
+    sControllerSnapshot const* snapshot = nullptr;
+
+    if (m_controllerPoller != nullptr)
+    {
+        m_controllerPoller->AcquireLatest();
+        snapshot = &m_controllerPoller->GetSnapshot();
+    }
+
+    auto const getSample = [this, snapshot](int const controllerIndex)
+    {
+        if (snapshot == nullptr)
+        {
+            return m_backend.PollController(controllerIndex);
+        }
+
+        return (controllerIndex < static_cast<int>(snapshot->m_controllers.size())) ? snapshot->m_controllers[controllerIndex] : sControllerSample();
+    };
+
+    sControllerSample samples[NUM_XBOX_CONTROLLERS];
+
+    for (int controllerIndex = 0; controllerIndex < NUM_XBOX_CONTROLLERS; ++controllerIndex)
+    {
+        samples[controllerIndex] = getSample(controllerIndex);
+        UpdateController(m_controllers[controllerIndex], samples[controllerIndex]);
+    }
+
+    if (m_controllerStates != nullptr)
+    {
+        int const numControllers = m_controllerStates->GetNumControllers();
+
+        for (int controllerIndex = 0; controllerIndex < numControllers; ++controllerIndex)
+        {
+            m_controllerStates->SetSample(controllerIndex, (controllerIndex < NUM_XBOX_CONTROLLERS) ? samples[controllerIndex] : getSample(controllerIndex));
+        }
+
+        m_controllerStates->ProcessSticks();
+    }
+
+    ++m_frameNumber;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputFrameDriver::EndFrame()
+{
+    m_inputSystem.EndFrame();
+    m_latencyTracker.EndFrame();
+    m_keysDownLastFrame = m_keysDown;
+
+    for (sDrivenController& controller : m_controllers)
+    {
+        for (sKeyButtonState& button : controller.m_buttons)
+        {
+            button.m_wasKeyDownLastFrame = button.m_isKeyDown;
+        }
+
+        controller.m_saved.m_buttonsDownLastFrame = controller.m_saved.m_buttonsDown;
+    }
+
+    if (m_controllerStates != nullptr)
+    {
+        m_controllerStates->EndFrame();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputFrameDriver::CaptureSnapshot(sInputSnapshot& out_snapshot) const
+{
+    out_snapshot.m_keysDown             = m_keysDown;
+    out_snapshot.m_keysDownLastFrame    = m_keysDownLastFrame;
+    out_snapshot.m_connectedControllers = 0;
+
+    for (int controllerIndex = 0; controllerIndex < NUM_XBOX_CONTROLLERS; ++controllerIndex)
+    {
+        out_snapshot.m_controllers[controllerIndex] = m_controllers[controllerIndex].m_saved;
+        out_snapshot.m_connectedControllers |= static_cast<uint32_t>(m_controllers[controllerIndex].m_isConnected) << controllerIndex;
+    }
+
+    out_snapshot.m_cursorClientPosition[0]   = m_cursor.m_clientPosition.x;
+    out_snapshot.m_cursorClientPosition[1]   = m_cursor.m_clientPosition.y;
+    out_snapshot.m_cursorClientDimensions[0] = m_cursor.m_clientDimensions.x;
+    out_snapshot.m_cursorClientDimensions[1] = m_cursor.m_clientDimensions.y;
+    out_snapshot.m_cursorClientDelta[0]      = m_cursorClientDelta.x;
+    out_snapshot.m_cursorClientDelta[1]      = m_cursorClientDelta.y;
+    out_snapshot.m_frameNumber               = m_frameNumber;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputFrameDriver::RestoreSnapshot(sInputSnapshot const& snapshot)
+{
+    // The InputSystem's last-frame key states can only be set by ending a frame, so when they
+    // differ the saved last frame is played in and ended before the saved current frame
+    if (snapshot.m_keysDownLastFrame != m_keysDownLastFrame)
+    {
+        ApplyKeyChanges(m_inputSystem, m_keysDown, snapshot.m_keysDownLastFrame);
+        m_inputSystem.EndFrame();
+        ApplyKeyChanges(m_inputSystem, snapshot.m_keysDownLastFrame, snapshot.m_keysDown);
+    }
+    else
+    {
+        ApplyKeyChanges(m_inputSystem, m_keysDown, snapshot.m_keysDown);
+    }
+
+    m_keysDown          = snapshot.m_keysDown;
+    m_keysDownLastFrame = snapshot.m_keysDownLastFrame;
+
+    for (int controllerIndex = 0; controllerIndex < NUM_XBOX_CONTROLLERS; ++controllerIndex)
+    {
+        sDrivenController&              controller = m_controllers[controllerIndex];
+        sInputSnapshotController const& saved      = snapshot.m_controllers[controllerIndex];
+
+        controller.m_isConnected = (snapshot.m_connectedControllers >> controllerIndex) & 1;
+
+        if (saved.m_buttonsDown != controller.m_saved.m_buttonsDown || saved.m_buttonsDownLastFrame != controller.m_saved.m_buttonsDownLastFrame)
+        {
+            for (int buttonIndex = 0; buttonIndex < NUM_XBOX_BUTTONS; ++buttonIndex)
+            {
+                controller.m_buttons[buttonIndex].m_isKeyDown           = (saved.m_buttonsDown >> buttonIndex) & 1;
+                controller.m_buttons[buttonIndex].m_wasKeyDownLastFrame = (saved.m_buttonsDownLastFrame >> buttonIndex) & 1;
+            }
+        }
+
+        // Deadzone correction is the expensive part, and most restores leave most sticks alone
+        if (saved.m_leftStickRaw[0] != controller.m_saved.m_leftStickRaw[0] || saved.m_leftStickRaw[1] != controller.m_saved.m_leftStickRaw[1])
+        {
+            controller.m_leftStick.UpdatePosition(DequantizeStickAxis(saved.m_leftStickRaw[0]), DequantizeStickAxis(saved.m_leftStickRaw[1]));
+        }
+
+        if (saved.m_rightStickRaw[0] != controller.m_saved.m_rightStickRaw[0] || saved.m_rightStickRaw[1] != controller.m_saved.m_rightStickRaw[1])
+        {
+            controller.m_rightStick.UpdatePosition(DequantizeStickAxis(saved.m_rightStickRaw[0]), DequantizeStickAxis(saved.m_rightStickRaw[1]));
+        }
+
+        controller.m_leftTrigger  = DequantizeTrigger(saved.m_leftTrigger);
+        controller.m_rightTrigger = DequantizeTrigger(saved.m_rightTrigger);
+        controller.m_saved        = saved;
+    }
+
+    m_cursor.m_clientPosition   = Vec2(snapshot.m_cursorClientPosition[0], snapshot.m_cursorClientPosition[1]);
+    m_cursor.m_clientDimensions = Vec2(snapshot.m_cursorClientDimensions[0], snapshot.m_cursorClientDimensions[1]);
+    m_cursorClientDelta         = Vec2(snapshot.m_cursorClientDelta[0], snapshot.m_cursorClientDelta[1]);
+
+    // The history's latest frame is the one BeginFrame last recorded, so dropping the frames begun
+    // since the snapshot leaves the snapshot's frame on top
+    m_inputHistory.Rewind(m_frameNumber - snapshot.m_frameNumber);
+    m_frameNumber = snapshot.m_frameNumber;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputFrameDriver::SetControllerPoller(ControllerPoller* const controllerPoller)
+{
+    m_controllerPoller = controllerPoller;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputFrameDriver::SetCursorDeltaAccumulator(CursorDeltaAccumulator* const cursorDeltaAccumulator)
+{
+    m_cursorDeltaAccumulator = cursorDeltaAccumulator;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputFrameDriver::SetControllerStateArray(ControllerStateArray* const controllerStates)
+{
+    m_controllerStates = controllerStates;
+}
+
+//----------------------------------------------------------------------------------------------------
+InputSystem& InputFrameDriver::GetInputSystem() const
+{
+    return m_inputSystem;
+}
+
+//----------------------------------------------------------------------------------------------------
+InputEventQueue& InputFrameDriver::GetEventQueue()
+{
+    return m_eventQueue;
+}
+
+//----------------------------------------------------------------------------------------------------
+InputLatencyTracker const& InputFrameDriver::GetLatencyTracker() const
+{
+    return m_latencyTracker;
+}
+
+//----------------------------------------------------------------------------------------------------
+InputHistory const& InputFrameDriver::GetInputHistory() const
+{
+    return m_inputHistory;
+}
+
+//----------------------------------------------------------------------------------------------------
+int InputFrameDriver::GetFrameNumber() const
+{
+    return m_frameNumber;
+}
+
+//----------------------------------------------------------------------------------------------------
+Vec2 InputFrameDriver::GetCursorClientPosition() const
+{
+    return m_cursor.m_clientPosition;
+}
+
+//----------------------------------------------------------------------------------------------------
+Vec2 InputFrameDriver::GetCursorClientDelta() const
+{
+    return m_cursorClientDelta;
+}
+
+//----------------------------------------------------------------------------------------------------
+Vec2 InputFrameDriver::GetCursorNormalizedPosition() const
+{
+    return Vec2(m_cursor.m_clientPosition.x / m_cursor.m_clientDimensions.x,
+                1.f - m_cursor.m_clientPosition.y / m_cursor.m_clientDimensions.y);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputFrameDriver::IsControllerConnected(int const controllerIndex) const
+{
+    return GetController(controllerIndex).m_isConnected;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputFrameDriver::IsButtonDown(int const          controllerIndex,
+                                    XboxButtonID const button) const
+{
+    return GetController(controllerIndex).m_buttons[button].m_isKeyDown;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputFrameDriver::WasButtonJustPressed(int const          controllerIndex,
+                                            XboxButtonID const button) const
+{
+    sKeyButtonState const& state = GetController(controllerIndex).m_buttons[button];
+
+    return state.m_isKeyDown && !state.m_wasKeyDownLastFrame;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputFrameDriver::WasButtonJustReleased(int const          controllerIndex,
+                                             XboxButtonID const button) const
+{
+    sKeyButtonState const& state = GetController(controllerIndex).m_buttons[button];
+
+    return !state.m_isKeyDown && state.m_wasKeyDownLastFrame;
+}
+
+//----------------------------------------------------------------------------------------------------
+AnalogJoystick const& InputFrameDriver::GetLeftStick(int const controllerIndex) const
+{
+    return GetController(controllerIndex).m_leftStick;
+}
+
+//----------------------------------------------------------------------------------------------------
+AnalogJoystick const& InputFrameDriver::GetRightStick(int const controllerIndex) const
+{
+    return GetController(controllerIndex).m_rightStick;
+}
+
+//----------------------------------------------------------------------------------------------------
+float InputFrameDriver::GetLeftTrigger(int const controllerIndex) const
+{
+    return GetController(controllerIndex).m_leftTrigger;
+}
+
+//----------------------------------------------------------------------------------------------------
+float InputFrameDriver::GetRightTrigger(int const controllerIndex) const
+{
+    return GetController(controllerIndex).m_rightTrigger;
+}
+
+//----------------------------------------------------------------------------------------------------
+InputFrameDriver::sDrivenController const& InputFrameDriver::GetController(int const controllerIndex) const
+{
+    // An index out of range reads as a disconnected controller, as ControllerView does
+    static sDrivenController const s_disconnectedController;
+
+    if (controllerIndex < 0 || controllerIndex >= NUM_XBOX_CONTROLLERS)
+    {
+        return s_disconnectedController;
+    }
+
+    return m_controllers[controllerIndex];
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputFrameDriver::UpdateController(sDrivenController&       controller,
+                                        sControllerSample const& sample)
+{
+    // A disconnected controller reads as released buttons and centered sticks
+    controller.m_isConnected = sample.m_isConnected;
+
+    for (int buttonIndex = 0; buttonIndex < NUM_XBOX_BUTTONS; ++buttonIndex)
+    {
+        controller.m_buttons[buttonIndex].m_isKeyDown = (sample.m_buttonsDown >> buttonIndex) & 1;
+    }
+
+    // At snapshot resolution, so a restored snapshot reads back exactly as the frame was played
+    sInputSnapshotController& saved = controller.m_saved;
+    saved.m_buttonsDown             = static_cast<uint16_t>(sample.m_buttonsDown & ((1u << NUM_XBOX_BUTTONS) - 1));
+    saved.m_leftStickRaw[0]         = QuantizeStickAxis(sample.m_leftStickRaw.x);
+    saved.m_leftStickRaw[1]         = QuantizeStickAxis(sample.m_leftStickRaw.y);
+    saved.m_rightStickRaw[0]        = QuantizeStickAxis(sample.m_rightStickRaw.x);
+    saved.m_rightStickRaw[1]        = QuantizeStickAxis(sample.m_rightStickRaw.y);
+    saved.m_leftTrigger             = QuantizeTrigger(sample.m_leftTrigger);
+    saved.m_rightTrigger            = QuantizeTrigger(sample.m_rightTrigger);
+
+    controller.m_leftStick.UpdatePosition(DequantizeStickAxis(saved.m_leftStickRaw[0]), DequantizeStickAxis(saved.m_leftStickRaw[1]));
+    controller.m_rightStick.UpdatePosition(DequantizeStickAxis(saved.m_rightStickRaw[0]), DequantizeStickAxis(saved.m_rightStickRaw[1]));
+    controller.m_leftTrigger  = DequantizeTrigger(saved.m_leftTrigger);
+    controller.m_rightTrigger = DequantizeTrigger(saved.m_rightTrigger);
+}
@@ -0,0 +1,108 @@
+//----------------------------------------------------------------------------------------------------
+// InputFrameDriver.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include "Engine/Input/InputSystem.hpp"
+#include "Game/Input/InputBackend.hpp"
+#include "Game/Input/InputEventQueue.hpp"
+#include "Game/Input/InputHistory.hpp"
+#include "Game/Input/InputLatencyTracker.hpp"
+#include "Game/Input/InputSnapshot.hpp"
+
+//----------------------------------------------------------------------------------------------------
+class ControllerPoller;
+class ControllerStateArray;
+class CursorDeltaAccumulator;
+
+//----------------------------------------------------------------------------------------------------
+// Runs the Startup -> BeginFrame -> EndFrame -> Shutdown cycle of an InputSystem from an
+// InputBackend instead of the Window and XInput, so the per-frame input path can run headless.
+//
+// BeginFrame pumps the backend and drains its key events into the InputSystem. It records the
+// frame's keys in its InputHistory and takes the cursor sample.
+//
+// Controllers come from the backend, polled slot by slot, or from the latest snapshot of a
+// ControllerPoller when one is set. Sticks go through AnalogJoystick's deadzone correction.
+//
+// A ControllerStateArray, when set, takes the same samples for its first slots. Its other slots
+// come from the same source, so set the poller's m_numControllers to cover the whole array.
+//
+// The age of every key event and cursor move goes to its InputLatencyTracker. EndFrame closes the
+// tracker's frame, ends the InputSystem's frame and rolls controller button states over.
+//
+// CaptureSnapshot and RestoreSnapshot save and rewind that state for rollback; see sInputSnapshot.
+// The key state they use is the InputSystem's as of BeginFrame.
+//
+// The InputSystem's own Startup and BeginFrame are never called, since they need the Window and
+// EventSystem. Cursor and controller state is read from here instead.
+//
+class InputFrameDriver
+{
+public:
+    InputFrameDriver(InputSystem& inputSystem, InputBackend& backend);
+
+    bool Startup();
+    void Shutdown();
+    void BeginFrame();
+    void EndFrame();
+
+    void CaptureSnapshot(sInputSnapshot& out_snapshot) const;
+    void RestoreSnapshot(sInputSnapshot const& snapshot);    // Rewinds the InputHistory to the snapshot's frame; latency stats are not rewound
+
+    void SetControllerPoller(ControllerPoller* controllerPoller);   // Controllers come from its latest snapshot; null polls the backend directly
+    void SetCursorDeltaAccumulator(CursorDeltaAccumulator* cursorDeltaAccumulator);     // The cursor delta comes from its coalesced raw motion
+    void SetControllerStateArray(ControllerStateArray* controllerStates);              // Updated every frame for as many controllers as it holds
+
+    InputSystem&               GetInputSystem() const;
+    InputEventQueue&           GetEventQueue();
+    InputLatencyTracker const& GetLatencyTracker() const;
+    InputHistory const&        GetInputHistory() const;
+    int                        GetFrameNumber() const;     // Frames begun since Startup
+
+    Vec2 GetCursorClientPosition() const;
+    Vec2 GetCursorClientDelta() const;
+    Vec2 GetCursorNormalizedPosition() const;   // (0, 0) at the bottom left of the client area
+
+    // An index outside [0, NUM_XBOX_CONTROLLERS) reads as a disconnected controller
+    bool                  IsControllerConnected(int controllerIndex) const;
+    bool                  IsButtonDown(int controllerIndex, XboxButtonID button) const;
+    bool                  WasButtonJustPressed(int controllerIndex, XboxButtonID button) const;
+    bool                  WasButtonJustReleased(int controllerIndex, XboxButtonID button) const;
+    AnalogJoystick const& GetLeftStick(int controllerIndex) const;
+    AnalogJoystick const& GetRightStick(int controllerIndex) const;
+    float                 GetLeftTrigger(int controllerIndex) const;
+    float                 GetRightTrigger(int controllerIndex) const;
+
+private:
+    struct sDrivenController
+    {
+        bool                     m_isConnected = false;
+        sKeyButtonState          m_buttons[NUM_XBOX_BUTTONS];
+        AnalogJoystick           m_leftStick;
+        AnalogJoystick           m_rightStick;
+        float                    m_leftTrigger  = 0.f;
+        float                    m_rightTrigger = 0.f;
+        sInputSnapshotController m_saved;           // The same state as CaptureSnapshot saves it
+    };
+
+    sDrivenController const& GetController(int controllerIndex) const;
+    void                     UpdateController(sDrivenController& controller, sControllerSample const& sample);
+
+    InputSystem&            m_inputSystem;
+    InputBackend&           m_backend;
+    InputEventQueue         m_eventQueue;
+    InputLatencyTracker     m_latencyTracker;
+    InputHistory            m_inputHistory;
+    sKeyMask                m_keysDown;                 // The InputSystem's keys as of BeginFrame
+    sKeyMask                m_keysDownLastFrame;
+    sDrivenController       m_controllers[NUM_XBOX_CONTROLLERS];
+    sCursorSample           m_cursor;
+    Vec2                    m_cursorClientDelta      = Vec2(0.f, 0.f);
+    ControllerPoller*       m_controllerPoller       = nullptr;
+    CursorDeltaAccumulator* m_cursorDeltaAccumulator = nullptr;
+    ControllerStateArray*   m_controllerStates       = nullptr;
+    int                     m_frameNumber            = 0;
+    bool                    m_isStarted              = false;
+};
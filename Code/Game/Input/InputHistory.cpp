@@ -0,0 +1,228 @@
+//----------------------------------------------------------------------------------------------------
+// InputHistory.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/InputHistory.hpp"
+
+#include <bit>
+
+#include "Engine/Input/InputSystem.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // Bits 0 to numFrames - 1, the latest numFrames frames
+    //
+    uint64_t GetWindowMask(int numFrames)
+    {
+        if (numFrames <= 0)
+        {
+            return 0;
+        }
+
+        if (numFrames > INPUT_HISTORY_DEPTH)
+        {
+            numFrames = INPUT_HISTORY_DEPTH;
+        }
+
+        return (uint64_t{1} << numFrames) - 1;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+InputHistory::InputHistory()
+{
+    Clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputHistory::RecordFrame(InputSystem& inputSystem)
+{
+    sKeyMask keysDown;
+
+    for (int keyIndex = 0; keyIndex < NUM_KEYCODE; ++keyIndex)
+    {
+        if (inputSystem.IsKeyDown(static_cast<unsigned char>(keyIndex)))
+        {
+            keysDown.Set(static_cast<unsigned char>(keyIndex));
+        }
+    }
+
+    RecordFrame(keysDown);
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputHistory::RecordFrame(sKeyMask const& keysDown)
+{
+    // Only keys with a down frame still in their word need shifting; the rest stay zero
+    for (int wordIndex = 0; wordIndex < 4; ++wordIndex)
+    {
+        uint64_t const keysDownInWord = keysDown.m_words[wordIndex];
+        m_activeKeys.m_words[wordIndex] |= keysDownInWord;
+
+        for (uint64_t keyBits = m_activeKeys.m_words[wordIndex]; keyBits != 0; keyBits &= keyBits - 1)
+        {
+            int const      bitIndex = std::countr_zero(keyBits);
+            int const      keyIndex = wordIndex * 64 + bitIndex;
+            uint64_t const history  = (m_downHistory[keyIndex] << 1) | ((keysDownInWord >> bitIndex) & 1);
+
+            m_downHistory[keyIndex] = history;
+
+            if (history == 0)
+            {
+                m_activeKeys.m_words[wordIndex] &= ~(uint64_t{1} << bitIndex);
+            }
+        }
+    }
+
+    ++m_numFramesRecorded;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputHistory::Rewind(int const numFrames)
+{
+    if (numFrames <= 0)
+    {
+        return;
+    }
+
+    for (int wordIndex = 0; wordIndex < 4; ++wordIndex)
+    {
+        for (uint64_t keyBits = m_activeKeys.m_words[wordIndex]; keyBits != 0; keyBits &= keyBits - 1)
+        {
+            int const      bitIndex = std::countr_zero(keyBits);
+            int const      keyIndex = wordIndex * 64 + bitIndex;
+            uint64_t const history  = (numFrames < 64) ? (m_downHistory[keyIndex] >> numFrames) : 0;
+
+            m_downHistory[keyIndex] = history;
+
+            if (history == 0)
+            {
+                m_activeKeys.m_words[wordIndex] &= ~(uint64_t{1} << bitIndex);
+            }
+        }
+    }
+
+    m_numFramesRecorded = (numFrames < m_numFramesRecorded) ? m_numFramesRecorded - numFrames : 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputHistory::Clear()
+{
+    for (uint64_t& downHistory : m_downHistory)
+    {
+        downHistory = 0;
+    }
+
+    m_activeKeys        = sKeyMask();
+    m_numFramesRecorded = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+int InputHistory::GetNumFramesRecorded() const
+{
+    return m_numFramesRecorded;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputHistory::WasKeyDown(unsigned char const keyCode,
+                              int const           framesAgo) const
+{
+    if (framesAgo < 0 || framesAgo >= INPUT_HISTORY_DEPTH)
+    {
+        return false;
+    }
+
+    return (m_downHistory[keyCode] >> framesAgo) & 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputHistory::WasKeyPressedWithinFrames(unsigned char const keyCode,
+                                             int const           numFrames) const
+{
+    return (GetEdges(keyCode, eKeyEdge::PRESSED) & GetWindowMask(numFrames)) != 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputHistory::WasKeyReleasedWithinFrames(unsigned char const keyCode,
+                                              int const           numFrames) const
+{
+    return (GetEdges(keyCode, eKeyEdge::RELEASED) & GetWindowMask(numFrames)) != 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputHistory::WasKeyHeldForFrames(unsigned char const keyCode,
+                                       int const           numFrames) const
+{
+    uint64_t const window = GetWindowMask(numFrames);
+
+    return window != 0 && (m_downHistory[keyCode] & window) == window;
+}
+
+//----------------------------------------------------------------------------------------------------
+int InputHistory::GetFramesSinceKeyPressed(unsigned char const keyCode) const
+{
+    uint64_t const presses = GetEdges(keyCode, eKeyEdge::PRESSED);
+
+    return (presses == 0) ? -1 : std::countr_zero(presses);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputHistory::WasSequenceWithinFrames(sInputSequenceStep const* const steps,
+                                           int const                       numSteps,
+                                           int const                       numFrames) const
+{
+    uint64_t const window  = GetWindowMask(numFrames);
+    uint64_t       allowed = window;    // Frames the current step may be on
+
+    // Newest step first, each taking its most recent match, which leaves the most frames for the
+    // steps before it
+    for (int stepIndex = numSteps - 1; stepIndex >= 0; --stepIndex)
+    {
+        uint64_t const matches = GetEdges(steps[stepIndex].m_keyCode, steps[stepIndex].m_edge) & allowed;
+
+        if (matches == 0)
+        {
+            return false;
+        }
+
+        allowed = window & ~GetWindowMask(std::countr_zero(matches) + 1);
+    }
+
+    return numSteps > 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputHistory::WasChordPressedWithinFrames(sKeyMask const& chord,
+                                               int const       numFrames) const
+{
+    uint64_t const window = GetWindowMask(numFrames);
+
+    for (int wordIndex = 0; wordIndex < 4; ++wordIndex)
+    {
+        for (uint64_t keyBits = chord.m_words[wordIndex]; keyBits != 0; keyBits &= keyBits - 1)
+        {
+            unsigned char const keyCode = static_cast<unsigned char>(wordIndex * 64 + std::countr_zero(keyBits));
+
+            if ((GetEdges(keyCode, eKeyEdge::PRESSED) & window) == 0)
+            {
+                return false;
+            }
+        }
+    }
+
+    return chord.IsAnySet();
+}
+
+//----------------------------------------------------------------------------------------------------
+uint64_t InputHistory::GetEdges(unsigned char const keyCode,
+                                eKeyEdge const      edge) const
+{
+    uint64_t const isDown        = m_downHistory[keyCode];
+    uint64_t const wasDownBefore = isDown >> 1;    // Bit i: down i + 1 frames ago
+    uint64_t const edges         = (edge == eKeyEdge::PRESSED) ? (isDown & ~wasDownBefore) : (~isDown & wasDownBefore);
+
+    return edges & GetWindowMask(INPUT_HISTORY_DEPTH);
+}
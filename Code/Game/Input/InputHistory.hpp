@@ -0,0 +1,77 @@
+//----------------------------------------------------------------------------------------------------
+// InputHistory.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+
+#include "Game/Input/KeyStateBitset.hpp"
+
+//----------------------------------------------------------------------------------------------------
+class InputSystem;
+
+//----------------------------------------------------------------------------------------------------
+int constexpr INPUT_HISTORY_DEPTH = 63;     // Frames that can be queried, the latest included
+
+//----------------------------------------------------------------------------------------------------
+enum class eKeyEdge : unsigned char
+{
+    PRESSED,
+    RELEASED
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sInputSequenceStep
+{
+    unsigned char m_keyCode = 0;
+    eKeyEdge      m_edge    = eKeyEdge::PRESSED;
+};
+
+//----------------------------------------------------------------------------------------------------
+// The last INPUT_HISTORY_DEPTH frames of keyboard state, for input buffering ("Jump pressed within
+// the last 6 frames") without per-key frame counters in gameplay code.
+//
+// The ring of per-frame key bitsets is stored transposed: one 64-bit word per key, bit i holding
+// whether the key was down i frames ago. Recording a frame shifts the words of the few keys down
+// within the last 64 frames, and a query about one key reads one word. Press and release edges
+// are derived from adjacent bits, which is why one bit beyond the queryable depth is kept.
+// "Pressed within n frames" is a mask and a test, and a sequence is matched newest step first
+// with one bit scan per step.
+//
+// Like WasKeyJustPressed, history is sampled once per frame, so a press and release inside one
+// frame is not seen. Rewinding shifts the words the other way; frames older than the 64 kept,
+// which a rewind brings back into range, read as up.
+//
+class InputHistory
+{
+public:
+    InputHistory();
+
+    void RecordFrame(InputSystem& inputSystem);     // Once per frame, after the frame's key events
+    void RecordFrame(sKeyMask const& keysDown);
+    void Rewind(int numFrames);                     // Forgets the latest numFrames frames, for rollback
+    void Clear();
+
+    int GetNumFramesRecorded() const;
+
+    // numFrames counts back from the latest frame, which is frame 0; it is clamped to the depth
+    bool WasKeyDown(unsigned char keyCode, int framesAgo) const;
+    bool WasKeyPressedWithinFrames(unsigned char keyCode, int numFrames) const;
+    bool WasKeyReleasedWithinFrames(unsigned char keyCode, int numFrames) const;
+    bool WasKeyHeldForFrames(unsigned char keyCode, int numFrames) const;  // Down on each of the last numFrames frames
+    int  GetFramesSinceKeyPressed(unsigned char keyCode) const;            // 0 if pressed this frame, -1 if not within the depth
+
+    // Each step on a later frame than the step before it, all within the last numFrames frames
+    bool WasSequenceWithinFrames(sInputSequenceStep const* steps, int numSteps, int numFrames) const;
+
+    // Every key in the chord pressed within the last numFrames frames, in any order
+    bool WasChordPressedWithinFrames(sKeyMask const& chord, int numFrames) const;
+
+private:
+    uint64_t GetEdges(unsigned char keyCode, eKeyEdge edge) const;     // Bit i set if the edge happened i frames ago
+
+    uint64_t m_downHistory[256];
+    sKeyMask m_activeKeys;          // Keys whose word is not all zeros
+    int      m_numFramesRecorded = 0;
+};
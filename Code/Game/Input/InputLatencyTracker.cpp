@@ -0,0 +1,182 @@
+//----------------------------------------------------------------------------------------------------
+// InputLatencyTracker.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/InputLatencyTracker.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    char const* const SOURCE_NAMES[] = {"Key", "Cursor"};
+    char const* const STAT_NAMES[]   = {"min", "avg", "max"};
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputLatencyTracker::sAccumulator::Add(double const ageMs)
+{
+    m_minMs = (m_numEvents == 0) ? ageMs : std::min(m_minMs, ageMs);
+    m_maxMs = (m_numEvents == 0) ? ageMs : std::max(m_maxMs, ageMs);
+    m_sumMs += ageMs;
+    ++m_numEvents;
+}
+
+//----------------------------------------------------------------------------------------------------
+sInputLatencyStats InputLatencyTracker::sAccumulator::GetStats() const
+{
+    sInputLatencyStats stats;
+    stats.m_numEvents = m_numEvents;
+
+    if (m_numEvents > 0)
+    {
+        stats.m_minMs = m_minMs;
+        stats.m_avgMs = m_sumMs / m_numEvents;
+        stats.m_maxMs = m_maxMs;
+    }
+
+    return stats;
+}
+
+//----------------------------------------------------------------------------------------------------
+double InputLatencyTracker::RecordEventConsumed(eInputLatencySource const          source,
+                                                PerformanceClock::time_point const eventTime)
+{
+    return RecordEventConsumed(source, eventTime, PerformanceClock::now());
+}
+
+//----------------------------------------------------------------------------------------------------
+double InputLatencyTracker::RecordEventConsumed(eInputLatencySource const          source,
+                                                PerformanceClock::time_point const eventTime,
+                                                PerformanceClock::time_point const consumedTime)
+{
+    std::chrono::duration<double, std::milli> const age = consumedTime - eventTime;
+
+    m_frame[static_cast<int>(source)].Add(age.count());
+    m_total[static_cast<int>(source)].Add(age.count());
+
+    return age.count();
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputLatencyTracker::EndFrame()
+{
+    for (int sourceIndex = 0; sourceIndex < static_cast<int>(eInputLatencySource::NUM); ++sourceIndex)
+    {
+        sInputLatencyStats const frameStats = m_frame[sourceIndex].GetStats();
+
+        if (frameStats.m_numEvents > 0)
+        {
+            ++m_histograms[sourceIndex][static_cast<int>(eInputLatencyStat::MIN)][GetBucketIndex(frameStats.m_minMs)];
+            ++m_histograms[sourceIndex][static_cast<int>(eInputLatencyStat::AVG)][GetBucketIndex(frameStats.m_avgMs)];
+            ++m_histograms[sourceIndex][static_cast<int>(eInputLatencyStat::MAX)][GetBucketIndex(frameStats.m_maxMs)];
+            ++m_numFramesWithEvents[sourceIndex];
+        }
+
+        m_lastFrame[sourceIndex] = m_frame[sourceIndex];
+        m_frame[sourceIndex]     = sAccumulator();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputLatencyTracker::Reset()
+{
+    *this = InputLatencyTracker();
+}
+
+//----------------------------------------------------------------------------------------------------
+sInputLatencyStats InputLatencyTracker::GetFrameStats(eInputLatencySource const source) const
+{
+    return m_frame[static_cast<int>(source)].GetStats();
+}
+
+//----------------------------------------------------------------------------------------------------
+sInputLatencyStats InputLatencyTracker::GetLastFrameStats(eInputLatencySource const source) const
+{
+    return m_lastFrame[static_cast<int>(source)].GetStats();
+}
+
+//----------------------------------------------------------------------------------------------------
+sInputLatencyStats InputLatencyTracker::GetTotalStats(eInputLatencySource const source) const
+{
+    return m_total[static_cast<int>(source)].GetStats();
+}
+
+//----------------------------------------------------------------------------------------------------
+int InputLatencyTracker::GetHistogramCount(eInputLatencySource const source,
+                                           eInputLatencyStat const   stat,
+                                           int const                 bucketIndex) const
+{
+    return m_histograms[static_cast<int>(source)][static_cast<int>(stat)][bucketIndex];
+}
+
+//----------------------------------------------------------------------------------------------------
+int InputLatencyTracker::GetNumFramesWithEvents(eInputLatencySource const source) const
+{
+    return m_numFramesWithEvents[static_cast<int>(source)];
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputLatencyTracker::PrintReport(char const* const title) const
+{
+    printf("  Input latency: %s\n", title);
+
+    for (int sourceIndex = 0; sourceIndex < static_cast<int>(eInputLatencySource::NUM); ++sourceIndex)
+    {
+        sInputLatencyStats const total = m_total[sourceIndex].GetStats();
+
+        if (total.m_numEvents == 0)
+        {
+            continue;
+        }
+
+        printf("    %-6s %d events over %d frames: min %.3f ms, avg %.3f ms, max %.3f ms\n",
+               SOURCE_NAMES[sourceIndex], total.m_numEvents, m_numFramesWithEvents[sourceIndex], total.m_minMs, total.m_avgMs, total.m_maxMs);
+        printf("      %-14s", "per-frame");
+
+        for (int statIndex = 0; statIndex < static_cast<int>(eInputLatencyStat::NUM); ++statIndex)
+        {
+            printf(" %6s", STAT_NAMES[statIndex]);
+        }
+
+        printf("\n");
+
+        for (int bucketIndex = 0; bucketIndex < NUM_INPUT_LATENCY_BUCKETS; ++bucketIndex)
+        {
+            int const minCount = m_histograms[sourceIndex][static_cast<int>(eInputLatencyStat::MIN)][bucketIndex];
+            int const avgCount = m_histograms[sourceIndex][static_cast<int>(eInputLatencyStat::AVG)][bucketIndex];
+            int const maxCount = m_histograms[sourceIndex][static_cast<int>(eInputLatencyStat::MAX)][bucketIndex];
+
+            if (minCount == 0 && avgCount == 0 && maxCount == 0)
+            {
+                continue;
+            }
+
+            if (bucketIndex < NUM_INPUT_LATENCY_BUCKETS - 1)
+            {
+                printf("      <= %7.4f ms ", INPUT_LATENCY_BUCKET_LIMITS_MS[bucketIndex]);
+            }
+            else
+            {
+                printf("      >  %7.4f ms ", INPUT_LATENCY_BUCKET_LIMITS_MS[bucketIndex - 1]);
+            }
+
+            printf(" %6d %6d %6d\n", minCount, avgCount, maxCount);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+int InputLatencyTracker::GetBucketIndex(double const ageMs)
+{
+    int bucketIndex = 0;
+
+    while (bucketIndex < NUM_INPUT_LATENCY_BUCKETS - 1 && ageMs > INPUT_LATENCY_BUCKET_LIMITS_MS[bucketIndex])
+    {
+        ++bucketIndex;
+    }
+
+    return bucketIndex;
+}
@@ -0,0 +1,84 @@
+//----------------------------------------------------------------------------------------------------
+// InputLatencyTracker.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include "Game/PerformanceTimer.hpp"
+
+//----------------------------------------------------------------------------------------------------
+enum class eInputLatencySource : unsigned char
+{
+    KEY,
+    CURSOR,
+    NUM
+};
+
+//----------------------------------------------------------------------------------------------------
+enum class eInputLatencyStat : unsigned char
+{
+    MIN,
+    AVG,
+    MAX,
+    NUM
+};
+
+//----------------------------------------------------------------------------------------------------
+// Upper bounds of the histogram buckets in milliseconds; the last bucket takes everything above
+//
+float constexpr INPUT_LATENCY_BUCKET_LIMITS_MS[] = {0.0625f, 0.125f, 0.25f, 0.5f, 1.f, 2.f, 4.f, 8.f, 16.f, 33.f, 66.f};
+int constexpr   NUM_INPUT_LATENCY_BUCKETS        = static_cast<int>(sizeof(INPUT_LATENCY_BUCKET_LIMITS_MS) / sizeof(float)) + 1;
+
+//----------------------------------------------------------------------------------------------------
+struct sInputLatencyStats
+{
+    int    m_numEvents = 0;
+    double m_minMs     = 0.0;
+    double m_avgMs     = 0.0;
+    double m_maxMs     = 0.0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// How long input waited between being produced and the simulation seeing it.
+//
+// Producers timestamp each event with PerformanceClock, so these numbers line up with every other
+// PerformanceTimer measurement. The consumer reports each event's age as it is applied; EndFrame
+// closes the frame and adds its min, average and max age to one histogram each, per source.
+// Frames without events of a source leave that source's histograms alone.
+//
+class InputLatencyTracker
+{
+public:
+    double RecordEventConsumed(eInputLatencySource source, PerformanceClock::time_point eventTime);     // Returns the age in ms
+    double RecordEventConsumed(eInputLatencySource source, PerformanceClock::time_point eventTime, PerformanceClock::time_point consumedTime);
+    void   EndFrame();
+    void   Reset();
+
+    sInputLatencyStats GetFrameStats(eInputLatencySource source) const;         // The frame in progress
+    sInputLatencyStats GetLastFrameStats(eInputLatencySource source) const;     // The frame last ended
+    sInputLatencyStats GetTotalStats(eInputLatencySource source) const;         // Every event since Reset
+    int                GetHistogramCount(eInputLatencySource source, eInputLatencyStat stat, int bucketIndex) const;
+    int                GetNumFramesWithEvents(eInputLatencySource source) const;
+
+    void PrintReport(char const* title) const;
+
+private:
+    struct sAccumulator
+    {
+        int    m_numEvents = 0;
+        double m_minMs     = 0.0;
+        double m_sumMs     = 0.0;
+        double m_maxMs     = 0.0;
+
+        void               Add(double ageMs);
+        sInputLatencyStats GetStats() const;
+    };
+
+    static int GetBucketIndex(double ageMs);
+
+    sAccumulator m_frame[static_cast<int>(eInputLatencySource::NUM)];
+    sAccumulator m_lastFrame[static_cast<int>(eInputLatencySource::NUM)];
+    sAccumulator m_total[static_cast<int>(eInputLatencySource::NUM)];
+    int          m_histograms[static_cast<int>(eInputLatencySource::NUM)][static_cast<int>(eInputLatencyStat::NUM)][NUM_INPUT_LATENCY_BUCKETS] = {};
+    int          m_numFramesWithEvents[static_cast<int>(eInputLatencySource::NUM)]                                                           = {};
+};
@@ -0,0 +1,821 @@
+//----------------------------------------------------------------------------------------------------
+// InputRecording.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/InputRecording.hpp"
+
+#include <bit>
+#include <cmath>
+#include <cstring>
+
+#include "Engine/Input/InputSystem.hpp"
+#include "Game/Input/InputEventQueue.hpp"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    uint32_t constexpr RECORDING_MAGIC   = 0x43524E49;     // "INRC"
+    uint32_t constexpr INDEX_MAGIC       = 0x58524E49;     // "INRX"
+    uint32_t constexpr RECORDING_VERSION = 1;
+    size_t constexpr   HEADER_SIZE       = 16;             // Magic, version, keyframe interval, reserved
+    size_t constexpr   TRAILER_SIZE      = 12;             // Frame count, keyframe count, magic
+    size_t constexpr   WRITE_BUFFER_SIZE = 64 * 1024;
+
+    //------------------------------------------------------------------------------------------------
+    struct sRecordingHeader
+    {
+        uint32_t m_magic;
+        uint32_t m_version;
+        uint32_t m_keyframeInterval;
+        uint32_t m_reserved;
+    };
+
+    //------------------------------------------------------------------------------------------------
+    struct sRecordingTrailer
+    {
+        uint32_t m_numFrames;
+        uint32_t m_numKeyframes;
+        uint32_t m_magic;
+    };
+
+    //------------------------------------------------------------------------------------------------
+    int32_t QuantizeAnalog(float const value)
+    {
+        return static_cast<int32_t>(std::lround(value * RECORDED_ANALOG_STEPS_PER_UNIT));
+    }
+
+    //------------------------------------------------------------------------------------------------
+    uint32_t ZigzagEncode(int32_t const value)
+    {
+        return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    int32_t ZigzagDecode(uint32_t const value)
+    {
+        return static_cast<int32_t>(value >> 1) ^ -static_cast<int32_t>(value & 1);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    bool ReadVarint(uint8_t const* data,
+                    size_t const   end,
+                    size_t&        offset,
+                    uint32_t&      out_value)
+    {
+        out_value = 0;
+
+        for (int shift = 0; shift < 35 && offset < end; shift += 7)
+        {
+            uint8_t const byte = data[offset++];
+            out_value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+
+            if ((byte & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Steps over one frame without decoding it, leaving offset alone if the frame is incomplete
+    //
+    bool SkipFrame(uint8_t const* data,
+                   size_t const   end,
+                   size_t&        offset)
+    {
+        size_t   frameOffset = offset;
+        uint32_t frameHeader;
+
+        if (!ReadVarint(data, end, frameOffset, frameHeader))
+        {
+            return false;
+        }
+
+        uint32_t const numToggledKeys = frameHeader >> 1;
+
+        if (numToggledKeys > 256 || end - frameOffset < numToggledKeys)
+        {
+            return false;
+        }
+
+        frameOffset += numToggledKeys;
+
+        if (frameHeader & 1)
+        {
+            if (frameOffset >= end)
+            {
+                return false;
+            }
+
+            int const numChangedAnalogs = std::popcount(data[frameOffset++]);
+
+            for (int analog = 0; analog < numChangedAnalogs; ++analog)
+            {
+                uint32_t delta;
+
+                if (!ReadVarint(data, end, frameOffset, delta))
+                {
+                    return false;
+                }
+            }
+        }
+
+        offset = frameOffset;
+
+        return true;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    uint8_t const* MapFileForReading(char const* filePath,
+                                     size_t&     out_size)
+    {
+        out_size = 0;
+
+#if defined(_WIN32)
+        HANDLE const file = CreateFileA(filePath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return nullptr;
+        }
+
+        LARGE_INTEGER fileSize;
+        HANDLE const  mapping = GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0 ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+        void* const   view    = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+        // The view keeps the file mapped after both handles are closed
+        if (mapping)
+        {
+            CloseHandle(mapping);
+        }
+
+        CloseHandle(file);
+
+        if (view)
+        {
+            out_size = static_cast<size_t>(fileSize.QuadPart);
+        }
+
+        return static_cast<uint8_t const*>(view);
+#else
+        int const fileDescriptor = open(filePath, O_RDONLY);
+
+        if (fileDescriptor < 0)
+        {
+            return nullptr;
+        }
+
+        struct stat fileStatus;
+        void*       view = MAP_FAILED;
+
+        if (fstat(fileDescriptor, &fileStatus) == 0 && fileStatus.st_size > 0)
+        {
+            view = mmap(nullptr, static_cast<size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        }
+
+        // The mapping keeps the file open after the descriptor is closed
+        close(fileDescriptor);
+
+        if (view == MAP_FAILED)
+        {
+            return nullptr;
+        }
+
+        out_size = static_cast<size_t>(fileStatus.st_size);
+
+        return static_cast<uint8_t const*>(view);
+#endif
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void UnmapFile(uint8_t const* data,
+                   size_t const   size)
+    {
+#if defined(_WIN32)
+        (void)size;
+        UnmapViewOfFile(data);
+#else
+        munmap(const_cast<uint8_t*>(data), size);
+#endif
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+sRecordedInputFrame CaptureInputFrame(InputSystem& inputSystem)
+{
+    sRecordedInputFrame frame;
+
+    for (int keyIndex = 0; keyIndex < NUM_KEYCODE; ++keyIndex)
+    {
+        if (inputSystem.IsKeyDown(static_cast<unsigned char>(keyIndex)))
+        {
+            frame.m_keysDown.Set(static_cast<unsigned char>(keyIndex));
+        }
+    }
+
+    Vec2 const            cursorPosition = inputSystem.GetCursorClientPosition();
+    XboxController const& controller     = inputSystem.GetController(0);
+    Vec2 const            leftStick      = controller.GetLeftStick().GetPosition();
+    Vec2 const            rightStick     = controller.GetRightStick().GetPosition();
+
+    frame.m_analogs[RECORDED_ANALOG_CURSOR_X]      = cursorPosition.x;
+    frame.m_analogs[RECORDED_ANALOG_CURSOR_Y]      = cursorPosition.y;
+    frame.m_analogs[RECORDED_ANALOG_LEFT_STICK_X]  = leftStick.x;
+    frame.m_analogs[RECORDED_ANALOG_LEFT_STICK_Y]  = leftStick.y;
+    frame.m_analogs[RECORDED_ANALOG_RIGHT_STICK_X] = rightStick.x;
+    frame.m_analogs[RECORDED_ANALOG_RIGHT_STICK_Y] = rightStick.y;
+    frame.m_analogs[RECORDED_ANALOG_LEFT_TRIGGER]  = controller.GetLeftTrigger();
+    frame.m_analogs[RECORDED_ANALOG_RIGHT_TRIGGER] = controller.GetRightTrigger();
+
+    return frame;
+}
+
+//----------------------------------------------------------------------------------------------------
+InputRecorder::~InputRecorder()
+{
+    StopRecording();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputRecorder::StartRecording(char const* filePath,
+                                   int const   keyframeInterval)
+{
+    StopRecording();
+
+    m_file = std::fopen(filePath, "wb");
+
+    if (m_file == nullptr)
+    {
+        return false;
+    }
+
+    // Writes already come in 64 KB buffers, and unbuffered, fwrite's result is what reached the file
+    std::setvbuf(m_file, nullptr, _IONBF, 0);
+
+    m_keyframeInterval = (keyframeInterval > 0) ? keyframeInterval : 60;
+    m_numFrames        = 0;
+    m_numBytes         = 0;
+    m_isStopping       = false;
+    m_hasWriteFailed   = false;
+    m_numBytesWritten  = 0;
+    m_keyframeOffsets.clear();
+    m_buffer.clear();
+    m_buffer.reserve(WRITE_BUFFER_SIZE);
+
+    sRecordingHeader const header = {RECORDING_MAGIC, RECORDING_VERSION, static_cast<uint32_t>(m_keyframeInterval), 0};
+    WriteBytes(&header, sizeof(header));
+
+    m_writerThread = std::thread(&InputRecorder::WriterThreadMain, this);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputRecorder::RecordFrame(sRecordedInputFrame const& frame)
+{
+    if (m_file == nullptr)
+    {
+        return;
+    }
+
+    if (m_numFrames % m_keyframeInterval == 0)
+    {
+        m_keyframeOffsets.push_back(static_cast<uint64_t>(m_numBytes));
+        m_previousKeys = sKeyMask();
+        std::memset(m_previousAnalogs, 0, sizeof(m_previousAnalogs));
+    }
+
+    // Toggled keys
+    uint8_t toggledKeys[256];
+    int     numToggledKeys = 0;
+
+    for (int wordIndex = 0; wordIndex < 4; ++wordIndex)
+    {
+        uint64_t toggled = frame.m_keysDown.m_words[wordIndex] ^ m_previousKeys.m_words[wordIndex];
+
+        while (toggled != 0)
+        {
+            toggledKeys[numToggledKeys++] = static_cast<uint8_t>(wordIndex * 64 + std::countr_zero(toggled));
+            toggled &= toggled - 1;
+        }
+    }
+
+    // Changed analogs
+    int32_t analogs[NUM_RECORDED_ANALOGS];
+    uint8_t analogMask = 0;
+
+    for (int analogIndex = 0; analogIndex < NUM_RECORDED_ANALOGS; ++analogIndex)
+    {
+        analogs[analogIndex] = QuantizeAnalog(frame.m_analogs[analogIndex]);
+
+        if (analogs[analogIndex] != m_previousAnalogs[analogIndex])
+        {
+            analogMask |= static_cast<uint8_t>(1u << analogIndex);
+        }
+    }
+
+    WriteVarint((static_cast<uint32_t>(numToggledKeys) << 1) | (analogMask != 0 ? 1u : 0u));
+    WriteBytes(toggledKeys, static_cast<size_t>(numToggledKeys));
+
+    if (analogMask != 0)
+    {
+        WriteBytes(&analogMask, 1);
+
+        for (int analogIndex = 0; analogIndex < NUM_RECORDED_ANALOGS; ++analogIndex)
+        {
+            if (analogMask & (1u << analogIndex))
+            {
+                WriteVarint(ZigzagEncode(analogs[analogIndex] - m_previousAnalogs[analogIndex]));
+            }
+        }
+    }
+
+    m_previousKeys = frame.m_keysDown;
+    std::memcpy(m_previousAnalogs, analogs, sizeof(analogs));
+    ++m_numFrames;
+
+    if (m_buffer.size() >= WRITE_BUFFER_SIZE)
+    {
+        SubmitBuffer();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputRecorder::StopRecording()
+{
+    if (m_file == nullptr)
+    {
+        return !m_hasWriteFailed;
+    }
+
+    WriteBytes(m_keyframeOffsets.data(), m_keyframeOffsets.size() * sizeof(uint64_t));
+
+    sRecordingTrailer const trailer = {static_cast<uint32_t>(m_numFrames), static_cast<uint32_t>(m_keyframeOffsets.size()), INDEX_MAGIC};
+    WriteBytes(&trailer, sizeof(trailer));
+    SubmitBuffer();
+
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        m_isStopping = true;
+    }
+
+    m_condition.notify_one();
+    m_writerThread.join();
+
+    if (std::fclose(m_file) != 0)
+    {
+        m_hasWriteFailed = true;
+    }
+
+    m_file = nullptr;
+
+    return !m_hasWriteFailed;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputRecorder::IsRecording() const
+{
+    return m_file != nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputRecorder::HasWriteFailed() const
+{
+    return m_hasWriteFailed;
+}
+
+//----------------------------------------------------------------------------------------------------
+int InputRecorder::GetNumFramesRecorded() const
+{
+    return m_numFrames;
+}
+
+//----------------------------------------------------------------------------------------------------
+long long InputRecorder::GetNumBytesRecorded() const
+{
+    return m_hasWriteFailed ? m_numBytesWritten.load() : m_numBytes;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputRecorder::WriteBytes(void const*  bytes,
+                               size_t const numBytes)
+{
+    uint8_t const* const byteData = static_cast<uint8_t const*>(bytes);
+
+    m_buffer.insert(m_buffer.end(), byteData, byteData + numBytes);
+    m_numBytes += static_cast<long long>(numBytes);
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputRecorder::WriteVarint(uint32_t value)
+{
+    while (value >= 0x80)
+    {
+        m_buffer.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+        ++m_numBytes;
+    }
+
+    m_buffer.push_back(static_cast<uint8_t>(value));
+    ++m_numBytes;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Hands the filled buffer to the writer thread and carries on in the buffer it last finished with
+//
+void InputRecorder::SubmitBuffer()
+{
+    if (m_buffer.empty())
+    {
+        return;
+    }
+
+    std::vector<uint8_t> nextBuffer;
+
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        m_pendingBuffers.push_back(std::move(m_buffer));
+        nextBuffer.swap(m_spareBuffer);
+    }
+
+    m_condition.notify_one();
+
+    m_buffer = std::move(nextBuffer);
+    m_buffer.clear();
+    m_buffer.reserve(WRITE_BUFFER_SIZE);
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputRecorder::WriterThreadMain()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    for (;;)
+    {
+        m_condition.wait(lock, [this] { return !m_pendingBuffers.empty() || m_isStopping; });
+
+        if (m_pendingBuffers.empty())
+        {
+            return;
+        }
+
+        std::vector<uint8_t> buffer = std::move(m_pendingBuffers.front());
+        m_pendingBuffers.pop_front();
+
+        // After a failure nothing more is written, so the file doesn't skip over the lost bytes
+        lock.unlock();
+        size_t const numWritten = m_hasWriteFailed ? 0 : std::fwrite(buffer.data(), 1, buffer.size(), m_file);
+        lock.lock();
+
+        m_numBytesWritten += static_cast<long long>(numWritten);
+
+        if (numWritten != buffer.size())
+        {
+            m_hasWriteFailed = true;
+        }
+
+        m_spareBuffer = std::move(buffer);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+InputPlayback::~InputPlayback()
+{
+    StopPlayback();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputPlayback::StartPlayback(char const* filePath)
+{
+    StopPlayback();
+
+    m_data = MapFileForReading(filePath, m_dataSize);
+
+    if (m_data == nullptr)
+    {
+        return false;
+    }
+
+    sRecordingHeader  header;
+    sRecordingTrailer trailer;
+
+    bool isValid = m_dataSize >= HEADER_SIZE;
+
+    if (isValid)
+    {
+        std::memcpy(&header, m_data, sizeof(header));
+
+        isValid = header.m_magic == RECORDING_MAGIC && header.m_version == RECORDING_VERSION && header.m_keyframeInterval > 0;
+    }
+
+    if (!isValid)
+    {
+        StopPlayback();
+        return false;
+    }
+
+    m_keyframeInterval = static_cast<int>(header.m_keyframeInterval);
+
+    bool hasIndex = m_dataSize >= HEADER_SIZE + TRAILER_SIZE;
+
+    if (hasIndex)
+    {
+        std::memcpy(&trailer, m_data + m_dataSize - TRAILER_SIZE, sizeof(trailer));
+
+        hasIndex = trailer.m_magic == INDEX_MAGIC && trailer.m_numKeyframes * sizeof(uint64_t) <= m_dataSize - HEADER_SIZE - TRAILER_SIZE;
+    }
+
+    if (!hasIndex)
+    {
+        RebuildIndex();
+        return SeekToFrame(0);
+    }
+
+    m_numFrames = static_cast<int>(trailer.m_numFrames);
+    m_framesEnd = m_dataSize - TRAILER_SIZE - trailer.m_numKeyframes * sizeof(uint64_t);
+    m_keyframeOffsets.resize(trailer.m_numKeyframes);
+    std::memcpy(m_keyframeOffsets.data(), m_data + m_framesEnd, trailer.m_numKeyframes * sizeof(uint64_t));
+
+    return SeekToFrame(0);
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputPlayback::StopPlayback()
+{
+    if (m_data != nullptr)
+    {
+        UnmapFile(m_data, m_dataSize);
+    }
+
+    m_data           = nullptr;
+    m_dataSize       = 0;
+    m_numFrames      = 0;
+    m_nextFrameIndex = 0;
+    m_keyframeOffsets.clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputPlayback::UpdatePlayback(InputSystem& inputSystem)
+{
+    sKeyMask changedKeys;
+
+    if (!DecodeKeyChanges(changedKeys))
+    {
+        return false;
+    }
+
+    for (int wordIndex = 0; wordIndex < 4; ++wordIndex)
+    {
+        for (uint64_t changed = changedKeys.m_words[wordIndex]; changed != 0; changed &= changed - 1)
+        {
+            unsigned char const keyCode = static_cast<unsigned char>(wordIndex * 64 + std::countr_zero(changed));
+
+            if (m_keys.Test(keyCode))
+            {
+                inputSystem.HandleKeyPressed(keyCode);
+            }
+            else
+            {
+                inputSystem.HandleKeyReleased(keyCode);
+            }
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputPlayback::UpdatePlayback(InputEventQueue& eventQueue)
+{
+    sKeyMask changedKeys;
+
+    if (!DecodeKeyChanges(changedKeys))
+    {
+        return false;
+    }
+
+    for (int wordIndex = 0; wordIndex < 4; ++wordIndex)
+    {
+        for (uint64_t changed = changedKeys.m_words[wordIndex]; changed != 0; changed &= changed - 1)
+        {
+            unsigned char const keyCode = static_cast<unsigned char>(wordIndex * 64 + std::countr_zero(changed));
+
+            bool const isPushed = m_keys.Test(keyCode) ? eventQueue.PushKeyPressed(keyCode) : eventQueue.PushKeyReleased(keyCode);
+
+            // A change the full queue dropped is left unapplied, so the next frame sends it again
+            if (!isPushed)
+            {
+                m_appliedKeys.m_words[wordIndex] ^= uint64_t{1} << (keyCode & 63);
+            }
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputPlayback::ReadNextFrame(sRecordedInputFrame& out_frame)
+{
+    if (!DecodeFrame())
+    {
+        return false;
+    }
+
+    out_frame = GetCurrentFrame();
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputPlayback::SeekToFrame(int const frameIndex)
+{
+    if (m_data == nullptr || frameIndex < 0 || frameIndex > m_numFrames)
+    {
+        return false;
+    }
+
+    m_needsFullKeySync = true;
+
+    if (frameIndex == m_numFrames)
+    {
+        m_nextFrameIndex = frameIndex;
+        return true;
+    }
+
+    int const keyframe = frameIndex / m_keyframeInterval;
+
+    if (keyframe >= static_cast<int>(m_keyframeOffsets.size()) || m_keyframeOffsets[keyframe] >= m_framesEnd)
+    {
+        return false;
+    }
+
+    m_readOffset     = static_cast<size_t>(m_keyframeOffsets[keyframe]);
+    m_nextFrameIndex = keyframe * m_keyframeInterval;
+
+    while (m_nextFrameIndex < frameIndex)
+    {
+        if (!DecodeFrame())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputPlayback::IsPlaybackActive() const
+{
+    return m_data != nullptr && m_nextFrameIndex < m_numFrames;
+}
+
+//----------------------------------------------------------------------------------------------------
+int InputPlayback::GetNumFrames() const
+{
+    return m_numFrames;
+}
+
+//----------------------------------------------------------------------------------------------------
+int InputPlayback::GetNextFrameIndex() const
+{
+    return m_nextFrameIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+sRecordedInputFrame InputPlayback::GetCurrentFrame() const
+{
+    sRecordedInputFrame frame;
+    frame.m_keysDown = m_keys;
+
+    for (int analogIndex = 0; analogIndex < NUM_RECORDED_ANALOGS; ++analogIndex)
+    {
+        frame.m_analogs[analogIndex] = static_cast<float>(m_analogs[analogIndex]) / RECORDED_ANALOG_STEPS_PER_UNIT;
+    }
+
+    return frame;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputPlayback::DecodeKeyChanges(sKeyMask& out_changedKeys)
+{
+    if (!DecodeFrame())
+    {
+        return false;
+    }
+
+    // After a seek every key is sent, since what the receiver last saw is unknown
+    for (int wordIndex = 0; wordIndex < 4; ++wordIndex)
+    {
+        out_changedKeys.m_words[wordIndex] = m_needsFullKeySync ? ~uint64_t{0} : (m_keys.m_words[wordIndex] ^ m_appliedKeys.m_words[wordIndex]);
+    }
+
+    m_appliedKeys      = m_keys;
+    m_needsFullKeySync = false;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Counts the frames after the header, noting every keyframe's offset, and stops at the first one
+// that's cut short
+//
+void InputPlayback::RebuildIndex()
+{
+    size_t offset = HEADER_SIZE;
+
+    m_numFrames = 0;
+    m_framesEnd = HEADER_SIZE;
+    m_keyframeOffsets.clear();
+
+    while (SkipFrame(m_data, m_dataSize, offset))
+    {
+        if (m_numFrames % m_keyframeInterval == 0)
+        {
+            m_keyframeOffsets.push_back(static_cast<uint64_t>(m_framesEnd));
+        }
+
+        ++m_numFrames;
+        m_framesEnd = offset;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputPlayback::DecodeFrame()
+{
+    if (!IsPlaybackActive())
+    {
+        return false;
+    }
+
+    if (m_nextFrameIndex % m_keyframeInterval == 0)
+    {
+        m_keys = sKeyMask();
+        std::memset(m_analogs, 0, sizeof(m_analogs));
+    }
+
+    size_t   offset = m_readOffset;
+    uint32_t frameHeader;
+
+    if (!ReadVarint(m_data, m_framesEnd, offset, frameHeader))
+    {
+        return false;
+    }
+
+    uint32_t const numToggledKeys = frameHeader >> 1;
+
+    if (numToggledKeys > 256 || offset + numToggledKeys > m_framesEnd)
+    {
+        return false;
+    }
+
+    for (uint32_t toggle = 0; toggle < numToggledKeys; ++toggle)
+    {
+        unsigned char const keyCode = m_data[offset++];
+        m_keys.m_words[keyCode >> 6] ^= uint64_t{1} << (keyCode & 63);
+    }
+
+    if (frameHeader & 1)
+    {
+        if (offset >= m_framesEnd)
+        {
+            return false;
+        }
+
+        uint8_t const analogMask = m_data[offset++];
+
+        for (int analogIndex = 0; analogIndex < NUM_RECORDED_ANALOGS; ++analogIndex)
+        {
+            uint32_t delta;
+
+            if ((analogMask & (1u << analogIndex)) == 0)
+            {
+                continue;
+            }
+
+            if (!ReadVarint(m_data, m_framesEnd, offset, delta))
+            {
+                return false;
+            }
+
+            m_analogs[analogIndex] += ZigzagDecode(delta);
+        }
+    }
+
+    m_readOffset = offset;
+    ++m_nextFrameIndex;
+
+    return true;
+}
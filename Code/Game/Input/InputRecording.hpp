@@ -0,0 +1,155 @@
+//----------------------------------------------------------------------------------------------------
+// InputRecording.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Game/Input/KeyStateBitset.hpp"
+
+//----------------------------------------------------------------------------------------------------
+class InputEventQueue;
+class InputSystem;
+
+//----------------------------------------------------------------------------------------------------
+enum eRecordedAnalog : unsigned char
+{
+    RECORDED_ANALOG_CURSOR_X,
+    RECORDED_ANALOG_CURSOR_Y,
+    RECORDED_ANALOG_LEFT_STICK_X,
+    RECORDED_ANALOG_LEFT_STICK_Y,
+    RECORDED_ANALOG_RIGHT_STICK_X,
+    RECORDED_ANALOG_RIGHT_STICK_Y,
+    RECORDED_ANALOG_LEFT_TRIGGER,
+    RECORDED_ANALOG_RIGHT_TRIGGER,
+    NUM_RECORDED_ANALOGS
+};
+
+//----------------------------------------------------------------------------------------------------
+// Analogs are stored as fixed point with this many steps per unit, so a recording reproduces
+// them to within half a step
+//
+float constexpr RECORDED_ANALOG_STEPS_PER_UNIT = 1024.f;
+
+//----------------------------------------------------------------------------------------------------
+struct sRecordedInputFrame
+{
+    sKeyMask m_keysDown;
+    float    m_analogs[NUM_RECORDED_ANALOGS] = {};     // Indexed by eRecordedAnalog; controller 0 only
+};
+
+//----------------------------------------------------------------------------------------------------
+sRecordedInputFrame CaptureInputFrame(InputSystem& inputSystem);
+
+//----------------------------------------------------------------------------------------------------
+// Writes one frame of input state per RecordFrame call, storing only what changed.
+//
+// A frame is a varint of (number of toggled keys << 1 | analogs changed), the toggled key codes,
+// and, if any analog changed, a byte mask of which ones followed by their zigzag varint deltas,
+// so an idle frame costs one byte. Every m_keyframeInterval frames the previous state is reset
+// to all zeros, which makes that frame decodable on its own; their offsets are written as an
+// index at the end of the file for seeking.
+//
+// Encoding happens on the calling thread into a 64 KB buffer; full buffers are handed to a
+// background thread that does the file writes. After a failed write it writes nothing more, so
+// the file holds whole buffers up to the failure, and StopRecording returns false.
+//
+class InputRecorder
+{
+public:
+    InputRecorder() = default;
+    ~InputRecorder();
+
+    InputRecorder(InputRecorder const&)            = delete;
+    InputRecorder& operator=(InputRecorder const&) = delete;
+
+    bool StartRecording(char const* filePath, int keyframeInterval = 60);
+    void RecordFrame(sRecordedInputFrame const& frame);
+    bool StopRecording();                      // False if any of the recording failed to reach the file
+
+    bool      IsRecording() const;
+    bool      HasWriteFailed() const;
+    int       GetNumFramesRecorded() const;
+    long long GetNumBytesRecorded() const;     // Header, frames and index; once a write fails, only what reached the file
+
+private:
+    void WriteBytes(void const* bytes, size_t numBytes);
+    void WriteVarint(uint32_t value);
+    void SubmitBuffer();
+    void WriterThreadMain();
+
+    FILE*                            m_file             = nullptr;
+    int                              m_keyframeInterval = 60;
+    int                              m_numFrames        = 0;
+    long long                        m_numBytes         = 0;
+    std::vector<uint64_t>            m_keyframeOffsets;
+    sKeyMask                         m_previousKeys;
+    int32_t                          m_previousAnalogs[NUM_RECORDED_ANALOGS] = {};
+    std::vector<uint8_t>             m_buffer;
+
+    std::thread                      m_writerThread;
+    std::mutex                       m_mutex;
+    std::condition_variable          m_condition;
+    std::deque<std::vector<uint8_t>> m_pendingBuffers;
+    std::vector<uint8_t>             m_spareBuffer;
+    bool                             m_isStopping = false;
+    std::atomic<bool>                m_hasWriteFailed{false};
+    std::atomic<long long>           m_numBytesWritten{0};
+};
+
+//----------------------------------------------------------------------------------------------------
+// Memory-maps a recording and decodes it one frame at a time, or jumps to any frame by decoding
+// forward from the keyframe at or before it.
+//
+// A recording without a valid index, such as one from a session that crashed before
+// StopRecording, is scanned once on open to rebuild the frame count and keyframe offsets up to
+// its last complete frame.
+//
+class InputPlayback
+{
+public:
+    InputPlayback() = default;
+    ~InputPlayback();
+
+    InputPlayback(InputPlayback const&)            = delete;
+    InputPlayback& operator=(InputPlayback const&) = delete;
+
+    bool StartPlayback(char const* filePath);
+    void StopPlayback();
+    bool UpdatePlayback(InputSystem& inputSystem);     // Reads the next frame and applies its key changes; false at the end
+    bool UpdatePlayback(InputEventQueue& eventQueue);  // The same, as events for InputFrameDriver to drain; a dropped change is resent next frame
+    bool ReadNextFrame(sRecordedInputFrame& out_frame);
+    bool SeekToFrame(int frameIndex);
+
+    bool                IsPlaybackActive() const;     // A recording is open and has frames left
+    int                 GetNumFrames() const;
+    int                 GetNextFrameIndex() const;
+    sRecordedInputFrame GetCurrentFrame() const;      // The frame last read or played
+
+private:
+    void RebuildIndex();
+    bool DecodeFrame();
+    bool DecodeKeyChanges(sKeyMask& out_changedKeys);     // Decodes the next frame, returning the keys to press or release
+
+    uint8_t const*        m_data             = nullptr;     // The whole mapped file
+    size_t                m_dataSize         = 0;
+    size_t                m_framesEnd        = 0;           // Offset of the keyframe index, or of the end of the last complete frame
+    int                   m_numFrames        = 0;
+    int                   m_keyframeInterval = 60;
+    std::vector<uint64_t> m_keyframeOffsets;
+
+    size_t                m_readOffset                    = 0;
+    int                   m_nextFrameIndex                = 0;
+    sKeyMask              m_keys;
+    int32_t               m_analogs[NUM_RECORDED_ANALOGS] = {};
+    sKeyMask              m_appliedKeys;                        // What UpdatePlayback last sent
+    bool                  m_needsFullKeySync              = true;
+};
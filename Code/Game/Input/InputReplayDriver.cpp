@@ -0,0 +1,165 @@
+//----------------------------------------------------------------------------------------------------
+// InputReplayDriver.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/InputReplayDriver.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "Engine/Input/InputSystem.hpp"
+#include "Game/Input/InputFrameDriver.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    // A sleep can wake up to a scheduler tick late, so pacing sleeps until this long before a frame
+    // is due and spins the rest
+    std::chrono::microseconds constexpr PACING_SPIN_TIME(2000);
+
+    //------------------------------------------------------------------------------------------------
+    // Expects sortedCosts to be sorted ascending
+    //
+    double GetPercentile(std::vector<double> const& sortedCosts,
+                         double const               percentile)
+    {
+        if (sortedCosts.empty())
+        {
+            return 0.0;
+        }
+
+        size_t const index = static_cast<size_t>(percentile * static_cast<double>(sortedCosts.size() - 1) + 0.5);
+
+        return sortedCosts[index];
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+InputReplayDriver::InputReplayDriver(InputSystem&   inputSystem,
+                                     InputPlayback& playback,
+                                     double const   frameSeconds,
+                                     double const   speedMultiplier)
+    : m_inputSystem(inputSystem),
+      m_playback(playback),
+      m_frameSeconds(frameSeconds),
+      m_speedMultiplier(speedMultiplier)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+InputReplayDriver::InputReplayDriver(InputFrameDriver& frameDriver,
+                                     InputPlayback&    playback,
+                                     double const      frameSeconds,
+                                     double const      speedMultiplier)
+    : m_inputSystem(frameDriver.GetInputSystem()),
+      m_frameDriver(&frameDriver),
+      m_playback(playback),
+      m_frameSeconds(frameSeconds),
+      m_speedMultiplier(speedMultiplier)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+sReplayStats InputReplayDriver::Run(ReplayFrameCallback const& simulateFrame,
+                                    int const                  maxFrames)
+{
+    using Clock = std::chrono::steady_clock;
+
+    int const framesLeft = m_playback.GetNumFrames() - m_playback.GetNextFrameIndex();
+    int const numToRun   = (maxFrames >= 0) ? std::min(maxFrames, framesLeft) : framesLeft;
+
+    m_frameCosts.clear();
+    m_frameCosts.reserve(static_cast<size_t>(std::max(numToRun, 0)));
+
+    double const            startSimulatedSeconds = m_simulatedSeconds;
+    int const               startNumDropped       = (m_frameDriver != nullptr) ? m_frameDriver->GetEventQueue().GetNumDropped() : 0;
+    Clock::time_point const runStart              = Clock::now();
+
+    for (int frame = 0; frame < numToRun; ++frame)
+    {
+        if (m_speedMultiplier > 0.0)
+        {
+            std::chrono::duration<double> const simulatedElapsed((m_simulatedSeconds - startSimulatedSeconds) / m_speedMultiplier);
+            Clock::time_point const             deadline = runStart + std::chrono::duration_cast<Clock::duration>(simulatedElapsed);
+
+            std::this_thread::sleep_until(deadline - PACING_SPIN_TIME);
+
+            while (Clock::now() < deadline)
+            {
+            }
+        }
+
+        Clock::time_point const frameStart = Clock::now();
+
+        if (m_frameDriver != nullptr)
+        {
+            if (!m_playback.UpdatePlayback(m_frameDriver->GetEventQueue()))
+            {
+                break;
+            }
+
+            m_frameDriver->BeginFrame();
+        }
+        else if (!m_playback.UpdatePlayback(m_inputSystem))
+        {
+            break;
+        }
+
+        m_simulatedSeconds += m_frameSeconds;
+
+        if (simulateFrame)
+        {
+            simulateFrame(m_inputSystem, m_playback.GetCurrentFrame(), m_frameSeconds);
+        }
+
+        if (m_frameDriver != nullptr)
+        {
+            m_frameDriver->EndFrame();
+        }
+        else
+        {
+            m_inputSystem.EndFrame();
+        }
+
+        ++m_numFrames;
+
+        std::chrono::duration<double, std::micro> const frameCost = Clock::now() - frameStart;
+        m_frameCosts.push_back(frameCost.count());
+    }
+
+    std::chrono::duration<double> const wallElapsed = Clock::now() - runStart;
+
+    sReplayStats stats;
+    stats.m_numFrames        = static_cast<int>(m_frameCosts.size());
+    stats.m_simulatedSeconds = m_simulatedSeconds - startSimulatedSeconds;
+    stats.m_wallSeconds      = wallElapsed.count();
+    stats.m_numDroppedEvents = (m_frameDriver != nullptr) ? m_frameDriver->GetEventQueue().GetNumDropped() - startNumDropped : 0;
+
+    if (stats.m_wallSeconds > 0.0)
+    {
+        stats.m_framesPerSecond = stats.m_numFrames / stats.m_wallSeconds;
+        stats.m_speedup         = stats.m_simulatedSeconds / stats.m_wallSeconds;
+    }
+
+    std::sort(m_frameCosts.begin(), m_frameCosts.end());
+    stats.m_frameCostP50 = GetPercentile(m_frameCosts, 0.50);
+    stats.m_frameCostP90 = GetPercentile(m_frameCosts, 0.90);
+    stats.m_frameCostP99 = GetPercentile(m_frameCosts, 0.99);
+    stats.m_frameCostMax = m_frameCosts.empty() ? 0.0 : m_frameCosts.back();
+
+    return stats;
+}
+
+//----------------------------------------------------------------------------------------------------
+double InputReplayDriver::GetSimulatedSeconds() const
+{
+    return m_simulatedSeconds;
+}
+
+//----------------------------------------------------------------------------------------------------
+int InputReplayDriver::GetNumFramesReplayed() const
+{
+    return m_numFrames;
+}
@@ -0,0 +1,70 @@
+//----------------------------------------------------------------------------------------------------
+// InputReplayDriver.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <functional>
+#include <vector>
+
+#include "Game/Input/InputRecording.hpp"
+
+//----------------------------------------------------------------------------------------------------
+class InputFrameDriver;
+
+//----------------------------------------------------------------------------------------------------
+// Called once per replayed frame, after its keys reach the InputSystem and before EndFrame
+//
+using ReplayFrameCallback = std::function<void(InputSystem& inputSystem, sRecordedInputFrame const& frame, double deltaSeconds)>;
+
+//----------------------------------------------------------------------------------------------------
+struct sReplayStats
+{
+    int    m_numFrames        = 0;
+    double m_simulatedSeconds = 0.0;
+    double m_wallSeconds      = 0.0;
+    double m_framesPerSecond  = 0.0;     // Wall-clock frame rate of the replay
+    double m_speedup          = 0.0;     // Simulated seconds per wall-clock second
+    double m_frameCostP50     = 0.0;     // Per-frame cost percentiles, in microseconds
+    double m_frameCostP90     = 0.0;
+    double m_frameCostP99     = 0.0;
+    double m_frameCostMax     = 0.0;
+    int    m_numDroppedEvents = 0;       // Key events the frame driver's full queue dropped; each is resent the next frame
+};
+
+//----------------------------------------------------------------------------------------------------
+// Replays a recording through an InputSystem on a simulated clock that is decoupled from the wall
+// clock: every frame advances simulated time by a fixed step no matter how long it took, so an
+// hour of recorded play can be pushed through the simulation as fast as the CPU allows.
+//
+// With a speed multiplier above zero the replay is paced instead, to that many simulated seconds
+// per wall-clock second. It sleeps until each frame is due and spins only for the last stretch,
+// which a sleep could overshoot.
+//
+// Given an InputFrameDriver, each frame's key changes go through its event queue and its headless
+// BeginFrame and EndFrame, so replayed keys take the same per-frame path as live keys, history and
+// latency tracking included. Only keys are replayed that way: BeginFrame still takes the cursor
+// and controllers from the driver's own backend, and the recorded analogs reach only the frame
+// passed to the callback. Given only an InputSystem, key changes are applied to it directly.
+//
+class InputReplayDriver
+{
+public:
+    InputReplayDriver(InputSystem& inputSystem, InputPlayback& playback, double frameSeconds = 1.0 / 60.0, double speedMultiplier = 0.0);
+    InputReplayDriver(InputFrameDriver& frameDriver, InputPlayback& playback, double frameSeconds = 1.0 / 60.0, double speedMultiplier = 0.0);
+
+    sReplayStats Run(ReplayFrameCallback const& simulateFrame, int maxFrames = -1);     // Until the recording ends or maxFrames
+
+    double GetSimulatedSeconds() const;
+    int    GetNumFramesReplayed() const;
+
+private:
+    InputSystem&        m_inputSystem;
+    InputFrameDriver*   m_frameDriver      = nullptr;
+    InputPlayback&      m_playback;
+    double              m_frameSeconds     = 1.0 / 60.0;
+    double              m_speedMultiplier  = 0.0;
+    double              m_simulatedSeconds = 0.0;
+    int                 m_numFrames        = 0;
+    std::vector<double> m_frameCosts;
+};
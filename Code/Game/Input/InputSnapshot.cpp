@@ -0,0 +1,46 @@
+//----------------------------------------------------------------------------------------------------
+// InputSnapshot.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/InputSnapshot.hpp"
+
+#include <cmath>
+#include <cstring>
+
+//----------------------------------------------------------------------------------------------------
+int16_t QuantizeStickAxis(float const axis)
+{
+    float const clampedAxis = (axis < -1.f) ? -1.f : ((axis > 1.f) ? 1.f : axis);
+
+    return static_cast<int16_t>(std::lround(clampedAxis * INPUT_SNAPSHOT_STICK_STEPS));
+}
+
+//----------------------------------------------------------------------------------------------------
+float DequantizeStickAxis(int16_t const quantizedAxis)
+{
+    // Quantize never gives -32768, but a snapshot from elsewhere might
+    float const axis = static_cast<float>(quantizedAxis) / INPUT_SNAPSHOT_STICK_STEPS;
+
+    return (axis < -1.f) ? -1.f : axis;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint16_t QuantizeTrigger(float const trigger)
+{
+    float const clampedTrigger = (trigger < 0.f) ? 0.f : ((trigger > 1.f) ? 1.f : trigger);
+
+    return static_cast<uint16_t>(std::lround(clampedTrigger * INPUT_SNAPSHOT_TRIGGER_STEPS));
+}
+
+//----------------------------------------------------------------------------------------------------
+float DequantizeTrigger(uint16_t const quantizedTrigger)
+{
+    return static_cast<float>(quantizedTrigger) / INPUT_SNAPSHOT_TRIGGER_STEPS;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool sInputSnapshot::operator==(sInputSnapshot const& compare) const
+{
+    return memcmp(this, &compare, sizeof(sInputSnapshot)) == 0;
+}
@@ -0,0 +1,65 @@
+//----------------------------------------------------------------------------------------------------
+// InputSnapshot.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <type_traits>
+
+#include "Engine/Input/InputSystem.hpp"
+#include "Game/Input/KeyStateBitset.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// XInput's own resolution: sticks are signed 16-bit and triggers are stored at 16 bits, so nothing
+// a controller reports is lost
+//
+float constexpr INPUT_SNAPSHOT_STICK_STEPS   = 32767.f;    // Per unit, either way from center
+float constexpr INPUT_SNAPSHOT_TRIGGER_STEPS = 65535.f;
+
+//----------------------------------------------------------------------------------------------------
+int16_t  QuantizeStickAxis(float axis);            // Clamped to [-1, 1]
+float    DequantizeStickAxis(int16_t quantizedAxis);
+uint16_t QuantizeTrigger(float trigger);           // Clamped to [0, 1]
+float    DequantizeTrigger(uint16_t quantizedTrigger);
+
+//----------------------------------------------------------------------------------------------------
+struct sInputSnapshotController
+{
+    uint16_t m_buttonsDown          = 0;           // Bit per XboxButtonID
+    uint16_t m_buttonsDownLastFrame = 0;
+    int16_t  m_leftStickRaw[2]      = {};
+    int16_t  m_rightStickRaw[2]     = {};
+    uint16_t m_leftTrigger          = 0;
+    uint16_t m_rightTrigger         = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// InputFrameDriver's key, controller and cursor state for one frame in 160 trivially copyable
+// bytes, for rollback and replay to save every frame and restore many times a frame. The driver's
+// InputHistory is not in it: restoring rewinds the history by the frames played since, and its
+// latency stats are not rewound at all.
+//
+// Keys and buttons are bitsets for this frame and the last, so just pressed and just released
+// survive a restore. Raw stick and trigger values are quantized; the driver quantizes them the
+// same way when it samples a controller, so a restored frame reads back exactly as it was played
+// and resimulation stays deterministic. Deadzone corrected positions are recomputed on restore.
+//
+// There is no padding, so snapshots can be compared, hashed or sent as raw bytes.
+//
+struct alignas(32) sInputSnapshot
+{
+    sKeyMask                 m_keysDown;
+    sKeyMask                 m_keysDownLastFrame;
+    sInputSnapshotController m_controllers[NUM_XBOX_CONTROLLERS];
+    float                    m_cursorClientPosition[2]   = {};
+    float                    m_cursorClientDimensions[2] = {};
+    float                    m_cursorClientDelta[2]      = {};
+    int32_t                  m_frameNumber               = 0;
+    uint32_t                 m_connectedControllers      = 0;      // Bit per controller index
+
+    bool operator==(sInputSnapshot const& compare) const;
+};
+
+static_assert(std::is_trivially_copyable_v<sInputSnapshot>, "Snapshots are saved and restored as raw bytes");
+static_assert(sizeof(sInputSnapshot) == 160, "sInputSnapshot should have no padding");
@@ -0,0 +1,199 @@
+//----------------------------------------------------------------------------------------------------
+// KeyStateBitset.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/KeyStateBitset.hpp"
+
+#include <bit>
+#include <emmintrin.h>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    __m128i LoadLow(sKeyMask const& mask)
+    {
+        return _mm_load_si128(reinterpret_cast<__m128i const*>(&mask.m_words[0]));
+    }
+
+    //------------------------------------------------------------------------------------------------
+    __m128i LoadHigh(sKeyMask const& mask)
+    {
+        return _mm_load_si128(reinterpret_cast<__m128i const*>(&mask.m_words[2]));
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void Store(sKeyMask&     out_mask,
+               __m128i const low,
+               __m128i const high)
+    {
+        _mm_store_si128(reinterpret_cast<__m128i*>(&out_mask.m_words[0]), low);
+        _mm_store_si128(reinterpret_cast<__m128i*>(&out_mask.m_words[2]), high);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    bool IsNonZero(__m128i const low,
+                   __m128i const high)
+    {
+        __m128i const combined = _mm_or_si128(low, high);
+
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(combined, _mm_setzero_si128())) != 0xFFFF;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool sKeyMask::Test(unsigned char const keyCode) const
+{
+    return (m_words[keyCode >> 6] >> (keyCode & 63)) & 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+void sKeyMask::Set(unsigned char const keyCode)
+{
+    m_words[keyCode >> 6] |= uint64_t{1} << (keyCode & 63);
+}
+
+//----------------------------------------------------------------------------------------------------
+void sKeyMask::Reset(unsigned char const keyCode)
+{
+    m_words[keyCode >> 6] &= ~(uint64_t{1} << (keyCode & 63));
+}
+
+//----------------------------------------------------------------------------------------------------
+bool sKeyMask::IsAnySet() const
+{
+    return IsNonZero(LoadLow(*this), LoadHigh(*this));
+}
+
+//----------------------------------------------------------------------------------------------------
+bool sKeyMask::Intersects(sKeyMask const& other) const
+{
+    return IsNonZero(_mm_and_si128(LoadLow(*this), LoadLow(other)),
+                     _mm_and_si128(LoadHigh(*this), LoadHigh(other)));
+}
+
+//----------------------------------------------------------------------------------------------------
+int sKeyMask::GetCount() const
+{
+    return std::popcount(m_words[0]) + std::popcount(m_words[1]) + std::popcount(m_words[2]) + std::popcount(m_words[3]);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool sKeyMask::operator==(sKeyMask const& compare) const
+{
+    __m128i const lowEqual  = _mm_cmpeq_epi8(LoadLow(*this), LoadLow(compare));
+    __m128i const highEqual = _mm_cmpeq_epi8(LoadHigh(*this), LoadHigh(compare));
+
+    return _mm_movemask_epi8(_mm_and_si128(lowEqual, highEqual)) == 0xFFFF;
+}
+
+//----------------------------------------------------------------------------------------------------
+void KeyStateBitset::HandleKeyPressed(unsigned char const keyCode)
+{
+    m_isDown.Set(keyCode);
+}
+
+//----------------------------------------------------------------------------------------------------
+void KeyStateBitset::HandleKeyReleased(unsigned char const keyCode)
+{
+    m_isDown.Reset(keyCode);
+}
+
+//----------------------------------------------------------------------------------------------------
+void KeyStateBitset::EndFrame()
+{
+    Store(m_wasDownLastFrame, LoadLow(m_isDown), LoadHigh(m_isDown));
+}
+
+//----------------------------------------------------------------------------------------------------
+void KeyStateBitset::Clear()
+{
+    m_isDown           = sKeyMask();
+    m_wasDownLastFrame = sKeyMask();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool KeyStateBitset::IsKeyDown(unsigned char const keyCode) const
+{
+    return m_isDown.Test(keyCode);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool KeyStateBitset::WasKeyJustPressed(unsigned char const keyCode) const
+{
+    int const      wordIndex = keyCode >> 6;
+    uint64_t const changed   = m_isDown.m_words[wordIndex] & ~m_wasDownLastFrame.m_words[wordIndex];
+
+    return (changed >> (keyCode & 63)) & 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool KeyStateBitset::WasKeyJustReleased(unsigned char const keyCode) const
+{
+    int const      wordIndex = keyCode >> 6;
+    uint64_t const changed   = ~m_isDown.m_words[wordIndex] & m_wasDownLastFrame.m_words[wordIndex];
+
+    return (changed >> (keyCode & 63)) & 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool KeyStateBitset::IsAnyKeyDown() const
+{
+    return m_isDown.IsAnySet();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool KeyStateBitset::WasAnyKeyJustPressed() const
+{
+    // _mm_andnot_si128(a, b) is ~a & b
+    return IsNonZero(_mm_andnot_si128(LoadLow(m_wasDownLastFrame), LoadLow(m_isDown)),
+                     _mm_andnot_si128(LoadHigh(m_wasDownLastFrame), LoadHigh(m_isDown)));
+}
+
+//----------------------------------------------------------------------------------------------------
+bool KeyStateBitset::WasAnyKeyJustReleased() const
+{
+    return IsNonZero(_mm_andnot_si128(LoadLow(m_isDown), LoadLow(m_wasDownLastFrame)),
+                     _mm_andnot_si128(LoadHigh(m_isDown), LoadHigh(m_wasDownLastFrame)));
+}
+
+//----------------------------------------------------------------------------------------------------
+int KeyStateBitset::GetNumKeysDown() const
+{
+    return m_isDown.GetCount();
+}
+
+//----------------------------------------------------------------------------------------------------
+sKeyMask const& KeyStateBitset::GetDownMask() const
+{
+    return m_isDown;
+}
+
+//----------------------------------------------------------------------------------------------------
+sKeyMask const& KeyStateBitset::GetPreviousDownMask() const
+{
+    return m_wasDownLastFrame;
+}
+
+//----------------------------------------------------------------------------------------------------
+sKeyMask KeyStateBitset::GetJustPressedMask() const
+{
+    sKeyMask mask;
+    Store(mask,
+          _mm_andnot_si128(LoadLow(m_wasDownLastFrame), LoadLow(m_isDown)),
+          _mm_andnot_si128(LoadHigh(m_wasDownLastFrame), LoadHigh(m_isDown)));
+
+    return mask;
+}
+
+//----------------------------------------------------------------------------------------------------
+sKeyMask KeyStateBitset::GetJustReleasedMask() const
+{
+    sKeyMask mask;
+    Store(mask,
+          _mm_andnot_si128(LoadLow(m_isDown), LoadLow(m_wasDownLastFrame)),
+          _mm_andnot_si128(LoadHigh(m_isDown), LoadHigh(m_wasDownLastFrame)));
+
+    return mask;
+}
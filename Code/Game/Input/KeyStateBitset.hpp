@@ -0,0 +1,60 @@
+//----------------------------------------------------------------------------------------------------
+// KeyStateBitset.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+
+//----------------------------------------------------------------------------------------------------
+// One bit per key code
+//
+struct alignas(32) sKeyMask
+{
+    uint64_t m_words[4] = {};
+
+    bool Test(unsigned char keyCode) const;
+    void Set(unsigned char keyCode);
+    void Reset(unsigned char keyCode);
+
+    bool IsAnySet() const;
+    bool Intersects(sKeyMask const& other) const;   // Any key set in both
+    int  GetCount() const;
+
+    bool operator==(sKeyMask const& compare) const;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Keyboard state as two 256-bit masks, one for this frame and one for last frame, in place of a
+// pair of bools per key.
+//
+// EndFrame copies the current mask over the previous one in two 128-bit moves instead of walking
+// every key, just pressed / just released are single bit tests, and the bulk queries answer
+// "any key" and "which keys" for the whole keyboard with a handful of SSE2 operations.
+//
+class KeyStateBitset
+{
+public:
+    void HandleKeyPressed(unsigned char keyCode);
+    void HandleKeyReleased(unsigned char keyCode);
+    void EndFrame();
+    void Clear();
+
+    bool IsKeyDown(unsigned char keyCode) const;
+    bool WasKeyJustPressed(unsigned char keyCode) const;
+    bool WasKeyJustReleased(unsigned char keyCode) const;
+
+    bool IsAnyKeyDown() const;
+    bool WasAnyKeyJustPressed() const;
+    bool WasAnyKeyJustReleased() const;
+    int  GetNumKeysDown() const;
+
+    sKeyMask const& GetDownMask() const;
+    sKeyMask const& GetPreviousDownMask() const;
+    sKeyMask        GetJustPressedMask() const;
+    sKeyMask        GetJustReleasedMask() const;
+
+private:
+    sKeyMask m_isDown;
+    sKeyMask m_wasDownLastFrame;
+};
@@ -0,0 +1,206 @@
+//----------------------------------------------------------------------------------------------------
+// StickProcessor.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/StickProcessor.hpp"
+
+#include <cmath>
+#include <emmintrin.h>
+
+//----------------------------------------------------------------------------------------------------
+static_assert(sizeof(Vec2) == 2 * sizeof(float), "ProcessSticks loads Vec2 arrays as packed floats");
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    float GetPresetCurveValue(eStickResponseCurve const curve,
+                              float const               magnitude)
+    {
+        switch (curve)
+        {
+        case eStickResponseCurve::QUADRATIC: return magnitude * magnitude;
+        case eStickResponseCurve::CUBIC:     return magnitude * magnitude * magnitude;
+        default:                             return magnitude;
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // What each of four raw positions is multiplied by to correct it and apply the curve
+    //
+    __m128 GetStickScales(__m128 const       x,
+                          __m128 const       y,
+                          float const        innerDeadZoneFraction,
+                          float const        inverseDeadZoneRange,
+                          float const* const table)
+    {
+        __m128 const zero = _mm_setzero_ps();
+
+        __m128 const length    = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)));
+        __m128 const magnitude = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_sub_ps(length, _mm_set1_ps(innerDeadZoneFraction)), _mm_set1_ps(inverseDeadZoneRange)), zero), _mm_set1_ps(1.f));
+
+        // Magnitude is never negative, so truncation is floor
+        __m128 const  position = _mm_mul_ps(magnitude, _mm_set1_ps(static_cast<float>(STICK_RESPONSE_TABLE_SIZE)));
+        __m128i const index    = _mm_cvttps_epi32(position);
+        __m128 const  fraction = _mm_sub_ps(position, _mm_cvtepi32_ps(index));
+
+        alignas(16) int indices[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(indices), index);
+
+        __m128 const low   = _mm_setr_ps(table[indices[0]], table[indices[1]], table[indices[2]], table[indices[3]]);
+        __m128 const high  = _mm_setr_ps(table[indices[0] + 1], table[indices[1] + 1], table[indices[2] + 1], table[indices[3] + 1]);
+        __m128 const curve = _mm_add_ps(low, _mm_mul_ps(_mm_sub_ps(high, low), fraction));
+
+        // A centered stick divides by zero; the mask turns its scale to 0 instead of NaN
+        return _mm_and_ps(_mm_cmpgt_ps(length, zero), _mm_div_ps(curve, length));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+StickResponseCurve::StickResponseCurve(eStickResponseCurve const curve)
+{
+    Bake([curve](float const magnitude)
+    {
+        return GetPresetCurveValue(curve, magnitude);
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+StickResponseCurve::StickResponseCurve(std::function<float(float)> const& curve)
+{
+    Bake(curve);
+}
+
+//----------------------------------------------------------------------------------------------------
+float StickResponseCurve::Evaluate(float const magnitude) const
+{
+    // Written so NaN clamps to 0, as it does in GetStickScales, rather than indexing past the table
+    float const clamped  = !(magnitude > 0.f) ? 0.f : ((magnitude < 1.f) ? magnitude : 1.f);
+    float const position = clamped * static_cast<float>(STICK_RESPONSE_TABLE_SIZE);
+    int const   index    = static_cast<int>(position);
+    float const fraction = position - static_cast<float>(index);
+
+    return m_table[index] + (m_table[index + 1] - m_table[index]) * fraction;
+}
+
+//----------------------------------------------------------------------------------------------------
+void StickResponseCurve::Bake(std::function<float(float)> const& curve)
+{
+    for (int entryIndex = 0; entryIndex <= STICK_RESPONSE_TABLE_SIZE; ++entryIndex)
+    {
+        m_table[entryIndex] = curve(static_cast<float>(entryIndex) / static_cast<float>(STICK_RESPONSE_TABLE_SIZE));
+    }
+
+    m_table[STICK_RESPONSE_TABLE_SIZE + 1] = m_table[STICK_RESPONSE_TABLE_SIZE];
+}
+
+//----------------------------------------------------------------------------------------------------
+StickProcessor::StickProcessor(float const innerDeadZoneFraction,
+                               float const outerDeadZoneFraction)
+{
+    SetDeadZoneFractions(innerDeadZoneFraction, outerDeadZoneFraction);
+}
+
+//----------------------------------------------------------------------------------------------------
+void StickProcessor::SetDeadZoneFractions(float const innerDeadZoneFraction,
+                                          float const outerDeadZoneFraction)
+{
+    m_innerDeadZoneFraction = innerDeadZoneFraction;
+    m_outerDeadZoneFraction = outerDeadZoneFraction;
+    m_inverseDeadZoneRange  = 1.f / (outerDeadZoneFraction - innerDeadZoneFraction);
+}
+
+//----------------------------------------------------------------------------------------------------
+void StickProcessor::SetResponseCurve(StickResponseCurve const& curve)
+{
+    m_curve = curve;
+}
+
+//----------------------------------------------------------------------------------------------------
+StickResponseCurve const& StickProcessor::GetResponseCurve() const
+{
+    return m_curve;
+}
+
+//----------------------------------------------------------------------------------------------------
+Vec2 StickProcessor::ProcessStick(Vec2 const& rawPosition) const
+{
+    float const scale = GetScale(rawPosition.x, rawPosition.y);
+
+    return Vec2(rawPosition.x * scale, rawPosition.y * scale);
+}
+
+//----------------------------------------------------------------------------------------------------
+void StickProcessor::ProcessSticks(Vec2 const* const rawPositions,
+                                   Vec2* const       out_positions,
+                                   int const         numSticks) const
+{
+    float const* const rawFloats = reinterpret_cast<float const*>(rawPositions);
+    float* const       outFloats = reinterpret_cast<float*>(out_positions);
+
+    int stickIndex = 0;
+
+    for (; stickIndex + 4 <= numSticks; stickIndex += 4)
+    {
+        // x0 y0 x1 y1 and x2 y2 x3 y3 into x0 x1 x2 x3 and y0 y1 y2 y3
+        __m128 const first  = _mm_loadu_ps(rawFloats + stickIndex * 2);
+        __m128 const second = _mm_loadu_ps(rawFloats + stickIndex * 2 + 4);
+        __m128 const x      = _mm_shuffle_ps(first, second, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 const y      = _mm_shuffle_ps(first, second, _MM_SHUFFLE(3, 1, 3, 1));
+
+        __m128 const scale = GetStickScales(x, y, m_innerDeadZoneFraction, m_inverseDeadZoneRange, m_curve.m_table);
+        __m128 const outX  = _mm_mul_ps(x, scale);
+        __m128 const outY  = _mm_mul_ps(y, scale);
+
+        _mm_storeu_ps(outFloats + stickIndex * 2, _mm_unpacklo_ps(outX, outY));
+        _mm_storeu_ps(outFloats + stickIndex * 2 + 4, _mm_unpackhi_ps(outX, outY));
+    }
+
+    for (; stickIndex < numSticks; ++stickIndex)
+    {
+        out_positions[stickIndex] = ProcessStick(rawPositions[stickIndex]);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void StickProcessor::ProcessSticks(float const* const rawXs,
+                                   float const* const rawYs,
+                                   float* const       out_xs,
+                                   float* const       out_ys,
+                                   int const          numSticks) const
+{
+    int stickIndex = 0;
+
+    for (; stickIndex + 4 <= numSticks; stickIndex += 4)
+    {
+        __m128 const x     = _mm_loadu_ps(rawXs + stickIndex);
+        __m128 const y     = _mm_loadu_ps(rawYs + stickIndex);
+        __m128 const scale = GetStickScales(x, y, m_innerDeadZoneFraction, m_inverseDeadZoneRange, m_curve.m_table);
+
+        _mm_storeu_ps(out_xs + stickIndex, _mm_mul_ps(x, scale));
+        _mm_storeu_ps(out_ys + stickIndex, _mm_mul_ps(y, scale));
+    }
+
+    for (; stickIndex < numSticks; ++stickIndex)
+    {
+        float const scale = GetScale(rawXs[stickIndex], rawYs[stickIndex]);
+
+        out_xs[stickIndex] = rawXs[stickIndex] * scale;
+        out_ys[stickIndex] = rawYs[stickIndex] * scale;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+float StickProcessor::GetScale(float const rawX,
+                               float const rawY) const
+{
+    float const length = std::sqrt(rawX * rawX + rawY * rawY);
+
+    if (length <= 0.f)
+    {
+        return 0.f;
+    }
+
+    return m_curve.Evaluate((length - m_innerDeadZoneFraction) * m_inverseDeadZoneRange) / length;
+}
@@ -0,0 +1,74 @@
+//----------------------------------------------------------------------------------------------------
+// StickProcessor.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <functional>
+
+#include "Engine/Math/Vec2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+int constexpr STICK_RESPONSE_TABLE_SIZE = 256;
+
+//----------------------------------------------------------------------------------------------------
+enum class eStickResponseCurve : unsigned char
+{
+    LINEAR,
+    QUADRATIC,
+    CUBIC,
+};
+
+//----------------------------------------------------------------------------------------------------
+// A response curve over the deadzone-corrected stick magnitude, [0, 1] -> [0, 1], baked into a
+// table and linearly interpolated, so a curve costs the same at runtime however it is defined.
+//
+class StickResponseCurve
+{
+public:
+    explicit StickResponseCurve(eStickResponseCurve curve = eStickResponseCurve::LINEAR);
+    explicit StickResponseCurve(std::function<float(float)> const& curve);
+
+    float Evaluate(float magnitude) const;
+
+private:
+    friend class StickProcessor;
+
+    void Bake(std::function<float(float)> const& curve);
+
+    // One extra entry past the end repeats the last, so a magnitude of exactly 1 needs no clamp
+    float m_table[STICK_RESPONSE_TABLE_SIZE + 2];
+};
+
+//----------------------------------------------------------------------------------------------------
+// AnalogJoystick's inner/outer deadzone correction followed by a response curve, for many sticks
+// at once.
+//
+// AnalogJoystick goes through atan2, cos and sin to rebuild the corrected position from its polar
+// form. Since correction only rescales the raw position along its own direction, this scales it by
+// curve(t) / length instead, with t the magnitude mapped from [inner, outer] to [0, 1].
+// ProcessSticks does that for four sticks per SSE2 pass, so every stick of every controller is
+// corrected in one call; the overload taking x and y streams skips the shuffles.
+//
+class StickProcessor
+{
+public:
+    explicit StickProcessor(float innerDeadZoneFraction = 0.3f, float outerDeadZoneFraction = 0.95f);
+
+    void SetDeadZoneFractions(float innerDeadZoneFraction, float outerDeadZoneFraction);
+    void SetResponseCurve(StickResponseCurve const& curve);
+
+    StickResponseCurve const& GetResponseCurve() const;
+
+    Vec2 ProcessStick(Vec2 const& rawPosition) const;
+    void ProcessSticks(Vec2 const* rawPositions, Vec2* out_positions, int numSticks) const;
+    void ProcessSticks(float const* rawXs, float const* rawYs, float* out_xs, float* out_ys, int numSticks) const;   // Separate x and y streams
+
+private:
+    float GetScale(float rawX, float rawY) const;
+
+    float              m_innerDeadZoneFraction = 0.3f;
+    float              m_outerDeadZoneFraction = 0.95f;
+    float              m_inverseDeadZoneRange  = 1.f / 0.65f;
+    StickResponseCurve m_curve;
+};
@@ -0,0 +1,409 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_ControllerPoller.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/UnitTests_ControllerPoller.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Input/ControllerPoller.hpp"
+#include "Game/Input/InputFrameDriver.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // Stands in for XInput: safe to poll from any thread, and a poll of an empty slot spins for a
+    // fixed stall the way XInputGetState does on a disconnected controller
+    //
+    class StallingControllerBackend : public InputBackend
+    {
+    public:
+        explicit StallingControllerBackend(int const disconnectedStallMicroseconds)
+            : m_disconnectedStall(std::chrono::microseconds(disconnectedStallMicroseconds))
+        {
+        }
+
+        void SetConnected(int const  controllerIndex,
+                          bool const isConnected)
+        {
+            m_isConnected[controllerIndex].store(isConnected);
+        }
+
+        void SetButtons(int const      controllerIndex,
+                        uint16_t const buttonsDown)
+        {
+            m_buttonsDown[controllerIndex].store(buttonsDown);
+        }
+
+        int GetNumPolls(int const controllerIndex) const
+        {
+            return m_numPolls[controllerIndex].load();
+        }
+
+        bool Startup() override { return true; }
+        void Shutdown() override {}
+        void PumpEvents(InputEventQueue&) override {}
+
+        sCursorSample GetCursorSample() const override { return sCursorSample(); }
+
+        sControllerSample PollController(int const controllerIndex) override
+        {
+            m_numPolls[controllerIndex].fetch_add(1);
+
+            sControllerSample sample;
+
+            if (!m_isConnected[controllerIndex].load())
+            {
+                std::chrono::steady_clock::time_point const stallEnd = std::chrono::steady_clock::now() + m_disconnectedStall;
+
+                while (std::chrono::steady_clock::now() < stallEnd)
+                {
+                }
+
+                return sample;
+            }
+
+            // The trigger mirrors the buttons so a torn read would show up as a mismatch
+            uint16_t const buttonsDown = m_buttonsDown[controllerIndex].load();
+            sample.m_isConnected       = true;
+            sample.m_buttonsDown       = buttonsDown;
+            sample.m_leftTrigger       = static_cast<float>(buttonsDown) / 65535.0f;
+
+            return sample;
+        }
+
+    private:
+        std::chrono::steady_clock::duration m_disconnectedStall;
+        std::atomic<bool>                   m_isConnected[NUM_XBOX_CONTROLLERS]{};
+        std::atomic<uint16_t>               m_buttonsDown[NUM_XBOX_CONTROLLERS]{};
+        std::atomic<int>                    m_numPolls[NUM_XBOX_CONTROLLERS]{};
+    };
+
+    //------------------------------------------------------------------------------------------------
+    // Acquires snapshots until one satisfies the condition or the timeout runs out
+    //
+    template <typename Condition>
+    bool WaitForSnapshot(ControllerPoller& poller,
+                         Condition         condition,
+                         double const      timeoutSeconds = 2.0)
+    {
+        std::chrono::steady_clock::time_point const deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(timeoutSeconds));
+
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            poller.AcquireLatest();
+
+            if (condition(poller.GetSnapshot()))
+            {
+                return true;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return false;
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_ControllerPoller_Basics()
+{
+#if defined(ENABLE_TestSet_ControllerPoller_Basics)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_ControllerPoller_Basics)(start)\n");
+    printf("####################################################################################################\n");
+
+    StallingControllerBackend backend(0);
+    ControllerPoller          poller(backend);
+
+    VerifyTestResult(!poller.IsRunning() && !poller.AcquireLatest() && !poller.GetSnapshot().m_controllers[0].m_isConnected,
+                     "A poller that was never started should have nothing to acquire");
+
+    backend.SetConnected(0, true);
+    backend.SetButtons(0, static_cast<uint16_t>(1u << XBOX_BUTTON_A));
+    poller.Start();
+
+    bool const bConnected = WaitForSnapshot(poller, [](sControllerSnapshot const& snapshot)
+    {
+        return snapshot.m_controllers[0].m_isConnected && snapshot.m_controllers[0].m_buttonsDown == (1u << XBOX_BUTTON_A);
+    });
+    VerifyTestResult(poller.IsRunning() && bConnected && !poller.GetSnapshot().m_controllers[1].m_isConnected,
+                     "The polling thread should publish connected controllers and their buttons");
+
+    backend.SetConnected(0, false);
+    bool const bDisconnected = WaitForSnapshot(poller, [](sControllerSnapshot const& snapshot)
+    {
+        return !snapshot.m_controllers[0].m_isConnected;
+    });
+    VerifyTestResult(bDisconnected, "A controller that goes away should be published as disconnected");
+
+    poller.Stop();
+    uint64_t const numCyclesAtStop = poller.GetNumPollCycles();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    VerifyTestResult(!poller.IsRunning() && poller.GetNumPollCycles() == numCyclesAtStop, "Stop should end the polling thread");
+
+    // Through InputFrameDriver
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    InputFrameDriver            driver(inputSystem, backend);
+
+    backend.SetConnected(2, true);
+    backend.SetButtons(2, static_cast<uint16_t>(1u << XBOX_BUTTON_START));
+    driver.SetControllerPoller(&poller);
+    driver.Startup();
+    poller.Start();
+
+    WaitForSnapshot(poller, [](sControllerSnapshot const& snapshot)
+    {
+        return snapshot.m_controllers[2].m_isConnected;
+    });
+
+    // Stopped, so any further backend poll would have to come from BeginFrame
+    poller.Stop();
+    int const numBackendPolls = backend.GetNumPolls(2);
+    driver.BeginFrame();
+    VerifyTestResult(driver.IsControllerConnected(2) && driver.IsButtonDown(2, XBOX_BUTTON_START) && driver.WasButtonJustPressed(2, XBOX_BUTTON_START),
+                     "InputFrameDriver should read controllers from the poller's snapshot");
+    VerifyTestResult(backend.GetNumPolls(2) == numBackendPolls, "BeginFrame should not poll the backend itself while a poller is set");
+
+    driver.EndFrame();
+    driver.Shutdown();
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_ControllerPoller_Basics)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 6; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_ControllerPoller_Backoff()
+{
+#if defined(ENABLE_TestSet_ControllerPoller_Backoff)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_ControllerPoller_Backoff)(start)\n");
+    printf("####################################################################################################\n");
+
+    StallingControllerBackend backend(0);
+    sControllerPollerConfig   pollerConfig;
+    pollerConfig.m_disconnectedBackoffSeconds = 0.01;
+    pollerConfig.m_maxBackoffSeconds          = 0.04;
+
+    ControllerPoller poller(backend, pollerConfig);
+    backend.SetConnected(0, true);
+
+    // Driven one cycle per simulated millisecond, so the counts do not depend on the scheduler
+    std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+
+    for (int cycle = 0; cycle < 200; ++cycle)
+    {
+        poller.PollOnce(start + std::chrono::milliseconds(cycle));
+    }
+
+    int const numConnectedPolls    = poller.GetNumPolls(0);
+    int const numDisconnectedPolls = poller.GetNumPolls(1);
+    printf("  200 cycles 1 ms apart: %d polls of the connected slot, %d of each empty one\n", numConnectedPolls, numDisconnectedPolls);
+
+    VerifyTestResult(numConnectedPolls == 200 && poller.GetNumPollCycles() == 200, "A connected slot should be polled every cycle");
+
+    // Empty slots are polled at 0, 10, 30, 70, 110, 150 and 190 ms: 10, 20, 40, 40... ms apart
+    VerifyTestResult(numDisconnectedPolls == 7 && poller.GetNumPolls(3) == 7, "Empty slots should back off exponentially up to the maximum");
+
+    // Slot 3 was last polled at 190 ms, so a controller plugged in now is found at 230 ms
+    backend.SetConnected(3, true);
+
+    int foundCycle = -1;
+    for (int cycle = 200; cycle < 300 && foundCycle < 0; ++cycle)
+    {
+        poller.PollOnce(start + std::chrono::milliseconds(cycle));
+        poller.AcquireLatest();
+
+        if (poller.GetSnapshot().m_controllers[3].m_isConnected)
+        {
+            foundCycle = cycle;
+        }
+    }
+    VerifyTestResult(foundCycle == 230, "A newly connected controller should be found when its backoff runs out");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_ControllerPoller_Backoff)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 3; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_ControllerPoller_TripleBuffer()
+{
+#if defined(ENABLE_TestSet_ControllerPoller_TripleBuffer)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_ControllerPoller_TripleBuffer)(start)\n");
+    printf("####################################################################################################\n");
+
+    StallingControllerBackend backend(0);
+    sControllerPollerConfig   pollerConfig;
+    pollerConfig.m_pollRateHz = 20000.0;
+
+    ControllerPoller poller(backend, pollerConfig);
+
+    for (int controllerIndex = 0; controllerIndex < NUM_XBOX_CONTROLLERS; ++controllerIndex)
+    {
+        backend.SetConnected(controllerIndex, true);
+    }
+
+    // Change the buttons as fast as possible while the game thread acquires
+    std::atomic<bool> bWriting = true;
+    std::thread       writer([&backend, &bWriting]
+    {
+        for (uint16_t value = 0; bWriting.load(); ++value)
+        {
+            backend.SetButtons(value % NUM_XBOX_CONTROLLERS, value);
+        }
+    });
+
+    poller.Start();
+
+    int      numAcquired     = 0;
+    int      numTorn         = 0;
+    bool     bCycleIncreases = true;
+    uint64_t lastCycle       = 0;
+
+    std::chrono::steady_clock::time_point const end = std::chrono::steady_clock::now() + std::chrono::milliseconds(100);
+
+    while (std::chrono::steady_clock::now() < end)
+    {
+        if (!poller.AcquireLatest())
+        {
+            continue;
+        }
+
+        sControllerSnapshot const& snapshot = poller.GetSnapshot();
+        ++numAcquired;
+        bCycleIncreases = bCycleIncreases && snapshot.m_pollCycle > lastCycle;
+        lastCycle       = snapshot.m_pollCycle;
+
+        for (sControllerSample const& sample : snapshot.m_controllers)
+        {
+            if (sample.m_leftTrigger != static_cast<float>(sample.m_buttonsDown) / 65535.0f)
+            {
+                ++numTorn;
+            }
+        }
+    }
+
+    poller.Stop();
+    bWriting.store(false);
+    writer.join();
+
+    printf("  %d snapshots acquired of %llu published\n", numAcquired, static_cast<unsigned long long>(poller.GetNumPollCycles()));
+
+    VerifyTestResult(numAcquired > 0 && bCycleIncreases, "Every acquired snapshot should be newer than the last");
+    VerifyTestResult(numTorn == 0, "No snapshot should mix two poll cycles");
+    poller.AcquireLatest();
+    VerifyTestResult(!poller.AcquireLatest(), "Nothing should be acquired twice");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_ControllerPoller_TripleBuffer)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 3; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_ControllerPoller_Performance()
+{
+#if defined(ENABLE_TestSet_ControllerPoller_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_ControllerPoller_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numFrames = CONTROLLER_POLLER_PERFORMANCE_NUM_FRAMES;
+
+    printf("  %d frames, %d us per poll of an empty slot...\n", numFrames, CONTROLLER_POLLER_DISCONNECTED_STALL_MICROSECONDS);
+
+    for (int numConnected = 0; numConnected <= NUM_XBOX_CONTROLLERS; numConnected += NUM_XBOX_CONTROLLERS)
+    {
+        StallingControllerBackend backend(CONTROLLER_POLLER_DISCONNECTED_STALL_MICROSECONDS);
+
+        for (int controllerIndex = 0; controllerIndex < numConnected; ++controllerIndex)
+        {
+            backend.SetConnected(controllerIndex, true);
+        }
+
+        InputSystemConfig constexpr config;
+        InputSystemClass            inputSystem(config);
+        InputFrameDriver            driver(inputSystem, backend);
+        ControllerPoller            poller(backend);
+        PerformanceTimer            timer;
+
+        driver.Startup();
+
+        // Polled on the game thread
+        timer.Start();
+        for (int frame = 0; frame < numFrames; ++frame)
+        {
+            driver.BeginFrame();
+            driver.EndFrame();
+        }
+        timer.Stop();
+        double const directTime = timer.GetElapsedMicroseconds();
+
+        // From the polling thread's snapshots
+        driver.SetControllerPoller(&poller);
+        poller.Start();
+
+        timer.Start();
+        for (int frame = 0; frame < numFrames; ++frame)
+        {
+            driver.BeginFrame();
+            driver.EndFrame();
+        }
+        timer.Stop();
+        double const polledTime = timer.GetElapsedMicroseconds();
+
+        poller.Stop();
+        driver.Shutdown();
+
+        printf("    %d controllers, BeginFrame polling directly:     %9.3f us/frame\n", numConnected, directTime / numFrames);
+        printf("    %d controllers, BeginFrame with ControllerPoller: %9.3f us/frame (%.1fx)\n", numConnected, polledTime / numFrames, directTime / polledTime);
+    }
+
+    VerifyTestResult(true, "ControllerPoller performance tests completed");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_ControllerPoller_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_ControllerPoller()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_ControllerPoller)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_ControllerPoller_Basics, "ControllerPoller - Basics");
+    RunTestSet(true, TestSet_ControllerPoller_Backoff, "ControllerPoller - Backoff");
+    RunTestSet(true, TestSet_ControllerPoller_TripleBuffer, "ControllerPoller - TripleBuffer");
+    RunTestSet(false, TestSet_ControllerPoller_Performance, "ControllerPoller - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_ControllerPoller)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
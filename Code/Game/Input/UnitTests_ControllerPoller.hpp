@@ -0,0 +1,32 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_ControllerPoller.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_ControllerPoller();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_ControllerPoller_Basics();
+int TestSet_ControllerPoller_Backoff();
+int TestSet_ControllerPoller_TripleBuffer();
+int TestSet_ControllerPoller_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_ControllerPoller_Basics
+#define ENABLE_TestSet_ControllerPoller_Backoff
+#define ENABLE_TestSet_ControllerPoller_TripleBuffer
+#define ENABLE_TestSet_ControllerPoller_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define CONTROLLER_POLLER_DISCONNECTED_STALL_MICROSECONDS 500    // What one poll of an empty slot costs the stand-in backend
+#define CONTROLLER_POLLER_PERFORMANCE_NUM_FRAMES          500
@@ -0,0 +1,393 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_ControllerStateArray.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/UnitTests_ControllerStateArray.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Input/ControllerPoller.hpp"
+#include "Game/Input/ControllerStateArray.hpp"
+#include "Game/Input/InputFrameDriver.hpp"
+#include "Game/Input/VirtualInputBackend.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // A connected controller with every field set from the seed
+    //
+    std::vector<sControllerSample> MakeRandomSamples(int const      numSamples,
+                                                     unsigned const seed)
+    {
+        std::mt19937                            random(seed);
+        std::uniform_real_distribution<float>   coordinate(-1.0f, 1.0f);
+        std::uniform_int_distribution<unsigned> buttons(0, (1u << NUM_XBOX_BUTTONS) - 1);
+        std::vector<sControllerSample>          samples(numSamples);
+
+        for (sControllerSample& sample : samples)
+        {
+            sample.m_isConnected   = true;
+            sample.m_buttonsDown   = static_cast<uint16_t>(buttons(random));
+            sample.m_leftStickRaw  = Vector2Class(coordinate(random), coordinate(random));
+            sample.m_rightStickRaw = Vector2Class(coordinate(random), coordinate(random));
+            sample.m_leftTrigger   = 0.5f + 0.5f * coordinate(random);
+            sample.m_rightTrigger  = 0.5f + 0.5f * coordinate(random);
+        }
+
+        return samples;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Array of structures, laid out and updated like XboxController
+    //
+    struct sControllerStruct
+    {
+        bool                m_isConnected = false;
+        sKeyButtonState     m_buttons[NUM_XBOX_BUTTONS];
+        AnalogJoystickClass m_leftStick;
+        AnalogJoystickClass m_rightStick;
+        float               m_leftTrigger  = 0.0f;
+        float               m_rightTrigger = 0.0f;
+
+        void Update(sControllerSample const& sample)
+        {
+            m_isConnected = sample.m_isConnected;
+
+            for (int buttonIndex = 0; buttonIndex < NUM_XBOX_BUTTONS; ++buttonIndex)
+            {
+                m_buttons[buttonIndex].m_isKeyDown = (sample.m_buttonsDown >> buttonIndex) & 1;
+            }
+
+            m_leftStick.UpdatePosition(sample.m_leftStickRaw.x, sample.m_leftStickRaw.y);
+            m_rightStick.UpdatePosition(sample.m_rightStickRaw.x, sample.m_rightStickRaw.y);
+            m_leftTrigger  = sample.m_leftTrigger;
+            m_rightTrigger = sample.m_rightTrigger;
+        }
+
+        void EndFrame()
+        {
+            for (sKeyButtonState& button : m_buttons)
+            {
+                button.m_wasKeyDownLastFrame = button.m_isKeyDown;
+            }
+        }
+    };
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_ControllerStateArray_Basics()
+{
+#if defined(ENABLE_TestSet_ControllerStateArray_Basics)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_ControllerStateArray_Basics)(start)\n");
+    printf("####################################################################################################\n");
+
+    ControllerStateArray states;
+    states.Startup(70);
+
+    VerifyTestResult(states.GetNumControllers() == 70 && states.GetNumConnected() == 0, "Startup should size the array with every controller disconnected");
+
+    sControllerSample sample;
+    sample.m_isConnected   = true;
+    sample.m_buttonsDown   = static_cast<uint16_t>((1u << XBOX_BUTTON_A) | (1u << XBOX_BUTTON_START));
+    sample.m_leftStickRaw  = Vector2Class(0.6f, -0.8f);
+    sample.m_rightStickRaw = Vector2Class(0.1f, 0.1f);
+    sample.m_leftTrigger   = 0.25f;
+    sample.m_rightTrigger  = 1.0f;
+
+    states.SetSample(66, sample);
+    states.ProcessSticks();
+    ControllerView const controller = states.GetController(66);
+
+    VerifyTestResult(controller.IsConnected() && states.GetNumConnected() == 1 && !states.GetController(65).IsConnected() && !states.GetController(2).IsConnected(),
+                     "A sample should connect only its own controller, past the first 64");
+    VerifyTestResult(controller.IsButtonDown(XBOX_BUTTON_A) && controller.WasButtonJustPressed(XBOX_BUTTON_START) && !controller.IsButtonDown(XBOX_BUTTON_B) &&
+                     IsMostlyEqual(controller.GetLeftTrigger(), 0.25f) && IsMostlyEqual(controller.GetRightTrigger(), 1.0f),
+                     "A sample's buttons should read as just pressed, and its triggers as given");
+
+    states.EndFrame();
+    sample.m_buttonsDown = static_cast<uint16_t>(1u << XBOX_BUTTON_A);
+    states.SetSample(66, sample);
+    states.ProcessSticks();
+
+    VerifyTestResult(controller.IsButtonDown(XBOX_BUTTON_A) && !controller.WasButtonJustPressed(XBOX_BUTTON_A) && controller.WasButtonJustReleased(XBOX_BUTTON_START),
+                     "After EndFrame a held button should not read as just pressed, and a lifted one should read as just released");
+
+    states.SetSample(66, sControllerSample());
+    states.ProcessSticks();
+
+    VerifyTestResult(!controller.IsConnected() && !controller.IsButtonDown(XBOX_BUTTON_A) && IsMostlyEqual(controller.GetLeftStickRawPosition(), 0.0f, 0.0f) &&
+                     IsMostlyEqual(controller.GetLeftStickPosition(), 0.0f, 0.0f) && IsMostlyEqual(controller.GetLeftTrigger(), 0.0f),
+                     "A disconnected controller should read as released buttons, centered sticks and released triggers");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_ControllerStateArray_Basics)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 5; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_ControllerStateArray_Views()
+{
+#if defined(ENABLE_TestSet_ControllerStateArray_Views)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_ControllerStateArray_Views)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numControllers = CONTROLLER_STATE_MAX_CONTROLLERS;
+
+    std::vector<sControllerSample> const samples = MakeRandomSamples(numControllers, 11);
+    ControllerStateArray                 states;
+    states.Startup(numControllers);
+
+    for (int controllerIndex = 0; controllerIndex < numControllers; ++controllerIndex)
+    {
+        states.SetSample(controllerIndex, samples[controllerIndex]);
+    }
+    states.ProcessSticks();
+
+    ControllerView const beforeFirst = states.GetController(-1);
+    ControllerView const pastLast    = states.GetController(numControllers);
+    ControllerView const unbound;
+
+    VerifyTestResult(!beforeFirst.IsConnected() && beforeFirst.GetControllerID() == -1 && !pastLast.IsConnected() && pastLast.GetControllerID() == -1 &&
+                     !pastLast.IsButtonDown(XBOX_BUTTON_A) && IsMostlyEqual(pastLast.GetLeftStickPosition(), 0.0f, 0.0f) && !unbound.IsConnected(),
+                     "Views of indices outside the array should read as disconnected with the ID -1");
+
+    bool allMatch    = true;
+    bool allSticksOk = true;
+
+    for (int controllerIndex = 0; controllerIndex < numControllers; ++controllerIndex)
+    {
+        ControllerView const     controller = states.GetController(controllerIndex);
+        sControllerSample const& sample     = samples[controllerIndex];
+
+        AnalogJoystickClass leftStick;
+        AnalogJoystickClass rightStick;
+        leftStick.UpdatePosition(sample.m_leftStickRaw.x, sample.m_leftStickRaw.y);
+        rightStick.UpdatePosition(sample.m_rightStickRaw.x, sample.m_rightStickRaw.y);
+
+        for (int buttonIndex = 0; buttonIndex < NUM_XBOX_BUTTONS; ++buttonIndex)
+        {
+            allMatch = allMatch && (controller.IsButtonDown(static_cast<XboxButtonID>(buttonIndex)) == (((sample.m_buttonsDown >> buttonIndex) & 1) != 0));
+        }
+
+        allMatch = allMatch && controller.GetControllerID() == controllerIndex && controller.IsConnected() &&
+                   IsMostlyEqual(controller.GetLeftStickRawPosition(), sample.m_leftStickRaw) && IsMostlyEqual(controller.GetRightStickRawPosition(), sample.m_rightStickRaw) &&
+                   IsMostlyEqual(controller.GetLeftTrigger(), sample.m_leftTrigger) && IsMostlyEqual(controller.GetRightTrigger(), sample.m_rightTrigger);
+
+        allSticksOk = allSticksOk && IsMostlyEqual(controller.GetLeftStickPosition(), leftStick.GetPosition()) && IsMostlyEqual(controller.GetRightStickPosition(), rightStick.GetPosition());
+    }
+
+    VerifyTestResult(allMatch, "Every controller's view should read back its own buttons, raw sticks and triggers");
+    VerifyTestResult(allSticksOk, "Batched stick correction should match AnalogJoystick's for every controller");
+
+    ControllerView const controller = states.GetController(5);
+    sControllerSample    moved      = samples[5];
+    moved.m_leftStickRaw            = Vector2Class(0.0f, 1.0f);
+    states.SetSample(5, moved);
+    states.ProcessSticks();
+
+    VerifyTestResult(IsMostlyEqual(controller.GetLeftStickPosition(), 0.0f, 1.0f), "A view should read the array's current state, not a copy");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_ControllerStateArray_Views)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 4; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_ControllerStateArray_FrameDriver()
+{
+#if defined(ENABLE_TestSet_ControllerStateArray_FrameDriver)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_ControllerStateArray_FrameDriver)(start)\n");
+    printf("####################################################################################################\n");
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    VirtualInputBackend         backend;
+    InputFrameDriver            driver(inputSystem, backend);
+    ControllerStateArray        states;
+
+    states.Startup(16);
+    driver.SetControllerStateArray(&states);
+    driver.Startup();
+
+    backend.ConnectController(0, 1);
+    backend.PressButton(0, 1, XBOX_BUTTON_X);
+    backend.ConnectController(0, 13);
+    backend.PressButton(0, 13, XBOX_BUTTON_Y);
+    backend.MoveRightStick(0, 13, Vector2Class(-1.0f, 0.0f));
+
+    driver.BeginFrame();
+
+    VerifyTestResult(states.GetNumConnected() == 2 && states.GetController(1).IsButtonDown(XBOX_BUTTON_X) && driver.IsButtonDown(1, XBOX_BUTTON_X) &&
+                     states.GetController(13).WasButtonJustPressed(XBOX_BUTTON_Y) && IsMostlyEqual(states.GetController(13).GetRightStickPosition(), -1.0f, 0.0f),
+                     "BeginFrame should fill every slot of the array, past the four the driver keeps itself");
+    VerifyTestResult(backend.GetNumPolls() == 16, "The driver's own slots should be polled once and shared with the array");
+
+    driver.EndFrame();
+    driver.BeginFrame();
+
+    VerifyTestResult(states.GetController(13).IsButtonDown(XBOX_BUTTON_Y) && !states.GetController(13).WasButtonJustPressed(XBOX_BUTTON_Y),
+                     "EndFrame should roll the array's buttons over");
+
+    driver.EndFrame();
+    driver.Shutdown();
+
+    // With a poller covering the whole array, every slot comes from its snapshot
+    InputSystemClass        polledInputSystem(config);
+    VirtualInputBackend     polledBackend;
+    InputFrameDriver        polledDriver(polledInputSystem, polledBackend);
+    ControllerStateArray    polledStates;
+    sControllerPollerConfig pollerConfig;
+    pollerConfig.m_numControllers = 8;
+
+    ControllerPoller poller(polledBackend, pollerConfig);
+
+    polledStates.Startup(8);
+    polledDriver.SetControllerStateArray(&polledStates);
+    polledDriver.Startup();
+
+    // The script is applied by BeginFrame, so play it in before the polling thread reads the backend
+    polledBackend.ConnectController(0, 6);
+    polledBackend.PressButton(0, 6, XBOX_BUTTON_B);
+    polledDriver.BeginFrame();
+    polledDriver.EndFrame();
+
+    polledDriver.SetControllerPoller(&poller);
+    poller.Start();
+    while (poller.GetNumPolls(6) < 2)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    poller.Stop();
+
+    int const numBackendPolls = polledBackend.GetNumPolls();
+    polledDriver.BeginFrame();
+
+    VerifyTestResult(polledStates.GetController(6).IsConnected() && polledStates.GetController(6).IsButtonDown(XBOX_BUTTON_B) && poller.GetNumControllers() == 8,
+                     "Slots past the driver's four should come from the poller's snapshot");
+    VerifyTestResult(polledBackend.GetNumPolls() == numBackendPolls, "BeginFrame should not poll any slot itself while a poller is set");
+
+    polledDriver.EndFrame();
+    polledDriver.Shutdown();
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_ControllerStateArray_FrameDriver)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 5; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_ControllerStateArray_Performance()
+{
+#if defined(ENABLE_TestSet_ControllerStateArray_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_ControllerStateArray_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numFrames  = CONTROLLER_STATE_PERFORMANCE_NUM_FRAMES;
+    int constexpr numSamples = 4096;
+
+    std::vector<sControllerSample> const samples = MakeRandomSamples(numSamples + CONTROLLER_STATE_MAX_CONTROLLERS, 3);
+
+    int const controllerCounts[] = {NUM_XBOX_CONTROLLERS, 16, CONTROLLER_STATE_MAX_CONTROLLERS};
+
+    printf("  %d frames, every controller connected and moving...\n", numFrames);
+
+    for (int const numControllers : controllerCounts)
+    {
+        std::vector<sControllerStruct> structs(numControllers);
+        ControllerStateArray           states;
+        PerformanceTimer               timer;
+        float                          checksum = 0.0f;
+
+        states.Startup(numControllers);
+
+        timer.Start();
+        for (int frame = 0; frame < numFrames; ++frame)
+        {
+            sControllerSample const* const frameSamples = samples.data() + frame % numSamples;
+
+            for (int controllerIndex = 0; controllerIndex < numControllers; ++controllerIndex)
+            {
+                structs[controllerIndex].Update(frameSamples[controllerIndex]);
+            }
+
+            checksum += structs[frame % numControllers].m_leftStick.GetPosition().x;
+
+            for (sControllerStruct& controller : structs)
+            {
+                controller.EndFrame();
+            }
+        }
+        timer.Stop();
+        double const structTime = timer.GetElapsedMicroseconds();
+
+        timer.Start();
+        for (int frame = 0; frame < numFrames; ++frame)
+        {
+            sControllerSample const* const frameSamples = samples.data() + frame % numSamples;
+
+            for (int controllerIndex = 0; controllerIndex < numControllers; ++controllerIndex)
+            {
+                states.SetSample(controllerIndex, frameSamples[controllerIndex]);
+            }
+            states.ProcessSticks();
+
+            checksum += states.GetLeftStickPosition(frame % numControllers).x;
+
+            states.EndFrame();
+        }
+        timer.Stop();
+        double const arrayTime = timer.GetElapsedMicroseconds();
+
+        printf("    %2d controllers, per-controller structs:  %8.1f ns/frame\n", numControllers, structTime * 1000.0 / numFrames);
+        printf("    %2d controllers, ControllerStateArray:    %8.1f ns/frame (%.2fx)   (checksum %.1f)\n", numControllers, arrayTime * 1000.0 / numFrames, structTime / arrayTime, checksum);
+    }
+
+    VerifyTestResult(true, "ControllerStateArray performance tests completed");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_ControllerStateArray_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_ControllerStateArray()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_ControllerStateArray)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_ControllerStateArray_Basics, "ControllerStateArray - Basics");
+    RunTestSet(true, TestSet_ControllerStateArray_Views, "ControllerStateArray - Views");
+    RunTestSet(true, TestSet_ControllerStateArray_FrameDriver, "ControllerStateArray - FrameDriver");
+    RunTestSet(false, TestSet_ControllerStateArray_Performance, "ControllerStateArray - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_ControllerStateArray)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
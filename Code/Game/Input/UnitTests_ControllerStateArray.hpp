@@ -0,0 +1,32 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_ControllerStateArray.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_ControllerStateArray();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_ControllerStateArray_Basics();
+int TestSet_ControllerStateArray_Views();
+int TestSet_ControllerStateArray_FrameDriver();
+int TestSet_ControllerStateArray_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_ControllerStateArray_Basics
+#define ENABLE_TestSet_ControllerStateArray_Views
+#define ENABLE_TestSet_ControllerStateArray_FrameDriver
+#define ENABLE_TestSet_ControllerStateArray_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define CONTROLLER_STATE_PERFORMANCE_NUM_FRAMES    100000
+#define CONTROLLER_STATE_MAX_CONTROLLERS           64
@@ -0,0 +1,332 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_CursorDeltaAccumulator.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/UnitTests_CursorDeltaAccumulator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Input/CursorDeltaAccumulator.hpp"
+#include "Game/Input/InputFrameDriver.hpp"
+#include "Game/Input/VirtualInputBackend.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    float constexpr PRODUCER_DELTA_X = 0.37f;
+    float constexpr PRODUCER_DELTA_Y = -0.13f;
+
+    //------------------------------------------------------------------------------------------------
+    // Adds numEvents sub-pixel deltas at rateHz, the way a raw-input thread receives a high-rate mouse
+    //
+    double RunPacedMouse(CursorDeltaAccumulator& accumulator,
+                         int const               numEvents,
+                         int const               rateHz)
+    {
+        PerformanceClock::duration const   period = std::chrono::duration_cast<PerformanceClock::duration>(std::chrono::duration<double>(1.0 / rateHz));
+        PerformanceClock::time_point const start  = PerformanceClock::now();
+
+        for (int index = 0; index < numEvents; ++index)
+        {
+            while (PerformanceClock::now() < start + period * index)
+            {
+                std::this_thread::yield();
+            }
+
+            accumulator.AddDelta(PRODUCER_DELTA_X, PRODUCER_DELTA_Y);
+        }
+
+        std::chrono::duration<double> const elapsed = PerformanceClock::now() - start;
+
+        return numEvents / elapsed.count();
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Per-event locking, for comparison
+    //
+    struct sLockedCursorDelta
+    {
+        std::mutex   m_mutex;
+        Vector2Class m_delta = Vector2Class(0.0f, 0.0f);
+
+        void AddDelta(float const deltaX,
+                      float const deltaY)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_delta += Vector2Class(deltaX, deltaY);
+        }
+
+        Vector2Class ConsumeFrameDelta()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            Vector2Class const          delta = m_delta;
+            m_delta                           = Vector2Class(0.0f, 0.0f);
+
+            return delta;
+        }
+    };
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_CursorDeltaAccumulator_Basics()
+{
+#if defined(ENABLE_TestSet_CursorDeltaAccumulator_Basics)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_CursorDeltaAccumulator_Basics)(start)\n");
+    printf("####################################################################################################\n");
+
+    CursorDeltaAccumulator accumulator;
+
+    for (int index = 0; index < 4; ++index)
+    {
+        accumulator.AddDelta(0.25f, -0.5f);
+    }
+
+    Vector2Class const frameDelta = accumulator.ConsumeFrameDelta();
+    VerifyTestResult(IsMostlyEqual(frameDelta, 1.0f, -2.0f) && accumulator.GetNumFrameEvents() == 4 && accumulator.GetFrameSamples().empty(),
+                     "Deltas added since the last frame should coalesce into one");
+
+    accumulator.ConsumeFrameDelta();
+    VerifyTestResult(accumulator.GetFrameDelta() == Vector2Class(0.0f, 0.0f) && accumulator.GetNumFrameEvents() == 0, "A frame without motion should have a zero delta");
+
+    // A thousand thousandths of a pixel per frame, for a hundred frames
+    float maxError = 0.0f;
+
+    for (int frame = 0; frame < 100; ++frame)
+    {
+        for (int index = 0; index < 1000; ++index)
+        {
+            accumulator.AddDelta(0.001f, 0.0f);
+        }
+
+        maxError = std::fmax(maxError, std::fabs(accumulator.ConsumeFrameDelta().x - 1.0f));
+    }
+
+    VerifyTestResult(maxError < 1e-5f, "Sub-pixel motion should not be lost or drift over many frames");
+
+    // Four samples kept, two more dropped, but the delta stays exact
+    CursorDeltaAccumulator sampled(4);
+
+    for (int index = 0; index < 6; ++index)
+    {
+        sampled.AddDelta(static_cast<float>(index), 1.0f);
+    }
+
+    Vector2Class const sampledDelta = sampled.ConsumeFrameDelta();
+    VerifyTestResult(IsMostlyEqual(sampledDelta, 15.0f, 6.0f) && sampled.GetFrameSamples().size() == 4 && sampled.GetNumDroppedSamples() == 2 &&
+                     sampled.GetFrameSamples()[3].m_delta == Vector2Class(3.0f, 1.0f),
+                     "A full sample ring should drop samples without losing motion");
+
+    sampled.AddDelta(-1.0f, 0.0f);
+    sampled.ConsumeFrameDelta();
+    VerifyTestResult(sampled.GetFrameSamples().size() == 1 && sampled.GetFrameSamples()[0].m_delta == Vector2Class(-1.0f, 0.0f),
+                     "Each frame's sample list should hold only that frame's samples");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_CursorDeltaAccumulator_Basics)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 5; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_CursorDeltaAccumulator_HighRateProducer()
+{
+#if defined(ENABLE_TestSet_CursorDeltaAccumulator_HighRateProducer)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_CursorDeltaAccumulator_HighRateProducer)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numEvents = CURSOR_DELTA_PRODUCER_NUM_EVENTS;
+
+    CursorDeltaAccumulator accumulator(256);
+    std::atomic<bool>      bProducing   = true;
+    double                 producerRate = 0.0;
+
+    std::thread producer([&accumulator, &bProducing, &producerRate]
+    {
+        producerRate = RunPacedMouse(accumulator, numEvents, CURSOR_DELTA_PRODUCER_RATE_HZ);
+        bProducing.store(false);
+    });
+
+    // Game frames of about 4 ms while the mouse moves
+    double sumX          = 0.0;
+    double sumY          = 0.0;
+    int    numCoalesced  = 0;
+    int    numSamples    = 0;
+    int    numFrames     = 0;
+    int    maxFrameCount = 0;
+
+    for (bool bLastFrame = false; !bLastFrame; ++numFrames)
+    {
+        bLastFrame = !bProducing.load();
+
+        Vector2Class const frameDelta = accumulator.ConsumeFrameDelta();
+        sumX += frameDelta.x;
+        sumY += frameDelta.y;
+        numCoalesced += accumulator.GetNumFrameEvents();
+        numSamples += static_cast<int>(accumulator.GetFrameSamples().size());
+        maxFrameCount = std::max(maxFrameCount, accumulator.GetNumFrameEvents());
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(4));
+    }
+
+    producer.join();
+    accumulator.ConsumeFrameDelta();
+    sumX += accumulator.GetFrameDelta().x;
+    sumY += accumulator.GetFrameDelta().y;
+    numCoalesced += accumulator.GetNumFrameEvents();
+    numSamples += static_cast<int>(accumulator.GetFrameSamples().size());
+
+    printf("  %d deltas at %.0f Hz over %d frames, up to %d per frame\n", numEvents, producerRate, numFrames, maxFrameCount);
+    printf("  Summed motion (%.4f, %.4f), expected (%.4f, %.4f)\n", sumX, sumY, numEvents * static_cast<double>(PRODUCER_DELTA_X), numEvents * static_cast<double>(PRODUCER_DELTA_Y));
+
+    VerifyTestResult(std::fabs(sumX - numEvents * static_cast<double>(PRODUCER_DELTA_X)) < 1e-3 && std::fabs(sumY - numEvents * static_cast<double>(PRODUCER_DELTA_Y)) < 1e-3,
+                     "The frame deltas should add up to all of the mouse's motion");
+    VerifyTestResult(numCoalesced == numEvents && maxFrameCount > 1, "Every delta should be coalesced into exactly one frame");
+    VerifyTestResult(numSamples == numEvents && accumulator.GetNumDroppedSamples() == 0, "Every delta should appear once in the frame sample lists");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_CursorDeltaAccumulator_HighRateProducer)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 3; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_CursorDeltaAccumulator_FrameDriver()
+{
+#if defined(ENABLE_TestSet_CursorDeltaAccumulator_FrameDriver)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_CursorDeltaAccumulator_FrameDriver)(start)\n");
+    printf("####################################################################################################\n");
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    VirtualInputBackend         backend;
+    InputFrameDriver            driver(inputSystem, backend);
+    CursorDeltaAccumulator      accumulator(64);
+
+    driver.SetCursorDeltaAccumulator(&accumulator);
+    driver.Startup();
+
+    accumulator.AddDelta(2.5f, 0.0f);
+    accumulator.AddDelta(0.25f, -1.0f);
+    driver.BeginFrame();
+
+    VerifyTestResult(IsMostlyEqual(driver.GetCursorClientDelta(), 2.75f, -1.0f) && driver.GetLatencyTracker().GetFrameStats(eInputLatencySource::CURSOR).m_numEvents == 2,
+                     "BeginFrame should take the cursor delta and sample ages from the accumulator");
+
+    driver.EndFrame();
+    driver.Shutdown();
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_CursorDeltaAccumulator_FrameDriver)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_CursorDeltaAccumulator_Performance()
+{
+#if defined(ENABLE_TestSet_CursorDeltaAccumulator_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_CursorDeltaAccumulator_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numEvents      = CURSOR_DELTA_PERFORMANCE_NUM_EVENTS;
+    int constexpr eventsPerFrame = 64;     // 8 kHz at 125 frames per second
+
+    PerformanceTimer timer;
+    float            checksum = 0.0f;
+
+    printf("  %d events, consumed every %d...\n", numEvents, eventsPerFrame);
+
+    sLockedCursorDelta locked;
+    timer.Start();
+    for (int index = 0; index < numEvents; ++index)
+    {
+        locked.AddDelta(0.5f, 0.25f);
+
+        if (index % eventsPerFrame == 0)
+        {
+            checksum += locked.ConsumeFrameDelta().x;
+        }
+    }
+    timer.Stop();
+    double const lockedTime = timer.GetElapsedMicroseconds();
+
+    CursorDeltaAccumulator accumulator;
+    timer.Start();
+    for (int index = 0; index < numEvents; ++index)
+    {
+        accumulator.AddDelta(0.5f, 0.25f);
+
+        if (index % eventsPerFrame == 0)
+        {
+            checksum += accumulator.ConsumeFrameDelta().x;
+        }
+    }
+    timer.Stop();
+    double const accumulatorTime = timer.GetElapsedMicroseconds();
+
+    CursorDeltaAccumulator sampled(256);
+    timer.Start();
+    for (int index = 0; index < numEvents; ++index)
+    {
+        sampled.AddDelta(0.5f, 0.25f);
+
+        if (index % eventsPerFrame == 0)
+        {
+            checksum += sampled.ConsumeFrameDelta().x;
+        }
+    }
+    timer.Stop();
+    double const sampledTime = timer.GetElapsedMicroseconds();
+
+    printf("    Mutex per event:                 %7.3f ns/event\n", lockedTime * 1000.0 / numEvents);
+    printf("    CursorDeltaAccumulator:          %7.3f ns/event (%.2fx)\n", accumulatorTime * 1000.0 / numEvents, lockedTime / accumulatorTime);
+    printf("    CursorDeltaAccumulator, samples: %7.3f ns/event (%.2fx)   (checksum %.0f)\n", sampledTime * 1000.0 / numEvents, lockedTime / sampledTime, checksum);
+
+    VerifyTestResult(true, "CursorDeltaAccumulator performance tests completed");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_CursorDeltaAccumulator_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_CursorDeltaAccumulator()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_CursorDeltaAccumulator)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_CursorDeltaAccumulator_Basics, "CursorDeltaAccumulator - Basics");
+    RunTestSet(true, TestSet_CursorDeltaAccumulator_HighRateProducer, "CursorDeltaAccumulator - HighRateProducer");
+    RunTestSet(true, TestSet_CursorDeltaAccumulator_FrameDriver, "CursorDeltaAccumulator - FrameDriver");
+    RunTestSet(false, TestSet_CursorDeltaAccumulator_Performance, "CursorDeltaAccumulator - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_CursorDeltaAccumulator)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
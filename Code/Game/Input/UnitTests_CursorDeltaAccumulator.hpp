@@ -0,0 +1,33 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_CursorDeltaAccumulator.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_CursorDeltaAccumulator();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_CursorDeltaAccumulator_Basics();
+int TestSet_CursorDeltaAccumulator_HighRateProducer();
+int TestSet_CursorDeltaAccumulator_FrameDriver();
+int TestSet_CursorDeltaAccumulator_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_CursorDeltaAccumulator_Basics
+#define ENABLE_TestSet_CursorDeltaAccumulator_HighRateProducer
+#define ENABLE_TestSet_CursorDeltaAccumulator_FrameDriver
+#define ENABLE_TestSet_CursorDeltaAccumulator_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define CURSOR_DELTA_PRODUCER_RATE_HZ          8000
+#define CURSOR_DELTA_PRODUCER_NUM_EVENTS       2000
+#define CURSOR_DELTA_PERFORMANCE_NUM_EVENTS    10000000
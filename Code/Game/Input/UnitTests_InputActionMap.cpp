@@ -0,0 +1,272 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_InputActionMap.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/UnitTests_InputActionMap.hpp"
+
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Input/InputActionMap.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // The uncompiled way: look the action up by name and test each bound key on every query
+    //
+    class NaiveActionMap
+    {
+    public:
+        void BindKey(std::string const& name,
+                     unsigned char const keyCode)
+        {
+            m_bindings[name].push_back(keyCode);
+        }
+
+        bool IsActionDown(InputSystemClass const& inputSystem,
+                          std::string const&      name) const
+        {
+            auto const found = m_bindings.find(name);
+
+            if (found == m_bindings.end())
+            {
+                return false;
+            }
+
+            for (unsigned char const keyCode : found->second)
+            {
+                if (inputSystem.IsKeyDown(keyCode))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+    private:
+        std::unordered_map<std::string, std::vector<unsigned char>> m_bindings;
+    };
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputActionMap_Basics()
+{
+#if defined(ENABLE_TestSet_InputActionMap_Basics)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputActionMap_Basics)(start)\n");
+    printf("####################################################################################################\n");
+
+    InputActionMap actions;
+    int const      jump = actions.AddAction("Jump");
+    int const      fire = actions.AddAction("Fire");
+
+    VerifyTestResult(jump == 0 && fire == 1 && actions.AddAction("Jump") == jump && actions.FindAction("Fire") == fire &&
+                     actions.FindAction("Crouch") == -1 && actions.GetNumActions() == 2 && actions.GetActionName(fire) == "Fire",
+                     "Actions should get stable indices and be found by name");
+
+    actions.BindKey(jump, KEYCODE_SPACE);
+    actions.BindButton(jump, XBOX_BUTTON_A);
+    actions.BindKey(fire, KEYCODE_LEFT_MOUSE);
+    actions.BindKey(fire, KEYCODE_CONTROL);
+
+    // Keyboard
+    sKeyMask keysDown;
+    keysDown.Set(KEYCODE_SPACE);
+    actions.Update(keysDown, 0);
+
+    VerifyTestResult(actions.IsActionDown(jump) && actions.WasActionJustPressed(jump) && !actions.IsActionDown(fire),
+                     "An action should be down and just pressed on the frame its key goes down");
+
+    actions.Update(keysDown, 0);
+    VerifyTestResult(actions.IsActionDown(jump) && !actions.WasActionJustPressed(jump), "A held action should not be just pressed again");
+
+    // Switching to the pad button keeps the action held
+    actions.Update(sKeyMask(), static_cast<uint16_t>(1u << XBOX_BUTTON_A));
+    VerifyTestResult(actions.IsActionDown(jump) && !actions.WasActionJustPressed(jump) && !actions.WasActionJustReleased(jump),
+                     "Any one bound key or button should hold the action down");
+
+    actions.Update(sKeyMask(), 0);
+    VerifyTestResult(!actions.IsActionDown(jump) && actions.WasActionJustReleased(jump), "An action should be just released once nothing bound is down");
+
+    // Either of two keys
+    keysDown = sKeyMask();
+    keysDown.Set(KEYCODE_CONTROL);
+    actions.Update(keysDown, 0);
+    VerifyTestResult(actions.IsActionDown(fire) && !actions.IsActionDown(jump), "Every bound key should trigger its action");
+
+    // Rebinding takes effect on the next Update
+    actions.UnbindAction(fire);
+    actions.BindKey(fire, KEYCODE_F1);
+    actions.Update(keysDown, 0);
+    VerifyTestResult(!actions.IsActionDown(fire) && actions.WasActionJustReleased(fire), "Unbound keys should no longer trigger an action");
+
+    // Through the InputSystem
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    inputSystem.HandleKeyPressed(KEYCODE_F1);
+    actions.Update(inputSystem);
+
+    VerifyTestResult(actions.IsActionDown(fire) && actions.WasActionJustPressed(fire) && !actions.IsActionDown(-1) && !actions.IsActionDown(MAX_INPUT_ACTIONS),
+                     "Update should read keys from the InputSystem, and out of range actions should read as up");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputActionMap_Basics)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 8; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputActionMap_Remapping()
+{
+#if defined(ENABLE_TestSet_InputActionMap_Remapping)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputActionMap_Remapping)(start)\n");
+    printf("####################################################################################################\n");
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    InputActionMap              actions;
+    int const                   moveLeft = actions.AddAction("MoveLeft");
+
+    actions.BindKey(moveLeft, KEYCODE_B);
+
+    // The remapping sketched in TestSet_InputSystem_UnimplementedMethods: pressing A acts as B
+    actions.RemapKey(KEYCODE_A, KEYCODE_B);
+    inputSystem.HandleKeyPressed(KEYCODE_A);
+    actions.Update(inputSystem);
+    VerifyTestResult(actions.IsActionDown(moveLeft), "Key remapping should work correctly");
+
+    inputSystem.HandleKeyReleased(KEYCODE_A);
+    inputSystem.HandleKeyPressed(KEYCODE_B);
+    actions.Update(inputSystem);
+    VerifyTestResult(actions.IsActionDown(moveLeft) && !actions.WasActionJustPressed(moveLeft), "The key remapped to should still trigger its own actions");
+
+    // Swap B away: only A triggers the action now
+    actions.RemapKey(KEYCODE_B, KEYCODE_D);
+    actions.Update(inputSystem);
+    VerifyTestResult(!actions.IsActionDown(moveLeft), "A key remapped elsewhere should stop triggering its old actions");
+
+    actions.ClearRemaps();
+    actions.Update(inputSystem);
+    VerifyTestResult(actions.IsActionDown(moveLeft) && actions.WasActionJustPressed(moveLeft), "ClearRemaps should restore the original keys");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputActionMap_Remapping)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 4; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputActionMap_Performance()
+{
+#if defined(ENABLE_TestSet_InputActionMap_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputActionMap_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numFrames          = INPUT_ACTION_PERFORMANCE_NUM_FRAMES;
+    int constexpr numQueriesPerFrame = INPUT_ACTION_PERFORMANCE_NUM_QUERIES_PER_FRAME;
+    int constexpr numActions         = 16;
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    InputActionMap              actions;
+    NaiveActionMap              naiveActions;
+    std::vector<std::string>    names;
+    std::vector<int>            indices;
+
+    // Sixteen actions with three keys each, like a typical control scheme
+    for (int actionIndex = 0; actionIndex < numActions; ++actionIndex)
+    {
+        names.push_back("Action_" + std::to_string(actionIndex));
+        indices.push_back(actions.AddAction(names.back()));
+
+        for (int keyIndex = 0; keyIndex < 3; ++keyIndex)
+        {
+            unsigned char const keyCode = static_cast<unsigned char>(32 + actionIndex * 3 + keyIndex);
+            actions.BindKey(indices.back(), keyCode);
+            naiveActions.BindKey(names.back(), keyCode);
+        }
+    }
+
+    PerformanceTimer timer;
+    int              naiveChecksum    = 0;
+    int              compiledChecksum = 0;
+
+    printf("  %d frames, %d action queries per frame...\n", numFrames, numQueriesPerFrame);
+
+    timer.Start();
+    for (int frame = 0; frame < numFrames; ++frame)
+    {
+        inputSystem.HandleKeyPressed(static_cast<unsigned char>(32 + frame % (numActions * 3)));
+
+        for (int query = 0; query < numQueriesPerFrame; ++query)
+        {
+            naiveChecksum += naiveActions.IsActionDown(inputSystem, names[query % numActions]) ? 1 : 0;
+        }
+
+        inputSystem.HandleKeyReleased(static_cast<unsigned char>(32 + frame % (numActions * 3)));
+        inputSystem.EndFrame();
+    }
+    timer.Stop();
+    double const naiveTime = timer.GetElapsedMicroseconds();
+
+    // Includes the once-per-frame Update that samples the InputSystem
+    timer.Start();
+    for (int frame = 0; frame < numFrames; ++frame)
+    {
+        inputSystem.HandleKeyPressed(static_cast<unsigned char>(32 + frame % (numActions * 3)));
+        actions.Update(inputSystem);
+
+        for (int query = 0; query < numQueriesPerFrame; ++query)
+        {
+            compiledChecksum += actions.IsActionDown(indices[query % numActions]) ? 1 : 0;
+        }
+
+        inputSystem.HandleKeyReleased(static_cast<unsigned char>(32 + frame % (numActions * 3)));
+        inputSystem.EndFrame();
+    }
+    timer.Stop();
+    double const compiledTime = timer.GetElapsedMicroseconds();
+
+    printf("    Name lookup per query:     %8.3f us/frame\n", naiveTime / numFrames);
+    printf("    Compiled InputActionMap:   %8.3f us/frame (%.2fx)\n", compiledTime / numFrames, naiveTime / compiledTime);
+
+    VerifyTestResult(naiveChecksum == compiledChecksum, "InputActionMap performance tests completed");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputActionMap_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_InputActionMap()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_InputActionMap)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_InputActionMap_Basics, "InputActionMap - Basics");
+    RunTestSet(true, TestSet_InputActionMap_Remapping, "InputActionMap - Remapping");
+    RunTestSet(false, TestSet_InputActionMap_Performance, "InputActionMap - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_InputActionMap)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
@@ -0,0 +1,30 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_InputActionMap.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_InputActionMap();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_InputActionMap_Basics();
+int TestSet_InputActionMap_Remapping();
+int TestSet_InputActionMap_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_InputActionMap_Basics
+#define ENABLE_TestSet_InputActionMap_Remapping
+#define ENABLE_TestSet_InputActionMap_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define INPUT_ACTION_PERFORMANCE_NUM_FRAMES            10000
+#define INPUT_ACTION_PERFORMANCE_NUM_QUERIES_PER_FRAME 500
@@ -0,0 +1,263 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_InputFrameDriver.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/UnitTests_InputFrameDriver.hpp"
+
+#include <cstdio>
+#include <random>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Input/InputFrameDriver.hpp"
+#include "Game/Input/VirtualInputBackend.hpp"
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputFrameDriver_Lifecycle()
+{
+#if defined(ENABLE_TestSet_InputFrameDriver_Lifecycle)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputFrameDriver_Lifecycle)(start)\n");
+    printf("####################################################################################################\n");
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    VirtualInputBackend         backend;
+    InputFrameDriver            driver(inputSystem, backend);
+
+    backend.PressKey(0, KEYCODE_A);
+
+    // Frames before Startup do nothing
+    driver.BeginFrame();
+    driver.EndFrame();
+    VerifyTestResult(driver.GetFrameNumber() == 0 && backend.GetCurrentFrame() == 0 && !inputSystem.IsKeyDown(KEYCODE_A),
+                     "BeginFrame before Startup should not pump the backend");
+
+    auto const bStarted = TimeFunction("Startup (virtual backend)", [&driver] { return driver.Startup(); });
+    VerifyTestResult(bStarted, "Startup should succeed without a Window or EventSystem");
+
+    TimeAction("BeginFrame (virtual backend)", [&driver] { driver.BeginFrame(); });
+    VerifyTestResult(driver.GetFrameNumber() == 1 && inputSystem.WasKeyJustPressed(KEYCODE_A), "BeginFrame should pump the backend into the InputSystem");
+
+    TimeAction("EndFrame (virtual backend)", [&driver] { driver.EndFrame(); });
+    VerifyTestResult(inputSystem.IsKeyDown(KEYCODE_A) && !inputSystem.WasKeyJustPressed(KEYCODE_A), "EndFrame should end the InputSystem's frame");
+
+    TimeAction("Shutdown (virtual backend)", [&driver] { driver.Shutdown(); });
+    driver.BeginFrame();
+    VerifyTestResult(driver.GetFrameNumber() == 1, "BeginFrame after Shutdown should do nothing");
+
+    // A second Startup replays the script from the first frame
+    InputSystemClass restartedSystem(config);
+    InputFrameDriver restartedDriver(restartedSystem, backend);
+    restartedDriver.Startup();
+    restartedDriver.BeginFrame();
+    VerifyTestResult(restartedSystem.WasKeyJustPressed(KEYCODE_A) && restartedDriver.GetFrameNumber() == 1, "Startup should rewind the virtual backend's script");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputFrameDriver_Lifecycle)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 6; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputFrameDriver_Keyboard()
+{
+#if defined(ENABLE_TestSet_InputFrameDriver_Keyboard)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputFrameDriver_Keyboard)(start)\n");
+    printf("####################################################################################################\n");
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    VirtualInputBackend         backend;
+    InputFrameDriver            driver(inputSystem, backend);
+
+    backend.PressKey(2, KEYCODE_W);
+    backend.ReleaseKey(5, KEYCODE_W);
+    backend.PressKey(6, KEYCODE_SPACE);     // A tap within one frame
+    backend.ReleaseKey(6, KEYCODE_SPACE);
+    backend.PressKey(6, KEYCODE_D);
+    driver.Startup();
+
+    bool bWDownOnlyInRange = true;
+    bool bWEdgesCorrect    = true;
+
+    for (int frame = 0; frame < 6; ++frame)
+    {
+        driver.BeginFrame();
+        bWDownOnlyInRange = bWDownOnlyInRange && inputSystem.IsKeyDown(KEYCODE_W) == (frame >= 2 && frame < 5);
+        bWEdgesCorrect    = bWEdgesCorrect && inputSystem.WasKeyJustPressed(KEYCODE_W) == (frame == 2);
+        bWEdgesCorrect    = bWEdgesCorrect && inputSystem.WasKeyJustReleased(KEYCODE_W) == (frame == 5);
+        driver.EndFrame();
+    }
+    VerifyTestResult(bWDownOnlyInRange, "W should be down from its scripted press to its scripted release");
+    VerifyTestResult(bWEdgesCorrect, "W should be just pressed and just released on the scripted frames");
+
+    driver.BeginFrame();
+    bool const bTapPressed = inputSystem.WasKeyJustPressed(KEYCODE_SPACE);
+    bool const bDHeldBack  = !inputSystem.IsKeyDown(KEYCODE_D);
+    driver.EndFrame();
+    driver.BeginFrame();
+    bool const bTapReleased = inputSystem.WasKeyJustReleased(KEYCODE_SPACE) && inputSystem.WasKeyJustPressed(KEYCODE_D);
+    driver.EndFrame();
+    VerifyTestResult(bTapPressed && bDHeldBack && bTapReleased,
+                     "A tap within one frame should span two frames, holding back the events queued after it");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputFrameDriver_Keyboard)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 3; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputFrameDriver_CursorAndControllers()
+{
+#if defined(ENABLE_TestSet_InputFrameDriver_CursorAndControllers)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputFrameDriver_CursorAndControllers)(start)\n");
+    printf("####################################################################################################\n");
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    VirtualInputBackend         backend(Vector2Class(1600.0f, 800.0f));
+    InputFrameDriver            driver(inputSystem, backend);
+
+    backend.MoveCursor(0, Vector2Class(400.0f, 200.0f));
+    backend.MoveCursor(1, Vector2Class(410.0f, 190.0f));
+    backend.ConnectController(0, 1);
+    backend.PressButton(1, 1, XBOX_BUTTON_A);
+    backend.MoveLeftStick(1, 1, Vector2Class(1.0f, 0.0f));
+    backend.MoveRightStick(1, 1, Vector2Class(0.1f, 0.1f));
+    backend.SetTriggers(1, 1, 0.25f, 1.0f);
+    backend.ReleaseButton(2, 1, XBOX_BUTTON_A);
+    backend.DisconnectController(3, 1);
+    driver.Startup();
+
+    driver.BeginFrame();
+    VerifyTestResult(IsMostlyEqual(driver.GetCursorClientPosition(), 400.0f, 200.0f) && IsMostlyEqual(driver.GetCursorNormalizedPosition(), 0.25f, 0.75f),
+                     "Cursor position should come from the backend, normalized with y up");
+    driver.EndFrame();
+
+    driver.BeginFrame();
+    VerifyTestResult(IsMostlyEqual(driver.GetCursorClientDelta(), 10.0f, -10.0f), "Cursor delta should be the movement since the last frame");
+    VerifyTestResult(driver.IsControllerConnected(1) && !driver.IsControllerConnected(0) && driver.WasButtonJustPressed(1, XBOX_BUTTON_A),
+                     "Controller 1 should connect with A just pressed");
+    VerifyTestResult(IsMostlyEqual(driver.GetLeftStick(1).GetPosition(), 1.0f, 0.0f) && IsMostlyEqual(driver.GetRightStick(1).GetMagnitude(), 0.0f),
+                     "Sticks should go through AnalogJoystick's deadzone correction");
+    VerifyTestResult(IsMostlyEqual(driver.GetLeftTrigger(1), 0.25f) && IsMostlyEqual(driver.GetRightTrigger(1), 1.0f), "Triggers should come from the backend");
+    driver.EndFrame();
+
+    driver.BeginFrame();
+    bool const bReleased = driver.WasButtonJustReleased(1, XBOX_BUTTON_A) && !driver.IsButtonDown(1, XBOX_BUTTON_A) && IsMostlyEqual(driver.GetCursorClientDelta(), 0.0f, 0.0f);
+    driver.EndFrame();
+    driver.BeginFrame();
+    bool const bDisconnected = !driver.IsControllerConnected(1) && IsMostlyEqual(driver.GetLeftStick(1).GetMagnitude(), 0.0f) && IsMostlyEqual(driver.GetRightTrigger(1), 0.0f);
+    driver.EndFrame();
+    VerifyTestResult(bReleased && bDisconnected, "Releasing and disconnecting should clear the controller");
+
+    VerifyTestResult(backend.GetNumPolls() == 4 * NUM_XBOX_CONTROLLERS, "Every controller slot should be polled once per frame");
+
+    VerifyTestResult(!driver.IsControllerConnected(-1) && !driver.IsControllerConnected(NUM_XBOX_CONTROLLERS) && !driver.IsButtonDown(-1, XBOX_BUTTON_A) &&
+                     !driver.WasButtonJustPressed(NUM_XBOX_CONTROLLERS, XBOX_BUTTON_A) && !driver.WasButtonJustReleased(64, XBOX_BUTTON_A) &&
+                     IsMostlyEqual(driver.GetLeftStick(-1).GetMagnitude(), 0.0f) && IsMostlyEqual(driver.GetRightStick(NUM_XBOX_CONTROLLERS).GetMagnitude(), 0.0f) &&
+                     driver.GetLeftTrigger(-1) == 0.0f && driver.GetRightTrigger(NUM_XBOX_CONTROLLERS) == 0.0f,
+                     "An index out of range should read as a disconnected controller");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputFrameDriver_CursorAndControllers)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 8; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputFrameDriver_Performance()
+{
+#if defined(ENABLE_TestSet_InputFrameDriver_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputFrameDriver_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numFrames = INPUT_FRAME_DRIVER_PERFORMANCE_NUM_FRAMES;
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    VirtualInputBackend         backend;
+    InputFrameDriver            driver(inputSystem, backend);
+
+    // Busy play: key changes, cursor motion every frame and all four controllers moving
+    std::mt19937                          rng(31337u);
+    std::uniform_real_distribution<float> unitDist(0.0f, 1.0f);
+    std::uniform_int_distribution<int>    keyDist(0, 255);
+
+    for (int controllerIndex = 0; controllerIndex < NUM_XBOX_CONTROLLERS; ++controllerIndex)
+    {
+        backend.ConnectController(0, controllerIndex);
+    }
+
+    for (int frame = 0; frame < numFrames; ++frame)
+    {
+        unsigned char const keyCode = static_cast<unsigned char>(keyDist(rng));
+
+        backend.PressKey(frame, keyCode);
+        backend.ReleaseKey(frame + 3, keyCode);
+        backend.MoveCursor(frame, Vector2Class(unitDist(rng) * 1600.0f, unitDist(rng) * 800.0f));
+
+        int const controllerIndex = frame % NUM_XBOX_CONTROLLERS;
+        backend.MoveLeftStick(frame, controllerIndex, Vector2Class(unitDist(rng) * 2.0f - 1.0f, unitDist(rng) * 2.0f - 1.0f));
+        backend.PressButton(frame, controllerIndex, static_cast<XboxButtonID>(frame % NUM_XBOX_BUTTONS));
+        backend.ReleaseButton(frame + 1, controllerIndex, static_cast<XboxButtonID>(frame % NUM_XBOX_BUTTONS));
+    }
+
+    PerformanceTimer timer;
+
+    timer.Start();
+    driver.Startup();
+    for (int frame = 0; frame < numFrames; ++frame)
+    {
+        driver.BeginFrame();
+        driver.EndFrame();
+    }
+    driver.Shutdown();
+    timer.Stop();
+    double const cycleTime = timer.GetElapsedMicroseconds();
+
+    printf("  %d frames of Startup -> (BeginFrame -> EndFrame) x %d -> Shutdown...\n", numFrames, numFrames);
+    printf("    Total:     %.3f ms\n", cycleTime / 1000.0);
+    printf("    Per frame: %.3f us\n", cycleTime / numFrames);
+
+    VerifyTestResult(driver.GetFrameNumber() == numFrames && driver.GetEventQueue().GetNumDropped() == 0, "InputFrameDriver performance tests completed");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputFrameDriver_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_InputFrameDriver()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_InputFrameDriver)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_InputFrameDriver_Lifecycle, "InputFrameDriver - Lifecycle");
+    RunTestSet(true, TestSet_InputFrameDriver_Keyboard, "InputFrameDriver - Keyboard");
+    RunTestSet(true, TestSet_InputFrameDriver_CursorAndControllers, "InputFrameDriver - Cursor and Controllers");
+    RunTestSet(false, TestSet_InputFrameDriver_Performance, "InputFrameDriver - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_InputFrameDriver)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
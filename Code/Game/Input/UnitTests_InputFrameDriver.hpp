@@ -0,0 +1,31 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_InputFrameDriver.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_InputFrameDriver();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_InputFrameDriver_Lifecycle();
+int TestSet_InputFrameDriver_Keyboard();
+int TestSet_InputFrameDriver_CursorAndControllers();
+int TestSet_InputFrameDriver_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_InputFrameDriver_Lifecycle
+#define ENABLE_TestSet_InputFrameDriver_Keyboard
+#define ENABLE_TestSet_InputFrameDriver_CursorAndControllers
+#define ENABLE_TestSet_InputFrameDriver_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define INPUT_FRAME_DRIVER_PERFORMANCE_NUM_FRAMES 10000
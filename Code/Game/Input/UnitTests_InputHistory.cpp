@@ -0,0 +1,441 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_InputHistory.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/UnitTests_InputHistory.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Input/InputFrameDriver.hpp"
+#include "Game/Input/InputHistory.hpp"
+#include "Game/Input/VirtualInputBackend.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    struct sKeyPattern
+    {
+        unsigned char m_keyCode  = 0;
+        char const*   m_isDownAt = "";     // One character per frame, oldest first; 'X' is down
+    };
+
+    //------------------------------------------------------------------------------------------------
+    void RecordPatterns(InputHistory&                   history,
+                        std::vector<sKeyPattern> const& patterns)
+    {
+        size_t const numFrames = strlen(patterns[0].m_isDownAt);
+
+        for (size_t frame = 0; frame < numFrames; ++frame)
+        {
+            sKeyMask keysDown;
+
+            for (sKeyPattern const& pattern : patterns)
+            {
+                if (pattern.m_isDownAt[frame] == 'X')
+                {
+                    keysDown.Set(pattern.m_keyCode);
+                }
+            }
+
+            history.RecordFrame(keysDown);
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // The same history as one key bitset per frame in a ring, queried by scanning frames
+    //
+    struct sKeyMaskRing
+    {
+        sKeyMask m_frames[64];
+        int      m_latest = 0;
+
+        void RecordFrame(sKeyMask const& keysDown)
+        {
+            m_latest           = (m_latest + 1) & 63;
+            m_frames[m_latest] = keysDown;
+        }
+
+        bool WasKeyPressed(unsigned char const keyCode,
+                           int const           framesAgo) const
+        {
+            return m_frames[(m_latest - framesAgo) & 63].Test(keyCode) && !m_frames[(m_latest - framesAgo - 1) & 63].Test(keyCode);
+        }
+
+        bool WasKeyPressedWithinFrames(unsigned char const keyCode,
+                                       int const           numFrames) const
+        {
+            for (int framesAgo = 0; framesAgo < numFrames; ++framesAgo)
+            {
+                if (WasKeyPressed(keyCode, framesAgo))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        bool WasPressReleasePressWithinFrames(unsigned char const keyCode,
+                                              int const           numFrames) const
+        {
+            int step = 0;   // Looking for the second press, then the release, then the first press
+
+            for (int framesAgo = 0; framesAgo < numFrames && step < 3; ++framesAgo)
+            {
+                bool const isDown     = m_frames[(m_latest - framesAgo) & 63].Test(keyCode);
+                bool const wasDown    = m_frames[(m_latest - framesAgo - 1) & 63].Test(keyCode);
+                bool const isExpected = (step == 1) ? (!isDown && wasDown) : (isDown && !wasDown);
+
+                if (isExpected)
+                {
+                    ++step;
+                }
+            }
+
+            return step == 3;
+        }
+    };
+
+    //------------------------------------------------------------------------------------------------
+    // Per-key frame counters, the way buffering is done by hand
+    //
+    struct sKeyPressCounters
+    {
+        sKeyMask m_wasDown;
+        int      m_framesSincePressed[256];
+
+        sKeyPressCounters()
+        {
+            for (int& framesSincePressed : m_framesSincePressed)
+            {
+                framesSincePressed = 1000;
+            }
+        }
+
+        void RecordFrame(sKeyMask const& keysDown)
+        {
+            for (int keyIndex = 0; keyIndex < 256; ++keyIndex)
+            {
+                unsigned char const keyCode = static_cast<unsigned char>(keyIndex);
+
+                if (keysDown.Test(keyCode) && !m_wasDown.Test(keyCode))
+                {
+                    m_framesSincePressed[keyIndex] = 0;
+                }
+                else if (m_framesSincePressed[keyIndex] < 1000)
+                {
+                    ++m_framesSincePressed[keyIndex];
+                }
+            }
+
+            m_wasDown = keysDown;
+        }
+    };
+
+    //------------------------------------------------------------------------------------------------
+    // A few keys held and released at random, from a fixed seed
+    //
+    std::vector<sKeyMask> MakeRandomFrames(int const numFrames)
+    {
+        std::vector<sKeyMask> frames(numFrames);
+        sKeyMask              keysDown;
+        uint32_t              seed = 12345;
+
+        for (sKeyMask& frame : frames)
+        {
+            seed = seed * 1664525u + 1013904223u;
+
+            unsigned char const keyCode = static_cast<unsigned char>('A' + (seed >> 24) % 8);
+
+            if ((seed >> 16) % 3 == 0)
+            {
+                keysDown.Set(keyCode);
+            }
+            else if ((seed >> 16) % 3 == 1)
+            {
+                keysDown.Reset(keyCode);
+            }
+
+            frame = keysDown;
+        }
+
+        return frames;
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputHistory_Basics()
+{
+#if defined(ENABLE_TestSet_InputHistory_Basics)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputHistory_Basics)(start)\n");
+    printf("####################################################################################################\n");
+
+    // Space pressed 3 frames ago, held for 3 frames and released on the latest
+    InputHistory history;
+    RecordPatterns(history, {{KEYCODE_SPACE, "__XXX_"}});
+
+    VerifyTestResult(history.GetNumFramesRecorded() == 6 && history.WasKeyDown(KEYCODE_SPACE, 1) && !history.WasKeyDown(KEYCODE_SPACE, 0) &&
+                     history.WasKeyDown(KEYCODE_SPACE, 3) && !history.WasKeyDown(KEYCODE_SPACE, 4),
+                     "WasKeyDown should count frames back from the latest");
+
+    VerifyTestResult(history.WasKeyPressedWithinFrames(KEYCODE_SPACE, 4) && !history.WasKeyPressedWithinFrames(KEYCODE_SPACE, 3) &&
+                     history.GetFramesSinceKeyPressed(KEYCODE_SPACE) == 3 && history.GetFramesSinceKeyPressed(KEYCODE_A) == -1,
+                     "A press should be buffered for exactly as many frames as asked");
+
+    VerifyTestResult(history.WasKeyReleasedWithinFrames(KEYCODE_SPACE, 1) && !history.WasKeyReleasedWithinFrames(KEYCODE_A, 6) &&
+                     !history.WasKeyReleasedWithinFrames(KEYCODE_SPACE, 0),
+                     "Releases should be found the same way, and a zero-frame window should find nothing");
+
+    RecordPatterns(history, {{KEYCODE_A, "XXXX"}});
+    VerifyTestResult(history.WasKeyHeldForFrames(KEYCODE_A, 4) && !history.WasKeyHeldForFrames(KEYCODE_A, 5) && history.WasKeyPressedWithinFrames(KEYCODE_A, 4),
+                     "WasKeyHeldForFrames should need the key down on every frame of the window");
+
+    for (int frame = 0; frame < INPUT_HISTORY_DEPTH - 4; ++frame)
+    {
+        history.RecordFrame(sKeyMask());
+    }
+
+    bool const bPressAtDepth = history.GetFramesSinceKeyPressed(KEYCODE_A) == INPUT_HISTORY_DEPTH - 1 && history.WasKeyPressedWithinFrames(KEYCODE_A, 1000);
+    history.RecordFrame(sKeyMask());
+    bool const bPressForgotten = history.GetFramesSinceKeyPressed(KEYCODE_A) == -1;
+    history.Clear();
+    VerifyTestResult(bPressAtDepth && bPressForgotten && history.GetNumFramesRecorded() == 0 && !history.WasKeyDown(KEYCODE_SPACE, 6),
+                     "Presses should be kept for the full depth and no longer, and Clear should forget everything");
+
+    // Rolled back by two frames, Space is still held on the latest frame
+    InputHistory rewound;
+    RecordPatterns(rewound, {{KEYCODE_SPACE, "__XXX__"}});
+    rewound.Rewind(2);
+    bool const bRewoundTwo = rewound.GetNumFramesRecorded() == 5 && rewound.WasKeyDown(KEYCODE_SPACE, 0) && rewound.GetFramesSinceKeyPressed(KEYCODE_SPACE) == 2 &&
+                             !rewound.WasKeyReleasedWithinFrames(KEYCODE_SPACE, INPUT_HISTORY_DEPTH);
+    rewound.Rewind(3);
+    VerifyTestResult(bRewoundTwo && rewound.GetNumFramesRecorded() == 2 && rewound.GetFramesSinceKeyPressed(KEYCODE_SPACE) == -1,
+                     "Rewind should forget the latest frames and leave the earlier ones where they were");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputHistory_Basics)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 6; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputHistory_Sequences()
+{
+#if defined(ENABLE_TestSet_InputHistory_Sequences)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputHistory_Sequences)(start)\n");
+    printf("####################################################################################################\n");
+
+    sInputSequenceStep const doubleTap[] = {{KEYCODE_SPACE, eKeyEdge::PRESSED}, {KEYCODE_SPACE, eKeyEdge::RELEASED}, {KEYCODE_SPACE, eKeyEdge::PRESSED}};
+
+    // Press-release-press spanning 7 frames
+    InputHistory history;
+    RecordPatterns(history, {{KEYCODE_SPACE, "____XX___XX_"}});
+    VerifyTestResult(history.WasSequenceWithinFrames(doubleTap, 3, 10) && history.WasSequenceWithinFrames(doubleTap, 3, 8) &&
+                     !history.WasSequenceWithinFrames(doubleTap, 3, 7),
+                     "Press-release-press should match only when the whole sequence is inside the window");
+
+    // One long hold has a press and a release but not a second press
+    InputHistory held;
+    RecordPatterns(held, {{KEYCODE_SPACE, "__XXXXXX____"}});
+    VerifyTestResult(!held.WasSequenceWithinFrames(doubleTap, 3, 10) && held.WasSequenceWithinFrames(doubleTap, 2, 10),
+                     "One press should not count twice");
+
+    // Down, then Right, then Space, with Right pressed before Down is released
+    sInputSequenceStep const motion[]         = {{KEYCODE_DOWNARROW, eKeyEdge::PRESSED}, {KEYCODE_RIGHTARROW, eKeyEdge::PRESSED}, {KEYCODE_SPACE, eKeyEdge::PRESSED}};
+    sInputSequenceStep const motionReversed[] = {{KEYCODE_RIGHTARROW, eKeyEdge::PRESSED}, {KEYCODE_DOWNARROW, eKeyEdge::PRESSED}, {KEYCODE_SPACE, eKeyEdge::PRESSED}};
+
+    InputHistory fighter;
+    RecordPatterns(fighter, {{KEYCODE_DOWNARROW,  "_XXX______"},
+                             {KEYCODE_RIGHTARROW, "___XXX____"},
+                             {KEYCODE_SPACE,      "_____XX___"}});
+    VerifyTestResult(fighter.WasSequenceWithinFrames(motion, 3, 9) && !fighter.WasSequenceWithinFrames(motionReversed, 3, 9) &&
+                     !fighter.WasSequenceWithinFrames(motion, 0, 9),
+                     "A sequence of different keys should match only in order");
+
+    // A and B pressed 2 frames apart
+    sKeyMask chord;
+    chord.Set(KEYCODE_A);
+    chord.Set(KEYCODE_B);
+
+    InputHistory chordHistory;
+    RecordPatterns(chordHistory, {{KEYCODE_A, "__XXXX"},
+                                  {KEYCODE_B, "____XX"}});
+    VerifyTestResult(chordHistory.WasChordPressedWithinFrames(chord, 4) && !chordHistory.WasChordPressedWithinFrames(chord, 3) &&
+                     !chordHistory.WasChordPressedWithinFrames(sKeyMask(), 4),
+                     "A chord should need every key pressed within the window");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputHistory_Sequences)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 4; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputHistory_FrameDriver()
+{
+#if defined(ENABLE_TestSet_InputHistory_FrameDriver)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputHistory_FrameDriver)(start)\n");
+    printf("####################################################################################################\n");
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    VirtualInputBackend         backend;
+    InputFrameDriver            driver(inputSystem, backend);
+
+    backend.PressKey(1, KEYCODE_SPACE);
+    backend.ReleaseKey(2, KEYCODE_SPACE);
+    driver.Startup();
+
+    for (int frame = 0; frame < 6; ++frame)
+    {
+        driver.BeginFrame();
+        driver.EndFrame();
+    }
+
+    InputHistory const& history = driver.GetInputHistory();
+    VerifyTestResult(history.GetNumFramesRecorded() == 6 && history.GetFramesSinceKeyPressed(KEYCODE_SPACE) == 4 &&
+                     history.WasKeyPressedWithinFrames(KEYCODE_SPACE, 6) && !history.WasKeyPressedWithinFrames(KEYCODE_SPACE, 4),
+                     "BeginFrame should record each frame's keys in the input history");
+
+    driver.Shutdown();
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputHistory_FrameDriver)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputHistory_Performance()
+{
+#if defined(ENABLE_TestSet_InputHistory_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputHistory_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numFrames  = INPUT_HISTORY_PERFORMANCE_NUM_FRAMES;
+    int constexpr numQueries = INPUT_HISTORY_PERFORMANCE_NUM_QUERIES;
+    int constexpr window     = INPUT_HISTORY_QUERY_WINDOW_FRAMES;
+
+    std::vector<sKeyMask> const frames = MakeRandomFrames(numFrames);
+    PerformanceTimer            timer;
+    int                         checksum = 0;
+
+    // Recording, per frame
+    sKeyPressCounters counters;
+    timer.Start();
+    for (sKeyMask const& frame : frames)
+    {
+        counters.RecordFrame(frame);
+    }
+    timer.Stop();
+    double const countersRecordTime = timer.GetElapsedMicroseconds();
+
+    sKeyMaskRing ring;
+    timer.Start();
+    for (sKeyMask const& frame : frames)
+    {
+        ring.RecordFrame(frame);
+    }
+    timer.Stop();
+    double const ringRecordTime = timer.GetElapsedMicroseconds();
+
+    InputHistory history;
+    timer.Start();
+    for (sKeyMask const& frame : frames)
+    {
+        history.RecordFrame(frame);
+    }
+    timer.Stop();
+    double const historyRecordTime = timer.GetElapsedMicroseconds();
+
+    printf("  Recording %d frames:\n", numFrames);
+    printf("    Per-key frame counters:          %7.1f ns/frame\n", countersRecordTime * 1000.0 / numFrames);
+    printf("    Key bitset ring:                 %7.1f ns/frame\n", ringRecordTime * 1000.0 / numFrames);
+    printf("    InputHistory:                    %7.1f ns/frame\n", historyRecordTime * 1000.0 / numFrames);
+
+    // Queries against the final history, over the keys the random input uses
+    timer.Start();
+    for (int query = 0; query < numQueries; ++query)
+    {
+        checksum += ring.WasKeyPressedWithinFrames(static_cast<unsigned char>('A' + (query & 7)), window) ? 1 : 0;
+    }
+    timer.Stop();
+    double const ringQueryTime = timer.GetElapsedMicroseconds();
+
+    timer.Start();
+    for (int query = 0; query < numQueries; ++query)
+    {
+        checksum += history.WasKeyPressedWithinFrames(static_cast<unsigned char>('A' + (query & 7)), window) ? 1 : 0;
+    }
+    timer.Stop();
+    double const historyQueryTime = timer.GetElapsedMicroseconds();
+
+    timer.Start();
+    for (int query = 0; query < numQueries; ++query)
+    {
+        checksum += ring.WasPressReleasePressWithinFrames(static_cast<unsigned char>('A' + (query & 7)), window) ? 1 : 0;
+    }
+    timer.Stop();
+    double const ringSequenceTime = timer.GetElapsedMicroseconds();
+
+    timer.Start();
+    for (int query = 0; query < numQueries; ++query)
+    {
+        unsigned char const      keyCode     = static_cast<unsigned char>('A' + (query & 7));
+        sInputSequenceStep const doubleTap[] = {{keyCode, eKeyEdge::PRESSED}, {keyCode, eKeyEdge::RELEASED}, {keyCode, eKeyEdge::PRESSED}};
+        checksum += history.WasSequenceWithinFrames(doubleTap, 3, window) ? 1 : 0;
+    }
+    timer.Stop();
+    double const historySequenceTime = timer.GetElapsedMicroseconds();
+
+    printf("  %d queries over a %d-frame window:\n", numQueries, window);
+    printf("    Pressed within, ring scan:       %7.2f ns/query\n", ringQueryTime * 1000.0 / numQueries);
+    printf("    Pressed within, InputHistory:    %7.2f ns/query (%.1fx)\n", historyQueryTime * 1000.0 / numQueries, ringQueryTime / historyQueryTime);
+    printf("    Double tap, ring scan:           %7.2f ns/query\n", ringSequenceTime * 1000.0 / numQueries);
+    printf("    Double tap, InputHistory:        %7.2f ns/query (%.1fx)   (checksum %d)\n", historySequenceTime * 1000.0 / numQueries, ringSequenceTime / historySequenceTime, checksum);
+
+    VerifyTestResult(true, "InputHistory performance tests completed");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputHistory_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_InputHistory()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_InputHistory)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_InputHistory_Basics, "InputHistory - Basics");
+    RunTestSet(true, TestSet_InputHistory_Sequences, "InputHistory - Sequences");
+    RunTestSet(true, TestSet_InputHistory_FrameDriver, "InputHistory - FrameDriver");
+    RunTestSet(false, TestSet_InputHistory_Performance, "InputHistory - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_InputHistory)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
@@ -0,0 +1,33 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_InputHistory.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_InputHistory();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_InputHistory_Basics();
+int TestSet_InputHistory_Sequences();
+int TestSet_InputHistory_FrameDriver();
+int TestSet_InputHistory_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_InputHistory_Basics
+#define ENABLE_TestSet_InputHistory_Sequences
+#define ENABLE_TestSet_InputHistory_FrameDriver
+#define ENABLE_TestSet_InputHistory_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define INPUT_HISTORY_PERFORMANCE_NUM_FRAMES     100000
+#define INPUT_HISTORY_PERFORMANCE_NUM_QUERIES    10000000
+#define INPUT_HISTORY_QUERY_WINDOW_FRAMES        10
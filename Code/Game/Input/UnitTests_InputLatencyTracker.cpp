@@ -0,0 +1,232 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_InputLatencyTracker.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/UnitTests_InputLatencyTracker.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Input/InputFrameDriver.hpp"
+#include "Game/Input/InputLatencyTracker.hpp"
+#include "Game/Input/VirtualInputBackend.hpp"
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputLatencyTracker_Basics()
+{
+#if defined(ENABLE_TestSet_InputLatencyTracker_Basics)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputLatencyTracker_Basics)(start)\n");
+    printf("####################################################################################################\n");
+
+    InputLatencyTracker                tracker;
+    PerformanceClock::time_point const consumed = PerformanceClock::now();
+
+    // Events 1, 2 and 3 ms old
+    double const age = tracker.RecordEventConsumed(eInputLatencySource::KEY, consumed - std::chrono::milliseconds(3), consumed);
+    tracker.RecordEventConsumed(eInputLatencySource::KEY, consumed - std::chrono::milliseconds(1), consumed);
+    tracker.RecordEventConsumed(eInputLatencySource::KEY, consumed - std::chrono::milliseconds(2), consumed);
+
+    sInputLatencyStats const frame = tracker.GetFrameStats(eInputLatencySource::KEY);
+    VerifyTestResult(IsMostlyEqual(static_cast<float>(age), 3.0f) && frame.m_numEvents == 3 && IsMostlyEqual(static_cast<float>(frame.m_minMs), 1.0f) &&
+                     IsMostlyEqual(static_cast<float>(frame.m_avgMs), 2.0f) && IsMostlyEqual(static_cast<float>(frame.m_maxMs), 3.0f),
+                     "The frame in progress should report the min, average and max event age in milliseconds");
+
+    tracker.EndFrame();
+    VerifyTestResult(tracker.GetFrameStats(eInputLatencySource::KEY).m_numEvents == 0 && tracker.GetLastFrameStats(eInputLatencySource::KEY).m_numEvents == 3 &&
+                     tracker.GetLastFrameStats(eInputLatencySource::CURSOR).m_numEvents == 0,
+                     "EndFrame should close the frame and keep it as the last frame");
+
+    // 1 ms falls in the "<= 1 ms" bucket, 2 ms in "<= 2 ms", 3 ms in "<= 4 ms"
+    VerifyTestResult(tracker.GetHistogramCount(eInputLatencySource::KEY, eInputLatencyStat::MIN, 4) == 1 &&
+                     tracker.GetHistogramCount(eInputLatencySource::KEY, eInputLatencyStat::AVG, 5) == 1 &&
+                     tracker.GetHistogramCount(eInputLatencySource::KEY, eInputLatencyStat::MAX, 6) == 1,
+                     "The frame's min, average and max should each land in their histogram bucket");
+
+    // An empty frame, then a frame with one very late cursor event
+    tracker.EndFrame();
+    tracker.RecordEventConsumed(eInputLatencySource::CURSOR, consumed - std::chrono::milliseconds(100), consumed);
+    tracker.EndFrame();
+
+    VerifyTestResult(tracker.GetNumFramesWithEvents(eInputLatencySource::KEY) == 1 && tracker.GetNumFramesWithEvents(eInputLatencySource::CURSOR) == 1 &&
+                     tracker.GetHistogramCount(eInputLatencySource::CURSOR, eInputLatencyStat::MAX, NUM_INPUT_LATENCY_BUCKETS - 1) == 1,
+                     "Frames without events should not count, and ages past the last limit go in the last bucket");
+
+    sInputLatencyStats const total = tracker.GetTotalStats(eInputLatencySource::KEY);
+    tracker.Reset();
+    VerifyTestResult(total.m_numEvents == 3 && tracker.GetTotalStats(eInputLatencySource::KEY).m_numEvents == 0 &&
+                     tracker.GetHistogramCount(eInputLatencySource::KEY, eInputLatencyStat::MIN, 4) == 0,
+                     "Totals should cover every frame, and Reset should clear everything");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputLatencyTracker_Basics)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 5; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputLatencyTracker_EventQueue()
+{
+#if defined(ENABLE_TestSet_InputLatencyTracker_EventQueue)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputLatencyTracker_EventQueue)(start)\n");
+    printf("####################################################################################################\n");
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    InputEventQueue             queue;
+    InputLatencyTracker         tracker;
+
+    queue.PushKeyPressed(KEYCODE_A);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    queue.PushKeyPressed(KEYCODE_B);
+    queue.DrainInto(inputSystem, &tracker);
+
+    sInputLatencyStats const stats = tracker.GetFrameStats(eInputLatencySource::KEY);
+    printf("  Ages at DrainInto: %.3f ms and %.3f ms\n", stats.m_maxMs, stats.m_minMs);
+    VerifyTestResult(stats.m_numEvents == 2 && stats.m_maxMs >= 2.0 && stats.m_minMs < stats.m_maxMs,
+                     "DrainInto should report each event's age when it is applied");
+
+    queue.PushKeyReleased(KEYCODE_A);
+    queue.DrainInto(inputSystem);
+    VerifyTestResult(tracker.GetFrameStats(eInputLatencySource::KEY).m_numEvents == 2 && !inputSystem.IsKeyDown(KEYCODE_A),
+                     "DrainInto without a tracker should still apply events");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputLatencyTracker_EventQueue)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 2; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputLatencyTracker_FrameDriver()
+{
+#if defined(ENABLE_TestSet_InputLatencyTracker_FrameDriver)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputLatencyTracker_FrameDriver)(start)\n");
+    printf("####################################################################################################\n");
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    VirtualInputBackend         backend;
+    InputFrameDriver            driver(inputSystem, backend);
+
+    backend.PressKey(0, KEYCODE_SPACE);
+    backend.MoveCursor(0, Vector2Class(100.0f, 200.0f));
+    backend.ReleaseKey(1, KEYCODE_SPACE);
+    driver.Startup();
+
+    driver.BeginFrame();
+    InputLatencyTracker const& tracker = driver.GetLatencyTracker();
+    VerifyTestResult(tracker.GetFrameStats(eInputLatencySource::KEY).m_numEvents == 1 && tracker.GetFrameStats(eInputLatencySource::CURSOR).m_numEvents == 1,
+                     "BeginFrame should report the age of key events and cursor moves");
+    driver.EndFrame();
+
+    // The cursor stays put on frame 1
+    driver.BeginFrame();
+    driver.EndFrame();
+    VerifyTestResult(tracker.GetLastFrameStats(eInputLatencySource::KEY).m_numEvents == 1 && tracker.GetLastFrameStats(eInputLatencySource::CURSOR).m_numEvents == 0 &&
+                     tracker.GetNumFramesWithEvents(eInputLatencySource::KEY) == 2,
+                     "EndFrame should close the tracker's frame, and a cursor that did not move should not count");
+
+    driver.Shutdown();
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputLatencyTracker_FrameDriver)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 2; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputLatencyTracker_Report()
+{
+#if defined(ENABLE_TestSet_InputLatencyTracker_Report)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputLatencyTracker_Report)(start)\n");
+    printf("####################################################################################################\n");
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    VirtualInputBackend         backend;
+    InputFrameDriver            driver(inputSystem, backend);
+    std::atomic<bool>           bProducing = true;
+
+    driver.Startup();
+
+    // A window thread taking key events at a steady rate while the game runs fixed-length frames
+    std::thread producer([&driver, &bProducing]
+    {
+        std::chrono::microseconds const period(1000000 / INPUT_LATENCY_REPORT_PRODUCER_HZ);
+
+        for (int index = 0; bProducing.load(); ++index)
+        {
+            unsigned char const keyCode = static_cast<unsigned char>(index % 64);
+
+            if ((index / 64) % 2 == 0)
+            {
+                driver.GetEventQueue().PushKeyPressed(keyCode);
+            }
+            else
+            {
+                driver.GetEventQueue().PushKeyReleased(keyCode);
+            }
+
+            std::this_thread::sleep_for(period);
+        }
+    });
+
+    for (int frame = 0; frame < INPUT_LATENCY_REPORT_NUM_FRAMES; ++frame)
+    {
+        driver.BeginFrame();
+        std::this_thread::sleep_for(std::chrono::milliseconds(INPUT_LATENCY_REPORT_FRAME_MS));
+        driver.EndFrame();
+    }
+
+    bProducing.store(false);
+    producer.join();
+
+    char title[128];
+    snprintf(title, sizeof(title), "%d Hz producer, %d ms frames", INPUT_LATENCY_REPORT_PRODUCER_HZ, INPUT_LATENCY_REPORT_FRAME_MS);
+    driver.GetLatencyTracker().PrintReport(title);
+
+    VerifyTestResult(driver.GetLatencyTracker().GetTotalStats(eInputLatencySource::KEY).m_numEvents > 0, "InputLatencyTracker report completed");
+    driver.Shutdown();
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputLatencyTracker_Report)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_InputLatencyTracker()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_InputLatencyTracker)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_InputLatencyTracker_Basics, "InputLatencyTracker - Basics");
+    RunTestSet(true, TestSet_InputLatencyTracker_EventQueue, "InputLatencyTracker - EventQueue");
+    RunTestSet(true, TestSet_InputLatencyTracker_FrameDriver, "InputLatencyTracker - FrameDriver");
+    RunTestSet(false, TestSet_InputLatencyTracker_Report, "InputLatencyTracker - Latency Report");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_InputLatencyTracker)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
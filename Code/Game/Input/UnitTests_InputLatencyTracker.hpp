@@ -0,0 +1,33 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_InputLatencyTracker.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_InputLatencyTracker();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_InputLatencyTracker_Basics();
+int TestSet_InputLatencyTracker_EventQueue();
+int TestSet_InputLatencyTracker_FrameDriver();
+int TestSet_InputLatencyTracker_Report();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_InputLatencyTracker_Basics
+#define ENABLE_TestSet_InputLatencyTracker_EventQueue
+#define ENABLE_TestSet_InputLatencyTracker_FrameDriver
+#define ENABLE_TestSet_InputLatencyTracker_Report
+
+//----------------------------------------------------------------------------------------------------
+// Report configuration
+//
+#define INPUT_LATENCY_REPORT_NUM_FRAMES  50
+#define INPUT_LATENCY_REPORT_FRAME_MS    4
+#define INPUT_LATENCY_REPORT_PRODUCER_HZ 1000
@@ -0,0 +1,482 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_InputRecording.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/UnitTests_InputRecording.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Input/InputEventQueue.hpp"
+#include "Game/Input/InputRecording.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    char const* const TEST_RECORDING_PATH = "test_input.dat";
+
+    //------------------------------------------------------------------------------------------------
+    // Play-like input: a few held movement keys, bursts of mouse motion and a slowly drifting stick
+    //
+    std::vector<sRecordedInputFrame> GenerateSession(int const      numFrames,
+                                                     unsigned const seed)
+    {
+        unsigned char const keys[] = {KEYCODE_W, KEYCODE_A, KEYCODE_S, KEYCODE_D, KEYCODE_SPACE, KEYCODE_SHIFT, KEYCODE_LEFT_MOUSE, KEYCODE_RIGHT_MOUSE};
+
+        std::mt19937                          rng(seed);
+        std::uniform_real_distribution<float> unitDist(0.0f, 1.0f);
+        std::uniform_int_distribution<int>    keyDist(0, static_cast<int>(sizeof(keys)) - 1);
+
+        std::vector<sRecordedInputFrame> frames(static_cast<size_t>(numFrames));
+        sRecordedInputFrame              frame;
+        float                            cursorVelocityX = 0.0f;
+        float                            cursorVelocityY = 0.0f;
+
+        frame.m_analogs[RECORDED_ANALOG_CURSOR_X] = 640.0f;
+        frame.m_analogs[RECORDED_ANALOG_CURSOR_Y] = 360.0f;
+
+        for (sRecordedInputFrame& out_frame : frames)
+        {
+            if (unitDist(rng) < 0.05f)
+            {
+                unsigned char const keyCode = keys[keyDist(rng)];
+
+                if (frame.m_keysDown.Test(keyCode))
+                {
+                    frame.m_keysDown.Reset(keyCode);
+                }
+                else
+                {
+                    frame.m_keysDown.Set(keyCode);
+                }
+            }
+
+            if (unitDist(rng) < 0.02f)
+            {
+                bool const isMoving = unitDist(rng) < 0.5f;
+                cursorVelocityX     = isMoving ? unitDist(rng) * 20.0f - 10.0f : 0.0f;
+                cursorVelocityY     = isMoving ? unitDist(rng) * 20.0f - 10.0f : 0.0f;
+            }
+
+            frame.m_analogs[RECORDED_ANALOG_CURSOR_X] += cursorVelocityX;
+            frame.m_analogs[RECORDED_ANALOG_CURSOR_Y] += cursorVelocityY;
+
+            if (unitDist(rng) < 0.1f)
+            {
+                frame.m_analogs[RECORDED_ANALOG_LEFT_STICK_X] = unitDist(rng) * 2.0f - 1.0f;
+                frame.m_analogs[RECORDED_ANALOG_LEFT_STICK_Y] = unitDist(rng) * 2.0f - 1.0f;
+            }
+
+            if (unitDist(rng) < 0.01f)
+            {
+                frame.m_analogs[RECORDED_ANALOG_RIGHT_TRIGGER] = unitDist(rng);
+            }
+
+            out_frame = frame;
+        }
+
+        return frames;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    bool IsFrameReproduced(sRecordedInputFrame const& original,
+                           sRecordedInputFrame const& replayed)
+    {
+        if (!(original.m_keysDown == replayed.m_keysDown))
+        {
+            return false;
+        }
+
+        for (int analogIndex = 0; analogIndex < NUM_RECORDED_ANALOGS; ++analogIndex)
+        {
+            if (std::fabs(original.m_analogs[analogIndex] - replayed.m_analogs[analogIndex]) > 0.5f / RECORDED_ANALOG_STEPS_PER_UNIT + 1e-4f)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    long long RecordSession(std::vector<sRecordedInputFrame> const& frames,
+                            int const                               keyframeInterval)
+    {
+        InputRecorder recorder;
+        recorder.StartRecording(TEST_RECORDING_PATH, keyframeInterval);
+
+        for (sRecordedInputFrame const& frame : frames)
+        {
+            recorder.RecordFrame(frame);
+        }
+
+        recorder.StopRecording();
+
+        return recorder.GetNumBytesRecorded();
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Cuts the recording down to its first numBytes, as if the session had crashed there
+    //
+    void TruncateRecording(long long const numBytes)
+    {
+        std::vector<char> bytes(static_cast<size_t>(numBytes));
+
+        FILE* const inFile = std::fopen(TEST_RECORDING_PATH, "rb");
+        std::fread(bytes.data(), 1, bytes.size(), inFile);
+        std::fclose(inFile);
+
+        FILE* const outFile = std::fopen(TEST_RECORDING_PATH, "wb");
+        std::fwrite(bytes.data(), 1, bytes.size(), outFile);
+        std::fclose(outFile);
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputRecording_RoundTrip()
+{
+#if defined(ENABLE_TestSet_InputRecording_RoundTrip)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputRecording_RoundTrip)(start)\n");
+    printf("####################################################################################################\n");
+
+    // Test that idle frames cost one byte each
+    InputRecorder recorder;
+    bool const    bStarted = recorder.StartRecording(TEST_RECORDING_PATH, 1000);
+    for (int frame = 0; frame < 1000; ++frame)
+    {
+        recorder.RecordFrame(sRecordedInputFrame());
+    }
+    recorder.StopRecording();
+    VerifyTestResult(bStarted && !recorder.IsRecording() && recorder.GetNumFramesRecorded() == 1000, "Recorder should start, record 1000 frames and stop");
+    VerifyTestResult(recorder.GetNumBytesRecorded() == 16 + 1000 + 8 + 12, "Idle frames should cost one byte each, plus header and index");
+
+    // Test the round trip of a play-like session
+    std::vector<sRecordedInputFrame> const frames   = GenerateSession(3000, 77u);
+    long long const                        numBytes = RecordSession(frames, 60);
+
+    InputPlayback playback;
+    VerifyTestResult(playback.StartPlayback(TEST_RECORDING_PATH) && playback.IsPlaybackActive() && playback.GetNumFrames() == 3000,
+                     "Playback should open the recording and report its frame count");
+
+    bool bAllReproduced = true;
+    for (sRecordedInputFrame const& frame : frames)
+    {
+        sRecordedInputFrame replayed;
+        bAllReproduced = bAllReproduced && playback.ReadNextFrame(replayed) && IsFrameReproduced(frame, replayed);
+    }
+    VerifyTestResult(bAllReproduced, "Every frame should replay with exact keys and analogs within half a step");
+
+    sRecordedInputFrame pastEnd;
+    VerifyTestResult(!playback.IsPlaybackActive() && !playback.ReadNextFrame(pastEnd), "Playback should end after the last frame");
+
+    printf("  %d frames in %lld bytes, %.2f bytes/frame\n", static_cast<int>(frames.size()), numBytes, static_cast<double>(numBytes) / frames.size());
+
+    // Test rejecting files that aren't recordings
+    FILE* const notARecording = std::fopen(TEST_RECORDING_PATH, "wb");
+    std::fputs("definitely not an input recording", notARecording);
+    std::fclose(notARecording);
+    VerifyTestResult(!playback.StartPlayback(TEST_RECORDING_PATH) && !playback.IsPlaybackActive() && !playback.StartPlayback("missing_input.dat"),
+                     "Playback should refuse files that aren't recordings");
+
+    std::remove(TEST_RECORDING_PATH);
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputRecording_RoundTrip)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 6; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputRecording_Seeking()
+{
+#if defined(ENABLE_TestSet_InputRecording_Seeking)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputRecording_Seeking)(start)\n");
+    printf("####################################################################################################\n");
+
+    std::vector<sRecordedInputFrame> const frames = GenerateSession(2000, 99u);
+    RecordSession(frames, 50);
+
+    InputPlayback playback;
+    playback.StartPlayback(TEST_RECORDING_PATH);
+
+    // Test seeking to keyframes, between them, and backwards
+    bool bAllSeeksMatch = true;
+    for (int frameIndex : {0, 49, 50, 51, 1234, 700, 1999, 3})
+    {
+        sRecordedInputFrame replayed;
+        bAllSeeksMatch = bAllSeeksMatch && playback.SeekToFrame(frameIndex) && playback.GetNextFrameIndex() == frameIndex;
+        bAllSeeksMatch = bAllSeeksMatch && playback.ReadNextFrame(replayed) && IsFrameReproduced(frames[frameIndex], replayed);
+    }
+    VerifyTestResult(bAllSeeksMatch, "Seeking should land on any frame, forwards or backwards");
+
+    std::mt19937                       rng(5u);
+    std::uniform_int_distribution<int> frameDist(0, 1999);
+    bool                               bRandomSeeksMatch = true;
+    for (int seek = 0; seek < 200; ++seek)
+    {
+        int const           frameIndex = frameDist(rng);
+        sRecordedInputFrame replayed;
+        bRandomSeeksMatch = bRandomSeeksMatch && playback.SeekToFrame(frameIndex) && playback.ReadNextFrame(replayed) && IsFrameReproduced(frames[frameIndex], replayed);
+    }
+    VerifyTestResult(bRandomSeeksMatch, "200 random seeks should match the recorded frames");
+
+    VerifyTestResult(playback.SeekToFrame(2000) && !playback.IsPlaybackActive() && !playback.SeekToFrame(2001) && !playback.SeekToFrame(-1),
+                     "Seeking to the end should end playback, and past it should fail");
+
+    auto const seekTime = TimeFunction("SeekToFrame (1999, keyframe interval 50)", [&playback] { return playback.SeekToFrame(1999); });
+    VerifyTestResult(seekTime, "Seeking to the last frame should succeed");
+
+    playback.StopPlayback();
+    std::remove(TEST_RECORDING_PATH);
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputRecording_Seeking)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 4; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputRecording_Playback()
+{
+#if defined(ENABLE_TestSet_InputRecording_Playback)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputRecording_Playback)(start)\n");
+    printf("####################################################################################################\n");
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            recordedSystem(config);
+    InputRecorder               recorder;
+
+    // Record A held for two frames, then a tap of SPACE, straight from an InputSystem
+    recorder.StartRecording(TEST_RECORDING_PATH);
+    recordedSystem.HandleKeyPressed(KEYCODE_A);
+    recorder.RecordFrame(CaptureInputFrame(recordedSystem));
+    recordedSystem.EndFrame();
+    recordedSystem.HandleKeyPressed(KEYCODE_SPACE);
+    recorder.RecordFrame(CaptureInputFrame(recordedSystem));
+    recordedSystem.EndFrame();
+    recordedSystem.HandleKeyReleased(KEYCODE_A);
+    recordedSystem.HandleKeyReleased(KEYCODE_SPACE);
+    recorder.RecordFrame(CaptureInputFrame(recordedSystem));
+    recorder.StopRecording();
+
+    InputSystemClass inputSystem(config);
+    InputPlayback    playback;
+    playback.StartPlayback(TEST_RECORDING_PATH);
+
+    // Keys held before playback starts are released by the first frame
+    inputSystem.HandleKeyPressed(KEYCODE_F1);
+
+    bool const bFrame0 = playback.UpdatePlayback(inputSystem) && inputSystem.WasKeyJustPressed(KEYCODE_A) && !inputSystem.IsKeyDown(KEYCODE_SPACE) &&
+                         !inputSystem.IsKeyDown(KEYCODE_F1);
+    inputSystem.EndFrame();
+    bool const bFrame1 = playback.UpdatePlayback(inputSystem) && inputSystem.IsKeyDown(KEYCODE_A) && !inputSystem.WasKeyJustPressed(KEYCODE_A) &&
+                         inputSystem.WasKeyJustPressed(KEYCODE_SPACE);
+    inputSystem.EndFrame();
+    bool const bFrame2 = playback.UpdatePlayback(inputSystem) && inputSystem.WasKeyJustReleased(KEYCODE_A) && inputSystem.WasKeyJustReleased(KEYCODE_SPACE);
+    VerifyTestResult(bFrame0 && bFrame1 && bFrame2, "UpdatePlayback should drive the InputSystem through the recorded key changes");
+
+    inputSystem.EndFrame();
+    VerifyTestResult(!playback.UpdatePlayback(inputSystem) && !playback.IsPlaybackActive(), "UpdatePlayback should stop at the end of the recording");
+
+    // Seeking re-syncs every key
+    playback.SeekToFrame(1);
+    inputSystem.HandleKeyPressed(KEYCODE_W);
+    VerifyTestResult(playback.UpdatePlayback(inputSystem) && inputSystem.IsKeyDown(KEYCODE_A) && inputSystem.IsKeyDown(KEYCODE_SPACE) && !inputSystem.IsKeyDown(KEYCODE_W),
+                     "The first frame after a seek should set every key to its recorded state");
+
+    // Key changes dropped by a full queue are sent again the next frame; the first frame after a
+    // seek sends all 256 keys, more than the queue holds
+    InputSystemClass queuedSystem(config);
+    InputEventQueue  eventQueue(64);
+    playback.SeekToFrame(0);
+
+    playback.UpdatePlayback(eventQueue);
+    eventQueue.DrainInto(queuedSystem);
+    bool const bDroppedAtFirst = !queuedSystem.IsKeyDown(KEYCODE_A) && eventQueue.GetNumDropped() > 0;
+    playback.UpdatePlayback(eventQueue);
+    eventQueue.DrainInto(queuedSystem);
+    VerifyTestResult(bDroppedAtFirst && queuedSystem.IsKeyDown(KEYCODE_A) && queuedSystem.IsKeyDown(KEYCODE_SPACE),
+                     "UpdatePlayback should resend key changes the event queue dropped");
+
+    playback.StopPlayback();
+    std::remove(TEST_RECORDING_PATH);
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputRecording_Playback)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 4; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputRecording_Recovery()
+{
+#if defined(ENABLE_TestSet_InputRecording_Recovery)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputRecording_Recovery)(start)\n");
+    printf("####################################################################################################\n");
+
+    std::vector<sRecordedInputFrame> const frames     = GenerateSession(1000, 31u);
+    long long const                        numBytes   = RecordSession(frames, 60);
+    long long const                        framesSize = numBytes - 12 - 17 * 8;     // Without the 17 keyframe offsets and the trailer
+
+    // Test that a recording without its index is scanned for frames and keyframes
+    TruncateRecording(framesSize);
+
+    InputPlayback playback;
+    bool          bAllReproduced = playback.StartPlayback(TEST_RECORDING_PATH) && playback.GetNumFrames() == 1000;
+    for (int frameIndex : {0, 59, 60, 61, 999, 500, 1})
+    {
+        sRecordedInputFrame replayed;
+        bAllReproduced = bAllReproduced && playback.SeekToFrame(frameIndex) && playback.ReadNextFrame(replayed) && IsFrameReproduced(frames[frameIndex], replayed);
+    }
+    VerifyTestResult(bAllReproduced, "A recording without an index should still play and seek through every frame");
+
+    // Test that a frame cut short is dropped
+    playback.StopPlayback();
+    TruncateRecording(framesSize - 1);
+
+    bool bCutFrameDropped = playback.StartPlayback(TEST_RECORDING_PATH) && playback.GetNumFrames() == 999;
+    for (int frameIndex = 0; frameIndex < 999; ++frameIndex)
+    {
+        sRecordedInputFrame replayed;
+        bCutFrameDropped = bCutFrameDropped && playback.ReadNextFrame(replayed) && IsFrameReproduced(frames[frameIndex], replayed);
+    }
+    VerifyTestResult(bCutFrameDropped && !playback.IsPlaybackActive(), "A recording cut mid-frame should play up to its last complete frame");
+
+    playback.StopPlayback();
+    std::remove(TEST_RECORDING_PATH);
+
+    // Test that a failed write is reported rather than making a short recording look complete
+    InputRecorder recorder;
+    recorder.StartRecording(TEST_RECORDING_PATH);
+    recorder.RecordFrame(frames[0]);
+    bool bWriteResultReported = recorder.StopRecording() && !recorder.HasWriteFailed() && recorder.GetNumBytesRecorded() > 0;
+    std::remove(TEST_RECORDING_PATH);
+
+#if !defined(_WIN32)
+    // Every write to /dev/full fails with ENOSPC
+    bool const bStarted = recorder.StartRecording("/dev/full");
+    for (sRecordedInputFrame const& frame : frames)
+    {
+        recorder.RecordFrame(frame);
+    }
+    bWriteResultReported = bWriteResultReported && bStarted && !recorder.StopRecording() && recorder.HasWriteFailed() && recorder.GetNumBytesRecorded() == 0;
+#endif
+    VerifyTestResult(bWriteResultReported, "StopRecording should report whether every write reached the file");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputRecording_Recovery)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 3; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputRecording_Performance()
+{
+#if defined(ENABLE_TestSet_InputRecording_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputRecording_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numFrames = INPUT_RECORDING_PERFORMANCE_NUM_FRAMES;
+
+    std::vector<sRecordedInputFrame> const frames = GenerateSession(numFrames, 2024u);
+    PerformanceTimer                       timer;
+
+    printf("  %d frames of play-like input...\n", numFrames);
+
+    InputRecorder recorder;
+    recorder.StartRecording(TEST_RECORDING_PATH);
+
+    timer.Start();
+    for (sRecordedInputFrame const& frame : frames)
+    {
+        recorder.RecordFrame(frame);
+    }
+    timer.Stop();
+    double const recordTime = timer.GetElapsedMicroseconds();
+
+    recorder.StopRecording();
+    long long const numBytes = recorder.GetNumBytesRecorded();
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    InputPlayback               playback;
+    playback.StartPlayback(TEST_RECORDING_PATH);
+
+    int numReplayed = 0;
+    timer.Start();
+    while (playback.UpdatePlayback(inputSystem))
+    {
+        inputSystem.EndFrame();
+        ++numReplayed;
+    }
+    timer.Stop();
+    double const replayTime = timer.GetElapsedMicroseconds();
+
+    timer.Start();
+    for (int seek = 0; seek < 1000; ++seek)
+    {
+        playback.SeekToFrame((seek * 7919) % numFrames);
+    }
+    timer.Stop();
+    double const seekTime = timer.GetElapsedMicroseconds();
+
+    double const rawFrameSize = static_cast<double>(sizeof(sRecordedInputFrame));
+
+    printf("    Size:   %.3f bytes/frame (%.1f KB total, %.0fx smaller than raw %d-byte frames)\n",
+           static_cast<double>(numBytes) / numFrames, numBytes / 1024.0, rawFrameSize * numFrames / numBytes, static_cast<int>(rawFrameSize));
+    printf("    Record: %.3f us/frame\n", recordTime / numFrames);
+    printf("    Replay: %.3f us/frame (UpdatePlayback + EndFrame)\n", replayTime / numFrames);
+    printf("    Seek:   %.3f us/seek\n", seekTime / 1000.0);
+
+    playback.StopPlayback();
+    std::remove(TEST_RECORDING_PATH);
+
+    VerifyTestResult(numReplayed == numFrames, "InputRecording performance tests completed");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputRecording_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_InputRecording()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_InputRecording)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_InputRecording_RoundTrip, "InputRecording - Round Trip");
+    RunTestSet(true, TestSet_InputRecording_Seeking, "InputRecording - Seeking");
+    RunTestSet(true, TestSet_InputRecording_Playback, "InputRecording - Playback");
+    RunTestSet(true, TestSet_InputRecording_Recovery, "InputRecording - Recovery");
+    RunTestSet(false, TestSet_InputRecording_Performance, "InputRecording - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_InputRecording)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
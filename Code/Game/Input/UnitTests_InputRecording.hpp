@@ -0,0 +1,33 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_InputRecording.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_InputRecording();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_InputRecording_RoundTrip();
+int TestSet_InputRecording_Seeking();
+int TestSet_InputRecording_Playback();
+int TestSet_InputRecording_Recovery();
+int TestSet_InputRecording_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_InputRecording_RoundTrip
+#define ENABLE_TestSet_InputRecording_Seeking
+#define ENABLE_TestSet_InputRecording_Playback
+#define ENABLE_TestSet_InputRecording_Recovery
+#define ENABLE_TestSet_InputRecording_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define INPUT_RECORDING_PERFORMANCE_NUM_FRAMES 216000   // One hour at 60 Hz
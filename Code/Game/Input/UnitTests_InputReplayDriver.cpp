@@ -0,0 +1,264 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_InputReplayDriver.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/UnitTests_InputReplayDriver.hpp"
+
+#include <cstdio>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Input/InputFrameDriver.hpp"
+#include "Game/Input/InputReplayDriver.hpp"
+#include "Game/Input/VirtualInputBackend.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    char const* const TEST_REPLAY_PATH = "test_replay.dat";
+
+    //------------------------------------------------------------------------------------------------
+    // Records numFrames of W held every other second and the left stick sweeping around
+    //
+    void RecordTestSession(int const numFrames)
+    {
+        InputRecorder recorder;
+        recorder.StartRecording(TEST_REPLAY_PATH);
+
+        for (int frame = 0; frame < numFrames; ++frame)
+        {
+            sRecordedInputFrame recordedFrame;
+
+            if ((frame / 60) % 2 == 0)
+            {
+                recordedFrame.m_keysDown.Set(KEYCODE_W);
+            }
+
+            recordedFrame.m_analogs[RECORDED_ANALOG_LEFT_STICK_X] = static_cast<float>(frame % 100) * 0.01f;
+            recorder.RecordFrame(recordedFrame);
+        }
+
+        recorder.StopRecording();
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // A stand-in for the input-dependent simulation: a player walking with W and steering with the stick
+    //
+    struct sTestPlayer
+    {
+        Vector2Class m_position = Vector2Class(0.0f, 0.0f);
+        int          m_numSteps = 0;
+
+        void Update(InputSystemClass const&    inputSystem,
+                    sRecordedInputFrame const& frame,
+                    double const               deltaSeconds)
+        {
+            float const speed = inputSystem.IsKeyDown(KEYCODE_W) ? 5.0f : 0.0f;
+
+            m_position.x += frame.m_analogs[RECORDED_ANALOG_LEFT_STICK_X] * static_cast<float>(deltaSeconds);
+            m_position.y += speed * static_cast<float>(deltaSeconds);
+            ++m_numSteps;
+        }
+    };
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputReplayDriver_Basics()
+{
+#if defined(ENABLE_TestSet_InputReplayDriver_Basics)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputReplayDriver_Basics)(start)\n");
+    printf("####################################################################################################\n");
+
+    RecordTestSession(600);
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    InputPlayback               playback;
+    playback.StartPlayback(TEST_REPLAY_PATH);
+
+    InputReplayDriver replay(inputSystem, playback);
+    sTestPlayer       player;
+    int               numJustPressed = 0;
+
+    auto const simulateFrame = [&player, &numJustPressed](InputSystemClass& frameInput, sRecordedInputFrame const& frame, double const deltaSeconds)
+    {
+        player.Update(frameInput, frame, deltaSeconds);
+        numJustPressed += frameInput.WasKeyJustPressed(KEYCODE_W) ? 1 : 0;
+    };
+
+    // Run the first half, then the rest
+    sReplayStats const firstHalf = replay.Run(simulateFrame, 300);
+    VerifyTestResult(firstHalf.m_numFrames == 300 && playback.GetNextFrameIndex() == 300 && IsMostlyEqual(static_cast<float>(firstHalf.m_simulatedSeconds), 5.0f),
+                     "Run should stop at maxFrames with 5 simulated seconds at 60 Hz");
+
+    sReplayStats const secondHalf = replay.Run(simulateFrame);
+    VerifyTestResult(secondHalf.m_numFrames == 300 && !playback.IsPlaybackActive() && replay.GetNumFramesReplayed() == 600 &&
+                     IsMostlyEqual(static_cast<float>(replay.GetSimulatedSeconds()), 10.0f),
+                     "Run should continue to the end of the recording");
+
+    VerifyTestResult(player.m_numSteps == 600 && numJustPressed == 5, "The simulation should run once per frame and see W pressed every other second");
+
+    // W is held for 5 of the 10 seconds at 5 units per second
+    VerifyTestResult(IsMostlyEqual(player.m_position.y, 25.0f), "Simulated movement should depend only on the simulated clock");
+
+    VerifyTestResult(firstHalf.m_speedup > 1.0 && firstHalf.m_frameCostP50 <= firstHalf.m_frameCostP99 && firstHalf.m_frameCostP99 <= firstHalf.m_frameCostMax,
+                     "An unpaced replay should run faster than real time, with ordered percentiles");
+
+    sReplayStats const afterEnd = replay.Run(simulateFrame);
+    VerifyTestResult(afterEnd.m_numFrames == 0 && player.m_numSteps == 600, "Running past the end should do nothing");
+
+    playback.StopPlayback();
+    std::remove(TEST_REPLAY_PATH);
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputReplayDriver_Basics)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 6; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputReplayDriver_FrameDriver()
+{
+#if defined(ENABLE_TestSet_InputReplayDriver_FrameDriver)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputReplayDriver_FrameDriver)(start)\n");
+    printf("####################################################################################################\n");
+
+    RecordTestSession(600);
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    VirtualInputBackend         backend;
+    InputFrameDriver            driver(inputSystem, backend);
+    InputPlayback               playback;
+    playback.StartPlayback(TEST_REPLAY_PATH);
+    driver.Startup();
+
+    InputReplayDriver replay(driver, playback);
+    sTestPlayer       player;
+    int               numJustPressed = 0;
+
+    sReplayStats const stats = replay.Run([&player, &numJustPressed](InputSystemClass& frameInput, sRecordedInputFrame const& frame, double const deltaSeconds)
+    {
+        player.Update(frameInput, frame, deltaSeconds);
+        numJustPressed += frameInput.WasKeyJustPressed(KEYCODE_W) ? 1 : 0;
+    });
+
+    VerifyTestResult(stats.m_numFrames == 600 && driver.GetFrameNumber() == 600 && numJustPressed == 5 && IsMostlyEqual(player.m_position.y, 25.0f),
+                     "A replay through InputFrameDriver should play every frame the same as one applied directly");
+
+    // W was last released on frame 540, 59 frames before the last, through the event queue
+    InputHistory const& history = driver.GetInputHistory();
+    VerifyTestResult(history.WasKeyReleasedWithinFrames(KEYCODE_W, 60) && !history.WasKeyReleasedWithinFrames(KEYCODE_W, 59) && stats.m_numDroppedEvents == 0,
+                     "Replayed frames should go through BeginFrame, recording the input history");
+
+    driver.Shutdown();
+    playback.StopPlayback();
+    std::remove(TEST_REPLAY_PATH);
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputReplayDriver_FrameDriver)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 2; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputReplayDriver_Pacing()
+{
+#if defined(ENABLE_TestSet_InputReplayDriver_Pacing)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputReplayDriver_Pacing)(start)\n");
+    printf("####################################################################################################\n");
+
+    RecordTestSession(121);
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    InputPlayback               playback;
+    playback.StartPlayback(TEST_REPLAY_PATH);
+
+    // 2 simulated seconds at 40x should take at least 50 ms
+    InputReplayDriver  replay(inputSystem, playback, 1.0 / 60.0, 40.0);
+    sReplayStats const stats = replay.Run(nullptr);
+
+    printf("  %.2f simulated seconds in %.2f ms (%.1fx)\n", stats.m_simulatedSeconds, stats.m_wallSeconds * 1000.0, stats.m_speedup);
+    VerifyTestResult(stats.m_numFrames == 121 && stats.m_wallSeconds >= 0.049 && stats.m_speedup <= 41.0,
+                     "A paced replay should not run faster than its speed multiplier");
+
+    playback.StopPlayback();
+    std::remove(TEST_REPLAY_PATH);
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputReplayDriver_Pacing)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputReplayDriver_Performance()
+{
+#if defined(ENABLE_TestSet_InputReplayDriver_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputReplayDriver_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    RecordTestSession(INPUT_REPLAY_PERFORMANCE_NUM_FRAMES);
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    InputPlayback               playback;
+    playback.StartPlayback(TEST_REPLAY_PATH);
+
+    InputReplayDriver  replay(inputSystem, playback);
+    sTestPlayer        player;
+    sReplayStats const stats = replay.Run([&player](InputSystemClass& frameInput, sRecordedInputFrame const& frame, double const deltaSeconds)
+    {
+        player.Update(frameInput, frame, deltaSeconds);
+    });
+
+    printf("  %d frames (%.1f simulated minutes), unpaced...\n", stats.m_numFrames, stats.m_simulatedSeconds / 60.0);
+    printf("    Wall time:  %.3f s\n", stats.m_wallSeconds);
+    printf("    Frame rate: %.0f frames/s (%.0fx real time)\n", stats.m_framesPerSecond, stats.m_speedup);
+    printf("    Frame cost: p50 %.3f us, p90 %.3f us, p99 %.3f us, max %.3f us\n",
+           stats.m_frameCostP50, stats.m_frameCostP90, stats.m_frameCostP99, stats.m_frameCostMax);
+
+    playback.StopPlayback();
+    std::remove(TEST_REPLAY_PATH);
+
+    VerifyTestResult(stats.m_numFrames == INPUT_REPLAY_PERFORMANCE_NUM_FRAMES, "InputReplayDriver performance tests completed");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputReplayDriver_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_InputReplayDriver()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_InputReplayDriver)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_InputReplayDriver_Basics, "InputReplayDriver - Basics");
+    RunTestSet(true, TestSet_InputReplayDriver_FrameDriver, "InputReplayDriver - FrameDriver");
+    RunTestSet(true, TestSet_InputReplayDriver_Pacing, "InputReplayDriver - Pacing");
+    RunTestSet(false, TestSet_InputReplayDriver_Performance, "InputReplayDriver - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_InputReplayDriver)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
@@ -0,0 +1,31 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_InputReplayDriver.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_InputReplayDriver();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_InputReplayDriver_Basics();
+int TestSet_InputReplayDriver_FrameDriver();
+int TestSet_InputReplayDriver_Pacing();
+int TestSet_InputReplayDriver_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_InputReplayDriver_Basics
+#define ENABLE_TestSet_InputReplayDriver_FrameDriver
+#define ENABLE_TestSet_InputReplayDriver_Pacing
+#define ENABLE_TestSet_InputReplayDriver_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define INPUT_REPLAY_PERFORMANCE_NUM_FRAMES 216000   // One hour at 60 Hz
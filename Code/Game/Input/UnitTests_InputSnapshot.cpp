@@ -0,0 +1,332 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_InputSnapshot.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/UnitTests_InputSnapshot.hpp"
+
+#include <cmath>
+#include <cstdio>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Input/InputFrameDriver.hpp"
+#include "Game/Input/InputSnapshot.hpp"
+#include "Game/Input/VirtualInputBackend.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // Everything the game can read from the two drivers, compared exactly
+    //
+    bool DoDriversMatch(InputFrameDriver const& driverA,
+                        InputFrameDriver const& driverB)
+    {
+        InputSystemClass& inputSystemA = driverA.GetInputSystem();
+        InputSystemClass& inputSystemB = driverB.GetInputSystem();
+
+        for (int keyIndex = 0; keyIndex < NUM_KEYCODE; ++keyIndex)
+        {
+            unsigned char const keyCode = static_cast<unsigned char>(keyIndex);
+
+            if (inputSystemA.IsKeyDown(keyCode) != inputSystemB.IsKeyDown(keyCode) ||
+                inputSystemA.WasKeyJustPressed(keyCode) != inputSystemB.WasKeyJustPressed(keyCode) ||
+                inputSystemA.WasKeyJustReleased(keyCode) != inputSystemB.WasKeyJustReleased(keyCode))
+            {
+                return false;
+            }
+        }
+
+        for (int controllerIndex = 0; controllerIndex < NUM_XBOX_CONTROLLERS; ++controllerIndex)
+        {
+            for (int buttonIndex = 0; buttonIndex < NUM_XBOX_BUTTONS; ++buttonIndex)
+            {
+                XboxButtonID const button = static_cast<XboxButtonID>(buttonIndex);
+
+                if (driverA.IsButtonDown(controllerIndex, button) != driverB.IsButtonDown(controllerIndex, button) ||
+                    driverA.WasButtonJustPressed(controllerIndex, button) != driverB.WasButtonJustPressed(controllerIndex, button) ||
+                    driverA.WasButtonJustReleased(controllerIndex, button) != driverB.WasButtonJustReleased(controllerIndex, button))
+                {
+                    return false;
+                }
+            }
+
+            if (driverA.IsControllerConnected(controllerIndex) != driverB.IsControllerConnected(controllerIndex) ||
+                driverA.GetLeftStick(controllerIndex).GetPosition() != driverB.GetLeftStick(controllerIndex).GetPosition() ||
+                driverA.GetRightStick(controllerIndex).GetPosition() != driverB.GetRightStick(controllerIndex).GetPosition() ||
+                driverA.GetLeftTrigger(controllerIndex) != driverB.GetLeftTrigger(controllerIndex) ||
+                driverA.GetRightTrigger(controllerIndex) != driverB.GetRightTrigger(controllerIndex))
+            {
+                return false;
+            }
+        }
+
+        return driverA.GetCursorClientPosition() == driverB.GetCursorClientPosition() && driverA.GetCursorClientDelta() == driverB.GetCursorClientDelta() &&
+               driverA.GetCursorNormalizedPosition() == driverB.GetCursorNormalizedPosition() && driverA.GetFrameNumber() == driverB.GetFrameNumber();
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void ScriptInputs(VirtualInputBackend& backend)
+    {
+        backend.PressKey(0, KEYCODE_A);
+        backend.ConnectController(0, 0);
+        backend.MoveCursor(0, Vector2Class(100.0f, 100.0f));
+        backend.MoveLeftStick(0, 0, Vector2Class(0.6f, 0.3f));
+        backend.SetTriggers(0, 0, 0.3f, 0.7f);
+        backend.PressButton(0, 0, XBOX_BUTTON_X);
+
+        backend.PressKey(1, KEYCODE_SPACE);
+        backend.ReleaseKey(1, KEYCODE_A);
+        backend.MoveCursor(1, Vector2Class(120.0f, 90.0f));
+        backend.MoveRightStick(1, 0, Vector2Class(-0.5f, 0.9f));
+
+        backend.PressKey(2, KEYCODE_B);
+        backend.ReleaseButton(2, 0, XBOX_BUTTON_X);
+        backend.PressButton(2, 0, XBOX_BUTTON_Y);
+
+        backend.PressKey(3, KEYCODE_D);
+        backend.MoveLeftStick(3, 0, Vector2Class(-0.2f, -0.99f));
+        backend.ReleaseKey(4, KEYCODE_SPACE);
+        backend.MoveCursor(4, Vector2Class(300.0f, 10.0f));
+        backend.DisconnectController(4, 0);
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputSnapshot_Quantization()
+{
+#if defined(ENABLE_TestSet_InputSnapshot_Quantization)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputSnapshot_Quantization)(start)\n");
+    printf("####################################################################################################\n");
+
+    float maxStickError   = 0.0f;
+    float maxTriggerError = 0.0f;
+
+    for (int step = 0; step <= 1000; ++step)
+    {
+        float const value = static_cast<float>(step) / 1000.0f;
+        maxStickError     = std::fmax(maxStickError, std::fabs(DequantizeStickAxis(QuantizeStickAxis(value * 2.0f - 1.0f)) - (value * 2.0f - 1.0f)));
+        maxTriggerError   = std::fmax(maxTriggerError, std::fabs(DequantizeTrigger(QuantizeTrigger(value)) - value));
+    }
+
+    VerifyTestResult(maxStickError <= 0.5f / INPUT_SNAPSHOT_STICK_STEPS + 1e-7f && maxTriggerError <= 0.5f / INPUT_SNAPSHOT_TRIGGER_STEPS + 1e-7f,
+                     "Quantized sticks and triggers should be within half a step");
+
+    bool bIdempotent = true;
+
+    for (int quantized = -32767; quantized <= 32767; ++quantized)
+    {
+        bIdempotent = bIdempotent && QuantizeStickAxis(DequantizeStickAxis(static_cast<int16_t>(quantized))) == quantized;
+    }
+
+    VerifyTestResult(bIdempotent && DequantizeStickAxis(-32768) == -1.0f, "Every quantized stick value should survive a round trip");
+
+    VerifyTestResult(QuantizeStickAxis(1.5f) == 32767 && QuantizeStickAxis(-7.0f) == -32767 && QuantizeTrigger(-0.5f) == 0 && QuantizeTrigger(2.0f) == 65535,
+                     "Out of range values should clamp");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputSnapshot_Quantization)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 3; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputSnapshot_RoundTrip()
+{
+#if defined(ENABLE_TestSet_InputSnapshot_RoundTrip)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputSnapshot_RoundTrip)(start)\n");
+    printf("####################################################################################################\n");
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    VirtualInputBackend         backend;
+    InputFrameDriver            driver(inputSystem, backend);
+
+    ScriptInputs(backend);
+    driver.Startup();
+
+    for (int frame = 0; frame < 2; ++frame)
+    {
+        driver.BeginFrame();
+        driver.EndFrame();
+    }
+
+    // Frame 2, with keys, buttons, sticks and the cursor all in play
+    driver.BeginFrame();
+    sInputSnapshot savedFrame;
+    driver.CaptureSnapshot(savedFrame);
+    InputHistory const savedHistory = driver.GetInputHistory();
+
+    InputSystemClass    restoredInputSystem(config);
+    VirtualInputBackend restoredBackend;
+    InputFrameDriver    restored(restoredInputSystem, restoredBackend);
+    restored.Startup();
+    restored.RestoreSnapshot(savedFrame);
+
+    VerifyTestResult(DoDriversMatch(driver, restored) && restoredInputSystem.WasKeyJustPressed(KEYCODE_B) && !restoredInputSystem.WasKeyJustPressed(KEYCODE_SPACE) &&
+                     restored.WasButtonJustReleased(0, XBOX_BUTTON_X),
+                     "A snapshot restored into another driver should read back exactly, just pressed and released included");
+
+    sInputSnapshot recaptured;
+    restored.CaptureSnapshot(recaptured);
+    VerifyTestResult(recaptured == savedFrame, "Capturing a restored snapshot should give the same bytes");
+
+    // Play on two more frames, then roll back
+    driver.EndFrame();
+
+    for (int frame = 3; frame < 5; ++frame)
+    {
+        driver.BeginFrame();
+        driver.EndFrame();
+    }
+
+    sInputSnapshot beforeRollback;
+    driver.CaptureSnapshot(beforeRollback);
+    driver.RestoreSnapshot(savedFrame);
+    driver.CaptureSnapshot(recaptured);
+    VerifyTestResult(!(beforeRollback == savedFrame) && recaptured == savedFrame && DoDriversMatch(driver, restored) && !inputSystem.IsKeyDown(KEYCODE_D),
+                     "Restoring an earlier frame should roll every input back");
+
+    bool bHistoryMatches = driver.GetInputHistory().GetNumFramesRecorded() == savedHistory.GetNumFramesRecorded();
+
+    for (int keyIndex = 0; keyIndex < NUM_KEYCODE; ++keyIndex)
+    {
+        for (int framesAgo = 0; framesAgo < INPUT_HISTORY_DEPTH; ++framesAgo)
+        {
+            unsigned char const keyCode = static_cast<unsigned char>(keyIndex);
+            bHistoryMatches             = bHistoryMatches && driver.GetInputHistory().WasKeyDown(keyCode, framesAgo) == savedHistory.WasKeyDown(keyCode, framesAgo);
+        }
+    }
+    VerifyTestResult(bHistoryMatches, "Restoring an earlier frame should rewind the input history to it");
+
+    // Same last frame, one more key down this frame
+    sInputSnapshot edited = savedFrame;
+    edited.m_keysDown.Set(KEYCODE_W);
+    driver.RestoreSnapshot(edited);
+    VerifyTestResult(inputSystem.WasKeyJustPressed(KEYCODE_W) && inputSystem.IsKeyDown(KEYCODE_B) && inputSystem.WasKeyJustPressed(KEYCODE_B),
+                     "Restoring with the same last frame should only change this frame's keys");
+
+    driver.Shutdown();
+    restored.Shutdown();
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputSnapshot_RoundTrip)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 5; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputSnapshot_Performance()
+{
+#if defined(ENABLE_TestSet_InputSnapshot_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputSnapshot_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numIterations = INPUT_SNAPSHOT_PERFORMANCE_NUM_ITERATIONS;
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    VirtualInputBackend         backend;
+    InputFrameDriver            driver(inputSystem, backend);
+
+    ScriptInputs(backend);
+    driver.Startup();
+
+    sInputSnapshot frames[2];
+
+    for (sInputSnapshot& frame : frames)
+    {
+        driver.BeginFrame();
+        driver.CaptureSnapshot(frame);
+        driver.EndFrame();
+    }
+
+    PerformanceTimer timer;
+    int              checksum = 0;
+
+    printf("  sizeof(InputSystem) = %d bytes, sizeof(sInputSnapshot) = %d bytes\n", static_cast<int>(sizeof(InputSystemClass)), static_cast<int>(sizeof(sInputSnapshot)));
+
+    // The whole InputSystem by value, as the tests' lambda captures do
+    InputSystemClass savedInputSystem(config);
+    timer.Start();
+    for (int iteration = 0; iteration < numIterations; ++iteration)
+    {
+        savedInputSystem = inputSystem;
+        checksum += savedInputSystem.IsKeyDown(static_cast<unsigned char>(iteration)) ? 1 : 0;
+    }
+    timer.Stop();
+    double const copyTime = timer.GetElapsedMicroseconds();
+
+    timer.Start();
+    for (int iteration = 0; iteration < numIterations; ++iteration)
+    {
+        inputSystem = savedInputSystem;
+        checksum += inputSystem.IsKeyDown(static_cast<unsigned char>(iteration)) ? 1 : 0;
+    }
+    timer.Stop();
+    double const copyBackTime = timer.GetElapsedMicroseconds();
+
+    sInputSnapshot snapshot;
+    timer.Start();
+    for (int iteration = 0; iteration < numIterations; ++iteration)
+    {
+        driver.CaptureSnapshot(snapshot);
+        checksum += snapshot.m_frameNumber;
+    }
+    timer.Stop();
+    double const captureTime = timer.GetElapsedMicroseconds();
+
+    // Alternating between two frames, so every restore changes keys, buttons and sticks
+    timer.Start();
+    for (int iteration = 0; iteration < numIterations; ++iteration)
+    {
+        driver.RestoreSnapshot(frames[iteration & 1]);
+        checksum += driver.GetFrameNumber();
+    }
+    timer.Stop();
+    double const restoreTime = timer.GetElapsedMicroseconds();
+
+    printf("  %d iterations:\n", numIterations);
+    printf("    Copy InputSystem out:            %7.1f ns\n", copyTime * 1000.0 / numIterations);
+    printf("    Copy InputSystem back:           %7.1f ns\n", copyBackTime * 1000.0 / numIterations);
+    printf("    CaptureSnapshot:                 %7.1f ns\n", captureTime * 1000.0 / numIterations);
+    printf("    RestoreSnapshot:                 %7.1f ns\n", restoreTime * 1000.0 / numIterations);
+    printf("    Capture + %d restores per frame:  %7.3f us   (checksum %d)\n", INPUT_SNAPSHOT_RESTORES_PER_FRAME,
+           (captureTime + INPUT_SNAPSHOT_RESTORES_PER_FRAME * restoreTime) / numIterations, checksum);
+
+    VerifyTestResult(true, "InputSnapshot performance tests completed");
+    driver.Shutdown();
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputSnapshot_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_InputSnapshot()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_InputSnapshot)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_InputSnapshot_Quantization, "InputSnapshot - Quantization");
+    RunTestSet(true, TestSet_InputSnapshot_RoundTrip, "InputSnapshot - RoundTrip");
+    RunTestSet(false, TestSet_InputSnapshot_Performance, "InputSnapshot - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_InputSnapshot)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
@@ -0,0 +1,30 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_InputSnapshot.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_InputSnapshot();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_InputSnapshot_Quantization();
+int TestSet_InputSnapshot_RoundTrip();
+int TestSet_InputSnapshot_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_InputSnapshot_Quantization
+#define ENABLE_TestSet_InputSnapshot_RoundTrip
+#define ENABLE_TestSet_InputSnapshot_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define INPUT_SNAPSHOT_PERFORMANCE_NUM_ITERATIONS    1000000
+#define INPUT_SNAPSHOT_RESTORES_PER_FRAME            8
@@ -5,9 +5,54 @@
 //----------------------------------------------------------------------------------------------------
 #include "Game/Input/UnitTests_InputSystem.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdio>
+#include <thread>
+#include <vector>
 
 #include "Game/GameCommon.hpp"
+#include "Game/Input/InputEventQueue.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // Calls pushEvent(index) for every event, spinning between calls to hold a fixed rate the way
+    // a window-message thread would receive them
+    //
+    template <typename PushFunction>
+    double RunPacedProducer(int const    numEvents,
+                            int const    rateHz,
+                            PushFunction pushEvent)
+    {
+        std::chrono::steady_clock::duration const   period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / rateHz));
+        std::chrono::steady_clock::time_point const start  = std::chrono::steady_clock::now();
+
+        for (int index = 0; index < numEvents; ++index)
+        {
+            std::chrono::steady_clock::time_point const deadline = start + period * index;
+
+            while (std::chrono::steady_clock::now() < deadline)
+            {
+                std::this_thread::yield();
+            }
+
+            pushEvent(index);
+        }
+
+        std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+
+        return numEvents / elapsed.count();
+    }
+
+    //------------------------------------------------------------------------------------------------
+    eInputEventType GetStressEventType(int const index)
+    {
+        return ((index / 256) % 2 == 0) ? eInputEventType::KEY_PRESSED : eInputEventType::KEY_RELEASED;
+    }
+}
 
 //-----------------------------------------------------------------------------------------------
 int TestSet_InputSystem_Construction()
@@ -449,6 +494,324 @@ int TestSet_InputSystem_UnimplementedMethods()
     return 1; // Number of tests expected (just the acknowledgment test)
 }
 
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputSystem_EventQueue()
+{
+#if defined(ENABLE_TestSet_InputSystem_EventQueue)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputSystem_EventQueue)(start)\n");
+    printf("####################################################################################################\n");
+
+    InputEventQueue const roundedQueue(1000);
+    VerifyTestResult(roundedQueue.GetCapacity() == 1024 && roundedQueue.GetNumQueued() == 0, "Capacity should round up to a power of two");
+
+    // Test FIFO order across wraparound
+    InputEventQueue smallQueue(4);
+    bool            bInOrder = true;
+
+    for (int index = 0; index < 10; ++index)
+    {
+        sInputEvent event;
+        event.m_keyCode = static_cast<unsigned char>(index);
+
+        sInputEvent popped;
+        bInOrder = bInOrder && smallQueue.TryPush(event) && smallQueue.TryPush(event) && smallQueue.TryPop(popped) && popped.m_keyCode == index;
+        bInOrder = bInOrder && smallQueue.TryPop(popped) && popped.m_keyCode == index;
+    }
+    VerifyTestResult(bInOrder, "Events should come out in the order they went in, across wraparound");
+
+    sInputEvent emptyEvent;
+    VerifyTestResult(!smallQueue.TryPop(emptyEvent), "TryPop should fail on an empty queue");
+
+    // Test overflow
+    int numPushed = 0;
+    for (int index = 0; index < 6; ++index)
+    {
+        numPushed += smallQueue.PushKeyPressed(KEYCODE_A) ? 1 : 0;
+    }
+    VerifyTestResult(numPushed == 4 && smallQueue.GetNumQueued() == 4 && smallQueue.GetNumDropped() == 2,
+                     "A full queue should drop and count new events instead of overwriting");
+
+    // Test DrainInto
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    InputEventQueue             queue;
+
+    queue.PushKeyPressed(KEYCODE_A);
+    queue.PushKeyPressed(KEYCODE_W);
+    int const numApplied = TimeFunction("DrainInto (2 events)", [&queue, &inputSystem] { return queue.DrainInto(inputSystem); });
+    VerifyTestResult(numApplied == 2 && inputSystem.IsKeyDown(KEYCODE_A) && inputSystem.WasKeyJustPressed(KEYCODE_W),
+                     "DrainInto should apply queued key events to the InputSystem");
+
+    // Test that a tap within one frame is split across two frames
+    inputSystem.EndFrame();
+    queue.PushKeyPressed(KEYCODE_SPACE);
+    queue.PushKeyReleased(KEYCODE_SPACE);
+    queue.PushKeyReleased(KEYCODE_A);
+    int const  numFirstFrame   = queue.DrainInto(inputSystem);
+    bool const bPressedFirst   = inputSystem.WasKeyJustPressed(KEYCODE_SPACE);
+    inputSystem.EndFrame();
+    int const  numSecondFrame  = queue.DrainInto(inputSystem);
+    bool const bReleasedSecond = inputSystem.WasKeyJustReleased(KEYCODE_SPACE) && inputSystem.WasKeyJustReleased(KEYCODE_A);
+    VerifyTestResult(numFirstFrame == 1 && bPressedFirst && numSecondFrame == 2 && bReleasedSecond,
+                     "A press and release in the same frame should be seen as just pressed, then just released");
+
+    // Test that auto-repeat keydowns do not hold back the events behind them
+    inputSystem.EndFrame();
+    queue.PushKeyPressed(KEYCODE_D);
+    queue.PushKeyPressed(KEYCODE_D);
+    queue.PushKeyPressed(KEYCODE_D);
+    queue.PushKeyPressed(KEYCODE_B);
+    queue.PushKeyReleased(KEYCODE_D);
+    int const  numRepeatFrame  = queue.DrainInto(inputSystem);
+    bool const bRepeatsApplied = inputSystem.WasKeyJustPressed(KEYCODE_D) && inputSystem.WasKeyJustPressed(KEYCODE_B);
+    inputSystem.EndFrame();
+    int const  numAfterRepeat  = queue.DrainInto(inputSystem);
+    VerifyTestResult(numRepeatFrame == 4 && bRepeatsApplied && numAfterRepeat == 1 && inputSystem.WasKeyJustReleased(KEYCODE_D),
+                     "Repeated presses of a key should be applied together, and only its release deferred");
+
+    inputSystem.EndFrame();
+    VerifyTestResult(queue.DrainInto(inputSystem) == 0 && inputSystem.IsKeyDown(KEYCODE_W), "Draining an empty queue should change nothing");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputSystem_EventQueue)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 8; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputSystem_EventQueueStress()
+{
+#if defined(ENABLE_TestSet_InputSystem_EventQueueStress)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputSystem_EventQueueStress)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numEvents = INPUT_EVENT_QUEUE_STRESS_NUM_EVENTS;
+
+    // A small ring so the indices wrap many times. The producer marks each event it has to drop
+    // before pushing the next, so the consumer knows which indices to skip
+    InputEventQueue   queue(64);
+    double            producerRate  = 0.0;
+    std::vector<char> wasDropped(numEvents, 0);
+    std::atomic<bool> bProducerDone = false;
+
+    std::thread producer([&queue, &producerRate, &wasDropped, &bProducerDone]
+    {
+        producerRate = RunPacedProducer(numEvents, INPUT_EVENT_QUEUE_PRODUCER_RATE_HZ, [&queue, &wasDropped](int const index)
+        {
+            sInputEvent event;
+            event.m_timestamp = PerformanceClock::now();
+            event.m_type      = GetStressEventType(index);
+            event.m_keyCode   = static_cast<unsigned char>(index);
+
+            // Only drops are written: a pushed event's flag may already be read by the consumer
+            if (!queue.TryPush(event))
+            {
+                wasDropped[index] = 1;
+            }
+        });
+        bProducerDone = true;
+    });
+
+    bool                         bInOrder      = true;
+    PerformanceClock::time_point lastTimestamp;
+    int                          numReceived   = 0;
+    int                          expectedIndex = 0;
+
+    // Ends once the producer is done and the queue is empty, however many events were dropped
+    while (!bProducerDone || queue.GetNumQueued() > 0)
+    {
+        sInputEvent event;
+
+        if (!queue.TryPop(event))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        while (expectedIndex < numEvents && wasDropped[expectedIndex] != 0)
+        {
+            ++expectedIndex;
+        }
+
+        bInOrder      = bInOrder && event.m_keyCode == static_cast<unsigned char>(expectedIndex) && event.m_type == GetStressEventType(expectedIndex);
+        bInOrder      = bInOrder && event.m_timestamp >= lastTimestamp;
+        lastTimestamp = event.m_timestamp;
+        ++expectedIndex;
+        ++numReceived;
+    }
+
+    producer.join();
+
+    printf("  %d events from a producer thread at %.0f Hz, %d dropped\n", numEvents, producerRate, queue.GetNumDropped());
+    VerifyTestResult(bInOrder && numReceived + queue.GetNumDropped() == numEvents && queue.GetNumQueued() == 0,
+                     "Every event from the producer thread should arrive once, in order, or be counted as dropped");
+
+    // Taps at 10 kHz drained by a game loop spinning through frames
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    InputEventQueue             tapQueue;
+    std::atomic<bool>           bTapProducerDone = false;
+
+    std::thread tapProducer([&tapQueue, &bTapProducerDone]
+    {
+        // A dropped press or release would unbalance the taps, so this producer waits for room
+        RunPacedProducer(numEvents, INPUT_EVENT_QUEUE_PRODUCER_RATE_HZ, [&tapQueue](int const index)
+        {
+            bool const bPressed = index % 2 == 0;
+
+            while (!(bPressed ? tapQueue.PushKeyPressed(KEYCODE_A) : tapQueue.PushKeyReleased(KEYCODE_A)))
+            {
+                std::this_thread::yield();
+            }
+        });
+        bTapProducerDone = true;
+    });
+
+    int numPressesSeen  = 0;
+    int numReleasesSeen = 0;
+    int numFrames       = 0;
+
+    while (!bTapProducerDone || tapQueue.GetNumQueued() > 0)
+    {
+        tapQueue.DrainInto(inputSystem);
+        numPressesSeen  += inputSystem.WasKeyJustPressed(KEYCODE_A) ? 1 : 0;
+        numReleasesSeen += inputSystem.WasKeyJustReleased(KEYCODE_A) ? 1 : 0;
+        inputSystem.EndFrame(); // Skip BeginFrame due to Window dependency
+        ++numFrames;
+    }
+
+    tapProducer.join();
+
+    printf("  %d taps drained over %d frames, %d pushes retried\n", numEvents / 2, numFrames, tapQueue.GetNumDropped());
+    VerifyTestResult(numPressesSeen == numEvents / 2 && numReleasesSeen == numEvents / 2,
+                     "Every tap should be seen as exactly one press and one release");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputSystem_EventQueueStress)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 2; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_InputSystem_EventQueuePerformance()
+{
+#if defined(ENABLE_TestSet_InputSystem_EventQueuePerformance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputSystem_EventQueuePerformance)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr batchSize  = 256;
+    int constexpr numBatches = INPUT_EVENT_QUEUE_PERFORMANCE_NUM_EVENTS / batchSize;
+    int constexpr numEvents  = batchSize * numBatches;
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    InputEventQueue             queue(batchSize);
+    PerformanceTimer            timer;
+    double                      enqueueTime = 0.0;
+    double                      drainTime   = 0.0;
+    int                         numApplied  = 0;
+
+    // One press or release of every key code per batch, so DrainInto never stops early
+    for (int batch = 0; batch < numBatches; ++batch)
+    {
+        timer.Start();
+        for (int keyCode = 0; keyCode < batchSize; ++keyCode)
+        {
+            if (batch % 2 == 0)
+            {
+                queue.PushKeyPressed(static_cast<unsigned char>(keyCode));
+            }
+            else
+            {
+                queue.PushKeyReleased(static_cast<unsigned char>(keyCode));
+            }
+        }
+        timer.Stop();
+        enqueueTime += timer.GetElapsedMicroseconds();
+
+        timer.Start();
+        numApplied += queue.DrainInto(inputSystem);
+        timer.Stop();
+        drainTime += timer.GetElapsedMicroseconds();
+
+        inputSystem.EndFrame();
+    }
+
+    printf("  %d events on one thread...\n", numEvents);
+    printf("    Enqueue (with timestamp): %7.2f ns/event\n", enqueueTime * 1000.0 / numEvents);
+    printf("    DrainInto:                %7.2f ns/event\n", drainTime * 1000.0 / numEvents);
+
+    // Cross-thread latency from the producer's timestamp to the consumer popping the event
+    int constexpr numLatencyEvents = INPUT_EVENT_QUEUE_PRODUCER_RATE_HZ / 2;
+
+    InputEventQueue     latencyQueue;
+    std::vector<double> latencies;
+    latencies.reserve(numLatencyEvents);
+
+    std::atomic<bool> bProducerDone = false;
+
+    std::thread producer([&latencyQueue, &bProducerDone]
+    {
+        RunPacedProducer(numLatencyEvents, INPUT_EVENT_QUEUE_PRODUCER_RATE_HZ, [&latencyQueue](int const index)
+        {
+            latencyQueue.PushKeyPressed(static_cast<unsigned char>(index));
+        });
+        bProducerDone = true;
+    });
+
+    while (!bProducerDone || latencyQueue.GetNumQueued() > 0)
+    {
+        sInputEvent event;
+
+        if (latencyQueue.TryPop(event))
+        {
+            std::chrono::duration<double, std::micro> const latency = PerformanceClock::now() - event.m_timestamp;
+            latencies.push_back(latency.count());
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+
+    std::sort(latencies.begin(), latencies.end());
+
+    int const numLatencies = static_cast<int>(latencies.size());
+    double    totalLatency = 0.0;
+    for (double const latency : latencies)
+    {
+        totalLatency += latency;
+    }
+
+    printf("  %d events at %d Hz, consumer polling TryPop (%d dropped)...\n", numLatencyEvents, INPUT_EVENT_QUEUE_PRODUCER_RATE_HZ, latencyQueue.GetNumDropped());
+    if (numLatencies > 0)
+    {
+        printf("    Enqueue-to-dequeue latency: avg %.3f us, p99 %.3f us, max %.3f us\n",
+               totalLatency / numLatencies, latencies[numLatencies * 99 / 100], latencies.back());
+    }
+
+    VerifyTestResult(numApplied == numEvents && numLatencies + latencyQueue.GetNumDropped() == numLatencyEvents, "InputEventQueue performance tests completed");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_InputSystem_EventQueuePerformance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
 //-----------------------------------------------------------------------------------------------
 void RunTests_InputSystem()
 {
@@ -464,6 +827,9 @@ void RunTests_InputSystem()
     RunTestSet(true, TestSet_InputSystem_EventHandling, "InputSystem - Event Handling");
     RunTestSet(true, TestSet_InputSystem_StateTracking, "InputSystem - State Tracking");
     RunTestSet(true, TestSet_InputSystem_UnimplementedMethods, "InputSystem - Unimplemented Methods");
+    RunTestSet(true, TestSet_InputSystem_EventQueue, "InputSystem - Event Queue");
+    RunTestSet(true, TestSet_InputSystem_EventQueueStress, "InputSystem - Event Queue Stress");
+    RunTestSet(false, TestSet_InputSystem_EventQueuePerformance, "InputSystem - Event Queue Performance Tests");
 
     printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
     printf("(UnitTests_InputSystem)(End)\n");
@@ -19,6 +19,9 @@ int TestSet_InputSystem_FrameManagement();
 int TestSet_InputSystem_EventHandling();
 int TestSet_InputSystem_StateTracking();
 int TestSet_InputSystem_UnimplementedMethods();
+int TestSet_InputSystem_EventQueue();
+int TestSet_InputSystem_EventQueueStress();
+int TestSet_InputSystem_EventQueuePerformance();
 
 //-----------------------------------------------------------------------------------------------
 // YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
@@ -32,3 +35,13 @@ int TestSet_InputSystem_UnimplementedMethods();
 #define ENABLE_TestSet_InputSystem_EventHandling
 #define ENABLE_TestSet_InputSystem_StateTracking
 #define ENABLE_TestSet_InputSystem_UnimplementedMethods
+#define ENABLE_TestSet_InputSystem_EventQueue
+#define ENABLE_TestSet_InputSystem_EventQueueStress
+#define ENABLE_TestSet_InputSystem_EventQueuePerformance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define INPUT_EVENT_QUEUE_PRODUCER_RATE_HZ 10000
+#define INPUT_EVENT_QUEUE_STRESS_NUM_EVENTS 4000
+#define INPUT_EVENT_QUEUE_PERFORMANCE_NUM_EVENTS 1000000
@@ -0,0 +1,315 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_KeyStateBitset.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/UnitTests_KeyStateBitset.hpp"
+
+#include <cstdio>
+#include <random>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Input/KeyStateBitset.hpp"
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_KeyStateBitset_Basics()
+{
+#if defined(ENABLE_TestSet_KeyStateBitset_Basics)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_KeyStateBitset_Basics)(start)\n");
+    printf("####################################################################################################\n");
+
+    printf("  sizeof(KeyStateBitset) = %d bytes, sizeof(InputSystem) = %d bytes\n",
+           static_cast<int>(sizeof(KeyStateBitset)), static_cast<int>(sizeof(InputSystemClass)));
+    VerifyTestResult(sizeof(KeyStateBitset) == 64, "KeyStateBitset should be two 256-bit masks");
+
+    KeyStateBitset keys;
+    VerifyTestResult(!keys.IsKeyDown(KEYCODE_A) && !keys.WasKeyJustPressed(KEYCODE_A) && !keys.WasKeyJustReleased(KEYCODE_A),
+                     "Key A should not be down, just pressed or just released initially");
+
+    keys.HandleKeyPressed(KEYCODE_A);
+    VerifyTestResult(keys.IsKeyDown(KEYCODE_A) && keys.WasKeyJustPressed(KEYCODE_A), "Key A should be down and just pressed after HandleKeyPressed");
+
+    keys.EndFrame();
+    VerifyTestResult(keys.IsKeyDown(KEYCODE_A) && !keys.WasKeyJustPressed(KEYCODE_A), "Key A should still be down but not just pressed after EndFrame");
+
+    keys.HandleKeyReleased(KEYCODE_A);
+    VerifyTestResult(!keys.IsKeyDown(KEYCODE_A) && keys.WasKeyJustReleased(KEYCODE_A), "Key A should be just released after HandleKeyReleased");
+
+    keys.EndFrame();
+    VerifyTestResult(!keys.WasKeyJustReleased(KEYCODE_A), "Just released state should clear after frame");
+
+    // Test the first and last bit of every word
+    bool bEdgesWork = true;
+    for (int keyCode : {0, 63, 64, 127, 128, 191, 192, 255})
+    {
+        unsigned char const key = static_cast<unsigned char>(keyCode);
+
+        keys.HandleKeyPressed(key);
+        bEdgesWork = bEdgesWork && keys.IsKeyDown(key) && keys.WasKeyJustPressed(key) && keys.GetNumKeysDown() == 1;
+        keys.EndFrame();
+        keys.HandleKeyReleased(key);
+        bEdgesWork = bEdgesWork && keys.WasKeyJustReleased(key) && !keys.IsKeyDown(key);
+        keys.EndFrame();
+    }
+    VerifyTestResult(bEdgesWork, "Key codes on every word boundary should be tracked independently");
+
+    keys.HandleKeyPressed(KEYCODE_W);
+    keys.HandleKeyPressed(KEYCODE_W); // Double press
+    keys.HandleKeyReleased(KEYCODE_F2); // Release without press
+    VerifyTestResult(keys.IsKeyDown(KEYCODE_W) && keys.GetNumKeysDown() == 1 && !keys.WasKeyJustReleased(KEYCODE_F2),
+                     "Double press and release without press should behave like InputSystem");
+
+    keys.Clear();
+    VerifyTestResult(!keys.IsAnyKeyDown() && !keys.WasAnyKeyJustReleased(), "Clear should reset both frames");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_KeyStateBitset_Basics)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 9; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_KeyStateBitset_BulkQueries()
+{
+#if defined(ENABLE_TestSet_KeyStateBitset_BulkQueries)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_KeyStateBitset_BulkQueries)(start)\n");
+    printf("####################################################################################################\n");
+
+    KeyStateBitset keys;
+    VerifyTestResult(!keys.IsAnyKeyDown() && !keys.WasAnyKeyJustPressed() && !keys.WasAnyKeyJustReleased() && keys.GetNumKeysDown() == 0,
+                     "No bulk query should report anything initially");
+
+    keys.HandleKeyPressed(KEYCODE_W);
+    keys.HandleKeyPressed(KEYCODE_A);
+    keys.HandleKeyPressed(255);
+    VerifyTestResult(keys.IsAnyKeyDown() && keys.WasAnyKeyJustPressed() && !keys.WasAnyKeyJustReleased() && keys.GetNumKeysDown() == 3,
+                     "Bulk queries should see keys pressed this frame");
+
+    keys.EndFrame();
+    keys.HandleKeyReleased(KEYCODE_A);
+    keys.HandleKeyPressed(KEYCODE_SPACE);
+
+    sKeyMask expectedPressed;
+    expectedPressed.Set(KEYCODE_SPACE);
+    sKeyMask expectedReleased;
+    expectedReleased.Set(KEYCODE_A);
+
+    sKeyMask const pressed  = TimeFunction("GetJustPressedMask", [&keys] { return keys.GetJustPressedMask(); });
+    sKeyMask const released = TimeFunction("GetJustReleasedMask", [&keys] { return keys.GetJustReleasedMask(); });
+    VerifyTestResult(pressed == expectedPressed && released == expectedReleased, "Just pressed and just released masks should hold only this frame's changes");
+
+    VerifyTestResult(keys.GetDownMask().Test(KEYCODE_W) && keys.GetDownMask().Test(255) && !keys.GetDownMask().Test(KEYCODE_A) &&
+                     keys.GetPreviousDownMask().Test(KEYCODE_A) && keys.GetDownMask().GetCount() == 3,
+                     "The down masks should match the per-key queries");
+
+    keys.EndFrame();
+    VerifyTestResult(keys.IsAnyKeyDown() && !keys.WasAnyKeyJustPressed() && !keys.WasAnyKeyJustReleased(),
+                     "Held keys should not count as just pressed after EndFrame");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_KeyStateBitset_BulkQueries)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 5; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_KeyStateBitset_MatchesInputSystem()
+{
+#if defined(ENABLE_TestSet_KeyStateBitset_MatchesInputSystem)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_KeyStateBitset_MatchesInputSystem)(start)\n");
+    printf("####################################################################################################\n");
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    KeyStateBitset              keys;
+
+    std::mt19937                       rng(1234u);
+    std::uniform_int_distribution<int> keyDist(0, 255);
+    std::uniform_int_distribution<int> numEventsDist(0, 8);
+
+    bool bAllMatch = true;
+
+    for (int frame = 0; frame < 1000; ++frame)
+    {
+        int const numEvents = numEventsDist(rng);
+
+        for (int event = 0; event < numEvents; ++event)
+        {
+            unsigned char const keyCode = static_cast<unsigned char>(keyDist(rng));
+
+            if (rng() % 2 == 0)
+            {
+                inputSystem.HandleKeyPressed(keyCode);
+                keys.HandleKeyPressed(keyCode);
+            }
+            else
+            {
+                inputSystem.HandleKeyReleased(keyCode);
+                keys.HandleKeyReleased(keyCode);
+            }
+        }
+
+        bool bAnyPressed = false;
+
+        for (int keyIndex = 0; keyIndex < 256; ++keyIndex)
+        {
+            unsigned char const keyCode = static_cast<unsigned char>(keyIndex);
+
+            bAllMatch   = bAllMatch && inputSystem.IsKeyDown(keyCode) == keys.IsKeyDown(keyCode);
+            bAllMatch   = bAllMatch && inputSystem.WasKeyJustPressed(keyCode) == keys.WasKeyJustPressed(keyCode);
+            bAllMatch   = bAllMatch && inputSystem.WasKeyJustReleased(keyCode) == keys.WasKeyJustReleased(keyCode);
+            bAnyPressed = bAnyPressed || inputSystem.WasKeyJustPressed(keyCode);
+        }
+
+        bAllMatch = bAllMatch && bAnyPressed == keys.WasAnyKeyJustPressed();
+
+        inputSystem.EndFrame(); // Skip BeginFrame due to Window dependency
+        keys.EndFrame();
+    }
+
+    VerifyTestResult(bAllMatch, "Every per-key query should match InputSystem across 1000 random frames");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_KeyStateBitset_MatchesInputSystem)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_KeyStateBitset_Performance()
+{
+#if defined(ENABLE_TestSet_KeyStateBitset_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_KeyStateBitset_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numFrames = KEY_STATE_PERFORMANCE_NUM_FRAMES;
+
+    InputSystemConfig constexpr config;
+    InputSystemClass            inputSystem(config);
+    KeyStateBitset              keys;
+    PerformanceTimer            timer;
+    int                         checksum = 0;
+
+    inputSystem.HandleKeyPressed(KEYCODE_W);
+    keys.HandleKeyPressed(KEYCODE_W);
+
+    printf("  %d frames...\n", numFrames);
+
+    // EndFrame, with one key toggled per frame so the work can't be skipped
+    timer.Start();
+    for (int frame = 0; frame < numFrames; ++frame)
+    {
+        inputSystem.HandleKeyPressed(static_cast<unsigned char>(frame));
+        inputSystem.EndFrame();
+        inputSystem.HandleKeyReleased(static_cast<unsigned char>(frame));
+    }
+    timer.Stop();
+    double const systemEndFrameTime = timer.GetElapsedMicroseconds();
+
+    timer.Start();
+    for (int frame = 0; frame < numFrames; ++frame)
+    {
+        keys.HandleKeyPressed(static_cast<unsigned char>(frame));
+        keys.EndFrame();
+        keys.HandleKeyReleased(static_cast<unsigned char>(frame));
+    }
+    timer.Stop();
+    double const bitsetEndFrameTime = timer.GetElapsedMicroseconds();
+
+    printf("    EndFrame (InputSystem):    %8.3f ns/frame\n", systemEndFrameTime * 1000.0 / numFrames);
+    printf("    EndFrame (KeyStateBitset): %8.3f ns/frame (%.2fx)\n", bitsetEndFrameTime * 1000.0 / numFrames, systemEndFrameTime / bitsetEndFrameTime);
+
+    // WasKeyJustPressed over every key code, the way gameplay polls a handful of keys many times per frame
+    timer.Start();
+    for (int frame = 0; frame < numFrames; ++frame)
+    {
+        checksum += inputSystem.WasKeyJustPressed(static_cast<unsigned char>(frame)) ? 1 : 0;
+    }
+    timer.Stop();
+    double const systemQueryTime = timer.GetElapsedMicroseconds();
+
+    timer.Start();
+    for (int frame = 0; frame < numFrames; ++frame)
+    {
+        checksum += keys.WasKeyJustPressed(static_cast<unsigned char>(frame)) ? 1 : 0;
+    }
+    timer.Stop();
+    double const bitsetQueryTime = timer.GetElapsedMicroseconds();
+
+    printf("    WasKeyJustPressed (InputSystem):    %8.3f ns/query\n", systemQueryTime * 1000.0 / numFrames);
+    printf("    WasKeyJustPressed (KeyStateBitset): %8.3f ns/query (%.2fx)\n", bitsetQueryTime * 1000.0 / numFrames, systemQueryTime / bitsetQueryTime);
+
+    // "Any key pressed this frame" by scanning every key versus one mask test
+    int constexpr numScans = numFrames / 10;
+
+    timer.Start();
+    for (int scan = 0; scan < numScans; ++scan)
+    {
+        inputSystem.HandleKeyPressed(static_cast<unsigned char>(scan));
+
+        bool bAnyPressed = false;
+        for (int keyIndex = 0; keyIndex < 256 && !bAnyPressed; ++keyIndex)
+        {
+            bAnyPressed = inputSystem.WasKeyJustPressed(static_cast<unsigned char>(keyIndex));
+        }
+
+        checksum += bAnyPressed ? 1 : 0;
+        inputSystem.EndFrame();
+    }
+    timer.Stop();
+    double const systemAnyTime = timer.GetElapsedMicroseconds();
+
+    timer.Start();
+    for (int scan = 0; scan < numScans; ++scan)
+    {
+        keys.HandleKeyPressed(static_cast<unsigned char>(scan));
+        checksum += keys.WasAnyKeyJustPressed() ? 1 : 0;
+        keys.EndFrame();
+    }
+    timer.Stop();
+    double const bitsetAnyTime = timer.GetElapsedMicroseconds();
+
+    printf("    Any key just pressed (InputSystem scan):    %8.3f ns/frame\n", systemAnyTime * 1000.0 / numScans);
+    printf("    Any key just pressed (KeyStateBitset mask): %8.3f ns/frame (%.2fx)\n", bitsetAnyTime * 1000.0 / numScans, systemAnyTime / bitsetAnyTime);
+    printf("    (checksum %d)\n", checksum);
+
+    VerifyTestResult(true, "KeyStateBitset performance tests completed");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_KeyStateBitset_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_KeyStateBitset()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_KeyStateBitset)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_KeyStateBitset_Basics, "KeyStateBitset - Basics");
+    RunTestSet(true, TestSet_KeyStateBitset_BulkQueries, "KeyStateBitset - Bulk Queries");
+    RunTestSet(true, TestSet_KeyStateBitset_MatchesInputSystem, "KeyStateBitset - Matches InputSystem");
+    RunTestSet(false, TestSet_KeyStateBitset_Performance, "KeyStateBitset - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_KeyStateBitset)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
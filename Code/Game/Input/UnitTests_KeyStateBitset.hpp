@@ -0,0 +1,31 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_KeyStateBitset.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_KeyStateBitset();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_KeyStateBitset_Basics();
+int TestSet_KeyStateBitset_BulkQueries();
+int TestSet_KeyStateBitset_MatchesInputSystem();
+int TestSet_KeyStateBitset_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_KeyStateBitset_Basics
+#define ENABLE_TestSet_KeyStateBitset_BulkQueries
+#define ENABLE_TestSet_KeyStateBitset_MatchesInputSystem
+#define ENABLE_TestSet_KeyStateBitset_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define KEY_STATE_PERFORMANCE_NUM_FRAMES 100000
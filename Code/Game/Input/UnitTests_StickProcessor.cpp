@@ -0,0 +1,312 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_StickProcessor.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/UnitTests_StickProcessor.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Input/StickProcessor.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // Raw stick positions over the whole square the hardware reports, corners included
+    //
+    std::vector<Vector2Class> MakeRandomSticks(int const      numSticks,
+                                               unsigned const seed)
+    {
+        std::mt19937                          random(seed);
+        std::uniform_real_distribution<float> coordinate(-1.0f, 1.0f);
+        std::vector<Vector2Class>             sticks;
+
+        sticks.reserve(numSticks);
+
+        for (int stickIndex = 0; stickIndex < numSticks; ++stickIndex)
+        {
+            sticks.emplace_back(coordinate(random), coordinate(random));
+        }
+
+        return sticks;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    float GetMaxError(std::vector<Vector2Class> const& a,
+                      std::vector<Vector2Class> const& b)
+    {
+        float maxError = 0.0f;
+
+        for (size_t index = 0; index < a.size(); ++index)
+        {
+            maxError = std::fmax(maxError, (a[index] - b[index]).GetLength());
+        }
+
+        return maxError;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    float ApplyExponentCurve(float const magnitude)
+    {
+        return std::pow(magnitude, 2.2f);
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_StickProcessor_ResponseCurves()
+{
+#if defined(ENABLE_TestSet_StickProcessor_ResponseCurves)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_StickProcessor_ResponseCurves)(start)\n");
+    printf("####################################################################################################\n");
+
+    StickResponseCurve const linear;
+    StickResponseCurve const quadratic(eStickResponseCurve::QUADRATIC);
+    StickResponseCurve const cubic(eStickResponseCurve::CUBIC);
+    StickResponseCurve const exponent(ApplyExponentCurve);
+
+    float linearError    = 0.0f;
+    float quadraticError = 0.0f;
+    float cubicError     = 0.0f;
+    float exponentError  = 0.0f;
+
+    for (int sample = 0; sample <= 1000; ++sample)
+    {
+        float const magnitude = static_cast<float>(sample) / 1000.0f;
+
+        linearError    = std::fmax(linearError, std::fabs(linear.Evaluate(magnitude) - magnitude));
+        quadraticError = std::fmax(quadraticError, std::fabs(quadratic.Evaluate(magnitude) - magnitude * magnitude));
+        cubicError     = std::fmax(cubicError, std::fabs(cubic.Evaluate(magnitude) - magnitude * magnitude * magnitude));
+        exponentError  = std::fmax(exponentError, std::fabs(exponent.Evaluate(magnitude) - ApplyExponentCurve(magnitude)));
+    }
+
+    printf("  Max table error: linear %.2e, quadratic %.2e, cubic %.2e, exponent 2.2 %.2e\n", linearError, quadraticError, cubicError, exponentError);
+
+    VerifyTestResult(linearError < 1e-6f, "A linear curve should be reproduced exactly");
+    VerifyTestResult(quadraticError < 1e-4f && cubicError < 1e-4f, "Preset curves should be within 1e-4 of their formula");
+    VerifyTestResult(exponentError < 1e-3f && exponent.Evaluate(0.0f) == 0.0f && exponent.Evaluate(1.0f) == 1.0f,
+                     "A custom curve should be baked and hit its endpoints exactly");
+    VerifyTestResult(quadratic.Evaluate(-0.5f) == 0.0f && quadratic.Evaluate(1.5f) == 1.0f && quadratic.Evaluate(std::numeric_limits<float>::quiet_NaN()) == 0.0f,
+                     "Magnitudes outside [0, 1] should be clamped, and NaN treated as 0");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_StickProcessor_ResponseCurves)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 4; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_StickProcessor_MatchesAnalogJoystick()
+{
+#if defined(ENABLE_TestSet_StickProcessor_MatchesAnalogJoystick)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_StickProcessor_MatchesAnalogJoystick)(start)\n");
+    printf("####################################################################################################\n");
+
+    // Every raw position on a 0.01 grid over the reported square
+    std::vector<Vector2Class> raw;
+
+    for (int yIndex = -100; yIndex <= 100; ++yIndex)
+    {
+        for (int xIndex = -100; xIndex <= 100; ++xIndex)
+        {
+            raw.emplace_back(static_cast<float>(xIndex) * 0.01f, static_cast<float>(yIndex) * 0.01f);
+        }
+    }
+
+    AnalogJoystickClass       joystick;
+    StickProcessor const      processor;
+    std::vector<Vector2Class> expected(raw.size());
+    std::vector<Vector2Class> scalar(raw.size());
+    std::vector<Vector2Class> batch(raw.size());
+
+    for (size_t index = 0; index < raw.size(); ++index)
+    {
+        joystick.UpdatePosition(raw[index].x, raw[index].y);
+        expected[index] = joystick.GetPosition();
+        scalar[index]   = processor.ProcessStick(raw[index]);
+    }
+
+    processor.ProcessSticks(raw.data(), batch.data(), static_cast<int>(raw.size()));
+
+    float const scalarError = GetMaxError(scalar, expected);
+    float const batchError  = GetMaxError(batch, expected);
+    printf("  %d positions, max error against AnalogJoystick: scalar %.2e, batch %.2e\n", static_cast<int>(raw.size()), scalarError, batchError);
+
+    VerifyTestResult(scalarError < 1e-5f, "ProcessStick should match AnalogJoystick's deadzone correction");
+    VerifyTestResult(batchError < 1e-5f, "ProcessSticks should match AnalogJoystick's deadzone correction");
+
+    Vector2Class const inside  = processor.ProcessStick(Vector2Class(0.2f, -0.1f));
+    Vector2Class const outside = processor.ProcessStick(Vector2Class(0.0f, -0.98f));
+    VerifyTestResult(IsMostlyEqual(inside, 0.0f, 0.0f) && IsMostlyEqual(outside, 0.0f, -1.0f),
+                     "Sticks inside the inner deadzone should be centered and past the outer one at full length");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_StickProcessor_MatchesAnalogJoystick)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 3; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_StickProcessor_Batch()
+{
+#if defined(ENABLE_TestSet_StickProcessor_Batch)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_StickProcessor_Batch)(start)\n");
+    printf("####################################################################################################\n");
+
+    StickProcessor processor(0.2f, 0.9f);
+    processor.SetResponseCurve(StickResponseCurve(eStickResponseCurve::QUADRATIC));
+
+    // Not a multiple of four, so the scalar tail runs too
+    std::vector<Vector2Class> raw = MakeRandomSticks(1003, 41);
+    raw[0]                        = Vector2Class(0.0f, 0.0f);
+
+    std::vector<Vector2Class> scalar(raw.size());
+    std::vector<Vector2Class> batch(raw.size());
+
+    for (size_t index = 0; index < raw.size(); ++index)
+    {
+        scalar[index] = processor.ProcessStick(raw[index]);
+    }
+
+    processor.ProcessSticks(raw.data(), batch.data(), static_cast<int>(raw.size()));
+    VerifyTestResult(GetMaxError(batch, scalar) < 1e-6f, "The batch path should match the scalar path");
+
+    VerifyTestResult(batch[0].x == 0.0f && batch[0].y == 0.0f, "A centered stick should come out centered, not NaN");
+
+    // Curved: half way through the live zone comes out at a quarter length, in the same direction
+    Vector2Class const halfway(0.55f * 0.6f, 0.55f * 0.8f);
+    Vector2Class const curved = processor.ProcessStick(halfway);
+    VerifyTestResult(IsMostlyEqual(curved, 0.25f * 0.6f, 0.25f * 0.8f), "The response curve should scale the corrected magnitude");
+
+    std::vector<Vector2Class> inPlace = raw;
+    processor.ProcessSticks(inPlace.data(), inPlace.data(), static_cast<int>(inPlace.size()));
+    VerifyTestResult(GetMaxError(inPlace, batch) == 0.0f, "Processing in place should give the same result");
+
+    std::vector<float> xs(raw.size());
+    std::vector<float> ys(raw.size());
+
+    for (size_t index = 0; index < raw.size(); ++index)
+    {
+        xs[index] = raw[index].x;
+        ys[index] = raw[index].y;
+    }
+
+    processor.ProcessSticks(xs.data(), ys.data(), xs.data(), ys.data(), static_cast<int>(raw.size()));
+
+    std::vector<Vector2Class> streamed(raw.size());
+    for (size_t index = 0; index < raw.size(); ++index)
+    {
+        streamed[index] = Vector2Class(xs[index], ys[index]);
+    }
+
+    VerifyTestResult(GetMaxError(streamed, batch) == 0.0f, "Separate x and y streams should give the same result as packed positions");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_StickProcessor_Batch)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 5; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_StickProcessor_Performance()
+{
+#if defined(ENABLE_TestSet_StickProcessor_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_StickProcessor_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numFrames  = STICK_PROCESSOR_PERFORMANCE_NUM_FRAMES;
+    int constexpr numSamples = 4096;
+
+    std::vector<Vector2Class> const samples = MakeRandomSticks(numSamples + STICK_PROCESSOR_MANY_PLAYERS_NUM_STICKS, 7);
+
+    StickProcessor processor;
+    processor.SetResponseCurve(StickResponseCurve(ApplyExponentCurve));
+
+    int const stickCounts[] = {NUM_XBOX_CONTROLLERS * 2, STICK_PROCESSOR_MANY_PLAYERS_NUM_STICKS};
+
+    printf("  %d frames, exponent 2.2 response curve...\n", numFrames);
+
+    for (int const numSticks : stickCounts)
+    {
+        std::vector<AnalogJoystickClass> joysticks(numSticks);
+        std::vector<Vector2Class>        corrected(numSticks);
+        PerformanceTimer                 timer;
+        float                            checksum = 0.0f;
+
+        // AnalogJoystick's correction per stick, then the curve on top
+        timer.Start();
+        for (int frame = 0; frame < numFrames; ++frame)
+        {
+            Vector2Class const* const raw = samples.data() + frame % numSamples;
+
+            for (int stickIndex = 0; stickIndex < numSticks; ++stickIndex)
+            {
+                joysticks[stickIndex].UpdatePosition(raw[stickIndex].x, raw[stickIndex].y);
+
+                float const magnitude = joysticks[stickIndex].GetMagnitude();
+                corrected[stickIndex] = (magnitude > 0.0f) ? joysticks[stickIndex].GetPosition() * (ApplyExponentCurve(magnitude) / magnitude) : Vector2Class(0.0f, 0.0f);
+            }
+
+            checksum += corrected[frame % numSticks].x;
+        }
+        timer.Stop();
+        double const joystickTime = timer.GetElapsedMicroseconds();
+
+        timer.Start();
+        for (int frame = 0; frame < numFrames; ++frame)
+        {
+            processor.ProcessSticks(samples.data() + frame % numSamples, corrected.data(), numSticks);
+            checksum += corrected[frame % numSticks].x;
+        }
+        timer.Stop();
+        double const batchTime = timer.GetElapsedMicroseconds();
+
+        printf("    %2d sticks, AnalogJoystick + curve:   %8.3f ns/frame\n", numSticks, joystickTime * 1000.0 / numFrames);
+        printf("    %2d sticks, StickProcessor batch:     %8.3f ns/frame (%.2fx)   (checksum %.1f)\n", numSticks, batchTime * 1000.0 / numFrames, joystickTime / batchTime, checksum);
+    }
+
+    VerifyTestResult(true, "StickProcessor performance tests completed");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_StickProcessor_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_StickProcessor()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_StickProcessor)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_StickProcessor_ResponseCurves, "StickProcessor - ResponseCurves");
+    RunTestSet(true, TestSet_StickProcessor_MatchesAnalogJoystick, "StickProcessor - MatchesAnalogJoystick");
+    RunTestSet(true, TestSet_StickProcessor_Batch, "StickProcessor - Batch");
+    RunTestSet(false, TestSet_StickProcessor_Performance, "StickProcessor - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_StickProcessor)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
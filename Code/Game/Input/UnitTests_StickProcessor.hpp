@@ -0,0 +1,32 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_StickProcessor.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_StickProcessor();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_StickProcessor_ResponseCurves();
+int TestSet_StickProcessor_MatchesAnalogJoystick();
+int TestSet_StickProcessor_Batch();
+int TestSet_StickProcessor_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_StickProcessor_ResponseCurves
+#define ENABLE_TestSet_StickProcessor_MatchesAnalogJoystick
+#define ENABLE_TestSet_StickProcessor_Batch
+#define ENABLE_TestSet_StickProcessor_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define STICK_PROCESSOR_PERFORMANCE_NUM_FRAMES 100000
+#define STICK_PROCESSOR_MANY_PLAYERS_NUM_STICKS 64
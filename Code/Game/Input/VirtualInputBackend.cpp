@@ -0,0 +1,297 @@
+//----------------------------------------------------------------------------------------------------
+// VirtualInputBackend.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Input/VirtualInputBackend.hpp"
+
+#include <algorithm>
+
+#include "Game/Input/InputEventQueue.hpp"
+
+//----------------------------------------------------------------------------------------------------
+VirtualInputBackend::VirtualInputBackend(Vec2 const& clientDimensions)
+{
+    m_cursor.m_clientDimensions = clientDimensions;
+}
+
+//----------------------------------------------------------------------------------------------------
+void VirtualInputBackend::AddInput(sVirtualInput const& input)
+{
+    // Keep the script sorted by frame, after any inputs already scripted for the same frame
+    auto const position = std::upper_bound(m_script.begin(), m_script.end(), input.m_frame, [](int const frame, sVirtualInput const& scripted)
+    {
+        return frame < scripted.m_frame;
+    });
+
+    m_script.insert(position, input);
+}
+
+//----------------------------------------------------------------------------------------------------
+void VirtualInputBackend::PressKey(int const           frame,
+                                   unsigned char const keyCode)
+{
+    sVirtualInput input;
+    input.m_frame   = frame;
+    input.m_type    = eVirtualInputType::KEY_PRESSED;
+    input.m_keyCode = keyCode;
+
+    AddInput(input);
+}
+
+//----------------------------------------------------------------------------------------------------
+void VirtualInputBackend::ReleaseKey(int const           frame,
+                                     unsigned char const keyCode)
+{
+    sVirtualInput input;
+    input.m_frame   = frame;
+    input.m_type    = eVirtualInputType::KEY_RELEASED;
+    input.m_keyCode = keyCode;
+
+    AddInput(input);
+}
+
+//----------------------------------------------------------------------------------------------------
+void VirtualInputBackend::MoveCursor(int const   frame,
+                                     Vec2 const& clientPosition)
+{
+    sVirtualInput input;
+    input.m_frame = frame;
+    input.m_type  = eVirtualInputType::CURSOR_MOVED;
+    input.m_value = clientPosition;
+
+    AddInput(input);
+}
+
+//----------------------------------------------------------------------------------------------------
+void VirtualInputBackend::ConnectController(int const frame,
+                                            int const controllerIndex)
+{
+    sVirtualInput input;
+    input.m_frame           = frame;
+    input.m_type            = eVirtualInputType::CONTROLLER_CONNECTED;
+    input.m_controllerIndex = controllerIndex;
+
+    AddInput(input);
+}
+
+//----------------------------------------------------------------------------------------------------
+void VirtualInputBackend::DisconnectController(int const frame,
+                                               int const controllerIndex)
+{
+    sVirtualInput input;
+    input.m_frame           = frame;
+    input.m_type            = eVirtualInputType::CONTROLLER_DISCONNECTED;
+    input.m_controllerIndex = controllerIndex;
+
+    AddInput(input);
+}
+
+//----------------------------------------------------------------------------------------------------
+void VirtualInputBackend::PressButton(int const          frame,
+                                      int const          controllerIndex,
+                                      XboxButtonID const button)
+{
+    sVirtualInput input;
+    input.m_frame           = frame;
+    input.m_type            = eVirtualInputType::CONTROLLER_BUTTON_PRESSED;
+    input.m_controllerIndex = controllerIndex;
+    input.m_button          = button;
+
+    AddInput(input);
+}
+
+//----------------------------------------------------------------------------------------------------
+void VirtualInputBackend::ReleaseButton(int const          frame,
+                                        int const          controllerIndex,
+                                        XboxButtonID const button)
+{
+    sVirtualInput input;
+    input.m_frame           = frame;
+    input.m_type            = eVirtualInputType::CONTROLLER_BUTTON_RELEASED;
+    input.m_controllerIndex = controllerIndex;
+    input.m_button          = button;
+
+    AddInput(input);
+}
+
+//----------------------------------------------------------------------------------------------------
+void VirtualInputBackend::MoveLeftStick(int const   frame,
+                                        int const   controllerIndex,
+                                        Vec2 const& rawPosition)
+{
+    sVirtualInput input;
+    input.m_frame           = frame;
+    input.m_type            = eVirtualInputType::CONTROLLER_LEFT_STICK;
+    input.m_controllerIndex = controllerIndex;
+    input.m_value           = rawPosition;
+
+    AddInput(input);
+}
+
+//----------------------------------------------------------------------------------------------------
+void VirtualInputBackend::MoveRightStick(int const   frame,
+                                         int const   controllerIndex,
+                                         Vec2 const& rawPosition)
+{
+    sVirtualInput input;
+    input.m_frame           = frame;
+    input.m_type            = eVirtualInputType::CONTROLLER_RIGHT_STICK;
+    input.m_controllerIndex = controllerIndex;
+    input.m_value           = rawPosition;
+
+    AddInput(input);
+}
+
+//----------------------------------------------------------------------------------------------------
+void VirtualInputBackend::SetTriggers(int const   frame,
+                                      int const   controllerIndex,
+                                      float const leftTrigger,
+                                      float const rightTrigger)
+{
+    sVirtualInput input;
+    input.m_frame           = frame;
+    input.m_type            = eVirtualInputType::CONTROLLER_TRIGGERS;
+    input.m_controllerIndex = controllerIndex;
+    input.m_value           = Vec2(leftTrigger, rightTrigger);
+
+    AddInput(input);
+}
+
+//----------------------------------------------------------------------------------------------------
+void VirtualInputBackend::ClearScript()
+{
+    m_script.clear();
+    m_nextInput = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool VirtualInputBackend::Startup()
+{
+    m_nextInput = 0;
+    m_frame     = 0;
+    m_numPolls  = 0;
+
+    for (sControllerSample& controller : m_controllers)
+    {
+        controller = sControllerSample();
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void VirtualInputBackend::Shutdown()
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void VirtualInputBackend::PumpEvents(InputEventQueue& eventQueue)
+{
+    // Inputs scripted for frames that already went by are applied late rather than dropped
+    while (m_nextInput < m_script.size() && m_script[m_nextInput].m_frame <= m_frame)
+    {
+        ApplyInput(m_script[m_nextInput], eventQueue);
+        ++m_nextInput;
+    }
+
+    ++m_frame;
+}
+
+//----------------------------------------------------------------------------------------------------
+sCursorSample VirtualInputBackend::GetCursorSample() const
+{
+    return m_cursor;
+}
+
+//----------------------------------------------------------------------------------------------------
+sControllerSample VirtualInputBackend::PollController(int const controllerIndex)
+{
+    ++m_numPolls;
+
+    if (controllerIndex < 0 || controllerIndex >= MAX_VIRTUAL_CONTROLLERS)
+    {
+        return sControllerSample();
+    }
+
+    return m_controllers[controllerIndex];
+}
+
+//----------------------------------------------------------------------------------------------------
+int VirtualInputBackend::GetCurrentFrame() const
+{
+    return m_frame;
+}
+
+//----------------------------------------------------------------------------------------------------
+int VirtualInputBackend::GetNumPolls() const
+{
+    return m_numPolls;
+}
+
+//----------------------------------------------------------------------------------------------------
+void VirtualInputBackend::ApplyInput(sVirtualInput const& input,
+                                     InputEventQueue&     eventQueue)
+{
+    switch (input.m_type)
+    {
+    case eVirtualInputType::KEY_PRESSED:
+        eventQueue.PushKeyPressed(input.m_keyCode);
+        return;
+
+    case eVirtualInputType::KEY_RELEASED:
+        eventQueue.PushKeyReleased(input.m_keyCode);
+        return;
+
+    case eVirtualInputType::CURSOR_MOVED:
+        m_cursor.m_clientPosition = input.m_value;
+        m_cursor.m_timestamp      = PerformanceClock::now();
+        return;
+
+    default:
+        break;
+    }
+
+    if (input.m_controllerIndex < 0 || input.m_controllerIndex >= MAX_VIRTUAL_CONTROLLERS)
+    {
+        return;
+    }
+
+    sControllerSample& controller = m_controllers[input.m_controllerIndex];
+    uint16_t const     buttonBit  = static_cast<uint16_t>(1u << input.m_button);
+
+    switch (input.m_type)
+    {
+    case eVirtualInputType::CONTROLLER_CONNECTED:
+        controller.m_isConnected = true;
+        break;
+
+    case eVirtualInputType::CONTROLLER_DISCONNECTED:
+        controller = sControllerSample();
+        break;
+
+    case eVirtualInputType::CONTROLLER_BUTTON_PRESSED:
+        controller.m_buttonsDown |= buttonBit;
+        break;
+
+    case eVirtualInputType::CONTROLLER_BUTTON_RELEASED:
+        controller.m_buttonsDown &= static_cast<uint16_t>(~buttonBit);
+        break;
+
+    case eVirtualInputType::CONTROLLER_LEFT_STICK:
+        controller.m_leftStickRaw = input.m_value;
+        break;
+
+    case eVirtualInputType::CONTROLLER_RIGHT_STICK:
+        controller.m_rightStickRaw = input.m_value;
+        break;
+
+    case eVirtualInputType::CONTROLLER_TRIGGERS:
+        controller.m_leftTrigger  = input.m_value.x;
+        controller.m_rightTrigger = input.m_value.y;
+        break;
+
+    default:
+        break;
+    }
+}
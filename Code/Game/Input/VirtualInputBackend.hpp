@@ -0,0 +1,84 @@
+//----------------------------------------------------------------------------------------------------
+// VirtualInputBackend.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <vector>
+
+#include "Engine/Input/InputSystem.hpp"
+#include "Game/Input/InputBackend.hpp"
+
+//----------------------------------------------------------------------------------------------------
+int constexpr MAX_VIRTUAL_CONTROLLERS = 64;     // Slots past NUM_XBOX_CONTROLLERS are for ControllerStateArray
+
+//----------------------------------------------------------------------------------------------------
+enum class eVirtualInputType : unsigned char
+{
+    KEY_PRESSED,
+    KEY_RELEASED,
+    CURSOR_MOVED,
+    CONTROLLER_CONNECTED,
+    CONTROLLER_DISCONNECTED,
+    CONTROLLER_BUTTON_PRESSED,
+    CONTROLLER_BUTTON_RELEASED,
+    CONTROLLER_LEFT_STICK,
+    CONTROLLER_RIGHT_STICK,
+    CONTROLLER_TRIGGERS,
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sVirtualInput
+{
+    int               m_frame           = 0;
+    eVirtualInputType m_type            = eVirtualInputType::KEY_PRESSED;
+    unsigned char     m_keyCode         = 0;
+    int               m_controllerIndex = 0;
+    XboxButtonID      m_button          = XBOX_BUTTON_A;
+    Vec2              m_value           = Vec2(0.f, 0.f);     // Cursor position, raw stick, or (left, right) triggers
+};
+
+//----------------------------------------------------------------------------------------------------
+// Scripted keyboard, cursor and Xbox controller input for running the input frame cycle without a
+// window or controller hardware.
+//
+// Inputs are scripted against frame numbers; each PumpEvents call applies the inputs of the next
+// frame, pushing key events to the queue and updating the cursor and controller samples.
+//
+class VirtualInputBackend : public InputBackend
+{
+public:
+    explicit VirtualInputBackend(Vec2 const& clientDimensions = Vec2(1600.f, 800.f));
+
+    void AddInput(sVirtualInput const& input);
+    void PressKey(int frame, unsigned char keyCode);
+    void ReleaseKey(int frame, unsigned char keyCode);
+    void MoveCursor(int frame, Vec2 const& clientPosition);
+    void ConnectController(int frame, int controllerIndex);
+    void DisconnectController(int frame, int controllerIndex);
+    void PressButton(int frame, int controllerIndex, XboxButtonID button);
+    void ReleaseButton(int frame, int controllerIndex, XboxButtonID button);
+    void MoveLeftStick(int frame, int controllerIndex, Vec2 const& rawPosition);
+    void MoveRightStick(int frame, int controllerIndex, Vec2 const& rawPosition);
+    void SetTriggers(int frame, int controllerIndex, float leftTrigger, float rightTrigger);
+    void ClearScript();
+
+    bool              Startup() override;
+    void              Shutdown() override;
+    void              PumpEvents(InputEventQueue& eventQueue) override;
+    sCursorSample     GetCursorSample() const override;
+    sControllerSample PollController(int controllerIndex) override;
+
+    int GetCurrentFrame() const;        // Frames pumped since Startup
+    int GetNumPolls() const;
+
+private:
+    void ApplyInput(sVirtualInput const& input, InputEventQueue& eventQueue);
+
+    std::vector<sVirtualInput> m_script;                     // Sorted by frame, stable within a frame
+    size_t                     m_nextInput = 0;
+    int                        m_frame     = 0;
+    int                        m_numPolls  = 0;
+    sCursorSample              m_cursor;
+    sControllerSample          m_controllers[MAX_VIRTUAL_CONTROLLERS];
+};
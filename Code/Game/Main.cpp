@@ -4,16 +4,64 @@
 
 //----------------------------------------------------------------------------------------------------
 #include "Game/GameCommon.hpp"
+#include "Game/Core/UnitTests_Allocators.hpp"
+#include "Game/Core/UnitTests_EventDispatcher.hpp"
+#include "Game/Core/UnitTests_JobSystem.hpp"
+#include "Game/Input/UnitTests_ControllerPoller.hpp"
+#include "Game/Input/UnitTests_ControllerStateArray.hpp"
+#include "Game/Input/UnitTests_CursorDeltaAccumulator.hpp"
+#include "Game/Input/UnitTests_InputActionMap.hpp"
+#include "Game/Input/UnitTests_InputFrameDriver.hpp"
+#include "Game/Input/UnitTests_InputHistory.hpp"
+#include "Game/Input/UnitTests_InputLatencyTracker.hpp"
+#include "Game/Input/UnitTests_InputRecording.hpp"
+#include "Game/Input/UnitTests_InputReplayDriver.hpp"
+#include "Game/Input/UnitTests_InputSnapshot.hpp"
 #include "Game/Input/UnitTests_InputSystem.hpp"
+#include "Game/Input/UnitTests_KeyStateBitset.hpp"
+#include "Game/Input/UnitTests_StickProcessor.hpp"
 #include "Game/Math/UnitTests_AABB2.hpp"
+#include "Game/Math/UnitTests_AABB2Array.hpp"
+#include "Game/Math/UnitTests_AABB2BatchKernels.hpp"
+#include "Game/Math/UnitTests_AABB2BoundsReduction.hpp"
+#include "Game/Math/UnitTests_AABB2LooseQuadtree.hpp"
+#include "Game/Math/UnitTests_AABB2Raycast.hpp"
+#include "Game/Math/UnitTests_AABB2SweepAndPrune.hpp"
+#include "Game/Math/UnitTests_SkylinePacker.hpp"
 #include "Game/Math/UnitTests_Vec2.hpp"
+#include "Game/Math/UnitTests_VecN.hpp"
+#include "Game/UI/UnitTests_UILayout.hpp"
 
 //----------------------------------------------------------------------------------------------------
 void RunTestSets()
 {
     RunTests_AABB2();
+    RunTests_AABB2Array();
+    RunTests_AABB2SweepAndPrune();
+    RunTests_AABB2BoundsReduction();
+    RunTests_AABB2LooseQuadtree();
+    RunTests_AABB2Raycast();
+    RunTests_AABB2BatchKernels();
+    RunTests_SkylinePacker();
+    RunTests_UILayout();
     RunTests_Vec2();
+    RunTests_VecN();
     RunTests_InputSystem();
+    RunTests_KeyStateBitset();
+    RunTests_InputRecording();
+    RunTests_InputFrameDriver();
+    RunTests_InputReplayDriver();
+    RunTests_InputActionMap();
+    RunTests_ControllerPoller();
+    RunTests_StickProcessor();
+    RunTests_InputLatencyTracker();
+    RunTests_CursorDeltaAccumulator();
+    RunTests_EventDispatcher();
+    RunTests_InputHistory();
+    RunTests_InputSnapshot();
+    RunTests_ControllerStateArray();
+    RunTests_JobSystem();
+    RunTests_Allocators();
 }
 
 //-----------------------------------------------------------------------------------------------
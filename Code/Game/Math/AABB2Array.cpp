@@ -0,0 +1,280 @@
+//----------------------------------------------------------------------------------------------------
+// AABB2Array.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Math/AABB2Array.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <xmmintrin.h>
+
+static_assert(sizeof(Vec2) == 2 * sizeof(float), "AABB2Array writes Vec2 outputs as packed floats");
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // Scalar _mm_min_ps and _mm_max_ps, so the tails treat NaNs as the SIMD loops do: when either
+    // operand is NaN the result is b. std::min and std::max return a instead.
+    //
+    float MinLikeSSE(float const a,
+                     float const b)
+    {
+        return (a < b) ? a : b;
+    }
+
+    float MaxLikeSSE(float const a,
+                     float const b)
+    {
+        return (a > b) ? a : b;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2Array::AABB2Array(std::span<AABB2 const> const boxes)
+{
+    Reserve(static_cast<int>(boxes.size()));
+
+    for (AABB2 const& box : boxes)
+    {
+        PushBack(box);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2Array::Reserve(int const capacity)
+{
+    m_minXs.reserve(capacity);
+    m_minYs.reserve(capacity);
+    m_maxXs.reserve(capacity);
+    m_maxYs.reserve(capacity);
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2Array::Clear()
+{
+    m_minXs.clear();
+    m_minYs.clear();
+    m_maxXs.clear();
+    m_maxYs.clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2Array::PushBack(AABB2 const& box)
+{
+    m_minXs.push_back(box.m_mins.x);
+    m_minYs.push_back(box.m_mins.y);
+    m_maxXs.push_back(box.m_maxs.x);
+    m_maxYs.push_back(box.m_maxs.y);
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2Array::Set(int const    index,
+                     AABB2 const& box)
+{
+    m_minXs[index] = box.m_mins.x;
+    m_minYs[index] = box.m_mins.y;
+    m_maxXs[index] = box.m_maxs.x;
+    m_maxYs[index] = box.m_maxs.y;
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2 AABB2Array::Get(int const index) const
+{
+    return AABB2(m_minXs[index], m_minYs[index], m_maxXs[index], m_maxYs[index]);
+}
+
+//----------------------------------------------------------------------------------------------------
+int AABB2Array::GetCount() const
+{
+    return static_cast<int>(m_minXs.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+int AABB2Array::FindOverlapping(AABB2 const&      query,
+                                std::vector<int>& out_indices) const
+{
+    out_indices.clear();
+
+    int const    count     = GetCount();
+    __m128 const queryMinX = _mm_set1_ps(query.m_mins.x);
+    __m128 const queryMinY = _mm_set1_ps(query.m_mins.y);
+    __m128 const queryMaxX = _mm_set1_ps(query.m_maxs.x);
+    __m128 const queryMaxY = _mm_set1_ps(query.m_maxs.y);
+    int          index     = 0;
+
+    for (; index + 4 <= count; index += 4)
+    {
+        __m128 const overlapX = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(&m_minXs[index]), queryMaxX),
+                                           _mm_cmple_ps(queryMinX, _mm_loadu_ps(&m_maxXs[index])));
+        __m128 const overlapY = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(&m_minYs[index]), queryMaxY),
+                                           _mm_cmple_ps(queryMinY, _mm_loadu_ps(&m_maxYs[index])));
+        int mask = _mm_movemask_ps(_mm_and_ps(overlapX, overlapY));
+
+        while (mask != 0)
+        {
+            out_indices.push_back(index + std::countr_zero(static_cast<unsigned int>(mask)));
+            mask &= mask - 1;
+        }
+    }
+
+    for (; index < count; ++index)
+    {
+        if (m_minXs[index] <= query.m_maxs.x && query.m_mins.x <= m_maxXs[index] &&
+            m_minYs[index] <= query.m_maxs.y && query.m_mins.y <= m_maxYs[index])
+        {
+            out_indices.push_back(index);
+        }
+    }
+
+    return static_cast<int>(out_indices.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2Array::GetAreas(float* out_areas) const
+{
+    int const count = GetCount();
+    int       index = 0;
+
+    for (; index + 4 <= count; index += 4)
+    {
+        __m128 const width  = _mm_sub_ps(_mm_loadu_ps(&m_maxXs[index]), _mm_loadu_ps(&m_minXs[index]));
+        __m128 const height = _mm_sub_ps(_mm_loadu_ps(&m_maxYs[index]), _mm_loadu_ps(&m_minYs[index]));
+        _mm_storeu_ps(out_areas + index, _mm_mul_ps(width, height));
+    }
+
+    for (; index < count; ++index)
+    {
+        out_areas[index] = (m_maxXs[index] - m_minXs[index]) * (m_maxYs[index] - m_minYs[index]);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2Array::GetCenters(Vec2* out_centers) const
+{
+    int const    count  = GetCount();
+    float*       output = reinterpret_cast<float*>(out_centers);
+    __m128 const half   = _mm_set1_ps(0.5f);
+    int          index  = 0;
+
+    for (; index + 4 <= count; index += 4)
+    {
+        __m128 const centerX = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&m_minXs[index]), _mm_loadu_ps(&m_maxXs[index])), half);
+        __m128 const centerY = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&m_minYs[index]), _mm_loadu_ps(&m_maxYs[index])), half);
+        _mm_storeu_ps(output + index * 2, _mm_unpacklo_ps(centerX, centerY));
+        _mm_storeu_ps(output + index * 2 + 4, _mm_unpackhi_ps(centerX, centerY));
+    }
+
+    for (; index < count; ++index)
+    {
+        out_centers[index] = Vec2((m_minXs[index] + m_maxXs[index]) * 0.5f, (m_minYs[index] + m_maxYs[index]) * 0.5f);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2Array::GetDimensions(Vec2* out_dimensions) const
+{
+    int const count  = GetCount();
+    float*    output = reinterpret_cast<float*>(out_dimensions);
+    int       index  = 0;
+
+    for (; index + 4 <= count; index += 4)
+    {
+        __m128 const width  = _mm_sub_ps(_mm_loadu_ps(&m_maxXs[index]), _mm_loadu_ps(&m_minXs[index]));
+        __m128 const height = _mm_sub_ps(_mm_loadu_ps(&m_maxYs[index]), _mm_loadu_ps(&m_minYs[index]));
+        _mm_storeu_ps(output + index * 2, _mm_unpacklo_ps(width, height));
+        _mm_storeu_ps(output + index * 2 + 4, _mm_unpackhi_ps(width, height));
+    }
+
+    for (; index < count; ++index)
+    {
+        out_dimensions[index] = Vec2(m_maxXs[index] - m_minXs[index], m_maxYs[index] - m_minYs[index]);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2Array::Translate(Vec2 const& translation)
+{
+    int const    count = GetCount();
+    __m128 const dx    = _mm_set1_ps(translation.x);
+    __m128 const dy    = _mm_set1_ps(translation.y);
+    int          index = 0;
+
+    for (; index + 4 <= count; index += 4)
+    {
+        _mm_storeu_ps(&m_minXs[index], _mm_add_ps(_mm_loadu_ps(&m_minXs[index]), dx));
+        _mm_storeu_ps(&m_minYs[index], _mm_add_ps(_mm_loadu_ps(&m_minYs[index]), dy));
+        _mm_storeu_ps(&m_maxXs[index], _mm_add_ps(_mm_loadu_ps(&m_maxXs[index]), dx));
+        _mm_storeu_ps(&m_maxYs[index], _mm_add_ps(_mm_loadu_ps(&m_maxYs[index]), dy));
+    }
+
+    for (; index < count; ++index)
+    {
+        m_minXs[index] += translation.x;
+        m_minYs[index] += translation.y;
+        m_maxXs[index] += translation.x;
+        m_maxYs[index] += translation.y;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2Array::Union(AABB2Array const& a,
+                       AABB2Array const& b,
+                       AABB2Array&       out_result)
+{
+    int const count = std::min(a.GetCount(), b.GetCount());
+    out_result.Resize(count);
+    int index = 0;
+
+    for (; index + 4 <= count; index += 4)
+    {
+        _mm_storeu_ps(&out_result.m_minXs[index], _mm_min_ps(_mm_loadu_ps(&a.m_minXs[index]), _mm_loadu_ps(&b.m_minXs[index])));
+        _mm_storeu_ps(&out_result.m_minYs[index], _mm_min_ps(_mm_loadu_ps(&a.m_minYs[index]), _mm_loadu_ps(&b.m_minYs[index])));
+        _mm_storeu_ps(&out_result.m_maxXs[index], _mm_max_ps(_mm_loadu_ps(&a.m_maxXs[index]), _mm_loadu_ps(&b.m_maxXs[index])));
+        _mm_storeu_ps(&out_result.m_maxYs[index], _mm_max_ps(_mm_loadu_ps(&a.m_maxYs[index]), _mm_loadu_ps(&b.m_maxYs[index])));
+    }
+
+    for (; index < count; ++index)
+    {
+        out_result.m_minXs[index] = MinLikeSSE(a.m_minXs[index], b.m_minXs[index]);
+        out_result.m_minYs[index] = MinLikeSSE(a.m_minYs[index], b.m_minYs[index]);
+        out_result.m_maxXs[index] = MaxLikeSSE(a.m_maxXs[index], b.m_maxXs[index]);
+        out_result.m_maxYs[index] = MaxLikeSSE(a.m_maxYs[index], b.m_maxYs[index]);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2Array::Intersection(AABB2Array const& a,
+                              AABB2Array const& b,
+                              AABB2Array&       out_result)
+{
+    int const count = std::min(a.GetCount(), b.GetCount());
+    out_result.Resize(count);
+    int index = 0;
+
+    for (; index + 4 <= count; index += 4)
+    {
+        _mm_storeu_ps(&out_result.m_minXs[index], _mm_max_ps(_mm_loadu_ps(&a.m_minXs[index]), _mm_loadu_ps(&b.m_minXs[index])));
+        _mm_storeu_ps(&out_result.m_minYs[index], _mm_max_ps(_mm_loadu_ps(&a.m_minYs[index]), _mm_loadu_ps(&b.m_minYs[index])));
+        _mm_storeu_ps(&out_result.m_maxXs[index], _mm_min_ps(_mm_loadu_ps(&a.m_maxXs[index]), _mm_loadu_ps(&b.m_maxXs[index])));
+        _mm_storeu_ps(&out_result.m_maxYs[index], _mm_min_ps(_mm_loadu_ps(&a.m_maxYs[index]), _mm_loadu_ps(&b.m_maxYs[index])));
+    }
+
+    for (; index < count; ++index)
+    {
+        out_result.m_minXs[index] = MaxLikeSSE(a.m_minXs[index], b.m_minXs[index]);
+        out_result.m_minYs[index] = MaxLikeSSE(a.m_minYs[index], b.m_minYs[index]);
+        out_result.m_maxXs[index] = MinLikeSSE(a.m_maxXs[index], b.m_maxXs[index]);
+        out_result.m_maxYs[index] = MinLikeSSE(a.m_maxYs[index], b.m_maxYs[index]);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2Array::Resize(int const count)
+{
+    m_minXs.resize(count);
+    m_minYs.resize(count);
+    m_maxXs.resize(count);
+    m_maxYs.resize(count);
+}
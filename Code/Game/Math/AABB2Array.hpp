@@ -0,0 +1,57 @@
+//----------------------------------------------------------------------------------------------------
+// AABB2Array.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <span>
+#include <vector>
+
+#include "Engine/Math/AABB2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Structure-of-arrays storage for many AABB2s: minX, minY, maxX and maxY each live in their own
+// contiguous stream, so bulk kernels process four boxes per SSE instruction.
+//
+// Semantics match AABB2: overlap and containment are inclusive of edges, and no kernel reorders
+// or fixes up inverted boxes. Intersection of disjoint boxes yields an inverted box (mins > maxs).
+//
+class AABB2Array
+{
+public:
+    AABB2Array() = default;
+    explicit AABB2Array(std::span<AABB2 const> boxes);
+
+    void  Reserve(int capacity);
+    void  Clear();
+    void  PushBack(AABB2 const& box);
+    void  Set(int index, AABB2 const& box);
+    AABB2 Get(int index) const;
+    int   GetCount() const;
+
+    float const* GetMinXs() const { return m_minXs.data(); }
+    float const* GetMinYs() const { return m_minYs.data(); }
+    float const* GetMaxXs() const { return m_maxXs.data(); }
+    float const* GetMaxYs() const { return m_maxYs.data(); }
+
+    // Bulk queries; output buffers must hold GetCount() elements
+    int  FindOverlapping(AABB2 const& query, std::vector<int>& out_indices) const;
+    void GetAreas(float* out_areas) const;
+    void GetCenters(Vec2* out_centers) const;
+    void GetDimensions(Vec2* out_dimensions) const;
+
+    // Bulk mutators
+    void Translate(Vec2 const& translation);
+
+    // Element-wise combination of two arrays of equal length
+    static void Union(AABB2Array const& a, AABB2Array const& b, AABB2Array& out_result);
+    static void Intersection(AABB2Array const& a, AABB2Array const& b, AABB2Array& out_result);
+
+private:
+    void Resize(int count);
+
+    std::vector<float> m_minXs;
+    std::vector<float> m_minYs;
+    std::vector<float> m_maxXs;
+    std::vector<float> m_maxYs;
+};
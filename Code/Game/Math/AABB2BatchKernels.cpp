@@ -0,0 +1,145 @@
+//----------------------------------------------------------------------------------------------------
+// AABB2BatchKernels.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Math/AABB2BatchKernels.hpp"
+
+#include <xmmintrin.h>
+
+#include "Game/Math/Vec2Array.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // Scalar _mm_min_ps(_mm_max_ps(value, min), max), so the tails clamp a NaN to min as the SIMD
+    // loops do. std::clamp returns the NaN instead.
+    //
+    float ClampLikeSSE(float const value,
+                       float const min,
+                       float const max)
+    {
+        return (value > min) ? ((value < max) ? value : max) : min;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+sAABB2UVMapping::sAABB2UVMapping(AABB2 const& box)
+    : m_mins(box.m_mins),
+      m_dimensions(box.m_maxs - box.m_mins),
+      m_inverseDimensions(1.f / m_dimensions.x, 1.f / m_dimensions.y)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+Vec2 sAABB2UVMapping::GetPointAtUV(Vec2 const& uv) const
+{
+    return Vec2(m_mins.x + uv.x * m_dimensions.x, m_mins.y + uv.y * m_dimensions.y);
+}
+
+//----------------------------------------------------------------------------------------------------
+Vec2 sAABB2UVMapping::GetUVForPoint(Vec2 const& point) const
+{
+    return Vec2((point.x - m_mins.x) * m_inverseDimensions.x, (point.y - m_mins.y) * m_inverseDimensions.y);
+}
+
+//----------------------------------------------------------------------------------------------------
+void GetNearestPoints(AABB2 const&     box,
+                      Vec2Array const& points,
+                      Vec2Array&       out_nearestPoints)
+{
+    int const count = points.GetCount();
+    out_nearestPoints.Resize(count);
+
+    float const* xs    = points.GetXs();
+    float const* ys    = points.GetYs();
+    float*       outXs = out_nearestPoints.GetXs();
+    float*       outYs = out_nearestPoints.GetYs();
+
+    __m128 const minX  = _mm_set1_ps(box.m_mins.x);
+    __m128 const minY  = _mm_set1_ps(box.m_mins.y);
+    __m128 const maxX  = _mm_set1_ps(box.m_maxs.x);
+    __m128 const maxY  = _mm_set1_ps(box.m_maxs.y);
+    int          index = 0;
+
+    for (; index + 4 <= count; index += 4)
+    {
+        _mm_storeu_ps(outXs + index, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(xs + index), minX), maxX));
+        _mm_storeu_ps(outYs + index, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(ys + index), minY), maxY));
+    }
+
+    for (; index < count; ++index)
+    {
+        outXs[index] = ClampLikeSSE(xs[index], box.m_mins.x, box.m_maxs.x);
+        outYs[index] = ClampLikeSSE(ys[index], box.m_mins.y, box.m_maxs.y);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void GetPointsAtUVs(AABB2 const&     box,
+                    Vec2Array const& uvs,
+                    Vec2Array&       out_points)
+{
+    int const count = uvs.GetCount();
+    out_points.Resize(count);
+
+    sAABB2UVMapping const mapping(box);
+    float const*          us    = uvs.GetXs();
+    float const*          vs    = uvs.GetYs();
+    float*                outXs = out_points.GetXs();
+    float*                outYs = out_points.GetYs();
+
+    __m128 const minX   = _mm_set1_ps(mapping.m_mins.x);
+    __m128 const minY   = _mm_set1_ps(mapping.m_mins.y);
+    __m128 const width  = _mm_set1_ps(mapping.m_dimensions.x);
+    __m128 const height = _mm_set1_ps(mapping.m_dimensions.y);
+    int          index  = 0;
+
+    for (; index + 4 <= count; index += 4)
+    {
+        _mm_storeu_ps(outXs + index, _mm_add_ps(minX, _mm_mul_ps(_mm_loadu_ps(us + index), width)));
+        _mm_storeu_ps(outYs + index, _mm_add_ps(minY, _mm_mul_ps(_mm_loadu_ps(vs + index), height)));
+    }
+
+    for (; index < count; ++index)
+    {
+        Vec2 const point = mapping.GetPointAtUV(Vec2(us[index], vs[index]));
+        outXs[index]     = point.x;
+        outYs[index]     = point.y;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void GetUVsForPoints(AABB2 const&     box,
+                     Vec2Array const& points,
+                     Vec2Array&       out_uvs)
+{
+    int const count = points.GetCount();
+    out_uvs.Resize(count);
+
+    sAABB2UVMapping const mapping(box);
+    float const*          xs    = points.GetXs();
+    float const*          ys    = points.GetYs();
+    float*                outUs = out_uvs.GetXs();
+    float*                outVs = out_uvs.GetYs();
+
+    __m128 const minX          = _mm_set1_ps(mapping.m_mins.x);
+    __m128 const minY          = _mm_set1_ps(mapping.m_mins.y);
+    __m128 const inverseWidth  = _mm_set1_ps(mapping.m_inverseDimensions.x);
+    __m128 const inverseHeight = _mm_set1_ps(mapping.m_inverseDimensions.y);
+    int          index         = 0;
+
+    for (; index + 4 <= count; index += 4)
+    {
+        _mm_storeu_ps(outUs + index, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(xs + index), minX), inverseWidth));
+        _mm_storeu_ps(outVs + index, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(ys + index), minY), inverseHeight));
+    }
+
+    for (; index < count; ++index)
+    {
+        Vec2 const uv = mapping.GetUVForPoint(Vec2(xs[index], ys[index]));
+        outUs[index]  = uv.x;
+        outVs[index]  = uv.y;
+    }
+}
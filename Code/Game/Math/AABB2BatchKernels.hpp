@@ -0,0 +1,36 @@
+//----------------------------------------------------------------------------------------------------
+// AABB2BatchKernels.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include "Engine/Math/AABB2.hpp"
+
+class Vec2Array;
+
+//----------------------------------------------------------------------------------------------------
+// An AABB2 prepared for repeated UV mapping: the reciprocal of its dimensions is computed once,
+// so GetUVForPoint costs a subtract and a multiply instead of a divide.
+//
+// Results may differ from AABB2::GetUVForPoint in the last bit. A box with a zero dimension maps
+// points to inf/NaN along that axis, as the divide would.
+//
+struct sAABB2UVMapping
+{
+    explicit sAABB2UVMapping(AABB2 const& box);
+
+    Vec2 GetPointAtUV(Vec2 const& uv) const;
+    Vec2 GetUVForPoint(Vec2 const& point) const;
+
+    Vec2 m_mins;
+    Vec2 m_dimensions;
+    Vec2 m_inverseDimensions;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Batch versions of AABB2::GetNearestPoint, GetPointAtUV and GetUVForPoint over Vec2 SoA streams,
+// four points per SSE iteration. Outputs are resized to match the input and may alias it.
+//
+void GetNearestPoints(AABB2 const& box, Vec2Array const& points, Vec2Array& out_nearestPoints);
+void GetPointsAtUVs(AABB2 const& box, Vec2Array const& uvs, Vec2Array& out_points);
+void GetUVsForPoints(AABB2 const& box, Vec2Array const& points, Vec2Array& out_uvs);
@@ -0,0 +1,199 @@
+//----------------------------------------------------------------------------------------------------
+// AABB2BoundsReduction.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Math/AABB2BoundsReduction.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <xmmintrin.h>
+
+static_assert(sizeof(Vec2) == 2 * sizeof(float), "Bounds reduction loads Vec2 arrays as packed floats");
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // min(newValue, accumulator) keeps the accumulator on ties and on NaN, like StretchToIncludePoint.
+    //
+    void ReduceRangeSIMD(Vec2 const* points,
+                         size_t const numPoints,
+                         Vec2 const&  seed,
+                         Vec2&        out_mins,
+                         Vec2&        out_maxs)
+    {
+        float const* floats = reinterpret_cast<float const*>(points);
+        __m128 const seedXY = _mm_setr_ps(seed.x, seed.y, seed.x, seed.y);
+        __m128       minsA  = seedXY;
+        __m128       maxsA  = seedXY;
+        __m128       minsB  = seedXY;
+        __m128       maxsB  = seedXY;
+
+        size_t index = 0;
+
+        // Four points (two registers) per iteration, two independent accumulator chains
+        for (; index + 4 <= numPoints; index += 4)
+        {
+            __m128 const pairA = _mm_loadu_ps(floats + index * 2);
+            __m128 const pairB = _mm_loadu_ps(floats + index * 2 + 4);
+            minsA              = _mm_min_ps(pairA, minsA);
+            maxsA              = _mm_max_ps(pairA, maxsA);
+            minsB              = _mm_min_ps(pairB, minsB);
+            maxsB              = _mm_max_ps(pairB, maxsB);
+        }
+
+        minsA = _mm_min_ps(minsB, minsA);
+        maxsA = _mm_max_ps(maxsB, maxsA);
+
+        // Fold the odd lane pair (second point of each register) into the even one
+        __m128 const minsHigh = _mm_movehl_ps(minsA, minsA);
+        __m128 const maxsHigh = _mm_movehl_ps(maxsA, maxsA);
+        minsA                 = _mm_min_ps(minsHigh, minsA);
+        maxsA                 = _mm_max_ps(maxsHigh, maxsA);
+
+        alignas(16) float mins[4];
+        alignas(16) float maxs[4];
+        _mm_store_ps(mins, minsA);
+        _mm_store_ps(maxs, maxsA);
+
+        AABB2 tail(mins[0], mins[1], maxs[0], maxs[1]);
+
+        for (; index < numPoints; ++index)
+        {
+            tail.StretchToIncludePoint(points[index]);
+        }
+
+        out_mins = tail.m_mins;
+        out_maxs = tail.m_maxs;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // SIMD min/max picks the right value but not necessarily the first of two equal zeros (+0/-0).
+    // The scalar loop keeps the first occurrence, so when a bound lands on zero we look it up.
+    //
+    float FixSignOfZero(std::span<Vec2 const> const points,
+                        float const                 bound,
+                        bool const                  isYAxis)
+    {
+        if (bound != 0.0f)
+        {
+            return bound;
+        }
+
+        for (Vec2 const& point : points)
+        {
+            float const value = isYAxis ? point.y : point.x;
+
+            if (value == 0.0f)
+            {
+                return value;
+            }
+        }
+
+        return bound;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    AABB2 FinalizeBounds(std::span<Vec2 const> const points,
+                         Vec2 const&                 mins,
+                         Vec2 const&                 maxs)
+    {
+        return AABB2(FixSignOfZero(points, mins.x, false),
+                     FixSignOfZero(points, mins.y, true),
+                     FixSignOfZero(points, maxs.x, false),
+                     FixSignOfZero(points, maxs.y, true));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2 MakeAABB2BoundsOfScalar(std::span<Vec2 const> const points)
+{
+    if (points.empty())
+    {
+        return AABB2();
+    }
+
+    AABB2 bounds(points[0], points[0]);
+
+    for (Vec2 const& point : points)
+    {
+        bounds.StretchToIncludePoint(point);
+    }
+
+    return bounds;
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2 MakeAABB2BoundsOf(std::span<Vec2 const> const points)
+{
+    if (points.empty())
+    {
+        return AABB2();
+    }
+
+    Vec2 mins;
+    Vec2 maxs;
+    ReduceRangeSIMD(points.data(), points.size(), points[0], mins, maxs);
+
+    return FinalizeBounds(points, mins, maxs);
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2 MakeAABB2BoundsOfParallel(std::span<Vec2 const> const points,
+                                int                         numThreads)
+{
+    if (numThreads <= 0)
+    {
+        numThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+
+    size_t const maxUsefulThreads = points.size() / BOUNDS_REDUCTION_MIN_POINTS_PER_THREAD;
+    numThreads                    = static_cast<int>(std::min(static_cast<size_t>(numThreads), maxUsefulThreads));
+
+    if (numThreads <= 1)
+    {
+        return MakeAABB2BoundsOf(points);
+    }
+
+    // Every chunk is seeded with points[0] rather than its own first point, so a NaN at a chunk
+    // boundary is ignored exactly as the scalar loop would ignore it.
+    std::vector<Vec2>        chunkMins(numThreads);
+    std::vector<Vec2>        chunkMaxs(numThreads);
+    std::vector<std::thread> workers;
+    workers.reserve(numThreads - 1);
+
+    size_t const chunkSize = (points.size() + numThreads - 1) / numThreads;
+    Vec2 const   seed      = points[0];
+
+    auto const reduceChunk = [&](int const chunkIndex)
+    {
+        size_t const begin = chunkIndex * chunkSize;
+        size_t const end   = std::min(points.size(), begin + chunkSize);
+        ReduceRangeSIMD(points.data() + begin, end - begin, seed, chunkMins[chunkIndex], chunkMaxs[chunkIndex]);
+    };
+
+    for (int chunkIndex = 1; chunkIndex < numThreads; ++chunkIndex)
+    {
+        workers.emplace_back(reduceChunk, chunkIndex);
+    }
+
+    reduceChunk(0);
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    AABB2 bounds(chunkMins[0], chunkMaxs[0]);
+
+    for (int chunkIndex = 1; chunkIndex < numThreads; ++chunkIndex)
+    {
+        bounds.StretchToIncludePoint(chunkMins[chunkIndex]);
+        bounds.StretchToIncludePoint(chunkMaxs[chunkIndex]);
+    }
+
+    return FinalizeBounds(points, bounds.m_mins, bounds.m_maxs);
+}
@@ -0,0 +1,26 @@
+//----------------------------------------------------------------------------------------------------
+// AABB2BoundsReduction.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <span>
+
+#include "Engine/Math/AABB2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Bulk bounds of a point set.
+//
+// All three variants return exactly what this loop returns (bit for bit, including the sign of a
+// zero bound and NaNs that appear after the first point being ignored):
+//
+//     AABB2 bounds(points[0], points[0]);
+//     for (Vec2 const& point : points) bounds.StretchToIncludePoint(point);
+//
+// An empty span returns a default-constructed AABB2.
+//
+int constexpr BOUNDS_REDUCTION_MIN_POINTS_PER_THREAD = 1 << 18;
+
+AABB2 MakeAABB2BoundsOfScalar(std::span<Vec2 const> points);
+AABB2 MakeAABB2BoundsOf(std::span<Vec2 const> points);
+AABB2 MakeAABB2BoundsOfParallel(std::span<Vec2 const> points, int numThreads = 0);   // 0 = hardware concurrency
@@ -0,0 +1,426 @@
+//----------------------------------------------------------------------------------------------------
+// AABB2LooseQuadtree.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Math/AABB2LooseQuadtree.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    int constexpr MAX_SUPPORTED_DEPTH = 15;
+    int constexpr QUERY_STACK_SIZE    = 3 * MAX_SUPPORTED_DEPTH + 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2LooseQuadtree::AABB2LooseQuadtree(sLooseQuadtreeConfig const& config)
+    : m_config(config)
+{
+    m_config.m_maxDepth  = std::clamp(m_config.m_maxDepth, 0, MAX_SUPPORTED_DEPTH);
+    m_config.m_looseness = std::max(m_config.m_looseness, 1.0f);
+
+    Vec2 const worldDimensions = m_config.m_worldBounds.GetDimensions();
+    m_worldSize                = std::max(worldDimensions.x, worldDimensions.y);
+
+    Clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+int AABB2LooseQuadtree::Insert(AABB2 const& bounds)
+{
+    int objectID;
+
+    if (!m_freeObjects.empty())
+    {
+        objectID = m_freeObjects.back();
+        m_freeObjects.pop_back();
+    }
+    else
+    {
+        objectID = static_cast<int>(m_objects.size());
+        m_objects.emplace_back();
+    }
+
+    m_objects[objectID].m_bounds = bounds;
+    LinkObject(objectID, FindNodeFor(bounds));
+    ++m_numObjects;
+
+    return objectID;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2LooseQuadtree::Remove(int const objectID)
+{
+    int const nodeIndex = m_objects[objectID].m_node;
+
+    if (nodeIndex < 0)
+    {
+        return;
+    }
+
+    UnlinkObject(objectID);
+    FreeNodeIfEmpty(nodeIndex);
+    m_freeObjects.push_back(objectID);
+    --m_numObjects;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2LooseQuadtree::Update(int const    objectID,
+                                AABB2 const& bounds)
+{
+    sObject&  object       = m_objects[objectID];
+    int const oldNodeIndex = object.m_node;
+
+    if (oldNodeIndex < 0)
+    {
+        return;
+    }
+
+    object.m_bounds = bounds;
+
+    // Fast path: the object still belongs to the same cell at the same depth
+    int depth;
+    int cellX;
+    int cellY;
+    ComputeCell(bounds, depth, cellX, cellY);
+
+    sNode const& oldNode = m_nodes[oldNodeIndex];
+
+    if (oldNode.m_depth == depth && oldNode.m_cellX == cellX && oldNode.m_cellY == cellY)
+    {
+        return;
+    }
+
+    // Link into the new node before pruning the old one, so a shared path is not freed and rebuilt
+    UnlinkObject(objectID);
+    LinkObject(objectID, FindOrCreateNode(depth, cellX, cellY));
+    FreeNodeIfEmpty(oldNodeIndex);
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2LooseQuadtree::Clear()
+{
+    m_nodes.clear();
+    m_freeNodes.clear();
+    m_objects.clear();
+    m_freeObjects.clear();
+    m_numObjects = 0;
+
+    AllocateNode(-1, 0, 0, 0);
+}
+
+//----------------------------------------------------------------------------------------------------
+int AABB2LooseQuadtree::QueryBox(AABB2 const&         query,
+                                 std::span<int> const out_objectIDs) const
+{
+    return Query([&query](AABB2 const& bounds)
+    {
+        return
+            bounds.m_mins.x <= query.m_maxs.x && query.m_mins.x <= bounds.m_maxs.x &&
+            bounds.m_mins.y <= query.m_maxs.y && query.m_mins.y <= bounds.m_maxs.y;
+    }, out_objectIDs);
+}
+
+//----------------------------------------------------------------------------------------------------
+int AABB2LooseQuadtree::QueryPoint(Vec2 const&          point,
+                                   std::span<int> const out_objectIDs) const
+{
+    return Query([&point](AABB2 const& bounds)
+    {
+        return bounds.IsPointInside(point);
+    }, out_objectIDs);
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2 const& AABB2LooseQuadtree::GetObjectBounds(int const objectID) const
+{
+    return m_objects[objectID].m_bounds;
+}
+
+//----------------------------------------------------------------------------------------------------
+int AABB2LooseQuadtree::GetObjectDepth(int const objectID) const
+{
+    return m_nodes[m_objects[objectID].m_node].m_depth;
+}
+
+//----------------------------------------------------------------------------------------------------
+int AABB2LooseQuadtree::GetNumObjects() const
+{
+    return m_numObjects;
+}
+
+//----------------------------------------------------------------------------------------------------
+int AABB2LooseQuadtree::GetNumNodesInUse() const
+{
+    return static_cast<int>(m_nodes.size() - m_freeNodes.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+// A cell of size s at looseness k accepts any object whose center lies in the cell and whose
+// extent is at most (k - 1) * s, so the deepest valid depth is floor(log2((k - 1) * world / extent)).
+//
+int AABB2LooseQuadtree::GetInsertionDepth(AABB2 const& bounds) const
+{
+    Vec2 const  dimensions = bounds.GetDimensions();
+    float const extent     = std::max(dimensions.x, dimensions.y);
+    float const slack      = m_config.m_looseness - 1.0f;
+
+    if (slack <= 0.0f)
+    {
+        return 0;
+    }
+
+    if (extent <= 0.0f)
+    {
+        return m_config.m_maxDepth;
+    }
+
+    float const depth = std::floor(std::log2(slack * m_worldSize / extent));
+
+    return static_cast<int>(std::clamp(depth, 0.0f, static_cast<float>(m_config.m_maxDepth)));
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2LooseQuadtree::ComputeCell(AABB2 const& bounds,
+                                     int&         out_depth,
+                                     int&         out_cellX,
+                                     int&         out_cellY) const
+{
+    Vec2 const center = bounds.GetCenter();
+
+    // Rounding or objects outside the world can leave the box poking out of the loose cell; step
+    // up until it fits, ending at the root, which is never culled.
+    for (int depth = GetInsertionDepth(bounds); depth >= 0; --depth)
+    {
+        int const   numCells = 1 << depth;
+        float const cellSize = m_worldSize / static_cast<float>(numCells);
+        int const   cellX    = std::clamp(static_cast<int>(std::floor((center.x - m_config.m_worldBounds.m_mins.x) / cellSize)), 0, numCells - 1);
+        int const   cellY    = std::clamp(static_cast<int>(std::floor((center.y - m_config.m_worldBounds.m_mins.y) / cellSize)), 0, numCells - 1);
+
+        out_depth = depth;
+        out_cellX = cellX;
+        out_cellY = cellY;
+
+        if (depth == 0 || IsContainedIn(bounds, GetLooseCellBounds(depth, cellX, cellY)))
+        {
+            return;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+int AABB2LooseQuadtree::FindNodeFor(AABB2 const& bounds)
+{
+    int depth;
+    int cellX;
+    int cellY;
+    ComputeCell(bounds, depth, cellX, cellY);
+
+    return FindOrCreateNode(depth, cellX, cellY);
+}
+
+//----------------------------------------------------------------------------------------------------
+int AABB2LooseQuadtree::FindOrCreateNode(int const depth,
+                                         int const cellX,
+                                         int const cellY)
+{
+    int nodeIndex = 0;
+
+    for (int childDepth = 1; childDepth <= depth; ++childDepth)
+    {
+        int const shift      = depth - childDepth;
+        int const childCellX = cellX >> shift;
+        int const childCellY = cellY >> shift;
+        int const quadrant   = (childCellX & 1) | ((childCellY & 1) << 1);
+        int       childIndex = m_nodes[nodeIndex].m_children[quadrant];
+
+        if (childIndex < 0)
+        {
+            childIndex                              = AllocateNode(nodeIndex, childDepth, childCellX, childCellY);
+            m_nodes[nodeIndex].m_children[quadrant] = childIndex;
+            ++m_nodes[nodeIndex].m_numChildren;
+        }
+
+        nodeIndex = childIndex;
+    }
+
+    return nodeIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+int AABB2LooseQuadtree::AllocateNode(int const parent,
+                                     int const depth,
+                                     int const cellX,
+                                     int const cellY)
+{
+    int nodeIndex;
+
+    if (!m_freeNodes.empty())
+    {
+        nodeIndex = m_freeNodes.back();
+        m_freeNodes.pop_back();
+    }
+    else
+    {
+        nodeIndex = static_cast<int>(m_nodes.size());
+        m_nodes.emplace_back();
+    }
+
+    sNode& node        = m_nodes[nodeIndex];
+    node               = sNode();
+    node.m_looseBounds = GetLooseCellBounds(depth, cellX, cellY);
+    node.m_parent      = parent;
+    node.m_depth       = depth;
+    node.m_cellX       = cellX;
+    node.m_cellY       = cellY;
+
+    return nodeIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2LooseQuadtree::FreeNodeIfEmpty(int nodeIndex)
+{
+    // Never free the root
+    while (nodeIndex > 0)
+    {
+        sNode const& node = m_nodes[nodeIndex];
+
+        if (node.m_numObjects > 0 || node.m_numChildren > 0)
+        {
+            return;
+        }
+
+        int const parentIndex = node.m_parent;
+        sNode&    parent      = m_nodes[parentIndex];
+
+        for (int& child : parent.m_children)
+        {
+            if (child == nodeIndex)
+            {
+                child = -1;
+                --parent.m_numChildren;
+                break;
+            }
+        }
+
+        m_freeNodes.push_back(nodeIndex);
+        nodeIndex = parentIndex;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2LooseQuadtree::LinkObject(int const objectID,
+                                    int const nodeIndex)
+{
+    sObject& object = m_objects[objectID];
+    sNode&   node   = m_nodes[nodeIndex];
+
+    object.m_node = nodeIndex;
+    object.m_prev = -1;
+    object.m_next = node.m_firstObject;
+
+    if (node.m_firstObject >= 0)
+    {
+        m_objects[node.m_firstObject].m_prev = objectID;
+    }
+
+    node.m_firstObject = objectID;
+    ++node.m_numObjects;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2LooseQuadtree::UnlinkObject(int const objectID)
+{
+    sObject& object = m_objects[objectID];
+    sNode&   node   = m_nodes[object.m_node];
+
+    if (object.m_prev >= 0)
+    {
+        m_objects[object.m_prev].m_next = object.m_next;
+    }
+    else
+    {
+        node.m_firstObject = object.m_next;
+    }
+
+    if (object.m_next >= 0)
+    {
+        m_objects[object.m_next].m_prev = object.m_prev;
+    }
+
+    --node.m_numObjects;
+    object.m_node = -1;
+    object.m_prev = -1;
+    object.m_next = -1;
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2 AABB2LooseQuadtree::GetLooseCellBounds(int const depth,
+                                             int const cellX,
+                                             int const cellY) const
+{
+    float const cellSize = m_worldSize / static_cast<float>(1 << depth);
+    float const padding  = 0.5f * (m_config.m_looseness - 1.0f) * cellSize;
+    Vec2 const  cellMins = m_config.m_worldBounds.m_mins + Vec2(static_cast<float>(cellX) * cellSize, static_cast<float>(cellY) * cellSize);
+
+    return AABB2(cellMins.x - padding, cellMins.y - padding, cellMins.x + cellSize + padding, cellMins.y + cellSize + padding);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool AABB2LooseQuadtree::IsContainedIn(AABB2 const& bounds,
+                                       AABB2 const& container) const
+{
+    return
+        bounds.m_mins.x >= container.m_mins.x && bounds.m_maxs.x <= container.m_maxs.x &&
+        bounds.m_mins.y >= container.m_mins.y && bounds.m_maxs.y <= container.m_maxs.y;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename OverlapFunc>
+int AABB2LooseQuadtree::Query(OverlapFunc const&   overlapsBounds,
+                              std::span<int> const out_objectIDs) const
+{
+    int numHits   = 0;
+    int stack[QUERY_STACK_SIZE];
+    int stackSize = 0;
+
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0)
+    {
+        int const    nodeIndex = stack[--stackSize];
+        sNode const& node      = m_nodes[nodeIndex];
+
+        // The root holds out-of-world objects, so it is visited unconditionally
+        if (nodeIndex != 0 && !overlapsBounds(node.m_looseBounds))
+        {
+            continue;
+        }
+
+        for (int objectID = node.m_firstObject; objectID >= 0; objectID = m_objects[objectID].m_next)
+        {
+            if (overlapsBounds(m_objects[objectID].m_bounds))
+            {
+                if (numHits < static_cast<int>(out_objectIDs.size()))
+                {
+                    out_objectIDs[numHits] = objectID;
+                }
+
+                ++numHits;
+            }
+        }
+
+        for (int const child : node.m_children)
+        {
+            if (child >= 0)
+            {
+                stack[stackSize++] = child;
+            }
+        }
+    }
+
+    return numHits;
+}
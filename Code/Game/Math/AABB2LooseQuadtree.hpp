@@ -0,0 +1,93 @@
+//----------------------------------------------------------------------------------------------------
+// AABB2LooseQuadtree.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <span>
+#include <vector>
+
+#include "Engine/Math/AABB2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+struct sLooseQuadtreeConfig
+{
+    AABB2 m_worldBounds = AABB2(0.f, 0.f, 1024.f, 1024.f);
+    int   m_maxDepth    = 8;        // Root is depth 0; clamped to [0, 15]
+    float m_looseness   = 2.0f;     // Loose cell size = looseness * cell size; must be > 1
+};
+
+//----------------------------------------------------------------------------------------------------
+// Loose quadtree for dynamic AABB2s.
+//
+// Each object lives in exactly one node, chosen by its center and its size: the depth comes
+// straight from the box's largest extent (one log2, no descent), so re-inserting a moved object
+// costs O(1) when it stays in its cell and O(depth) at worst when a new path must be created.
+// Nodes come from a pool with a free list and are returned to it when they empty out.
+// Objects that stick out of the world bounds are kept at the root, which queries always visit.
+//
+// Queries write object IDs into a caller-provided span and return the total number of hits,
+// which may be larger than the span when it was too small.
+//
+class AABB2LooseQuadtree
+{
+public:
+    explicit AABB2LooseQuadtree(sLooseQuadtreeConfig const& config);
+
+    int  Insert(AABB2 const& bounds);
+    void Remove(int objectID);
+    void Update(int objectID, AABB2 const& bounds);
+    void Clear();
+
+    int QueryBox(AABB2 const& query, std::span<int> out_objectIDs) const;
+    int QueryPoint(Vec2 const& point, std::span<int> out_objectIDs) const;
+
+    AABB2 const& GetObjectBounds(int objectID) const;
+    int          GetObjectDepth(int objectID) const;
+    int          GetNumObjects() const;
+    int          GetNumNodesInUse() const;
+    int          GetInsertionDepth(AABB2 const& bounds) const;
+
+private:
+    struct sNode
+    {
+        AABB2 m_looseBounds;
+        int   m_children[4] = {-1, -1, -1, -1};
+        int   m_parent      = -1;
+        int   m_firstObject = -1;
+        int   m_numObjects  = 0;
+        int   m_numChildren = 0;
+        int   m_depth       = 0;
+        int   m_cellX       = 0;
+        int   m_cellY       = 0;
+    };
+
+    struct sObject
+    {
+        AABB2 m_bounds;
+        int   m_node = -1;      // -1 when the ID is free
+        int   m_prev = -1;      // Intrusive list of objects within a node
+        int   m_next = -1;
+    };
+
+    void  ComputeCell(AABB2 const& bounds, int& out_depth, int& out_cellX, int& out_cellY) const;
+    int   FindNodeFor(AABB2 const& bounds);
+    int   FindOrCreateNode(int depth, int cellX, int cellY);
+    int   AllocateNode(int parent, int depth, int cellX, int cellY);
+    void  FreeNodeIfEmpty(int nodeIndex);
+    void  LinkObject(int objectID, int nodeIndex);
+    void  UnlinkObject(int objectID);
+    AABB2 GetLooseCellBounds(int depth, int cellX, int cellY) const;
+    bool  IsContainedIn(AABB2 const& bounds, AABB2 const& container) const;
+
+    template <typename OverlapFunc>
+    int Query(OverlapFunc const& overlapsBounds, std::span<int> out_objectIDs) const;
+
+    sLooseQuadtreeConfig m_config;
+    float                m_worldSize  = 0.f;     // Largest world extent; cells are square
+    std::vector<sNode>   m_nodes;
+    std::vector<int>     m_freeNodes;
+    std::vector<sObject> m_objects;
+    std::vector<int>     m_freeObjects;
+    int                  m_numObjects = 0;
+};
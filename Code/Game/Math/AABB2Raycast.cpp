@@ -0,0 +1,413 @@
+//----------------------------------------------------------------------------------------------------
+// AABB2Raycast.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Math/AABB2Raycast.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <emmintrin.h>
+#include <limits>
+
+#include "Game/Math/AABB2Array.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    float constexpr INFINITY_F = std::numeric_limits<float>::infinity();
+
+    //------------------------------------------------------------------------------------------------
+    // Branch-free lane select: mask ? a : b
+    __m128 Select(__m128 const mask,
+                  __m128 const a,
+                  __m128 const b)
+    {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Ray terms broadcast across four lanes, shared by every group of four boxes
+    struct sRay4
+    {
+        __m128 m_startX;
+        __m128 m_startY;
+        __m128 m_inverseX;
+        __m128 m_inverseY;
+        __m128 m_isParallelX;
+        __m128 m_isParallelY;
+        __m128 m_maxDistance;
+    };
+
+    //------------------------------------------------------------------------------------------------
+    sRay4 MakeRay4(Vec2 const& startPos,
+                   Vec2 const& fwdNormal,
+                   float const maxDistance)
+    {
+        __m128 const zero = _mm_setzero_ps();
+        __m128 const fwdX = _mm_set1_ps(fwdNormal.x);
+        __m128 const fwdY = _mm_set1_ps(fwdNormal.y);
+
+        // 1/0 gives inf in parallel lanes; those lanes are replaced by the inside test below
+        return
+        {
+            _mm_set1_ps(startPos.x),
+            _mm_set1_ps(startPos.y),
+            _mm_div_ps(_mm_set1_ps(1.f), fwdX),
+            _mm_div_ps(_mm_set1_ps(1.f), fwdY),
+            _mm_cmpeq_ps(fwdX, zero),
+            _mm_cmpeq_ps(fwdY, zero),
+            _mm_set1_ps(maxDistance),
+        };
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // One slab: entry and exit distances of the ray against [mins, maxs] along one axis.
+    // A parallel ray is inside the slab for all t or for none.
+    void ComputeSlab4(__m128 const start,
+                      __m128 const inverse,
+                      __m128 const isParallel,
+                      __m128 const mins,
+                      __m128 const maxs,
+                      __m128&      out_near,
+                      __m128&      out_far)
+    {
+        __m128 const tMins = _mm_mul_ps(_mm_sub_ps(mins, start), inverse);
+        __m128 const tMaxs = _mm_mul_ps(_mm_sub_ps(maxs, start), inverse);
+
+        __m128 const isInside     = _mm_and_ps(_mm_cmpge_ps(start, mins), _mm_cmple_ps(start, maxs));
+        __m128 const negativeInf  = _mm_set1_ps(-INFINITY_F);
+        __m128 const positiveInf  = _mm_set1_ps(INFINITY_F);
+        __m128 const parallelNear = Select(isInside, negativeInf, positiveInf);
+        __m128 const parallelFar  = Select(isInside, positiveInf, negativeInf);
+
+        out_near = Select(isParallel, parallelNear, _mm_min_ps(tMins, tMaxs));
+        out_far  = Select(isParallel, parallelFar, _mm_max_ps(tMins, tMaxs));
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Returns the hit mask; out_enter is the unclamped entry distance
+    __m128 SlabTest4(sRay4 const& ray,
+                     __m128 const minX,
+                     __m128 const minY,
+                     __m128 const maxX,
+                     __m128 const maxY,
+                     __m128&      out_nearX,
+                     __m128&      out_nearY,
+                     __m128&      out_enter)
+    {
+        __m128 farX;
+        __m128 farY;
+        ComputeSlab4(ray.m_startX, ray.m_inverseX, ray.m_isParallelX, minX, maxX, out_nearX, farX);
+        ComputeSlab4(ray.m_startY, ray.m_inverseY, ray.m_isParallelY, minY, maxY, out_nearY, farY);
+
+        out_enter         = _mm_max_ps(out_nearX, out_nearY);
+        __m128 const exit = _mm_min_ps(farX, farY);
+
+        return _mm_and_ps(_mm_and_ps(_mm_cmple_ps(out_enter, exit), _mm_cmpge_ps(exit, _mm_setzero_ps())),
+                          _mm_cmple_ps(out_enter, ray.m_maxDistance));
+    }
+
+    //------------------------------------------------------------------------------------------------
+    sAABB2RaycastResult MakeMissResult(Vec2 const& startPos,
+                                       Vec2 const& fwdNormal,
+                                       float const maxDistance)
+    {
+        sAABB2RaycastResult result;
+        result.m_impactDistance = maxDistance;
+        result.m_impactPosition = startPos + fwdNormal * maxDistance;
+        result.m_impactNormal   = Vec2(0.f, 0.f);
+
+        return result;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    sAABB2RaycastResult MakeHitResult(Vec2 const& startPos,
+                                      Vec2 const& fwdNormal,
+                                      float const enter,
+                                      float const nearX,
+                                      float const nearY)
+    {
+        sAABB2RaycastResult result;
+        result.m_didImpact = true;
+
+        if (enter < 0.f)
+        {
+            result.m_impactDistance = 0.f;
+            result.m_impactPosition = startPos;
+            result.m_impactNormal   = -fwdNormal;
+
+            return result;
+        }
+
+        result.m_impactDistance = enter;
+        result.m_impactPosition = startPos + fwdNormal * enter;
+        result.m_impactNormal   = (nearX >= nearY) ? Vec2(fwdNormal.x > 0.f ? -1.f : 1.f, 0.f)
+                                                   : Vec2(0.f, fwdNormal.y > 0.f ? -1.f : 1.f);
+
+        return result;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void GetSegmentRay(Vec2 const& startPos,
+                       Vec2 const& endPos,
+                       Vec2&       out_fwdNormal,
+                       float&      out_length)
+    {
+        Vec2 const displacement = endPos - startPos;
+        out_length              = displacement.GetLength();
+        out_fwdNormal           = (out_length > 0.f) ? displacement / out_length : Vec2(0.f, 0.f);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Single box: lanes hold [minX, minY, maxX, maxY], so both slabs are computed in one pass
+//
+sAABB2RaycastResult RaycastVsAABB2(Vec2 const&  startPos,
+                                   Vec2 const&  fwdNormal,
+                                   float const  maxDistance,
+                                   AABB2 const& box)
+{
+    __m128 const bounds     = _mm_setr_ps(box.m_mins.x, box.m_mins.y, box.m_maxs.x, box.m_maxs.y);
+    __m128 const start      = _mm_setr_ps(startPos.x, startPos.y, startPos.x, startPos.y);
+    __m128 const fwd        = _mm_setr_ps(fwdNormal.x, fwdNormal.y, fwdNormal.x, fwdNormal.y);
+    __m128 const isParallel = _mm_cmpeq_ps(fwd, _mm_setzero_ps());
+
+    // [tMinX, tMinY, tMaxX, tMaxY] against its half-swapped copy gives near and far in every lane pair
+    __m128 const t        = _mm_mul_ps(_mm_sub_ps(bounds, start), _mm_div_ps(_mm_set1_ps(1.f), fwd));
+    __m128 const tSwapped = _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 0, 3, 2));
+
+    __m128 const boundsSwapped = _mm_shuffle_ps(bounds, bounds, _MM_SHUFFLE(1, 0, 3, 2));
+    __m128 const isInside      = _mm_and_ps(_mm_cmpge_ps(start, bounds), _mm_cmple_ps(start, boundsSwapped));
+    __m128 const negativeInf   = _mm_set1_ps(-INFINITY_F);
+    __m128 const positiveInf   = _mm_set1_ps(INFINITY_F);
+
+    __m128 const nearXY = Select(isParallel, Select(isInside, negativeInf, positiveInf), _mm_min_ps(t, tSwapped));
+    __m128 const farXY  = Select(isParallel, Select(isInside, positiveInf, negativeInf), _mm_max_ps(t, tSwapped));
+
+    float const nearX = _mm_cvtss_f32(nearXY);
+    float const nearY = _mm_cvtss_f32(_mm_shuffle_ps(nearXY, nearXY, _MM_SHUFFLE(1, 1, 1, 1)));
+    float const enter = _mm_cvtss_f32(_mm_max_ss(nearXY, _mm_shuffle_ps(nearXY, nearXY, _MM_SHUFFLE(1, 1, 1, 1))));
+    float const exit  = _mm_cvtss_f32(_mm_min_ss(farXY, _mm_shuffle_ps(farXY, farXY, _MM_SHUFFLE(1, 1, 1, 1))));
+
+    if (enter <= exit && exit >= 0.f && enter <= maxDistance)
+    {
+        return MakeHitResult(startPos, fwdNormal, enter, nearX, nearY);
+    }
+
+    return MakeMissResult(startPos, fwdNormal, maxDistance);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Straightforward per-axis reference, kept for validating the SIMD paths
+//
+sAABB2RaycastResult RaycastVsAABB2Scalar(Vec2 const&  startPos,
+                                         Vec2 const&  fwdNormal,
+                                         float const  maxDistance,
+                                         AABB2 const& box)
+{
+    float near[2];
+    float far[2];
+
+    float const starts[2] = {startPos.x, startPos.y};
+    float const fwds[2]   = {fwdNormal.x, fwdNormal.y};
+    float const mins[2]   = {box.m_mins.x, box.m_mins.y};
+    float const maxs[2]   = {box.m_maxs.x, box.m_maxs.y};
+
+    for (int axis = 0; axis < 2; ++axis)
+    {
+        if (fwds[axis] == 0.f)
+        {
+            bool const isInside = starts[axis] >= mins[axis] && starts[axis] <= maxs[axis];
+            near[axis]          = isInside ? -INFINITY_F : INFINITY_F;
+            far[axis]           = isInside ? INFINITY_F : -INFINITY_F;
+            continue;
+        }
+
+        float const inverse = 1.f / fwds[axis];
+        float const tMin    = (mins[axis] - starts[axis]) * inverse;
+        float const tMax    = (maxs[axis] - starts[axis]) * inverse;
+        near[axis]          = std::min(tMin, tMax);
+        far[axis]           = std::max(tMin, tMax);
+    }
+
+    float const enter = std::max(near[0], near[1]);
+    float const exit  = std::min(far[0], far[1]);
+
+    if (enter > exit || exit < 0.f || enter > maxDistance)
+    {
+        return MakeMissResult(startPos, fwdNormal, maxDistance);
+    }
+
+    return MakeHitResult(startPos, fwdNormal, enter, near[0], near[1]);
+}
+
+//----------------------------------------------------------------------------------------------------
+sAABB2RaycastResult SegmentCastVsAABB2(Vec2 const&  startPos,
+                                       Vec2 const&  endPos,
+                                       AABB2 const& box)
+{
+    Vec2  fwdNormal;
+    float length;
+    GetSegmentRay(startPos, endPos, fwdNormal, length);
+
+    return RaycastVsAABB2(startPos, fwdNormal, length, box);
+}
+
+//----------------------------------------------------------------------------------------------------
+int RaycastVsAABB2s(Vec2 const&          startPos,
+                    Vec2 const&          fwdNormal,
+                    float const          maxDistance,
+                    AABB2Array const&    boxes,
+                    sAABB2RaycastResult* out_results)
+{
+    sRay4 const  ray     = MakeRay4(startPos, fwdNormal, maxDistance);
+    float const* minXs   = boxes.GetMinXs();
+    float const* minYs   = boxes.GetMinYs();
+    float const* maxXs   = boxes.GetMaxXs();
+    float const* maxYs   = boxes.GetMaxYs();
+    int const    count   = boxes.GetCount();
+    int          numHits = 0;
+    int          index   = 0;
+
+    for (; index + 4 <= count; index += 4)
+    {
+        __m128 nearX;
+        __m128 nearY;
+        __m128 enter;
+        __m128 const hitMask = SlabTest4(ray, _mm_loadu_ps(minXs + index), _mm_loadu_ps(minYs + index),
+                                         _mm_loadu_ps(maxXs + index), _mm_loadu_ps(maxYs + index), nearX, nearY, enter);
+        int const    hits    = _mm_movemask_ps(hitMask);
+
+        if (hits == 0)
+        {
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                out_results[index + lane] = MakeMissResult(startPos, fwdNormal, maxDistance);
+            }
+
+            continue;
+        }
+
+        alignas(16) float nearXs[4];
+        alignas(16) float nearYs[4];
+        alignas(16) float enters[4];
+        _mm_store_ps(nearXs, nearX);
+        _mm_store_ps(nearYs, nearY);
+        _mm_store_ps(enters, enter);
+
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            out_results[index + lane] = ((hits >> lane) & 1) ? MakeHitResult(startPos, fwdNormal, enters[lane], nearXs[lane], nearYs[lane])
+                                                             : MakeMissResult(startPos, fwdNormal, maxDistance);
+        }
+
+        numHits += std::popcount(static_cast<unsigned int>(hits));
+    }
+
+    for (; index < count; ++index)
+    {
+        out_results[index] = RaycastVsAABB2(startPos, fwdNormal, maxDistance, boxes.Get(index));
+        numHits += out_results[index].m_didImpact ? 1 : 0;
+    }
+
+    return numHits;
+}
+
+//----------------------------------------------------------------------------------------------------
+int SegmentCastVsAABB2s(Vec2 const&          startPos,
+                        Vec2 const&          endPos,
+                        AABB2Array const&    boxes,
+                        sAABB2RaycastResult* out_results)
+{
+    Vec2  fwdNormal;
+    float length;
+    GetSegmentRay(startPos, endPos, fwdNormal, length);
+
+    return RaycastVsAABB2s(startPos, fwdNormal, length, boxes, out_results);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Tracks the nearest entry distance and its box index per lane, then reduces across lanes once.
+// Only the winning box is turned into a full result.
+//
+int RaycastVsAABB2sClosest(Vec2 const&          startPos,
+                           Vec2 const&          fwdNormal,
+                           float const          maxDistance,
+                           AABB2Array const&    boxes,
+                           sAABB2RaycastResult& out_result)
+{
+    sRay4 const  ray          = MakeRay4(startPos, fwdNormal, maxDistance);
+    float const* minXs        = boxes.GetMinXs();
+    float const* minYs        = boxes.GetMinYs();
+    float const* maxXs        = boxes.GetMaxXs();
+    float const* maxYs        = boxes.GetMaxYs();
+    int const    count        = boxes.GetCount();
+    __m128       bestDistance = _mm_set1_ps(INFINITY_F);
+    __m128i      bestIndex    = _mm_set1_epi32(-1);
+    __m128i      laneIndex    = _mm_setr_epi32(0, 1, 2, 3);
+    int          index        = 0;
+
+    for (; index + 4 <= count; index += 4)
+    {
+        __m128 nearX;
+        __m128 nearY;
+        __m128 enter;
+        __m128 const hitMask  = SlabTest4(ray, _mm_loadu_ps(minXs + index), _mm_loadu_ps(minYs + index),
+                                          _mm_loadu_ps(maxXs + index), _mm_loadu_ps(maxYs + index), nearX, nearY, enter);
+        __m128 const distance = _mm_max_ps(enter, _mm_setzero_ps());
+        __m128 const isCloser = _mm_and_ps(hitMask, _mm_cmplt_ps(distance, bestDistance));
+
+        bestDistance = Select(isCloser, distance, bestDistance);
+        bestIndex    = _mm_castps_si128(Select(isCloser, _mm_castsi128_ps(laneIndex), _mm_castsi128_ps(bestIndex)));
+        laneIndex    = _mm_add_epi32(laneIndex, _mm_set1_epi32(4));
+    }
+
+    alignas(16) float bestDistances[4];
+    alignas(16) int   bestIndices[4];
+    _mm_store_ps(bestDistances, bestDistance);
+    _mm_store_si128(reinterpret_cast<__m128i*>(bestIndices), bestIndex);
+
+    float closestDistance = INFINITY_F;
+    int   closestIndex    = -1;
+
+    // Ties go to the lowest index so the result does not depend on lane layout
+    for (int lane = 0; lane < 4; ++lane)
+    {
+        if (bestIndices[lane] >= 0 &&
+            (bestDistances[lane] < closestDistance || (bestDistances[lane] == closestDistance && bestIndices[lane] < closestIndex)))
+        {
+            closestDistance = bestDistances[lane];
+            closestIndex    = bestIndices[lane];
+        }
+    }
+
+    for (; index < count; ++index)
+    {
+        sAABB2RaycastResult const result = RaycastVsAABB2(startPos, fwdNormal, maxDistance, boxes.Get(index));
+
+        if (result.m_didImpact && result.m_impactDistance < closestDistance)
+        {
+            closestDistance = result.m_impactDistance;
+            closestIndex    = index;
+        }
+    }
+
+    out_result = (closestIndex >= 0) ? RaycastVsAABB2(startPos, fwdNormal, maxDistance, boxes.Get(closestIndex))
+                                     : MakeMissResult(startPos, fwdNormal, maxDistance);
+
+    return closestIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+int SegmentCastVsAABB2sClosest(Vec2 const&          startPos,
+                               Vec2 const&          endPos,
+                               AABB2Array const&    boxes,
+                               sAABB2RaycastResult& out_result)
+{
+    Vec2  fwdNormal;
+    float length;
+    GetSegmentRay(startPos, endPos, fwdNormal, length);
+
+    return RaycastVsAABB2sClosest(startPos, fwdNormal, length, boxes, out_result);
+}
@@ -0,0 +1,43 @@
+//----------------------------------------------------------------------------------------------------
+// AABB2Raycast.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include "Engine/Math/AABB2.hpp"
+
+class AABB2Array;
+
+//----------------------------------------------------------------------------------------------------
+struct sAABB2RaycastResult
+{
+    bool  m_didImpact      = false;
+    float m_impactDistance = 0.f;       // Entry distance along the ray; maxDistance on a miss
+    Vec2  m_impactPosition;
+    Vec2  m_impactNormal;               // Outward face normal; -fwd when the ray starts inside
+};
+
+//----------------------------------------------------------------------------------------------------
+// Slab-method ray and segment casts against AABB2s.
+//
+// Boxes are closed: grazing an edge or corner counts as a hit. A ray starting inside a box hits it
+// at distance 0. Axis-parallel rays (a zero direction component, including -0) are handled
+// explicitly instead of relying on 0 * inf, so rays lying exactly on a box edge still hit it.
+// When entry distances tie on both axes (a corner hit), the X face normal is reported.
+//
+// fwdNormal is expected to be unit length; distances are measured in units of it.
+//
+sAABB2RaycastResult RaycastVsAABB2(Vec2 const& startPos, Vec2 const& fwdNormal, float maxDistance, AABB2 const& box);
+sAABB2RaycastResult RaycastVsAABB2Scalar(Vec2 const& startPos, Vec2 const& fwdNormal, float maxDistance, AABB2 const& box);
+sAABB2RaycastResult SegmentCastVsAABB2(Vec2 const& startPos, Vec2 const& endPos, AABB2 const& box);
+
+//----------------------------------------------------------------------------------------------------
+// Batch casts over an AABB2Array, four boxes per SSE iteration.
+//
+// The per-box versions fill out_results (which must hold boxes.GetCount() entries) and return the
+// number of hits. The closest-hit versions return the index of the nearest box, or -1 on a miss.
+//
+int RaycastVsAABB2s(Vec2 const& startPos, Vec2 const& fwdNormal, float maxDistance, AABB2Array const& boxes, sAABB2RaycastResult* out_results);
+int SegmentCastVsAABB2s(Vec2 const& startPos, Vec2 const& endPos, AABB2Array const& boxes, sAABB2RaycastResult* out_results);
+int RaycastVsAABB2sClosest(Vec2 const& startPos, Vec2 const& fwdNormal, float maxDistance, AABB2Array const& boxes, sAABB2RaycastResult& out_result);
+int SegmentCastVsAABB2sClosest(Vec2 const& startPos, Vec2 const& endPos, AABB2Array const& boxes, sAABB2RaycastResult& out_result);
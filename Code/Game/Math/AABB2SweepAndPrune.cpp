@@ -0,0 +1,416 @@
+//----------------------------------------------------------------------------------------------------
+// AABB2SweepAndPrune.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Math/AABB2SweepAndPrune.hpp"
+
+#include <algorithm>
+#include <limits>
+
+//----------------------------------------------------------------------------------------------------
+int AABB2SweepAndPrune::AddProxy(AABB2 const& bounds)
+{
+    int proxyID;
+
+    if (!m_freeProxyIDs.empty())
+    {
+        proxyID = m_freeProxyIDs.back();
+        m_freeProxyIDs.pop_back();
+    }
+    else
+    {
+        proxyID = static_cast<int>(m_proxies.size());
+        m_proxies.emplace_back();
+    }
+
+    sProxy& proxy        = m_proxies[proxyID];
+    proxy.m_bounds       = bounds;
+    proxy.m_targetBounds = bounds;
+    proxy.m_isActive     = true;
+    ++m_numActiveProxies;
+
+    // Append both endpoints at the far end of each axis, then sift them into place; the swaps
+    // generate the new proxy's overlap pairs exactly as if it had moved in from infinity.
+    for (int axis = 0; axis < 2; ++axis)
+    {
+        std::vector<sEndpoint>& endpoints = m_endpoints[axis];
+
+        for (int isMax = 0; isMax < 2; ++isMax)
+        {
+            sEndpoint endpoint;
+            endpoint.m_value         = GetBoundsValue(bounds, axis, isMax != 0);
+            endpoint.m_proxyAndIsMax = (static_cast<uint32_t>(proxyID) << 1) | static_cast<uint32_t>(isMax);
+
+            proxy.m_endpointIndex[axis][isMax] = static_cast<int>(endpoints.size());
+            endpoints.push_back(endpoint);
+        }
+
+        SiftLeft(axis, proxy.m_endpointIndex[axis][0]);
+        SiftLeft(axis, proxy.m_endpointIndex[axis][1]);
+    }
+
+    return proxyID;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2SweepAndPrune::RemoveProxy(int const proxyID)
+{
+    sProxy& proxy = m_proxies[proxyID];
+
+    if (!proxy.m_isActive)
+    {
+        return;
+    }
+
+    // Push the proxy out to +infinity so the swaps remove all of its pairs, then cut its endpoints.
+    float constexpr infinity = std::numeric_limits<float>::infinity();
+    proxy.m_bounds           = AABB2(infinity, infinity, infinity, infinity);
+
+    for (int axis = 0; axis < 2; ++axis)
+    {
+        std::vector<sEndpoint>& endpoints = m_endpoints[axis];
+
+        endpoints[proxy.m_endpointIndex[axis][1]].m_value = infinity;
+        SiftRight(axis, proxy.m_endpointIndex[axis][1]);
+        endpoints[proxy.m_endpointIndex[axis][0]].m_value = infinity;
+        SiftRight(axis, proxy.m_endpointIndex[axis][0]);
+
+        int const firstIndex = std::min(proxy.m_endpointIndex[axis][0], proxy.m_endpointIndex[axis][1]);
+        int       writeIndex = firstIndex;
+
+        for (int readIndex = firstIndex; readIndex < static_cast<int>(endpoints.size()); ++readIndex)
+        {
+            sEndpoint const& endpoint = endpoints[readIndex];
+
+            if (endpoint.GetProxyID() == proxyID)
+            {
+                continue;
+            }
+
+            endpoints[writeIndex]                                                        = endpoint;
+            m_proxies[endpoint.GetProxyID()].m_endpointIndex[axis][endpoint.IsMax() ? 1 : 0] = writeIndex;
+            ++writeIndex;
+        }
+
+        endpoints.resize(writeIndex);
+        proxy.m_endpointIndex[axis][0] = -1;
+        proxy.m_endpointIndex[axis][1] = -1;
+    }
+
+    proxy.m_isActive = false;
+    --m_numActiveProxies;
+    m_pendingFreeProxyIDs.push_back(proxyID);
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2SweepAndPrune::SetProxyBounds(int const    proxyID,
+                                        AABB2 const& bounds)
+{
+    m_proxies[proxyID].m_targetBounds = bounds;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2SweepAndPrune::Update()
+{
+    // Commit every target bounds first, so overlap checks during the sort see the final boxes.
+    for (sProxy& proxy : m_proxies)
+    {
+        if (proxy.m_isActive)
+        {
+            proxy.m_bounds = proxy.m_targetBounds;
+        }
+    }
+
+    for (int axis = 0; axis < 2; ++axis)
+    {
+        for (sEndpoint& endpoint : m_endpoints[axis])
+        {
+            endpoint.m_value = GetBoundsValue(m_proxies[endpoint.GetProxyID()].m_bounds, axis, endpoint.IsMax());
+        }
+
+        int const numEndpoints = static_cast<int>(m_endpoints[axis].size());
+
+        for (int index = 1; index < numEndpoints; ++index)
+        {
+            SiftLeft(axis, index);
+        }
+    }
+
+    FlushEvents();
+
+    m_freeProxyIDs.insert(m_freeProxyIDs.end(), m_pendingFreeProxyIDs.begin(), m_pendingFreeProxyIDs.end());
+    m_pendingFreeProxyIDs.clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2SweepAndPrune::Clear()
+{
+    m_proxies.clear();
+    m_endpoints[0].clear();
+    m_endpoints[1].clear();
+    m_freeProxyIDs.clear();
+    m_pendingFreeProxyIDs.clear();
+    m_pairs.clear();
+    m_toggledPairs.clear();
+    m_addedPairs.clear();
+    m_removedPairs.clear();
+    m_numActiveProxies = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2 const& AABB2SweepAndPrune::GetProxyBounds(int const proxyID) const
+{
+    return m_proxies[proxyID].m_targetBounds;
+}
+
+//----------------------------------------------------------------------------------------------------
+int AABB2SweepAndPrune::GetNumProxies() const
+{
+    return m_numActiveProxies;
+}
+
+//----------------------------------------------------------------------------------------------------
+int AABB2SweepAndPrune::GetNumOverlapPairs() const
+{
+    return static_cast<int>(m_pairs.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+bool AABB2SweepAndPrune::IsOverlapping(int const proxyA,
+                                       int const proxyB) const
+{
+    return m_pairs.contains(MakePairKey(proxyA, proxyB));
+}
+
+//----------------------------------------------------------------------------------------------------
+std::vector<sOverlapPair> const& AABB2SweepAndPrune::GetAddedPairs() const
+{
+    return m_addedPairs;
+}
+
+//----------------------------------------------------------------------------------------------------
+std::vector<sOverlapPair> const& AABB2SweepAndPrune::GetRemovedPairs() const
+{
+    return m_removedPairs;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2SweepAndPrune::GetOverlapPairs(std::vector<sOverlapPair>& out_pairs) const
+{
+    out_pairs.clear();
+    out_pairs.reserve(m_pairs.size());
+
+    for (uint64_t const key : m_pairs)
+    {
+        out_pairs.push_back({static_cast<int>(key >> 32), static_cast<int>(key & 0xFFFFFFFFu)});
+    }
+
+    std::sort(out_pairs.begin(), out_pairs.end(), [](sOverlapPair const& a, sOverlapPair const& b)
+    {
+        return (a.m_proxyA != b.m_proxyA) ? (a.m_proxyA < b.m_proxyA) : (a.m_proxyB < b.m_proxyB);
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2SweepAndPrune::FindOverlapPairsSortAndSweep(std::vector<AABB2> const& boxes,
+                                                      std::vector<sOverlapPair>& out_pairs)
+{
+    out_pairs.clear();
+
+    std::vector<int> order(boxes.size());
+
+    for (int index = 0; index < static_cast<int>(boxes.size()); ++index)
+    {
+        order[index] = index;
+    }
+
+    std::sort(order.begin(), order.end(), [&boxes](int const a, int const b)
+    {
+        return boxes[a].m_mins.x < boxes[b].m_mins.x;
+    });
+
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        AABB2 const& boxA = boxes[order[i]];
+
+        for (size_t j = i + 1; j < order.size(); ++j)
+        {
+            AABB2 const& boxB = boxes[order[j]];
+
+            if (boxB.m_mins.x > boxA.m_maxs.x)
+            {
+                break;
+            }
+
+            if (boxB.m_mins.y <= boxA.m_maxs.y && boxA.m_mins.y <= boxB.m_maxs.y)
+            {
+                out_pairs.push_back({std::min(order[i], order[j]), std::max(order[i], order[j])});
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+uint64_t AABB2SweepAndPrune::MakePairKey(int const proxyA,
+                                         int const proxyB)
+{
+    uint64_t const low  = static_cast<uint32_t>(std::min(proxyA, proxyB));
+    uint64_t const high = static_cast<uint32_t>(std::max(proxyA, proxyB));
+
+    return (low << 32) | high;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Mins sort before maxs at equal values, so touching boxes count as overlapping (matching the
+// inclusive AABB2::IsPointInside).
+//
+bool AABB2SweepAndPrune::IsEndpointLess(sEndpoint const& a,
+                                        sEndpoint const& b)
+{
+    if (a.m_value != b.m_value)
+    {
+        return a.m_value < b.m_value;
+    }
+
+    return !a.IsMax() && b.IsMax();
+}
+
+//----------------------------------------------------------------------------------------------------
+float AABB2SweepAndPrune::GetBoundsValue(AABB2 const& bounds,
+                                         int const    axis,
+                                         bool const   isMax)
+{
+    Vec2 const& corner = isMax ? bounds.m_maxs : bounds.m_mins;
+
+    return (axis == 0) ? corner.x : corner.y;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool AABB2SweepAndPrune::DoBoundsOverlap(AABB2 const& a,
+                                         AABB2 const& b)
+{
+    return
+        a.m_mins.x <= b.m_maxs.x && b.m_mins.x <= a.m_maxs.x &&
+        a.m_mins.y <= b.m_maxs.y && b.m_mins.y <= a.m_maxs.y;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2SweepAndPrune::SiftLeft(int const axis,
+                                  int       index)
+{
+    std::vector<sEndpoint>& endpoints = m_endpoints[axis];
+
+    while (index > 0 && IsEndpointLess(endpoints[index], endpoints[index - 1]))
+    {
+        SwapEndpoints(axis, index - 1, index);
+        --index;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2SweepAndPrune::SiftRight(int const axis,
+                                   int       index)
+{
+    std::vector<sEndpoint>& endpoints    = m_endpoints[axis];
+    int const               lastIndex    = static_cast<int>(endpoints.size()) - 1;
+
+    while (index < lastIndex && IsEndpointLess(endpoints[index + 1], endpoints[index]))
+    {
+        SwapEndpoints(axis, index, index + 1);
+        ++index;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Swaps adjacent endpoints where endpoints[rightIndex] is moving left past endpoints[leftIndex].
+//
+void AABB2SweepAndPrune::SwapEndpoints(int const axis,
+                                       int const leftIndex,
+                                       int const rightIndex)
+{
+    std::vector<sEndpoint>& endpoints   = m_endpoints[axis];
+    sEndpoint const         movingLeft  = endpoints[rightIndex];
+    sEndpoint const         movingRight = endpoints[leftIndex];
+    int const               proxyL      = movingLeft.GetProxyID();
+    int const               proxyR      = movingRight.GetProxyID();
+
+    if (proxyL != proxyR)
+    {
+        if (!movingLeft.IsMax() && movingRight.IsMax())
+        {
+            // A min passed a max: the pair may have started overlapping on this axis.
+            if (DoBoundsOverlap(m_proxies[proxyL].m_bounds, m_proxies[proxyR].m_bounds))
+            {
+                AddPair(proxyL, proxyR);
+            }
+        }
+        else if (movingLeft.IsMax() && !movingRight.IsMax())
+        {
+            // A max passed a min: the pair is now separated on this axis.
+            RemovePair(proxyL, proxyR);
+        }
+    }
+
+    endpoints[leftIndex]  = movingLeft;
+    endpoints[rightIndex] = movingRight;
+
+    m_proxies[proxyL].m_endpointIndex[axis][movingLeft.IsMax() ? 1 : 0]  = leftIndex;
+    m_proxies[proxyR].m_endpointIndex[axis][movingRight.IsMax() ? 1 : 0] = rightIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2SweepAndPrune::AddPair(int const proxyA,
+                                 int const proxyB)
+{
+    uint64_t const key = MakePairKey(proxyA, proxyB);
+
+    if (m_pairs.insert(key).second)
+    {
+        RecordToggle(key, false);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2SweepAndPrune::RemovePair(int const proxyA,
+                                    int const proxyB)
+{
+    uint64_t const key = MakePairKey(proxyA, proxyB);
+
+    if (m_pairs.erase(key) != 0)
+    {
+        RecordToggle(key, true);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2SweepAndPrune::RecordToggle(uint64_t const key,
+                                      bool const     wasPresent)
+{
+    // Only the first toggle since the last flush remembers the original state.
+    m_toggledPairs.try_emplace(key, wasPresent);
+}
+
+//----------------------------------------------------------------------------------------------------
+void AABB2SweepAndPrune::FlushEvents()
+{
+    m_addedPairs.clear();
+    m_removedPairs.clear();
+
+    for (auto const& [key, wasPresent] : m_toggledPairs)
+    {
+        bool const         isPresent = m_pairs.contains(key);
+        sOverlapPair const pair      = {static_cast<int>(key >> 32), static_cast<int>(key & 0xFFFFFFFFu)};
+
+        if (isPresent && !wasPresent)
+        {
+            m_addedPairs.push_back(pair);
+        }
+        else if (!isPresent && wasPresent)
+        {
+            m_removedPairs.push_back(pair);
+        }
+    }
+
+    m_toggledPairs.clear();
+}
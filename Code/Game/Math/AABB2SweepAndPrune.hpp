@@ -0,0 +1,89 @@
+//----------------------------------------------------------------------------------------------------
+// AABB2SweepAndPrune.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Engine/Math/AABB2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+struct sOverlapPair
+{
+    int m_proxyA = -1;      // Always the smaller proxy ID of the pair
+    int m_proxyB = -1;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Incremental sweep-and-prune broadphase.
+//
+// Keeps one sorted endpoint list per axis. Because most proxies only move a little each frame,
+// Update() re-sorts both lists with insertion sort (near O(n) for coherent motion), and every
+// endpoint swap toggles the overlap state of exactly one pair. Pair add/remove events are
+// netted per Update(), so a pair that starts and stops overlapping within one update is silent.
+//
+class AABB2SweepAndPrune
+{
+public:
+    int  AddProxy(AABB2 const& bounds);
+    void RemoveProxy(int proxyID);
+    void SetProxyBounds(int proxyID, AABB2 const& bounds);
+    void Update();
+    void Clear();
+
+    AABB2 const&                     GetProxyBounds(int proxyID) const;
+    int                              GetNumProxies() const;
+    int                              GetNumOverlapPairs() const;
+    bool                             IsOverlapping(int proxyA, int proxyB) const;
+    std::vector<sOverlapPair> const& GetAddedPairs() const;
+    std::vector<sOverlapPair> const& GetRemovedPairs() const;
+    void                             GetOverlapPairs(std::vector<sOverlapPair>& out_pairs) const;
+
+    // Full-rebuild reference: sort all proxies along X and sweep. Used by tests and benchmarks.
+    static void FindOverlapPairsSortAndSweep(std::vector<AABB2> const& boxes, std::vector<sOverlapPair>& out_pairs);
+
+private:
+    struct sEndpoint
+    {
+        float    m_value;
+        uint32_t m_proxyAndIsMax;  // (proxyID << 1) | isMax
+
+        int  GetProxyID() const { return static_cast<int>(m_proxyAndIsMax >> 1); }
+        bool IsMax() const { return (m_proxyAndIsMax & 1u) != 0; }
+    };
+
+    struct sProxy
+    {
+        AABB2 m_bounds;                                      // Bounds the endpoint lists are sorted by
+        AABB2 m_targetBounds;                                // Bounds to commit on the next Update()
+        int   m_endpointIndex[2][2] = {{-1, -1}, {-1, -1}};  // [axis][isMax]
+        bool  m_isActive            = false;
+    };
+
+    static uint64_t MakePairKey(int proxyA, int proxyB);
+    static bool     IsEndpointLess(sEndpoint const& a, sEndpoint const& b);
+    static float    GetBoundsValue(AABB2 const& bounds, int axis, bool isMax);
+    static bool     DoBoundsOverlap(AABB2 const& a, AABB2 const& b);
+
+    void SiftLeft(int axis, int index);
+    void SiftRight(int axis, int index);
+    void SwapEndpoints(int axis, int leftIndex, int rightIndex);
+    void AddPair(int proxyA, int proxyB);
+    void RemovePair(int proxyA, int proxyB);
+    void RecordToggle(uint64_t key, bool wasPresent);
+    void FlushEvents();
+
+    std::vector<sProxy>                m_proxies;
+    std::vector<sEndpoint>             m_endpoints[2];
+    std::vector<int>                   m_freeProxyIDs;
+    std::vector<int>                   m_pendingFreeProxyIDs;  // Recycled only after the next Update()
+    std::unordered_set<uint64_t>       m_pairs;
+    std::unordered_map<uint64_t, bool> m_toggledPairs;  // Pair key -> was present before this update
+    std::vector<sOverlapPair>          m_addedPairs;
+    std::vector<sOverlapPair>          m_removedPairs;
+    int                                m_numActiveProxies = 0;
+};
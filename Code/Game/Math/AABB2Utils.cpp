@@ -0,0 +1,145 @@
+//----------------------------------------------------------------------------------------------------
+// AABB2Utils.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Math/AABB2Utils.hpp"
+
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    void ClampRangeWithin(float&      mins,
+                          float&      maxs,
+                          float const containerMins,
+                          float const containerMaxs)
+    {
+        if (maxs - mins >= containerMaxs - containerMins)
+        {
+            mins = containerMins;
+            maxs = containerMaxs;
+        }
+        else if (mins < containerMins)
+        {
+            maxs += containerMins - mins;
+            mins  = containerMins;
+        }
+        else if (maxs > containerMaxs)
+        {
+            mins -= maxs - containerMaxs;
+            maxs  = containerMaxs;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2 GetBoxAtUVs(AABB2 const& box,
+                  Vec2 const&  uvMins,
+                  Vec2 const&  uvMaxs)
+{
+    return AABB2(box.GetPointAtUV(uvMins), box.GetPointAtUV(uvMaxs));
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2 GetUVsForBox(AABB2 const& box,
+                   AABB2 const& subBox)
+{
+    return AABB2(box.GetUVForPoint(subBox.m_mins), box.GetUVForPoint(subBox.m_maxs));
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2 ChopOffTop(AABB2&      box,
+                 float const amount)
+{
+    float const cutY = std::max(box.m_maxs.y - amount, box.m_mins.y);
+    AABB2 const slice(box.m_mins.x, cutY, box.m_maxs.x, box.m_maxs.y);
+    box.m_maxs.y     = cutY;
+
+    return slice;
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2 ChopOffBottom(AABB2&      box,
+                    float const amount)
+{
+    float const cutY = std::min(box.m_mins.y + amount, box.m_maxs.y);
+    AABB2 const slice(box.m_mins.x, box.m_mins.y, box.m_maxs.x, cutY);
+    box.m_mins.y     = cutY;
+
+    return slice;
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2 ChopOffLeft(AABB2&      box,
+                  float const amount)
+{
+    float const cutX = std::min(box.m_mins.x + amount, box.m_maxs.x);
+    AABB2 const slice(box.m_mins.x, box.m_mins.y, cutX, box.m_maxs.y);
+    box.m_mins.x     = cutX;
+
+    return slice;
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2 ChopOffRight(AABB2&      box,
+                   float const amount)
+{
+    float const cutX = std::max(box.m_maxs.x - amount, box.m_mins.x);
+    AABB2 const slice(cutX, box.m_mins.y, box.m_maxs.x, box.m_maxs.y);
+    box.m_maxs.x     = cutX;
+
+    return slice;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AddPadding(AABB2&      box,
+                float const paddingX,
+                float const paddingY)
+{
+    box.m_mins.x -= paddingX;
+    box.m_mins.y -= paddingY;
+    box.m_maxs.x += paddingX;
+    box.m_maxs.y += paddingY;
+}
+
+//----------------------------------------------------------------------------------------------------
+void ReduceToAspectRatio(AABB2&      box,
+                         float const aspectRatio)
+{
+    Vec2 const dimensions = box.GetDimensions();
+
+    if (dimensions.x > dimensions.y * aspectRatio)
+    {
+        box.SetDimensions(Vec2(dimensions.y * aspectRatio, dimensions.y));
+    }
+    else
+    {
+        box.SetDimensions(Vec2(dimensions.x, dimensions.x / aspectRatio));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void EnlargeToAspectRatio(AABB2&      box,
+                          float const aspectRatio)
+{
+    Vec2 const dimensions = box.GetDimensions();
+
+    if (dimensions.x < dimensions.y * aspectRatio)
+    {
+        box.SetDimensions(Vec2(dimensions.y * aspectRatio, dimensions.y));
+    }
+    else
+    {
+        box.SetDimensions(Vec2(dimensions.x, dimensions.x / aspectRatio));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void ClampWithin(AABB2&       box,
+                 AABB2 const& container)
+{
+    ClampRangeWithin(box.m_mins.x, box.m_maxs.x, container.m_mins.x, container.m_maxs.x);
+    ClampRangeWithin(box.m_mins.y, box.m_maxs.y, container.m_mins.y, container.m_maxs.y);
+}
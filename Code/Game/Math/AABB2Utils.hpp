@@ -0,0 +1,30 @@
+//----------------------------------------------------------------------------------------------------
+// AABB2Utils.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include "Engine/Math/AABB2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Free-function versions of the AABB2 methods sketched in TestSet_AABB2_UnimplementedMethods,
+// for code in this project that needs them before AABB2 itself implements them.
+//
+AABB2 GetBoxAtUVs(AABB2 const& box, Vec2 const& uvMins, Vec2 const& uvMaxs);
+AABB2 GetUVsForBox(AABB2 const& box, AABB2 const& subBox);      // Inverse of GetBoxAtUVs
+
+// Remove a slice of up to `amount` from one side of the box and return the slice
+AABB2 ChopOffTop(AABB2& box, float amount);
+AABB2 ChopOffBottom(AABB2& box, float amount);
+AABB2 ChopOffLeft(AABB2& box, float amount);
+AABB2 ChopOffRight(AABB2& box, float amount);
+
+// Grow every side by the given amounts; negative padding insets the box
+void AddPadding(AABB2& box, float paddingX, float paddingY);
+
+// Shrink or grow one dimension about the center until width / height == aspectRatio
+void ReduceToAspectRatio(AABB2& box, float aspectRatio);
+void EnlargeToAspectRatio(AABB2& box, float aspectRatio);
+
+// Slide the box inside container; on any axis where it is larger, it is cut to the container
+void ClampWithin(AABB2& box, AABB2 const& container);
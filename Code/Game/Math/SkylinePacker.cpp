@@ -0,0 +1,230 @@
+//----------------------------------------------------------------------------------------------------
+// SkylinePacker.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Math/SkylinePacker.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include "Game/Math/AABB2Utils.hpp"
+
+//----------------------------------------------------------------------------------------------------
+SkylinePacker::SkylinePacker(IntVec2 const& atlasDimensions,
+                             int const      padding)
+    : m_atlasDimensions(atlasDimensions),
+      m_padding(std::max(padding, 0))
+{
+    Reset();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool SkylinePacker::Insert(IntVec2 const& dimensions,
+                           sPackedRect&   out_rect)
+{
+    out_rect = sPackedRect();
+
+    if (dimensions.x <= 0 || dimensions.y <= 0)
+    {
+        return false;
+    }
+
+    int const paddedWidth  = dimensions.x + m_padding;
+    int const paddedHeight = dimensions.y + m_padding;
+    int       segmentIndex;
+    int       y;
+
+    if (!FindPosition(paddedWidth, paddedHeight, segmentIndex, y))
+    {
+        return false;
+    }
+
+    int const x = m_skyline[segmentIndex].m_x;
+    AddSkylineLevel(segmentIndex, y, paddedWidth, paddedHeight);
+
+    m_packedArea    += static_cast<long long>(dimensions.x) * dimensions.y;
+    m_skylineHeight  = std::max(m_skylineHeight, y + dimensions.y);
+    ++m_numPacked;
+
+    out_rect = MakePackedRect(x, y, dimensions);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+int SkylinePacker::InsertAll(std::span<IntVec2 const> const dimensions,
+                             std::vector<sPackedRect>&      out_rects)
+{
+    out_rects.assign(dimensions.size(), sPackedRect());
+
+    std::vector<int> order(dimensions.size());
+    std::iota(order.begin(), order.end(), 0);
+
+    std::stable_sort(order.begin(), order.end(), [&dimensions](int const a, int const b)
+    {
+        return (dimensions[a].y != dimensions[b].y) ? (dimensions[a].y > dimensions[b].y) : (dimensions[a].x > dimensions[b].x);
+    });
+
+    int numPacked = 0;
+
+    for (int const index : order)
+    {
+        numPacked += Insert(dimensions[index], out_rects[index]) ? 1 : 0;
+    }
+
+    return numPacked;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SkylinePacker::Reset()
+{
+    m_skyline.clear();
+    m_skyline.push_back({0, 0, m_atlasDimensions.x});
+    m_packedArea    = 0;
+    m_numPacked     = 0;
+    m_skylineHeight = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+IntVec2 SkylinePacker::GetAtlasDimensions() const
+{
+    return m_atlasDimensions;
+}
+
+//----------------------------------------------------------------------------------------------------
+int SkylinePacker::GetNumPacked() const
+{
+    return m_numPacked;
+}
+
+//----------------------------------------------------------------------------------------------------
+int SkylinePacker::GetSkylineHeight() const
+{
+    return m_skylineHeight;
+}
+
+//----------------------------------------------------------------------------------------------------
+float SkylinePacker::GetOccupancy() const
+{
+    if (m_skylineHeight == 0)
+    {
+        return 0.f;
+    }
+
+    return static_cast<float>(static_cast<double>(m_packedArea) / (static_cast<double>(m_atlasDimensions.x) * m_skylineHeight));
+}
+
+//----------------------------------------------------------------------------------------------------
+bool SkylinePacker::FindPosition(int const width,
+                                 int const height,
+                                 int&      out_segmentIndex,
+                                 int&      out_y) const
+{
+    int bestTop = m_atlasDimensions.y + 1;
+
+    out_segmentIndex = -1;
+
+    for (int segmentIndex = 0; segmentIndex < static_cast<int>(m_skyline.size()); ++segmentIndex)
+    {
+        int const y = GetFitY(segmentIndex, width);
+
+        // Segments are visited left to right, so a strict < keeps the leftmost of equal tops
+        if (y >= 0 && y + height <= m_atlasDimensions.y && y + height < bestTop)
+        {
+            bestTop          = y + height;
+            out_segmentIndex = segmentIndex;
+            out_y            = y;
+        }
+    }
+
+    return out_segmentIndex >= 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Lowest y at which a rect of this width can rest with its left edge on the segment's start,
+// or -1 if it would stick out of the atlas's right side
+//
+int SkylinePacker::GetFitY(int const segmentIndex,
+                           int const width) const
+{
+    int const x = m_skyline[segmentIndex].m_x;
+
+    if (x + width > m_atlasDimensions.x)
+    {
+        return -1;
+    }
+
+    int y              = 0;
+    int remainingWidth = width;
+
+    // The skyline spans the full atlas width, so this never runs past the last segment
+    for (int index = segmentIndex; remainingWidth > 0; ++index)
+    {
+        y               = std::max(y, m_skyline[index].m_y);
+        remainingWidth -= m_skyline[index].m_width;
+    }
+
+    return y;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SkylinePacker::AddSkylineLevel(int const segmentIndex,
+                                    int const y,
+                                    int const width,
+                                    int const height)
+{
+    int const x     = m_skyline[segmentIndex].m_x;
+    int const right = x + width;
+
+    m_skyline.insert(m_skyline.begin() + segmentIndex, {x, y + height, width});
+
+    // Trim or drop every segment the new level now covers
+    int const next  = segmentIndex + 1;
+    int const count = static_cast<int>(m_skyline.size());
+    int       end   = next;
+
+    while (end < count && m_skyline[end].m_x + m_skyline[end].m_width <= right)
+    {
+        ++end;
+    }
+
+    if (end < count && m_skyline[end].m_x < right)
+    {
+        m_skyline[end].m_width -= right - m_skyline[end].m_x;
+        m_skyline[end].m_x      = right;
+    }
+
+    m_skyline.erase(m_skyline.begin() + next, m_skyline.begin() + end);
+
+    // Merge the new level with equal-height neighbors
+    int first = segmentIndex;
+
+    if (first > 0 && m_skyline[first - 1].m_y == m_skyline[first].m_y)
+    {
+        m_skyline[first - 1].m_width += m_skyline[first].m_width;
+        m_skyline.erase(m_skyline.begin() + first);
+        --first;
+    }
+
+    if (first + 1 < static_cast<int>(m_skyline.size()) && m_skyline[first + 1].m_y == m_skyline[first].m_y)
+    {
+        m_skyline[first].m_width += m_skyline[first + 1].m_width;
+        m_skyline.erase(m_skyline.begin() + first + 1);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+sPackedRect SkylinePacker::MakePackedRect(int const      x,
+                                          int const      y,
+                                          IntVec2 const& dimensions) const
+{
+    AABB2 const atlasBounds(0.f, 0.f, static_cast<float>(m_atlasDimensions.x), static_cast<float>(m_atlasDimensions.y));
+
+    sPackedRect rect;
+    rect.m_placement = AABB2(IntVec2(x, y), IntVec2(x + dimensions.x, y + dimensions.y));
+    rect.m_uvs       = GetUVsForBox(atlasBounds, rect.m_placement);
+    rect.m_isPacked  = true;
+
+    return rect;
+}
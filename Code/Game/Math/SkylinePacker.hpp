@@ -0,0 +1,67 @@
+//----------------------------------------------------------------------------------------------------
+// SkylinePacker.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <span>
+#include <vector>
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/IntVec2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+struct sPackedRect
+{
+    AABB2 m_placement;              // Texel rect within the atlas, excluding padding
+    AABB2 m_uvs;                    // m_placement in atlas UV space; (0,0) is the atlas mins
+    bool  m_isPacked = false;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Skyline bottom-left rectangle packer for texture atlases.
+//
+// The skyline is the upper outline of everything packed so far, kept as a left-to-right list of
+// horizontal segments. Each rect goes where its top edge ends up lowest (ties go left), and the
+// segments it covers are replaced by one at its top. Space under an overhang is never reused,
+// which keeps every insertion cheap at a small cost in occupancy.
+//
+// Insert packs one rect at a time, in arrival order. InsertAll sorts by height, then width,
+// before packing, which packs noticeably tighter when all rects are known up front.
+//
+// Padding is reserved to the right of and above every rect, so neighbors never share texels.
+//
+class SkylinePacker
+{
+public:
+    explicit SkylinePacker(IntVec2 const& atlasDimensions, int padding = 0);
+
+    bool Insert(IntVec2 const& dimensions, sPackedRect& out_rect);
+    int  InsertAll(std::span<IntVec2 const> dimensions, std::vector<sPackedRect>& out_rects);
+    void Reset();
+
+    IntVec2 GetAtlasDimensions() const;
+    int     GetNumPacked() const;
+    int     GetSkylineHeight() const;
+    float   GetOccupancy() const;   // Packed texels / (atlas width * skyline height)
+
+private:
+    struct sSkylineSegment
+    {
+        int m_x;
+        int m_y;
+        int m_width;
+    };
+
+    bool        FindPosition(int width, int height, int& out_segmentIndex, int& out_y) const;
+    int         GetFitY(int segmentIndex, int width) const;
+    void        AddSkylineLevel(int segmentIndex, int y, int width, int height);
+    sPackedRect MakePackedRect(int x, int y, IntVec2 const& dimensions) const;
+
+    IntVec2                      m_atlasDimensions;
+    int                          m_padding       = 0;
+    std::vector<sSkylineSegment> m_skyline;
+    long long                    m_packedArea    = 0;
+    int                          m_numPacked     = 0;
+    int                          m_skylineHeight = 0;
+};
@@ -0,0 +1,513 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_AABB2Array.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Math/UnitTests_AABB2Array.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Math/AABB2Array.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    void MakeRandomBoxes(int const                numBoxes,
+                         unsigned int const       seed,
+                         std::vector<AABB2Class>& out_boxes)
+    {
+        std::mt19937                          rng(seed);
+        std::uniform_real_distribution<float> positionDist(-500.0f, 500.0f);
+        std::uniform_real_distribution<float> sizeDist(1.0f, 40.0f);
+
+        out_boxes.clear();
+
+        for (int index = 0; index < numBoxes; ++index)
+        {
+            float const minX = positionDist(rng);
+            float const minY = positionDist(rng);
+            out_boxes.emplace_back(minX, minY, minX + sizeDist(rng), minY + sizeDist(rng));
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------
+    bool DoBoxesOverlap(AABB2Class const& a,
+                        AABB2Class const& b)
+    {
+        return
+            a.AABB2_Mins.x <= b.AABB2_Maxs.x && b.AABB2_Mins.x <= a.AABB2_Maxs.x &&
+            a.AABB2_Mins.y <= b.AABB2_Maxs.y && b.AABB2_Mins.y <= a.AABB2_Maxs.y;
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2Array_Constructors()
+{
+#if defined(ENABLE_TestSet_AABB2Array_Constructors)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2Array_Constructors)(start)\n");
+    printf("####################################################################################################\n");
+
+    // Test default constructor
+    auto const emptyArray = TimeFunction("Default constructor", []() { return AABB2Array(); });
+    VerifyTestResult(emptyArray.GetCount() == 0, "AABB2Array default constructor should be empty");
+
+    // Test constructor from AABB2 span
+    std::vector<AABB2Class> const boxes = {AABB2Class(1.0f, 2.0f, 5.0f, 8.0f), AABB2Class(1.5f, 2.5f, 5.5f, 8.5f), AABB2Class(-3.0f, -4.0f, 7.0f, 9.0f)};
+    auto const array = TimeFunction("Constructor from AABB2 span", [&boxes]() { return AABB2Array(boxes); });
+    VerifyTestResult(array.GetCount() == 3, "AABB2Array constructor from span should copy every box");
+    VerifyTestResult(array.Get(0) == boxes[0] && array.Get(1) == boxes[1] && array.Get(2) == boxes[2],
+                     "AABB2Array::Get should return exactly the boxes it was built from");
+
+    // Test streams are laid out per component
+    VerifyTestResult(array.GetMinXs()[1] == 1.5f && array.GetMinYs()[1] == 2.5f && array.GetMaxXs()[1] == 5.5f && array.GetMaxYs()[1] == 8.5f,
+                     "AABB2Array should store minX/minY/maxX/maxY as separate streams");
+
+    // Test PushBack and Set
+    AABB2Array mutableArray;
+    mutableArray.PushBack(AABB2Class(0.0f, 0.0f, 1.0f, 1.0f));
+    mutableArray.PushBack(AABB2Class(2.0f, 2.0f, 3.0f, 3.0f));
+    mutableArray.Set(0, AABB2Class::ZERO_TO_ONE);
+    mutableArray.Set(1, AABB2Class::NEG_HALF_TO_HALF);
+    VerifyTestResult(mutableArray.Get(0) == AABB2Class::ZERO_TO_ONE && mutableArray.Get(1) == AABB2Class::NEG_HALF_TO_HALF,
+                     "AABB2Array::Set should overwrite the stored box");
+
+    mutableArray.Clear();
+    VerifyTestResult(mutableArray.GetCount() == 0, "AABB2Array::Clear should remove every box");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2Array_Constructors)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 6; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2Array_AccessorMethods()
+{
+#if defined(ENABLE_TestSet_AABB2Array_AccessorMethods)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2Array_AccessorMethods)(start)\n");
+    printf("####################################################################################################\n");
+
+    // Same boxes as TestSet_AABB2_AccessorMethods, padded past one SIMD width so both the vector
+    // loop and the scalar tail run
+    std::vector<AABB2Class> boxes = {AABB2Class(10.0f, 20.0f, 50.0f, 80.0f), AABB2Class(5.0f, 15.0f, 25.0f, 35.0f),
+                                     AABB2Class(0.0f, 0.0f, 10.0f, 10.0f), AABB2Class(0.0f, 0.0f, 20.0f, 10.0f),
+                                     AABB2Class(0.0f, 0.0f, 10.0f, 20.0f)};
+    AABB2Array const array(boxes);
+
+    std::vector<Vector2Class> centers(array.GetCount());
+    std::vector<Vector2Class> dimensions(array.GetCount());
+    std::vector<float>        areas(array.GetCount());
+
+    TimeAction("GetCenters (5 boxes)", [&array, &centers] { array.GetCenters(centers.data()); });
+    VerifyTestResult(IsMostlyEqual(centers[0], 30.0f, 50.0f), "GetCenters should return center point of box");
+    VerifyTestResult(IsMostlyEqual(centers[1], 15.0f, 25.0f) && IsMostlyEqual(centers[4], 5.0f, 10.0f),
+                     "GetCenters should be correct in both the SIMD loop and the scalar tail");
+
+    TimeAction("GetDimensions (5 boxes)", [&array, &dimensions] { array.GetDimensions(dimensions.data()); });
+    VerifyTestResult(IsMostlyEqual(dimensions[0], 40.0f, 60.0f), "GetDimensions should return width and height");
+    VerifyTestResult(IsMostlyEqual(dimensions[1], 20.0f, 20.0f) && IsMostlyEqual(dimensions[4], 10.0f, 20.0f),
+                     "GetDimensions should be correct in both the SIMD loop and the scalar tail");
+
+    TimeAction("GetAreas (5 boxes)", [&array, &areas] { array.GetAreas(areas.data()); });
+    VerifyTestResult(IsMostlyEqual(areas[0], 2400.0f) && IsMostlyEqual(areas[3], 200.0f) && IsMostlyEqual(areas[4], 200.0f),
+                     "GetAreas should return width * height");
+
+    // Aspect ratios, as in TestSet_AABB2_AccessorMethods
+    VerifyTestResult(IsMostlyEqual(dimensions[2].x / dimensions[2].y, 1.0f) &&
+                     IsMostlyEqual(dimensions[3].x / dimensions[3].y, 2.0f) &&
+                     IsMostlyEqual(dimensions[4].x / dimensions[4].y, 0.5f),
+                     "GetDimensions should yield square, wide and tall aspect ratios of 1, 2 and 0.5");
+
+    // Bulk results should match the per-box AABB2 methods
+    MakeRandomBoxes(1027, 5u, boxes);
+    AABB2Array const randomArray(boxes);
+    centers.resize(boxes.size());
+    dimensions.resize(boxes.size());
+    randomArray.GetCenters(centers.data());
+    randomArray.GetDimensions(dimensions.data());
+
+    bool bAllMatch = true;
+
+    for (size_t index = 0; index < boxes.size(); ++index)
+    {
+        bAllMatch = bAllMatch &&
+                    IsMostlyEqual(centers[index], boxes[index].AABB2_GetCenter()) &&
+                    IsMostlyEqual(dimensions[index], boxes[index].AABB2_GetDimensions());
+    }
+
+    VerifyTestResult(bAllMatch, "GetCenters/GetDimensions should match AABB2::GetCenter/GetDimensions for every box");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2Array_AccessorMethods)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 7; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2Array_MutatorMethods()
+{
+#if defined(ENABLE_TestSet_AABB2Array_MutatorMethods)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2Array_MutatorMethods)(start)\n");
+    printf("####################################################################################################\n");
+
+    // Same values as TestSet_AABB2_MutatorMethods
+    std::vector<AABB2Class> const boxes(6, AABB2Class(10.0f, 20.0f, 30.0f, 40.0f));
+    AABB2Array                    array(boxes);
+
+    array.Translate(Vector2Class(5.0f, 10.0f));
+    VerifyTestResult(IsMostlyEqual(array.Get(0), 15.0f, 30.0f, 35.0f, 50.0f) && IsMostlyEqual(array.Get(5), 15.0f, 30.0f, 35.0f, 50.0f),
+                     "Translate should move every box by offset");
+
+    std::vector<Vector2Class> dimensions(array.GetCount());
+    array.GetDimensions(dimensions.data());
+    VerifyTestResult(IsMostlyEqual(dimensions[0], 20.0f, 20.0f) && IsMostlyEqual(dimensions[5], 20.0f, 20.0f),
+                     "Translate should not change box dimensions");
+
+    array.Translate(Vector2Class(-5.0f, -10.0f));
+    VerifyTestResult(IsMostlyEqual(array.Get(0), 10.0f, 20.0f, 30.0f, 40.0f) && IsMostlyEqual(array.Get(5), 10.0f, 20.0f, 30.0f, 40.0f),
+                     "Translate should work with negative offsets");
+
+    // Must equal AABB2::Translate exactly
+    std::vector<AABB2Class> randomBoxes;
+    MakeRandomBoxes(103, 9u, randomBoxes);
+    AABB2Array randomArray(randomBoxes);
+    randomArray.Translate(Vector2Class(0.1f, -7.3f));
+
+    bool bAllMatch = true;
+
+    for (int index = 0; index < randomArray.GetCount(); ++index)
+    {
+        randomBoxes[index].AABB2_Translate(Vector2Class(0.1f, -7.3f));
+        bAllMatch = bAllMatch && randomArray.Get(index) == randomBoxes[index];
+    }
+
+    VerifyTestResult(bAllMatch, "Translate should equal AABB2::Translate for every box");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2Array_MutatorMethods)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 4; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2Array_Overlap()
+{
+#if defined(ENABLE_TestSet_AABB2Array_Overlap)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2Array_Overlap)(start)\n");
+    printf("####################################################################################################\n");
+
+    std::vector<AABB2Class> const boxes = {AABB2Class(10.0f, 20.0f, 50.0f, 80.0f), AABB2Class(50.0f, 80.0f, 60.0f, 90.0f),
+                                           AABB2Class(51.0f, 0.0f, 60.0f, 10.0f), AABB2Class(0.0f, 0.0f, 5.0f, 5.0f),
+                                           AABB2Class(20.0f, 30.0f, 25.0f, 35.0f)};
+    AABB2Array const array(boxes);
+    std::vector<int> indices;
+
+    array.FindOverlapping(AABB2Class(30.0f, 50.0f, 30.0f, 50.0f), indices);
+    VerifyTestResult(indices.size() == 1 && indices[0] == 0, "FindOverlapping with a point-sized query should act like IsPointInside");
+
+    array.FindOverlapping(AABB2Class(50.0f, 80.0f, 50.0f, 80.0f), indices);
+    VerifyTestResult(indices.size() == 2 && indices[0] == 0 && indices[1] == 1, "FindOverlapping should be inclusive of shared corners");
+
+    array.FindOverlapping(AABB2Class(15.0f, 25.0f, 30.0f, 40.0f), indices);
+    VerifyTestResult(indices.size() == 2 && indices[0] == 0 && indices[1] == 4, "FindOverlapping should report boxes contained in the query");
+
+    array.FindOverlapping(AABB2Class(200.0f, 200.0f, 300.0f, 300.0f), indices);
+    VerifyTestResult(indices.empty(), "FindOverlapping should report nothing for a disjoint query");
+
+    // Randomized comparison against a scalar loop over AABB2s
+    std::vector<AABB2Class> randomBoxes;
+    MakeRandomBoxes(2051, 21u, randomBoxes);
+    AABB2Array const randomArray(randomBoxes);
+    bool             bAllMatch = true;
+    std::mt19937     rng(77u);
+    std::uniform_real_distribution<float> positionDist(-500.0f, 500.0f);
+
+    for (int queryIndex = 0; queryIndex < 64; ++queryIndex)
+    {
+        float const      minX = positionDist(rng);
+        float const      minY = positionDist(rng);
+        AABB2Class const query(minX, minY, minX + 60.0f, minY + 30.0f);
+        std::vector<int> expected;
+
+        for (int index = 0; index < static_cast<int>(randomBoxes.size()); ++index)
+        {
+            if (DoBoxesOverlap(randomBoxes[index], query))
+            {
+                expected.push_back(index);
+            }
+        }
+
+        randomArray.FindOverlapping(query, indices);
+        bAllMatch = bAllMatch && indices == expected;
+    }
+
+    VerifyTestResult(bAllMatch, "FindOverlapping should match a scalar AABB2 loop for random queries");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2Array_Overlap)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 5; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2Array_UnionIntersection()
+{
+#if defined(ENABLE_TestSet_AABB2Array_UnionIntersection)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2Array_UnionIntersection)(start)\n");
+    printf("####################################################################################################\n");
+
+    std::vector<AABB2Class> const boxesA = {AABB2Class(0.0f, 0.0f, 10.0f, 10.0f), AABB2Class(0.0f, 0.0f, 10.0f, 10.0f),
+                                            AABB2Class(0.0f, 0.0f, 10.0f, 10.0f), AABB2Class(-5.0f, -5.0f, 5.0f, 5.0f),
+                                            AABB2Class(1.0f, 1.0f, 2.0f, 2.0f)};
+    std::vector<AABB2Class> const boxesB = {AABB2Class(5.0f, 5.0f, 15.0f, 15.0f), AABB2Class(2.0f, 3.0f, 4.0f, 5.0f),
+                                            AABB2Class(20.0f, 20.0f, 30.0f, 30.0f), AABB2Class(-5.0f, -5.0f, 5.0f, 5.0f),
+                                            AABB2Class(0.0f, 0.0f, 3.0f, 3.0f)};
+    AABB2Array const a(boxesA);
+    AABB2Array const b(boxesB);
+    AABB2Array       result;
+
+    TimeAction("Union (5 pairs)", [&a, &b, &result] { AABB2Array::Union(a, b, result); });
+    VerifyTestResult(result.GetCount() == 5 && IsMostlyEqual(result.Get(0), 0.0f, 0.0f, 15.0f, 15.0f),
+                     "Union should enclose both overlapping boxes");
+    VerifyTestResult(IsMostlyEqual(result.Get(1), 0.0f, 0.0f, 10.0f, 10.0f) && IsMostlyEqual(result.Get(2), 0.0f, 0.0f, 30.0f, 30.0f),
+                     "Union should return the container for nested boxes and span disjoint boxes");
+    VerifyTestResult(IsMostlyEqual(result.Get(4), 0.0f, 0.0f, 3.0f, 3.0f), "Union should be correct in the scalar tail");
+
+    TimeAction("Intersection (5 pairs)", [&a, &b, &result] { AABB2Array::Intersection(a, b, result); });
+    VerifyTestResult(IsMostlyEqual(result.Get(0), 5.0f, 5.0f, 10.0f, 10.0f) && IsMostlyEqual(result.Get(1), 2.0f, 3.0f, 4.0f, 5.0f),
+                     "Intersection should return the shared region");
+    AABB2Class const disjoint = result.Get(2);
+    VerifyTestResult(disjoint.AABB2_Mins.x > disjoint.AABB2_Maxs.x && disjoint.AABB2_Mins.y > disjoint.AABB2_Maxs.y,
+                     "Intersection of disjoint boxes should be inverted (mins > maxs)");
+    VerifyTestResult(IsMostlyEqual(result.Get(3), -5.0f, -5.0f, 5.0f, 5.0f) && IsMostlyEqual(result.Get(4), 1.0f, 1.0f, 2.0f, 2.0f),
+                     "Intersection of identical or nested boxes should return the inner box");
+
+    // A NaN in box 1 goes through the SIMD loop and one in box 4 through the scalar tail; both
+    // should come out the same way, b's value when a is NaN and NaN when b is
+    float const             nan       = std::numeric_limits<float>::quiet_NaN();
+    std::vector<AABB2Class> nanBoxesA = boxesA;
+    std::vector<AABB2Class> nanBoxesB = boxesB;
+    nanBoxesA[1].AABB2_Mins.x = nanBoxesA[4].AABB2_Mins.x = nan;
+    nanBoxesB[1].AABB2_Maxs.y = nanBoxesB[4].AABB2_Maxs.y = nan;
+
+    AABB2Array const nanA(nanBoxesA);
+    AABB2Array const nanB(nanBoxesB);
+    AABB2Array       nanIntersection;
+    AABB2Array::Union(nanA, nanB, result);
+    AABB2Array::Intersection(nanA, nanB, nanIntersection);
+
+    VerifyTestResult(result.Get(1).AABB2_Mins.x == 2.0f && result.Get(4).AABB2_Mins.x == 0.0f && std::isnan(result.Get(1).AABB2_Maxs.y) && std::isnan(result.Get(4).AABB2_Maxs.y) &&
+                     nanIntersection.Get(1).AABB2_Mins.x == 2.0f && nanIntersection.Get(4).AABB2_Mins.x == 0.0f &&
+                     std::isnan(nanIntersection.Get(1).AABB2_Maxs.y) && std::isnan(nanIntersection.Get(4).AABB2_Maxs.y),
+                     "NaNs should give the same results in the scalar tail as in the SIMD loop");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2Array_UnionIntersection)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 7; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2Array_Performance()
+{
+#if defined(ENABLE_TestSet_AABB2Array_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2Array_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    printf("  Running AoS vs SoA benchmarks with %d boxes, %d repeats...\n", AABB2ARRAY_PERFORMANCE_NUM_BOXES, AABB2ARRAY_PERFORMANCE_REPEATS);
+
+    std::vector<AABB2Class> boxes;
+    MakeRandomBoxes(AABB2ARRAY_PERFORMANCE_NUM_BOXES, 123u, boxes);
+    AABB2Array array(boxes);
+
+    PerformanceTimer          timer;
+    std::vector<int>          indices;
+    std::vector<Vector2Class> vectors(boxes.size());
+    AABB2Class const          query(-100.0f, -100.0f, 100.0f, 100.0f);
+    size_t                    checksum = 0;
+
+    auto const report = [](char const* name, double const aosTime, double const soaTime)
+    {
+        printf("    %s: AoS %.3f us, SoA %.3f us per pass (%.2fx)\n", name,
+               aosTime / AABB2ARRAY_PERFORMANCE_REPEATS, soaTime / AABB2ARRAY_PERFORMANCE_REPEATS, aosTime / soaTime);
+    };
+
+    // Overlap query
+    timer.Start();
+    for (int repeat = 0; repeat < AABB2ARRAY_PERFORMANCE_REPEATS; ++repeat)
+    {
+        indices.clear();
+        for (int index = 0; index < static_cast<int>(boxes.size()); ++index)
+        {
+            if (DoBoxesOverlap(boxes[index], query))
+            {
+                indices.push_back(index);
+            }
+        }
+        checksum += indices.size();
+    }
+    timer.Stop();
+    double const aosOverlap = timer.GetElapsedMicroseconds();
+
+    timer.Start();
+    for (int repeat = 0; repeat < AABB2ARRAY_PERFORMANCE_REPEATS; ++repeat)
+    {
+        checksum += array.FindOverlapping(query, indices);
+    }
+    timer.Stop();
+    report("Overlap query", aosOverlap, timer.GetElapsedMicroseconds());
+
+    // GetCenter extraction
+    timer.Start();
+    for (int repeat = 0; repeat < AABB2ARRAY_PERFORMANCE_REPEATS; ++repeat)
+    {
+        for (size_t index = 0; index < boxes.size(); ++index)
+        {
+            vectors[index] = boxes[index].AABB2_GetCenter();
+        }
+        checksum += static_cast<size_t>(vectors[repeat].x != 0.0f);
+    }
+    timer.Stop();
+    double const aosCenters = timer.GetElapsedMicroseconds();
+
+    timer.Start();
+    for (int repeat = 0; repeat < AABB2ARRAY_PERFORMANCE_REPEATS; ++repeat)
+    {
+        array.GetCenters(vectors.data());
+        checksum += static_cast<size_t>(vectors[repeat].x != 0.0f);
+    }
+    timer.Stop();
+    report("GetCenter", aosCenters, timer.GetElapsedMicroseconds());
+
+    // GetDimensions extraction
+    timer.Start();
+    for (int repeat = 0; repeat < AABB2ARRAY_PERFORMANCE_REPEATS; ++repeat)
+    {
+        for (size_t index = 0; index < boxes.size(); ++index)
+        {
+            vectors[index] = boxes[index].AABB2_GetDimensions();
+        }
+        checksum += static_cast<size_t>(vectors[repeat].x != 0.0f);
+    }
+    timer.Stop();
+    double const aosDimensions = timer.GetElapsedMicroseconds();
+
+    timer.Start();
+    for (int repeat = 0; repeat < AABB2ARRAY_PERFORMANCE_REPEATS; ++repeat)
+    {
+        array.GetDimensions(vectors.data());
+        checksum += static_cast<size_t>(vectors[repeat].x != 0.0f);
+    }
+    timer.Stop();
+    report("GetDimensions", aosDimensions, timer.GetElapsedMicroseconds());
+
+    // Translate
+    Vector2Class const offset(0.25f, -0.25f);
+
+    timer.Start();
+    for (int repeat = 0; repeat < AABB2ARRAY_PERFORMANCE_REPEATS; ++repeat)
+    {
+        for (AABB2Class& box : boxes)
+        {
+            box.AABB2_Translate(offset);
+        }
+    }
+    timer.Stop();
+    double const aosTranslate = timer.GetElapsedMicroseconds();
+
+    timer.Start();
+    for (int repeat = 0; repeat < AABB2ARRAY_PERFORMANCE_REPEATS; ++repeat)
+    {
+        array.Translate(offset);
+    }
+    timer.Stop();
+    report("Translate", aosTranslate, timer.GetElapsedMicroseconds());
+
+    // Union of two arrays
+    std::vector<AABB2Class> otherBoxes;
+    MakeRandomBoxes(AABB2ARRAY_PERFORMANCE_NUM_BOXES, 321u, otherBoxes);
+    AABB2Array const        otherArray(otherBoxes);
+    std::vector<AABB2Class> unionBoxes(boxes.size());
+    AABB2Array              unionArray;
+
+    timer.Start();
+    for (int repeat = 0; repeat < AABB2ARRAY_PERFORMANCE_REPEATS; ++repeat)
+    {
+        for (size_t index = 0; index < boxes.size(); ++index)
+        {
+            AABB2Class const& a = boxes[index];
+            AABB2Class const& b = otherBoxes[index];
+            unionBoxes[index]   = AABB2Class(std::min(a.AABB2_Mins.x, b.AABB2_Mins.x), std::min(a.AABB2_Mins.y, b.AABB2_Mins.y),
+                                             std::max(a.AABB2_Maxs.x, b.AABB2_Maxs.x), std::max(a.AABB2_Maxs.y, b.AABB2_Maxs.y));
+        }
+        checksum += static_cast<size_t>(unionBoxes[repeat].AABB2_Maxs.x > 0.0f);
+    }
+    timer.Stop();
+    double const aosUnion = timer.GetElapsedMicroseconds();
+
+    timer.Start();
+    for (int repeat = 0; repeat < AABB2ARRAY_PERFORMANCE_REPEATS; ++repeat)
+    {
+        AABB2Array::Union(array, otherArray, unionArray);
+        checksum += static_cast<size_t>(unionArray.GetMaxXs()[repeat] > 0.0f);
+    }
+    timer.Stop();
+    report("Union", aosUnion, timer.GetElapsedMicroseconds());
+
+    VerifyTestResult(checksum > 0, "AABB2Array performance tests completed");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2Array_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_AABB2Array()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_AABB2Array)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_AABB2Array_Constructors, "AABB2Array - Constructors");
+    RunTestSet(true, TestSet_AABB2Array_AccessorMethods, "AABB2Array - Accessor Methods");
+    RunTestSet(true, TestSet_AABB2Array_MutatorMethods, "AABB2Array - Mutator Methods");
+    RunTestSet(true, TestSet_AABB2Array_Overlap, "AABB2Array - Overlap");
+    RunTestSet(true, TestSet_AABB2Array_UnionIntersection, "AABB2Array - Union and Intersection");
+    RunTestSet(false, TestSet_AABB2Array_Performance, "AABB2Array - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_AABB2Array)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
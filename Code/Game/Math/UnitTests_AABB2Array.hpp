@@ -0,0 +1,36 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_AABB2Array.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_AABB2Array();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_AABB2Array_Constructors();
+int TestSet_AABB2Array_AccessorMethods();
+int TestSet_AABB2Array_MutatorMethods();
+int TestSet_AABB2Array_Overlap();
+int TestSet_AABB2Array_UnionIntersection();
+int TestSet_AABB2Array_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_AABB2Array_Constructors
+#define ENABLE_TestSet_AABB2Array_AccessorMethods
+#define ENABLE_TestSet_AABB2Array_MutatorMethods
+#define ENABLE_TestSet_AABB2Array_Overlap
+#define ENABLE_TestSet_AABB2Array_UnionIntersection
+#define ENABLE_TestSet_AABB2Array_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define AABB2ARRAY_PERFORMANCE_NUM_BOXES 65536
+#define AABB2ARRAY_PERFORMANCE_REPEATS 100
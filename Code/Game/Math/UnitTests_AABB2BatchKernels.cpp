@@ -0,0 +1,361 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_AABB2BatchKernels.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Math/UnitTests_AABB2BatchKernels.hpp"
+
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Math/AABB2BatchKernels.hpp"
+#include "Game/Math/Vec2Array.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    struct sKernelCase
+    {
+        Vector2Class m_input;
+        Vector2Class m_expected;
+        char const*  m_testName;
+    };
+
+    //------------------------------------------------------------------------------------------------
+    using BatchKernel = void (*)(AABB2Class const&, Vec2Array const&, Vec2Array&);
+
+    //------------------------------------------------------------------------------------------------
+    // Runs every case through one batch call and verifies each output separately
+    template <int NumCases>
+    void VerifyKernelCases(char const*       description,
+                           BatchKernel       kernel,
+                           AABB2Class const& box,
+                           sKernelCase const (&cases)[NumCases])
+    {
+        Vec2Array inputs;
+        Vec2Array outputs;
+
+        for (sKernelCase const& kernelCase : cases)
+        {
+            inputs.PushBack(kernelCase.m_input);
+        }
+
+        TimeAction(description, [&]() { kernel(box, inputs, outputs); });
+
+        for (int index = 0; index < NumCases; ++index)
+        {
+            VerifyTestResult(outputs.GetCount() == NumCases && IsMostlyEqual(outputs.Get(index), cases[index].m_expected),
+                             cases[index].m_testName);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2BatchKernels_Vec2Array()
+{
+#if defined(ENABLE_TestSet_AABB2BatchKernels_Vec2Array)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2BatchKernels_Vec2Array)(start)\n");
+    printf("####################################################################################################\n");
+
+    Vec2Array emptyArray;
+    VerifyTestResult(emptyArray.GetCount() == 0, "Default Vec2Array should be empty");
+
+    Vector2Class const points[] = {Vector2Class(1.0f, 2.0f), Vector2Class(3.0f, 4.0f), Vector2Class(5.0f, 6.0f)};
+    Vec2Array          array(points);
+    VerifyTestResult(array.GetCount() == 3 && array.Get(1) == Vector2Class(3.0f, 4.0f),
+                     "Vec2Array built from a span should hold every point in order");
+    VerifyTestResult(array.GetXs()[2] == 5.0f && array.GetYs()[0] == 2.0f, "Vec2Array should store x and y in separate streams");
+
+    array.Set(0, Vector2Class(-1.0f, -2.0f));
+    array.PushBack(Vector2Class(7.0f, 8.0f));
+    VerifyTestResult(array.Get(0) == Vector2Class(-1.0f, -2.0f) && array.GetCount() == 4 && array.Get(3) == Vector2Class(7.0f, 8.0f),
+                     "Vec2Array Set and PushBack should update the streams");
+
+    array.Clear();
+    VerifyTestResult(array.GetCount() == 0, "Vec2Array Clear should remove every point");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2BatchKernels_Vec2Array)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 5; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+// Mirrors the single-call GetNearestPoint, GetPointAtUV and GetUVForPoint cases in
+// TestSet_AABB2_AccessorMethods, batched per box
+//
+int TestSet_AABB2BatchKernels_AccessorMethods()
+{
+#if defined(ENABLE_TestSet_AABB2BatchKernels_AccessorMethods)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2BatchKernels_AccessorMethods)(start)\n");
+    printf("####################################################################################################\n");
+
+    AABB2Class       box(10.0f, 20.0f, 50.0f, 80.0f);
+    const AABB2Class constBox(5.0f, 15.0f, 25.0f, 35.0f);
+
+    // Test GetNearestPoints
+    sKernelCase const nearestCases[] =
+    {
+        {Vector2Class(30.0f, 50.0f), Vector2Class(30.0f, 50.0f), "GetNearestPoints should return same point if inside box"},
+        {Vector2Class(60.0f, 50.0f), Vector2Class(50.0f, 50.0f), "GetNearestPoints should clamp to east edge for point east of box"},
+        {Vector2Class(5.0f, 50.0f), Vector2Class(10.0f, 50.0f), "GetNearestPoints should clamp to west edge for point west of box"},
+        {Vector2Class(30.0f, 90.0f), Vector2Class(30.0f, 80.0f), "GetNearestPoints should clamp to north edge for point north of box"},
+        {Vector2Class(30.0f, 10.0f), Vector2Class(30.0f, 20.0f), "GetNearestPoints should clamp to south edge for point south of box"},
+    };
+    VerifyKernelCases("GetNearestPoints (5 points)", GetNearestPoints, box, nearestCases);
+
+    sKernelCase const nearestConstCases[] =
+    {
+        {Vector2Class(0.0f, 0.0f), Vector2Class(5.0f, 15.0f), "GetNearestPoints should work on const AABB2 objects"},
+    };
+    VerifyKernelCases("GetNearestPoints (const)", GetNearestPoints, constBox, nearestConstCases);
+
+    // Test GetPointsAtUVs
+    sKernelCase const pointAtUVCases[] =
+    {
+        {Vector2Class(0.0f, 0.0f), Vector2Class(10.0f, 20.0f), "GetPointsAtUVs(0,0) should return mins"},
+        {Vector2Class(1.0f, 1.0f), Vector2Class(50.0f, 80.0f), "GetPointsAtUVs(1,1) should return maxs"},
+        {Vector2Class(0.5f, 0.5f), Vector2Class(30.0f, 50.0f), "GetPointsAtUVs(0.5,0.5) should return center"},
+        {Vector2Class(0.25f, 0.75f), Vector2Class(20.0f, 65.0f), "GetPointsAtUVs should interpolate correctly"},
+    };
+    VerifyKernelCases("GetPointsAtUVs (4 UVs)", GetPointsAtUVs, box, pointAtUVCases);
+
+    sKernelCase const pointAtUVConstCases[] =
+    {
+        {Vector2Class(0.5f, 0.5f), Vector2Class(15.0f, 25.0f), "GetPointsAtUVs should work on const AABB2 objects"},
+    };
+    VerifyKernelCases("GetPointsAtUVs (const)", GetPointsAtUVs, constBox, pointAtUVConstCases);
+
+    // Test GetUVsForPoints
+    sKernelCase const uvCases[] =
+    {
+        {Vector2Class(10.0f, 20.0f), Vector2Class(0.0f, 0.0f), "GetUVsForPoints(mins) should return (0,0)"},
+        {Vector2Class(50.0f, 80.0f), Vector2Class(1.0f, 1.0f), "GetUVsForPoints(maxs) should return (1,1)"},
+        {Vector2Class(30.0f, 50.0f), Vector2Class(0.5f, 0.5f), "GetUVsForPoints(center) should return (0.5,0.5)"},
+        {Vector2Class(20.0f, 65.0f), Vector2Class(0.25f, 0.75f), "GetUVsForPoints should convert correctly"},
+    };
+    VerifyKernelCases("GetUVsForPoints (4 points)", GetUVsForPoints, box, uvCases);
+
+    sKernelCase const uvConstCases[] =
+    {
+        {Vector2Class(15.0f, 25.0f), Vector2Class(0.5f, 0.5f), "GetUVsForPoints should work on const AABB2 objects"},
+    };
+    VerifyKernelCases("GetUVsForPoints (const)", GetUVsForPoints, constBox, uvConstCases);
+
+    // The precomputed mapping should agree with the single-call AABB2 methods
+    sAABB2UVMapping const mapping(box);
+    VerifyTestResult(IsMostlyEqual(mapping.GetUVForPoint(Vector2Class(20.0f, 65.0f)), box.AABB2_GetUVForPoint(Vector2Class(20.0f, 65.0f))) &&
+                     IsMostlyEqual(mapping.GetPointAtUV(Vector2Class(0.25f, 0.75f)), box.AABB2_GetPointAtUV(Vector2Class(0.25f, 0.75f))),
+                     "sAABB2UVMapping should match AABB2 GetUVForPoint and GetPointAtUV");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2BatchKernels_AccessorMethods)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 17; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2BatchKernels_MatchesSingleCall()
+{
+#if defined(ENABLE_TestSet_AABB2BatchKernels_MatchesSingleCall)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2BatchKernels_MatchesSingleCall)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numPoints = 1003;     // Not a multiple of 4, so the scalar tail is covered
+
+    std::mt19937                          rng(31u);
+    std::uniform_real_distribution<float> pointDist(-200.0f, 200.0f);
+    std::uniform_real_distribution<float> uvDist(-0.5f, 1.5f);
+
+    AABB2Class const box(-37.5f, 12.25f, 81.0f, 140.0f);
+    Vec2Array        points;
+    Vec2Array        uvs;
+
+    for (int index = 0; index < numPoints; ++index)
+    {
+        points.PushBack(Vector2Class(pointDist(rng), pointDist(rng)));
+        uvs.PushBack(Vector2Class(uvDist(rng), uvDist(rng)));
+    }
+
+    Vec2Array nearestPoints;
+    Vec2Array pointsAtUVs;
+    Vec2Array uvsForPoints;
+    GetNearestPoints(box, points, nearestPoints);
+    GetPointsAtUVs(box, uvs, pointsAtUVs);
+    GetUVsForPoints(box, points, uvsForPoints);
+
+    bool bNearestMatches = nearestPoints.GetCount() == numPoints;
+    bool bPointsMatch    = pointsAtUVs.GetCount() == numPoints;
+    bool bUVsMatch       = uvsForPoints.GetCount() == numPoints;
+
+    for (int index = 0; index < numPoints; ++index)
+    {
+        bNearestMatches = bNearestMatches && nearestPoints.Get(index) == box.AABB2_GetNearestPoint(points.Get(index));
+        bPointsMatch    = bPointsMatch && IsMostlyEqual(pointsAtUVs.Get(index), box.AABB2_GetPointAtUV(uvs.Get(index)));
+        bUVsMatch       = bUVsMatch && IsMostlyEqual(uvsForPoints.Get(index), box.AABB2_GetUVForPoint(points.Get(index)));
+    }
+
+    VerifyTestResult(bNearestMatches, "GetNearestPoints should exactly match GetNearestPoint for every point");
+    VerifyTestResult(bPointsMatch, "GetPointsAtUVs should match GetPointAtUV for every UV");
+    VerifyTestResult(bUVsMatch, "GetUVsForPoints should match GetUVForPoint for every point");
+
+    // In place: UV -> point -> UV should round-trip
+    Vec2Array roundTrip = uvs;
+    GetPointsAtUVs(box, roundTrip, roundTrip);
+    GetUVsForPoints(box, roundTrip, roundTrip);
+
+    bool bRoundTrips = roundTrip.GetCount() == numPoints;
+
+    for (int index = 0; index < numPoints; ++index)
+    {
+        bRoundTrips = bRoundTrips && IsMostlyEqual(roundTrip.Get(index), uvs.Get(index));
+    }
+
+    VerifyTestResult(bRoundTrips, "Batch kernels should work in place and round-trip UVs through points");
+
+    // A NaN in the SIMD loop (index 1) and in the scalar tail (index 5) should clamp the same way
+    float const nan = std::numeric_limits<float>::quiet_NaN();
+    Vec2Array   nanPoints;
+
+    for (int index = 0; index < 6; ++index)
+    {
+        nanPoints.PushBack((index == 1 || index == 5) ? Vector2Class(nan, nan) : Vector2Class(0.0f, 50.0f));
+    }
+
+    GetNearestPoints(box, nanPoints, nearestPoints);
+    VerifyTestResult(nearestPoints.Get(1) == box.m_mins && nearestPoints.Get(5) == box.m_mins,
+                     "GetNearestPoints should clamp NaN coordinates to the box mins in both the SIMD loop and the tail");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2BatchKernels_MatchesSingleCall)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 5; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2BatchKernels_Performance()
+{
+#if defined(ENABLE_TestSet_AABB2BatchKernels_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2BatchKernels_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    printf("  Running batch kernel benchmarks over %d points...\n", BATCH_KERNELS_PERFORMANCE_NUM_POINTS);
+
+    std::mt19937                          rng(42u);
+    std::uniform_real_distribution<float> pointDist(-200.0f, 200.0f);
+
+    AABB2Class const          box(-37.5f, 12.25f, 81.0f, 140.0f);
+    std::vector<Vector2Class> pointList;
+    pointList.reserve(BATCH_KERNELS_PERFORMANCE_NUM_POINTS);
+
+    for (int index = 0; index < BATCH_KERNELS_PERFORMANCE_NUM_POINTS; ++index)
+    {
+        pointList.emplace_back(pointDist(rng), pointDist(rng));
+    }
+
+    Vec2Array const           points(pointList);
+    Vec2Array                 batchOutput;
+    std::vector<Vector2Class> singleOutput(BATCH_KERNELS_PERFORMANCE_NUM_POINTS);
+    PerformanceTimer          timer;
+    float                     checksum = 0.0f;
+
+    // Touch the output streams once so the first timed kernel does not pay for page faults
+    GetNearestPoints(box, points, batchOutput);
+
+    auto const report = [](char const* name, double const singleMicroseconds, double const batchMicroseconds)
+    {
+        printf("    %-16s single %8.3f ms, batch %8.3f ms (%.2fx, %.1f M points/s)\n",
+               name, singleMicroseconds / 1000.0, batchMicroseconds / 1000.0, singleMicroseconds / batchMicroseconds,
+               BATCH_KERNELS_PERFORMANCE_NUM_POINTS / batchMicroseconds);
+    };
+
+    // GetNearestPoint
+    timer.Start();
+    for (int index = 0; index < BATCH_KERNELS_PERFORMANCE_NUM_POINTS; ++index)
+    {
+        singleOutput[index] = box.AABB2_GetNearestPoint(pointList[index]);
+    }
+    timer.Stop();
+    double const singleNearestTime = timer.GetElapsedMicroseconds();
+
+    timer.Start();
+    GetNearestPoints(box, points, batchOutput);
+    timer.Stop();
+    report("GetNearestPoint", singleNearestTime, timer.GetElapsedMicroseconds());
+    checksum += singleOutput.back().x + batchOutput.Get(0).x;
+
+    // GetPointAtUV, treating the points as UVs
+    timer.Start();
+    for (int index = 0; index < BATCH_KERNELS_PERFORMANCE_NUM_POINTS; ++index)
+    {
+        singleOutput[index] = box.AABB2_GetPointAtUV(pointList[index]);
+    }
+    timer.Stop();
+    double const singlePointTime = timer.GetElapsedMicroseconds();
+
+    timer.Start();
+    GetPointsAtUVs(box, points, batchOutput);
+    timer.Stop();
+    report("GetPointAtUV", singlePointTime, timer.GetElapsedMicroseconds());
+    checksum += singleOutput.back().x + batchOutput.Get(0).x;
+
+    // GetUVForPoint
+    timer.Start();
+    for (int index = 0; index < BATCH_KERNELS_PERFORMANCE_NUM_POINTS; ++index)
+    {
+        singleOutput[index] = box.AABB2_GetUVForPoint(pointList[index]);
+    }
+    timer.Stop();
+    double const singleUVTime = timer.GetElapsedMicroseconds();
+
+    timer.Start();
+    GetUVsForPoints(box, points, batchOutput);
+    timer.Stop();
+    report("GetUVForPoint", singleUVTime, timer.GetElapsedMicroseconds());
+    checksum += singleOutput.back().x + batchOutput.Get(0).x;
+
+    printf("  (checksum %f)\n", checksum);
+    VerifyTestResult(batchOutput.GetCount() == BATCH_KERNELS_PERFORMANCE_NUM_POINTS, "Batch kernel performance tests completed");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2BatchKernels_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_AABB2BatchKernels()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_AABB2BatchKernels)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_AABB2BatchKernels_Vec2Array, "AABB2BatchKernels - Vec2Array");
+    RunTestSet(true, TestSet_AABB2BatchKernels_AccessorMethods, "AABB2BatchKernels - Accessor Methods");
+    RunTestSet(true, TestSet_AABB2BatchKernels_MatchesSingleCall, "AABB2BatchKernels - Matches Single Call");
+    RunTestSet(false, TestSet_AABB2BatchKernels_Performance, "AABB2BatchKernels - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_AABB2BatchKernels)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
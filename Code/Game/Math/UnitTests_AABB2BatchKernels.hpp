@@ -0,0 +1,31 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_AABB2BatchKernels.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_AABB2BatchKernels();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_AABB2BatchKernels_Vec2Array();
+int TestSet_AABB2BatchKernels_AccessorMethods();
+int TestSet_AABB2BatchKernels_MatchesSingleCall();
+int TestSet_AABB2BatchKernels_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_AABB2BatchKernels_Vec2Array
+#define ENABLE_TestSet_AABB2BatchKernels_AccessorMethods
+#define ENABLE_TestSet_AABB2BatchKernels_MatchesSingleCall
+#define ENABLE_TestSet_AABB2BatchKernels_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define BATCH_KERNELS_PERFORMANCE_NUM_POINTS 1000000
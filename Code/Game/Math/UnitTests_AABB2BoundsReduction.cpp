@@ -0,0 +1,236 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_AABB2BoundsReduction.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Math/UnitTests_AABB2BoundsReduction.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Math/AABB2BoundsReduction.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    bool IsBitwiseEqual(AABB2Class const& box1,
+                        AABB2Class const& box2)
+    {
+        return std::memcmp(&box1, &box2, sizeof(AABB2Class)) == 0;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void MakeRandomPoints(size_t const               numPoints,
+                          unsigned int const         seed,
+                          std::vector<Vector2Class>& out_points)
+    {
+        std::mt19937                          rng(seed);
+        std::uniform_real_distribution<float> coordinateDist(-1000.0f, 1000.0f);
+
+        out_points.resize(numPoints);
+
+        for (Vector2Class& point : out_points)
+        {
+            point = Vector2Class(coordinateDist(rng), coordinateDist(rng));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2BoundsReduction_MatchesScalar()
+{
+#if defined(ENABLE_TestSet_AABB2BoundsReduction_MatchesScalar)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2BoundsReduction_MatchesScalar)(start)\n");
+    printf("####################################################################################################\n");
+
+    std::vector<Vector2Class> points;
+
+    // Every size from 1 to 40 exercises each SIMD tail length
+    bool bAllSmallSizesMatch = true;
+
+    for (size_t numPoints = 1; numPoints <= 40; ++numPoints)
+    {
+        MakeRandomPoints(numPoints, static_cast<unsigned int>(numPoints), points);
+        bAllSmallSizesMatch = bAllSmallSizesMatch && IsBitwiseEqual(MakeAABB2BoundsOf(points), MakeAABB2BoundsOfScalar(points));
+    }
+
+    VerifyTestResult(bAllSmallSizesMatch, "MakeAABB2BoundsOf should match the StretchToIncludePoint loop for 1-40 points");
+
+    MakeRandomPoints(100003, 7u, points);
+    AABB2Class const scalarBounds = TimeFunction("MakeAABB2BoundsOfScalar (100003 points)", [&points] { return MakeAABB2BoundsOfScalar(points); });
+    AABB2Class const simdBounds   = TimeFunction("MakeAABB2BoundsOf (100003 points)", [&points] { return MakeAABB2BoundsOf(points); });
+    VerifyTestResult(IsBitwiseEqual(simdBounds, scalarBounds), "MakeAABB2BoundsOf should match the StretchToIncludePoint loop for 100003 points");
+
+    // Stretching a box built from the first point must agree with the engine's own mutator
+    AABB2Class manualBounds(points[0], points[0]);
+    for (Vector2Class const& point : points)
+    {
+        manualBounds.AABB2_StretchToIncludePoint(point);
+    }
+    VerifyTestResult(manualBounds == simdBounds, "MakeAABB2BoundsOf should equal AABB2::StretchToIncludePoint applied in a loop");
+
+    // Multithreaded path, forced to split into several chunks
+    MakeRandomPoints(static_cast<size_t>(BOUNDS_REDUCTION_MIN_POINTS_PER_THREAD) * 8 + 5, 11u, points);
+    AABB2Class const parallelScalar = MakeAABB2BoundsOfScalar(points);
+    AABB2Class const parallelBounds = TimeFunction("MakeAABB2BoundsOfParallel (8 threads)", [&points] { return MakeAABB2BoundsOfParallel(points, 8); });
+    VerifyTestResult(IsBitwiseEqual(parallelBounds, parallelScalar), "MakeAABB2BoundsOfParallel should match the StretchToIncludePoint loop");
+
+    AABB2Class const oddThreadBounds = MakeAABB2BoundsOfParallel(points, 3);
+    VerifyTestResult(IsBitwiseEqual(oddThreadBounds, parallelScalar), "MakeAABB2BoundsOfParallel should match for uneven chunk counts");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2BoundsReduction_MatchesScalar)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 5; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2BoundsReduction_EdgeCases()
+{
+#if defined(ENABLE_TestSet_AABB2BoundsReduction_EdgeCases)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2BoundsReduction_EdgeCases)(start)\n");
+    printf("####################################################################################################\n");
+
+    std::vector<Vector2Class> points;
+
+    VerifyTestResult(IsMostlyEqual(MakeAABB2BoundsOf(points), 0.0f, 0.0f, 0.0f, 0.0f),
+                     "MakeAABB2BoundsOf of no points should return a default AABB2");
+
+    points.emplace_back(3.0f, -4.0f);
+    VerifyTestResult(IsMostlyEqual(MakeAABB2BoundsOf(points), 3.0f, -4.0f, 3.0f, -4.0f),
+                     "MakeAABB2BoundsOf of one point should return a zero-size box at that point");
+
+    // +0 and -0 compare equal; the scalar loop keeps whichever it saw first
+    points = {Vector2Class(0.0f, 5.0f), Vector2Class(-0.0f, -0.0f), Vector2Class(1.0f, 0.0f),
+              Vector2Class(-0.0f, 2.0f), Vector2Class(0.0f, 1.0f), Vector2Class(0.5f, -0.0f)};
+    VerifyTestResult(IsBitwiseEqual(MakeAABB2BoundsOf(points), MakeAABB2BoundsOfScalar(points)),
+                     "MakeAABB2BoundsOf should preserve the scalar loop's sign of zero bounds");
+
+    // NaNs after the first point never win a comparison, so the scalar loop ignores them
+    float const nan = std::numeric_limits<float>::quiet_NaN();
+    MakeRandomPoints(37, 3u, points);
+    points[5]  = Vector2Class(nan, 0.0f);
+    points[16] = Vector2Class(1.0f, nan);
+    VerifyTestResult(IsBitwiseEqual(MakeAABB2BoundsOf(points), MakeAABB2BoundsOfScalar(points)),
+                     "MakeAABB2BoundsOf should ignore NaNs after the first point like the scalar loop");
+
+    points[0] = Vector2Class(nan, nan);
+    VerifyTestResult(IsBitwiseEqual(MakeAABB2BoundsOf(points), MakeAABB2BoundsOfScalar(points)),
+                     "MakeAABB2BoundsOf should propagate a NaN first point like the scalar loop");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2BoundsReduction_EdgeCases)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 5; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2BoundsReduction_Performance()
+{
+#if defined(ENABLE_TestSet_AABB2BoundsReduction_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2BoundsReduction_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    PerformanceTimer          timer;
+    std::vector<Vector2Class> points;
+    float                     checksum = 0.0f;
+
+    // Throughput at several sizes
+    size_t constexpr sizes[] = {1024, 65536, BOUNDS_REDUCTION_PERFORMANCE_LARGE_POINTS};
+
+    for (size_t const numPoints : sizes)
+    {
+        MakeRandomPoints(numPoints, 99u, points);
+
+        timer.Start();
+        for (int repeat = 0; repeat < BOUNDS_REDUCTION_PERFORMANCE_REPEATS; ++repeat)
+        {
+            checksum += MakeAABB2BoundsOfScalar(points).m_maxs.x;
+        }
+        timer.Stop();
+        double const scalarTime = timer.GetElapsedMicroseconds() / BOUNDS_REDUCTION_PERFORMANCE_REPEATS;
+
+        timer.Start();
+        for (int repeat = 0; repeat < BOUNDS_REDUCTION_PERFORMANCE_REPEATS; ++repeat)
+        {
+            checksum += MakeAABB2BoundsOf(points).m_maxs.x;
+        }
+        timer.Stop();
+        double const simdTime = timer.GetElapsedMicroseconds() / BOUNDS_REDUCTION_PERFORMANCE_REPEATS;
+
+        printf("    %zu points: scalar %.1f Mpts/s, SIMD %.1f Mpts/s (%.2fx)\n",
+               numPoints,
+               numPoints / scalarTime,
+               numPoints / simdTime,
+               scalarTime / simdTime);
+    }
+
+    // Core scaling on the largest input
+    MakeRandomPoints(BOUNDS_REDUCTION_PERFORMANCE_LARGE_POINTS, 99u, points);
+    int const maxThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    double    oneThreadTime = 0.0;
+
+    for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+    {
+        timer.Start();
+        for (int repeat = 0; repeat < BOUNDS_REDUCTION_PERFORMANCE_REPEATS; ++repeat)
+        {
+            checksum += MakeAABB2BoundsOfParallel(points, numThreads).m_mins.y;
+        }
+        timer.Stop();
+        double const parallelTime = timer.GetElapsedMicroseconds() / BOUNDS_REDUCTION_PERFORMANCE_REPEATS;
+
+        if (numThreads == 1)
+        {
+            oneThreadTime = parallelTime;
+        }
+
+        printf("    %d thread(s), %d points: %.3f us, %.1f Mpts/s, speedup %.2fx\n",
+               numThreads, BOUNDS_REDUCTION_PERFORMANCE_LARGE_POINTS,
+               parallelTime,
+               BOUNDS_REDUCTION_PERFORMANCE_LARGE_POINTS / parallelTime,
+               oneThreadTime / parallelTime);
+    }
+
+    VerifyTestResult(checksum == checksum, "AABB2 bounds reduction performance tests completed");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2BoundsReduction_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_AABB2BoundsReduction()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_AABB2BoundsReduction)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_AABB2BoundsReduction_MatchesScalar, "AABB2BoundsReduction - Matches Scalar");
+    RunTestSet(true, TestSet_AABB2BoundsReduction_EdgeCases, "AABB2BoundsReduction - Edge Cases");
+    RunTestSet(false, TestSet_AABB2BoundsReduction_Performance, "AABB2BoundsReduction - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_AABB2BoundsReduction)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
@@ -0,0 +1,30 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_AABB2BoundsReduction.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_AABB2BoundsReduction();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_AABB2BoundsReduction_MatchesScalar();
+int TestSet_AABB2BoundsReduction_EdgeCases();
+int TestSet_AABB2BoundsReduction_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_AABB2BoundsReduction_MatchesScalar
+#define ENABLE_TestSet_AABB2BoundsReduction_EdgeCases
+#define ENABLE_TestSet_AABB2BoundsReduction_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define BOUNDS_REDUCTION_PERFORMANCE_LARGE_POINTS 4194304
+#define BOUNDS_REDUCTION_PERFORMANCE_REPEATS 10
@@ -0,0 +1,465 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_AABB2LooseQuadtree.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Math/UnitTests_AABB2LooseQuadtree.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Math/AABB2LooseQuadtree.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    AABB2Class MakeRandomBox(std::mt19937& rng,
+                             float const   worldSize,
+                             float const   maxBoxSize)
+    {
+        // Centers may fall slightly outside the world so the root's overflow list is exercised
+        std::uniform_real_distribution<float> positionDist(-0.05f * worldSize, 1.05f * worldSize);
+        std::uniform_real_distribution<float> sizeDist(0.0f, 1.0f);
+
+        // Squared distribution: mostly small boxes, a few large ones
+        float const width  = maxBoxSize * sizeDist(rng) * sizeDist(rng);
+        float const height = maxBoxSize * sizeDist(rng) * sizeDist(rng);
+        float const minX   = positionDist(rng);
+        float const minY   = positionDist(rng);
+
+        return AABB2Class(minX, minY, minX + width, minY + height);
+    }
+
+    //------------------------------------------------------------------------------------------------
+    bool DoBoxesOverlap(AABB2Class const& a,
+                        AABB2Class const& b)
+    {
+        return
+            a.AABB2_Mins.x <= b.AABB2_Maxs.x && b.AABB2_Mins.x <= a.AABB2_Maxs.x &&
+            a.AABB2_Mins.y <= b.AABB2_Maxs.y && b.AABB2_Mins.y <= a.AABB2_Maxs.y;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Brute-force reference over the live slots of a box list
+    void BruteForceQueryBox(std::vector<AABB2Class> const& boxes,
+                            std::vector<bool> const&       isAlive,
+                            AABB2Class const&              query,
+                            std::vector<int>&              out_objectIDs)
+    {
+        out_objectIDs.clear();
+
+        for (int index = 0; index < static_cast<int>(boxes.size()); ++index)
+        {
+            if (isAlive[index] && DoBoxesOverlap(boxes[index], query))
+            {
+                out_objectIDs.push_back(index);
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------
+    bool AreIDListsEqual(std::vector<int> a,
+                         std::vector<int> b)
+    {
+        std::sort(a.begin(), a.end());
+        std::sort(b.begin(), b.end());
+
+        return a == b;
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2LooseQuadtree_Basics()
+{
+#if defined(ENABLE_TestSet_AABB2LooseQuadtree_Basics)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2LooseQuadtree_Basics)(start)\n");
+    printf("####################################################################################################\n");
+
+    sLooseQuadtreeConfig config;
+    config.m_worldBounds = AABB2Class(0.0f, 0.0f, 1024.0f, 1024.0f);
+    config.m_maxDepth    = 6;
+    config.m_looseness   = 2.0f;
+
+    AABB2LooseQuadtree tree(config);
+
+    // With looseness 2, a box of extent e fits at depth floor(log2(1024 / e))
+    VerifyTestResult(tree.GetInsertionDepth(AABB2Class(0.0f, 0.0f, 1024.0f, 1024.0f)) == 0 &&
+                     tree.GetInsertionDepth(AABB2Class(0.0f, 0.0f, 100.0f, 10.0f)) == 3 &&
+                     tree.GetInsertionDepth(AABB2Class(0.0f, 0.0f, 1.0f, 1.0f)) == 6,
+                     "GetInsertionDepth should follow box size and clamp to the max depth");
+
+    VerifyTestResult(tree.GetNumNodesInUse() == 1 && tree.GetNumObjects() == 0,
+                     "An empty quadtree should only hold its root node");
+
+    int const small  = tree.Insert(AABB2Class(10.0f, 10.0f, 12.0f, 12.0f));
+    int const medium = tree.Insert(AABB2Class(500.0f, 500.0f, 600.0f, 540.0f));
+    int const huge   = tree.Insert(AABB2Class(-100.0f, -100.0f, 2000.0f, 50.0f));
+
+    VerifyTestResult(tree.GetObjectDepth(small) == 6 && tree.GetObjectDepth(medium) == 3 && tree.GetObjectDepth(huge) == 0,
+                     "Insert should place objects at the depth matching their size");
+    VerifyTestResult(tree.GetNumObjects() == 3 && tree.GetNumNodesInUse() == 1 + 6 + 3,
+                     "Insert should create only the nodes along each object's path");
+
+    int results[8];
+    int numHits = tree.QueryPoint(Vector2Class(11.0f, 11.0f), results);
+    VerifyTestResult(numHits == 2 && std::min(results[0], results[1]) == small && std::max(results[0], results[1]) == huge,
+                     "QueryPoint should return the small box and the world-spanning box");
+
+    numHits = tree.QueryBox(AABB2Class(590.0f, 530.0f, 700.0f, 700.0f), results);
+    VerifyTestResult(numHits == 1 && results[0] == medium, "QueryBox should treat touching edges as overlapping");
+
+    numHits = tree.QueryBox(AABB2Class(0.0f, 0.0f, 1024.0f, 1024.0f), std::span<int>(results, 1));
+    VerifyTestResult(numHits == 3, "Queries should report the total hit count even when the buffer is too small");
+
+    // Moving within the same cell keeps the node; moving across the world relocates it
+    tree.Update(small, AABB2Class(11.0f, 11.0f, 13.0f, 13.0f));
+    VerifyTestResult(tree.GetNumNodesInUse() == 10 && tree.GetObjectDepth(small) == 6,
+                     "Update within a cell should not touch the node structure");
+
+    tree.Update(small, AABB2Class(1000.0f, 10.0f, 1002.0f, 12.0f));
+    numHits = tree.QueryPoint(Vector2Class(11.0f, 11.0f), results);
+    VerifyTestResult(numHits == 1 && results[0] == huge && tree.GetNumNodesInUse() == 10,
+                     "Update across cells should move the object and recycle the emptied path");
+
+    tree.Remove(small);
+    tree.Remove(medium);
+    VerifyTestResult(tree.GetNumObjects() == 1 && tree.GetNumNodesInUse() == 1,
+                     "Remove should return every emptied node to the pool");
+
+    tree.Update(small, AABB2Class(500.0f, 500.0f, 502.0f, 502.0f));
+    numHits = tree.QueryPoint(Vector2Class(501.0f, 501.0f), results);
+    VerifyTestResult(numHits == 0 && tree.GetNumObjects() == 1 && tree.GetNumNodesInUse() == 1,
+                     "Update should ignore a removed object");
+
+    int const recycled      = tree.Insert(AABB2Class(10.0f, 10.0f, 12.0f, 12.0f));
+    int const recycledAgain = tree.Insert(AABB2Class(20.0f, 20.0f, 22.0f, 22.0f));
+    VerifyTestResult(recycled != recycledAgain && (recycled == medium || recycled == small) && (recycledAgain == medium || recycledAgain == small),
+                     "Insert should recycle each freed object ID once");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2LooseQuadtree_Basics)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 12; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2LooseQuadtree_AgainstBruteForce()
+{
+#if defined(ENABLE_TestSet_AABB2LooseQuadtree_AgainstBruteForce)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2LooseQuadtree_AgainstBruteForce)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr   numObjects = 2000;
+    int constexpr   numFrames  = 30;
+    int constexpr   numQueries = 50;
+    float constexpr worldSize  = 512.0f;
+
+    sLooseQuadtreeConfig config;
+    config.m_worldBounds = AABB2Class(0.0f, 0.0f, worldSize, worldSize);
+    config.m_maxDepth    = 7;
+    config.m_looseness   = 1.5f;
+
+    std::mt19937                       rng(2024u);
+    std::uniform_int_distribution<int> objectDist(0, numObjects - 1);
+    AABB2LooseQuadtree                 tree(config);
+    std::vector<AABB2Class>            boxes;
+    std::vector<bool>                  isAlive(numObjects, true);
+
+    for (int index = 0; index < numObjects; ++index)
+    {
+        boxes.push_back(MakeRandomBox(rng, worldSize, 64.0f));
+        tree.Insert(boxes.back());
+    }
+
+    std::vector<int> results(numObjects);
+    std::vector<int> expected;
+    bool             bBoxQueriesMatch   = true;
+    bool             bPointQueriesMatch = true;
+    bool             bBoundsMatch       = true;
+
+    auto const runQueries = [&]()
+    {
+        for (int query = 0; query < numQueries; ++query)
+        {
+            AABB2Class const queryBox = MakeRandomBox(rng, worldSize, 128.0f);
+            int const        numHits  = tree.QueryBox(queryBox, results);
+            BruteForceQueryBox(boxes, isAlive, queryBox, expected);
+            bBoxQueriesMatch = bBoxQueriesMatch && AreIDListsEqual(std::vector<int>(results.begin(), results.begin() + numHits), expected);
+
+            Vector2Class const point        = queryBox.AABB2_Mins;
+            int const          numPointHits = tree.QueryPoint(point, results);
+            BruteForceQueryBox(boxes, isAlive, AABB2Class(point.x, point.y, point.x, point.y), expected);
+            bPointQueriesMatch = bPointQueriesMatch && AreIDListsEqual(std::vector<int>(results.begin(), results.begin() + numPointHits), expected);
+        }
+    };
+
+    runQueries();
+    VerifyTestResult(bBoxQueriesMatch && bPointQueriesMatch, "Initial queries should match brute force");
+
+    // Churn: 10% of objects move each frame, with a mix of small steps and teleports
+    std::uniform_real_distribution<float> stepDist(-4.0f, 4.0f);
+
+    for (int frame = 0; frame < numFrames; ++frame)
+    {
+        for (int move = 0; move < numObjects / 10; ++move)
+        {
+            int const objectID = objectDist(rng);
+
+            if (!isAlive[objectID])
+            {
+                continue;
+            }
+
+            if (move % 8 == 0)
+            {
+                boxes[objectID] = MakeRandomBox(rng, worldSize, 64.0f);
+            }
+            else
+            {
+                boxes[objectID].AABB2_Translate(Vector2Class(stepDist(rng), stepDist(rng)));
+            }
+
+            tree.Update(objectID, boxes[objectID]);
+        }
+
+        runQueries();
+    }
+
+    VerifyTestResult(bBoxQueriesMatch, "Box queries should match brute force on every churn frame");
+    VerifyTestResult(bPointQueriesMatch, "Point queries should match brute force on every churn frame");
+
+    // Remove a third of the objects, then re-insert some
+    for (int index = 0; index < numObjects; index += 3)
+    {
+        tree.Remove(index);
+        isAlive[index] = false;
+    }
+
+    for (int index = 0; index < numObjects; index += 9)
+    {
+        AABB2Class const box      = MakeRandomBox(rng, worldSize, 64.0f);
+        int const        objectID = tree.Insert(box);
+        bBoundsMatch              = bBoundsMatch && !isAlive[objectID];
+        boxes[objectID]           = box;
+        isAlive[objectID]         = true;
+    }
+
+    for (int index = 0; index < numObjects; ++index)
+    {
+        if (isAlive[index])
+        {
+            AABB2Class const& stored = tree.GetObjectBounds(index);
+            bBoundsMatch             = bBoundsMatch && stored.AABB2_Mins == boxes[index].AABB2_Mins && stored.AABB2_Maxs == boxes[index].AABB2_Maxs;
+        }
+    }
+
+    bBoxQueriesMatch   = true;
+    bPointQueriesMatch = true;
+    runQueries();
+    VerifyTestResult(bBoxQueriesMatch && bPointQueriesMatch && bBoundsMatch,
+                     "Queries should match brute force after removals and re-insertions");
+
+    int const liveCount = static_cast<int>(std::count(isAlive.begin(), isAlive.end(), true));
+    VerifyTestResult(tree.GetNumObjects() == liveCount, "GetNumObjects should match the number of live objects");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2LooseQuadtree_AgainstBruteForce)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 5; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2LooseQuadtree_Performance()
+{
+#if defined(ENABLE_TestSet_AABB2LooseQuadtree_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2LooseQuadtree_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    printf("  Running loose quadtree churn benchmark: %d objects, 10%% moving per frame, %d frames, %d queries per frame...\n",
+           LOOSE_QUADTREE_PERFORMANCE_NUM_OBJECTS, LOOSE_QUADTREE_PERFORMANCE_NUM_FRAMES, LOOSE_QUADTREE_PERFORMANCE_NUM_QUERIES);
+
+    float constexpr worldSize = 4096.0f;
+    int constexpr   numMoving = LOOSE_QUADTREE_PERFORMANCE_NUM_OBJECTS / 10;
+
+    sLooseQuadtreeConfig config;
+    config.m_worldBounds = AABB2Class(0.0f, 0.0f, worldSize, worldSize);
+    config.m_maxDepth    = 8;
+    config.m_looseness   = 2.0f;
+
+    std::mt19937                          rng(42u);
+    std::uniform_int_distribution<int>    objectDist(0, LOOSE_QUADTREE_PERFORMANCE_NUM_OBJECTS - 1);
+    std::uniform_real_distribution<float> stepDist(-8.0f, 8.0f);
+    std::vector<AABB2Class>               boxes;
+
+    for (int index = 0; index < LOOSE_QUADTREE_PERFORMANCE_NUM_OBJECTS; ++index)
+    {
+        boxes.push_back(MakeRandomBox(rng, worldSize, 96.0f));
+    }
+
+    // Pre-generate per-frame moves and queries so every variant sees identical work
+    struct sMove
+    {
+        int          m_objectID;
+        Vector2Class m_step;
+    };
+
+    std::vector<sMove>      moves;
+    std::vector<AABB2Class> queries;
+
+    for (int frame = 0; frame < LOOSE_QUADTREE_PERFORMANCE_NUM_FRAMES; ++frame)
+    {
+        for (int move = 0; move < numMoving; ++move)
+        {
+            moves.push_back({objectDist(rng), Vector2Class(stepDist(rng), stepDist(rng))});
+        }
+
+        for (int query = 0; query < LOOSE_QUADTREE_PERFORMANCE_NUM_QUERIES; ++query)
+        {
+            queries.push_back(MakeRandomBox(rng, worldSize, 256.0f));
+        }
+    }
+
+    PerformanceTimer timer;
+    std::vector<int> results(LOOSE_QUADTREE_PERFORMANCE_NUM_OBJECTS);
+    size_t           quadtreeHits = 0;
+    size_t           rebuildHits  = 0;
+    size_t           bruteHits    = 0;
+
+    // Incremental updates
+    {
+        std::vector<AABB2Class> frameBoxes = boxes;
+        AABB2LooseQuadtree      tree(config);
+
+        for (AABB2Class const& box : frameBoxes)
+        {
+            tree.Insert(box);
+        }
+
+        double updateTime = 0.0;
+        double queryTime  = 0.0;
+
+        for (int frame = 0; frame < LOOSE_QUADTREE_PERFORMANCE_NUM_FRAMES; ++frame)
+        {
+            timer.Start();
+            for (int move = frame * numMoving; move < (frame + 1) * numMoving; ++move)
+            {
+                AABB2Class& box = frameBoxes[moves[move].m_objectID];
+                box.AABB2_Translate(moves[move].m_step);
+                tree.Update(moves[move].m_objectID, box);
+            }
+            timer.Stop();
+            updateTime += timer.GetElapsedMicroseconds();
+
+            timer.Start();
+            for (int query = frame * LOOSE_QUADTREE_PERFORMANCE_NUM_QUERIES; query < (frame + 1) * LOOSE_QUADTREE_PERFORMANCE_NUM_QUERIES; ++query)
+            {
+                quadtreeHits += tree.QueryBox(queries[query], results);
+            }
+            timer.Stop();
+            queryTime += timer.GetElapsedMicroseconds();
+        }
+
+        printf("    Quadtree incremental: update %.3f us/frame, query %.3f us/frame, %d nodes in use\n",
+               updateTime / LOOSE_QUADTREE_PERFORMANCE_NUM_FRAMES,
+               queryTime / LOOSE_QUADTREE_PERFORMANCE_NUM_FRAMES,
+               tree.GetNumNodesInUse());
+    }
+
+    // Full rebuild every frame
+    {
+        std::vector<AABB2Class> frameBoxes = boxes;
+        AABB2LooseQuadtree      tree(config);
+        double                  rebuildTime = 0.0;
+
+        for (int frame = 0; frame < LOOSE_QUADTREE_PERFORMANCE_NUM_FRAMES; ++frame)
+        {
+            timer.Start();
+            for (int move = frame * numMoving; move < (frame + 1) * numMoving; ++move)
+            {
+                frameBoxes[moves[move].m_objectID].AABB2_Translate(moves[move].m_step);
+            }
+
+            tree.Clear();
+
+            for (AABB2Class const& box : frameBoxes)
+            {
+                tree.Insert(box);
+            }
+            timer.Stop();
+            rebuildTime += timer.GetElapsedMicroseconds();
+
+            for (int query = frame * LOOSE_QUADTREE_PERFORMANCE_NUM_QUERIES; query < (frame + 1) * LOOSE_QUADTREE_PERFORMANCE_NUM_QUERIES; ++query)
+            {
+                rebuildHits += tree.QueryBox(queries[query], results);
+            }
+        }
+
+        printf("    Quadtree rebuild:     rebuild %.3f us/frame\n", rebuildTime / LOOSE_QUADTREE_PERFORMANCE_NUM_FRAMES);
+    }
+
+    // Brute-force queries
+    {
+        std::vector<AABB2Class> frameBoxes = boxes;
+        std::vector<bool> const isAlive(frameBoxes.size(), true);
+        std::vector<int>        expected;
+        double                  queryTime = 0.0;
+
+        for (int frame = 0; frame < LOOSE_QUADTREE_PERFORMANCE_NUM_FRAMES; ++frame)
+        {
+            for (int move = frame * numMoving; move < (frame + 1) * numMoving; ++move)
+            {
+                frameBoxes[moves[move].m_objectID].AABB2_Translate(moves[move].m_step);
+            }
+
+            timer.Start();
+            for (int query = frame * LOOSE_QUADTREE_PERFORMANCE_NUM_QUERIES; query < (frame + 1) * LOOSE_QUADTREE_PERFORMANCE_NUM_QUERIES; ++query)
+            {
+                BruteForceQueryBox(frameBoxes, isAlive, queries[query], expected);
+                bruteHits += expected.size();
+            }
+            timer.Stop();
+            queryTime += timer.GetElapsedMicroseconds();
+        }
+
+        printf("    Brute force:          query %.3f us/frame\n", queryTime / LOOSE_QUADTREE_PERFORMANCE_NUM_FRAMES);
+    }
+
+    VerifyTestResult(quadtreeHits == bruteHits && rebuildHits == bruteHits, "LooseQuadtree performance tests completed with matching hit counts");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2LooseQuadtree_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_AABB2LooseQuadtree()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_AABB2LooseQuadtree)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_AABB2LooseQuadtree_Basics, "AABB2LooseQuadtree - Basics");
+    RunTestSet(true, TestSet_AABB2LooseQuadtree_AgainstBruteForce, "AABB2LooseQuadtree - Against Brute Force");
+    RunTestSet(false, TestSet_AABB2LooseQuadtree_Performance, "AABB2LooseQuadtree - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_AABB2LooseQuadtree)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
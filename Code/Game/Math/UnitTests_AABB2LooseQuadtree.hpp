@@ -0,0 +1,31 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_AABB2LooseQuadtree.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_AABB2LooseQuadtree();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_AABB2LooseQuadtree_Basics();
+int TestSet_AABB2LooseQuadtree_AgainstBruteForce();
+int TestSet_AABB2LooseQuadtree_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_AABB2LooseQuadtree_Basics
+#define ENABLE_TestSet_AABB2LooseQuadtree_AgainstBruteForce
+#define ENABLE_TestSet_AABB2LooseQuadtree_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define LOOSE_QUADTREE_PERFORMANCE_NUM_OBJECTS 10000
+#define LOOSE_QUADTREE_PERFORMANCE_NUM_FRAMES 100
+#define LOOSE_QUADTREE_PERFORMANCE_NUM_QUERIES 200
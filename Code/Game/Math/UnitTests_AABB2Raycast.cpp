@@ -0,0 +1,421 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_AABB2Raycast.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Math/UnitTests_AABB2Raycast.hpp"
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Math/AABB2Array.hpp"
+#include "Game/Math/AABB2Raycast.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    bool AreResultsEqual(sAABB2RaycastResult const& a,
+                         sAABB2RaycastResult const& b)
+    {
+        return
+            a.m_didImpact == b.m_didImpact &&
+            IsMostlyEqual(a.m_impactDistance, b.m_impactDistance) &&
+            IsMostlyEqual(a.m_impactPosition, b.m_impactPosition) &&
+            a.m_impactNormal == b.m_impactNormal;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Casts with both the SIMD and the scalar path and checks they agree before returning the result
+    sAABB2RaycastResult RaycastBoth(Vector2Class const& startPos,
+                                    Vector2Class const& fwdNormal,
+                                    float const         maxDistance,
+                                    AABB2Class const&   box,
+                                    bool&               out_bPathsAgree)
+    {
+        sAABB2RaycastResult const simdResult   = RaycastVsAABB2(startPos, fwdNormal, maxDistance, box);
+        sAABB2RaycastResult const scalarResult = RaycastVsAABB2Scalar(startPos, fwdNormal, maxDistance, box);
+        out_bPathsAgree                        = out_bPathsAgree && AreResultsEqual(simdResult, scalarResult);
+
+        return simdResult;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // A quarter of the rays are axis-parallel (some with -0 components), and a quarter start exactly
+    // on a box edge, so the inf/NaN-prone slab cases are exercised alongside random directions.
+    void MakeRandomRay(std::mt19937&                  rng,
+                       std::vector<AABB2Class> const& boxes,
+                       Vector2Class&                  out_startPos,
+                       Vector2Class&                  out_fwdNormal,
+                       float&                         out_maxDistance)
+    {
+        std::uniform_real_distribution<float> positionDist(-10.0f, 110.0f);
+        std::uniform_real_distribution<float> angleDist(0.0f, 360.0f);
+        std::uniform_real_distribution<float> distanceDist(0.0f, 150.0f);
+        std::uniform_int_distribution<int>    caseDist(0, 3);
+        std::uniform_int_distribution<int>    boxDist(0, static_cast<int>(boxes.size()) - 1);
+
+        Vector2Class const axisDirections[] =
+        {
+            Vector2Class(1.0f, 0.0f), Vector2Class(-1.0f, 0.0f), Vector2Class(0.0f, 1.0f), Vector2Class(0.0f, -1.0f),
+            Vector2Class(1.0f, -0.0f), Vector2Class(-1.0f, -0.0f), Vector2Class(-0.0f, 1.0f), Vector2Class(-0.0f, -1.0f),
+        };
+
+        out_startPos    = Vector2Class(positionDist(rng), positionDist(rng));
+        out_fwdNormal   = Vector2Class::MakeFromPolarDegrees(angleDist(rng));
+        out_maxDistance = distanceDist(rng);
+
+        switch (caseDist(rng))
+        {
+        case 0:
+            out_fwdNormal = axisDirections[caseDist(rng) * 2 + (caseDist(rng) & 1)];
+            break;
+
+        case 1:
+        {
+            AABB2Class const& box = boxes[boxDist(rng)];
+            out_fwdNormal         = axisDirections[caseDist(rng)];
+            out_startPos.x        = (caseDist(rng) & 1) ? box.AABB2_Mins.x : box.AABB2_Maxs.x;
+            out_startPos.y        = (caseDist(rng) & 1) ? box.AABB2_Mins.y : box.AABB2_Maxs.y;
+            break;
+        }
+
+        default:
+            break;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2Raycast_SingleBox()
+{
+#if defined(ENABLE_TestSet_AABB2Raycast_SingleBox)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2Raycast_SingleBox)(start)\n");
+    printf("####################################################################################################\n");
+
+    AABB2Class const box(10.0f, 10.0f, 20.0f, 20.0f);
+    bool             bPathsAgree = true;
+
+    sAABB2RaycastResult result = TimeFunction("RaycastVsAABB2 (west face)", [&box]()
+    {
+        return RaycastVsAABB2(Vector2Class(0.0f, 15.0f), Vector2Class(1.0f, 0.0f), 100.0f, box);
+    });
+    RaycastBoth(Vector2Class(0.0f, 15.0f), Vector2Class(1.0f, 0.0f), 100.0f, box, bPathsAgree);
+    VerifyTestResult(result.m_didImpact && IsMostlyEqual(result.m_impactDistance, 10.0f) &&
+                     IsMostlyEqual(result.m_impactPosition, 10.0f, 15.0f) && result.m_impactNormal == Vector2Class(-1.0f, 0.0f),
+                     "RaycastVsAABB2 should hit the west face at distance 10 with normal (-1, 0)");
+
+    result = RaycastBoth(Vector2Class(30.0f, 15.0f), Vector2Class(-1.0f, -0.0f), 100.0f, box, bPathsAgree);
+    VerifyTestResult(result.m_didImpact && IsMostlyEqual(result.m_impactDistance, 10.0f) && result.m_impactNormal == Vector2Class(1.0f, 0.0f),
+                     "RaycastVsAABB2 should hit the east face with a -0 direction component");
+
+    result = RaycastBoth(Vector2Class(0.0f, 25.0f), Vector2Class(1.0f, 0.0f), 100.0f, box, bPathsAgree);
+    VerifyTestResult(!result.m_didImpact && IsMostlyEqual(result.m_impactDistance, 100.0f) && IsMostlyEqual(result.m_impactPosition, 100.0f, 25.0f),
+                     "RaycastVsAABB2 should miss an axis-parallel ray outside the slab and report the full ray");
+
+    result = RaycastBoth(Vector2Class(0.0f, 20.0f), Vector2Class(1.0f, 0.0f), 100.0f, box, bPathsAgree);
+    VerifyTestResult(result.m_didImpact && IsMostlyEqual(result.m_impactDistance, 10.0f),
+                     "RaycastVsAABB2 should hit when an axis-parallel ray runs exactly along an edge");
+
+    result = RaycastBoth(Vector2Class(15.0f, 15.0f), Vector2Class(0.0f, 1.0f), 100.0f, box, bPathsAgree);
+    VerifyTestResult(result.m_didImpact && result.m_impactDistance == 0.0f && result.m_impactNormal == Vector2Class(-0.0f, -1.0f),
+                     "RaycastVsAABB2 should hit at distance 0 with normal -fwd when starting inside");
+
+    result = RaycastBoth(Vector2Class(0.0f, 15.0f), Vector2Class(1.0f, 0.0f), 5.0f, box, bPathsAgree);
+    bool const bShortMisses = !result.m_didImpact;
+    result = RaycastBoth(Vector2Class(0.0f, 15.0f), Vector2Class(-1.0f, 0.0f), 100.0f, box, bPathsAgree);
+    VerifyTestResult(bShortMisses && !result.m_didImpact,
+                     "RaycastVsAABB2 should miss when the box is beyond maxDistance or behind the ray");
+
+    Vector2Class const diagonal = Vector2Class(1.0f, 1.0f).GetNormalized();
+    result = RaycastBoth(Vector2Class(0.0f, 0.0f), diagonal, 100.0f, box, bPathsAgree);
+    VerifyTestResult(result.m_didImpact && IsMostlyEqual(result.m_impactPosition, 10.0f, 10.0f) && result.m_impactNormal == Vector2Class(-1.0f, 0.0f),
+                     "RaycastVsAABB2 should hit a corner exactly and report the X face normal on a tie");
+
+    result = SegmentCastVsAABB2(Vector2Class(0.0f, 15.0f), Vector2Class(5.0f, 15.0f), box);
+    bool const bShortSegmentMisses = !result.m_didImpact && IsMostlyEqual(result.m_impactPosition, 5.0f, 15.0f);
+    result = SegmentCastVsAABB2(Vector2Class(0.0f, 15.0f), Vector2Class(12.0f, 15.0f), box);
+    VerifyTestResult(bShortSegmentMisses && result.m_didImpact && IsMostlyEqual(result.m_impactDistance, 10.0f),
+                     "SegmentCastVsAABB2 should only hit when the segment reaches the box");
+
+    result = SegmentCastVsAABB2(Vector2Class(12.0f, 12.0f), Vector2Class(12.0f, 12.0f), box);
+    bool const bPointInsideHits = result.m_didImpact && result.m_impactDistance == 0.0f;
+    result = SegmentCastVsAABB2(Vector2Class(2.0f, 2.0f), Vector2Class(2.0f, 2.0f), box);
+    VerifyTestResult(bPointInsideHits && !result.m_didImpact,
+                     "SegmentCastVsAABB2 should treat a zero-length segment as a point test");
+
+    VerifyTestResult(bPathsAgree, "RaycastVsAABB2 and RaycastVsAABB2Scalar should agree on every case above");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2Raycast_SingleBox)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 10; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2Raycast_AgainstScalarReference()
+{
+#if defined(ENABLE_TestSet_AABB2Raycast_AgainstScalarReference)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2Raycast_AgainstScalarReference)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numBoxes = 203;     // Not a multiple of 4, so the scalar tail is covered
+    int constexpr numRays  = 2000;
+
+    std::mt19937                          rng(777u);
+    std::uniform_real_distribution<float> positionDist(0.0f, 100.0f);
+    std::uniform_real_distribution<float> sizeDist(0.0f, 20.0f);
+    std::vector<AABB2Class>               boxes;
+
+    for (int index = 0; index < numBoxes; ++index)
+    {
+        float const minX = positionDist(rng);
+        float const minY = positionDist(rng);
+        boxes.emplace_back(minX, minY, minX + sizeDist(rng), minY + sizeDist(rng));
+    }
+
+    AABB2Array const                 boxArray(boxes);
+    std::vector<sAABB2RaycastResult> batchResults(numBoxes);
+    bool                             bSingleMatches  = true;
+    bool                             bBatchMatches   = true;
+    bool                             bClosestMatches = true;
+    int                              numHits         = 0;
+    int                              numMisses       = 0;
+
+    for (int ray = 0; ray < numRays; ++ray)
+    {
+        Vector2Class startPos;
+        Vector2Class fwdNormal;
+        float        maxDistance;
+        MakeRandomRay(rng, boxes, startPos, fwdNormal, maxDistance);
+
+        int const batchHits = RaycastVsAABB2s(startPos, fwdNormal, maxDistance, boxArray, batchResults.data());
+
+        int   expectedHits    = 0;
+        int   expectedClosest = -1;
+        float closestDistance = 0.0f;
+
+        for (int index = 0; index < numBoxes; ++index)
+        {
+            sAABB2RaycastResult const reference = RaycastVsAABB2Scalar(startPos, fwdNormal, maxDistance, boxes[index]);
+            sAABB2RaycastResult const single    = RaycastVsAABB2(startPos, fwdNormal, maxDistance, boxes[index]);
+
+            bSingleMatches = bSingleMatches && AreResultsEqual(single, reference);
+            bBatchMatches  = bBatchMatches && AreResultsEqual(batchResults[index], reference);
+
+            if (reference.m_didImpact)
+            {
+                ++expectedHits;
+
+                if (expectedClosest < 0 || reference.m_impactDistance < closestDistance)
+                {
+                    expectedClosest = index;
+                    closestDistance = reference.m_impactDistance;
+                }
+            }
+        }
+
+        sAABB2RaycastResult closest;
+        int const           closestIndex = RaycastVsAABB2sClosest(startPos, fwdNormal, maxDistance, boxArray, closest);
+
+        bBatchMatches   = bBatchMatches && batchHits == expectedHits;
+        bClosestMatches = bClosestMatches && closestIndex == expectedClosest &&
+                          (closestIndex < 0 ? !closest.m_didImpact : AreResultsEqual(closest, batchResults[closestIndex]));
+
+        numHits   += expectedHits;
+        numMisses += numBoxes - expectedHits;
+    }
+
+    printf("  %d ray-box hits and %d misses compared\n", numHits, numMisses);
+
+    VerifyTestResult(bSingleMatches, "RaycastVsAABB2 should match the scalar reference for random and axis-parallel rays");
+    VerifyTestResult(bBatchMatches, "RaycastVsAABB2s should match the scalar reference for every box");
+    VerifyTestResult(bClosestMatches, "RaycastVsAABB2sClosest should find the lowest-index nearest hit");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2Raycast_AgainstScalarReference)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 3; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2Raycast_Batch()
+{
+#if defined(ENABLE_TestSet_AABB2Raycast_Batch)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2Raycast_Batch)(start)\n");
+    printf("####################################################################################################\n");
+
+    AABB2Array boxes;
+    boxes.PushBack(AABB2Class(10.0f, 10.0f, 20.0f, 20.0f));     // 0: hit at 10
+    boxes.PushBack(AABB2Class(30.0f, 12.0f, 40.0f, 18.0f));     // 1: hit at 30
+    boxes.PushBack(AABB2Class(5.0f, 0.0f, 8.0f, 4.0f));         // 2: below the ray
+    boxes.PushBack(AABB2Class(50.0f, 15.0f, 60.0f, 30.0f));     // 3: ray grazes its bottom edge
+    boxes.PushBack(AABB2Class(-20.0f, 10.0f, -10.0f, 20.0f));   // 4: behind the ray
+    boxes.PushBack(AABB2Class(2.0f, 14.0f, 3.0f, 16.0f));       // 5: nearest, in the scalar tail
+    boxes.PushBack(AABB2Class(100.0f, 0.0f, 110.0f, 100.0f));   // 6: beyond maxDistance
+
+    std::vector<sAABB2RaycastResult> results(boxes.GetCount());
+
+    int const numHits = RaycastVsAABB2s(Vector2Class(0.0f, 15.0f), Vector2Class(1.0f, 0.0f), 80.0f, boxes, results.data());
+    VerifyTestResult(numHits == 4 && results[0].m_didImpact && results[1].m_didImpact && !results[2].m_didImpact &&
+                     results[3].m_didImpact && !results[4].m_didImpact && results[5].m_didImpact && !results[6].m_didImpact,
+                     "RaycastVsAABB2s should report exactly the boxes the ray reaches");
+    VerifyTestResult(IsMostlyEqual(results[1].m_impactDistance, 30.0f) && IsMostlyEqual(results[3].m_impactDistance, 50.0f) &&
+                     IsMostlyEqual(results[5].m_impactDistance, 2.0f),
+                     "RaycastVsAABB2s should report each box's entry distance");
+
+    sAABB2RaycastResult closest;
+    int closestIndex = RaycastVsAABB2sClosest(Vector2Class(0.0f, 15.0f), Vector2Class(1.0f, 0.0f), 80.0f, boxes, closest);
+    VerifyTestResult(closestIndex == 5 && IsMostlyEqual(closest.m_impactDistance, 2.0f) && closest.m_impactNormal == Vector2Class(-1.0f, 0.0f),
+                     "RaycastVsAABB2sClosest should return the nearest box even when it is in the scalar tail");
+
+    closestIndex = SegmentCastVsAABB2sClosest(Vector2Class(45.0f, 15.0f), Vector2Class(0.0f, 15.0f), boxes, closest);
+    VerifyTestResult(closestIndex == 1 && IsMostlyEqual(closest.m_impactPosition, 40.0f, 15.0f) && closest.m_impactNormal == Vector2Class(1.0f, 0.0f),
+                     "SegmentCastVsAABB2sClosest should hit the first box along the segment");
+
+    int const segmentHits = SegmentCastVsAABB2s(Vector2Class(0.0f, 15.0f), Vector2Class(35.0f, 15.0f), boxes, results.data());
+    VerifyTestResult(segmentHits == 3 && results[0].m_didImpact && results[1].m_didImpact && results[5].m_didImpact,
+                     "SegmentCastVsAABB2s should stop at the segment's end");
+
+    closestIndex = RaycastVsAABB2sClosest(Vector2Class(0.0f, 50.0f), Vector2Class(0.0f, 1.0f), 80.0f, boxes, closest);
+    VerifyTestResult(closestIndex == -1 && !closest.m_didImpact && IsMostlyEqual(closest.m_impactPosition, 0.0f, 130.0f),
+                     "RaycastVsAABB2sClosest should return -1 and a full-length miss when nothing is hit");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2Raycast_Batch)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 6; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2Raycast_Performance()
+{
+#if defined(ENABLE_TestSet_AABB2Raycast_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2Raycast_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    printf("  Casting %d rays against %d boxes...\n", RAYCAST_PERFORMANCE_NUM_RAYS, RAYCAST_PERFORMANCE_NUM_BOXES);
+
+    std::mt19937                          rng(42u);
+    std::uniform_real_distribution<float> positionDist(0.0f, 100.0f);
+    std::uniform_real_distribution<float> sizeDist(0.0f, 4.0f);
+    std::vector<AABB2Class>               boxes;
+
+    for (int index = 0; index < RAYCAST_PERFORMANCE_NUM_BOXES; ++index)
+    {
+        float const minX = positionDist(rng);
+        float const minY = positionDist(rng);
+        boxes.emplace_back(minX, minY, minX + sizeDist(rng), minY + sizeDist(rng));
+    }
+
+    std::vector<Vector2Class> startPositions;
+    std::vector<Vector2Class> fwdNormals;
+    std::vector<float>        maxDistances;
+
+    for (int ray = 0; ray < RAYCAST_PERFORMANCE_NUM_RAYS; ++ray)
+    {
+        Vector2Class startPos;
+        Vector2Class fwdNormal;
+        float        maxDistance;
+        MakeRandomRay(rng, boxes, startPos, fwdNormal, maxDistance);
+        startPositions.push_back(startPos);
+        fwdNormals.push_back(fwdNormal);
+        maxDistances.push_back(maxDistance);
+    }
+
+    AABB2Array const                 boxArray(boxes);
+    std::vector<sAABB2RaycastResult> results(RAYCAST_PERFORMANCE_NUM_BOXES);
+    PerformanceTimer                 timer;
+    double constexpr                 numCasts = static_cast<double>(RAYCAST_PERFORMANCE_NUM_RAYS) * RAYCAST_PERFORMANCE_NUM_BOXES;
+    int                              scalarHits  = 0;
+    int                              singleHits  = 0;
+    int                              batchHits   = 0;
+    int                              closestHits = 0;
+
+    auto const report = [numCasts](char const* name, double const microseconds)
+    {
+        printf("    %-34s %10.3f ms  (%.1f M rays x boxes / s)\n", name, microseconds / 1000.0, numCasts / microseconds);
+    };
+
+    timer.Start();
+    for (int ray = 0; ray < RAYCAST_PERFORMANCE_NUM_RAYS; ++ray)
+    {
+        for (AABB2Class const& box : boxes)
+        {
+            scalarHits += RaycastVsAABB2Scalar(startPositions[ray], fwdNormals[ray], maxDistances[ray], box).m_didImpact ? 1 : 0;
+        }
+    }
+    timer.Stop();
+    report("Scalar reference, one box at a time", timer.GetElapsedMicroseconds());
+
+    timer.Start();
+    for (int ray = 0; ray < RAYCAST_PERFORMANCE_NUM_RAYS; ++ray)
+    {
+        for (AABB2Class const& box : boxes)
+        {
+            singleHits += RaycastVsAABB2(startPositions[ray], fwdNormals[ray], maxDistances[ray], box).m_didImpact ? 1 : 0;
+        }
+    }
+    timer.Stop();
+    report("SIMD, one box at a time", timer.GetElapsedMicroseconds());
+
+    timer.Start();
+    for (int ray = 0; ray < RAYCAST_PERFORMANCE_NUM_RAYS; ++ray)
+    {
+        batchHits += RaycastVsAABB2s(startPositions[ray], fwdNormals[ray], maxDistances[ray], boxArray, results.data());
+    }
+    timer.Stop();
+    report("SIMD batch, all results", timer.GetElapsedMicroseconds());
+
+    timer.Start();
+    for (int ray = 0; ray < RAYCAST_PERFORMANCE_NUM_RAYS; ++ray)
+    {
+        sAABB2RaycastResult closest;
+        closestHits += (RaycastVsAABB2sClosest(startPositions[ray], fwdNormals[ray], maxDistances[ray], boxArray, closest) >= 0) ? 1 : 0;
+    }
+    timer.Stop();
+    report("SIMD batch, closest hit only", timer.GetElapsedMicroseconds());
+
+    VerifyTestResult(scalarHits == singleHits && scalarHits == batchHits && closestHits > 0,
+                     "Raycast performance tests completed with matching hit counts");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2Raycast_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_AABB2Raycast()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_AABB2Raycast)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_AABB2Raycast_SingleBox, "AABB2Raycast - Single Box");
+    RunTestSet(true, TestSet_AABB2Raycast_AgainstScalarReference, "AABB2Raycast - Against Scalar Reference");
+    RunTestSet(true, TestSet_AABB2Raycast_Batch, "AABB2Raycast - Batch");
+    RunTestSet(false, TestSet_AABB2Raycast_Performance, "AABB2Raycast - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_AABB2Raycast)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
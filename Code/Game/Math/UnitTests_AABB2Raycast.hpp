@@ -0,0 +1,32 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_AABB2Raycast.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_AABB2Raycast();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_AABB2Raycast_SingleBox();
+int TestSet_AABB2Raycast_AgainstScalarReference();
+int TestSet_AABB2Raycast_Batch();
+int TestSet_AABB2Raycast_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_AABB2Raycast_SingleBox
+#define ENABLE_TestSet_AABB2Raycast_AgainstScalarReference
+#define ENABLE_TestSet_AABB2Raycast_Batch
+#define ENABLE_TestSet_AABB2Raycast_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define RAYCAST_PERFORMANCE_NUM_BOXES 4096
+#define RAYCAST_PERFORMANCE_NUM_RAYS 1000
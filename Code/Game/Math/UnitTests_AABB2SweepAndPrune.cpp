@@ -0,0 +1,366 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_AABB2SweepAndPrune.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Math/UnitTests_AABB2SweepAndPrune.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Math/AABB2SweepAndPrune.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    bool ArePairListsEqual(std::vector<sOverlapPair> a,
+                           std::vector<sOverlapPair> b)
+    {
+        auto const isPairLess = [](sOverlapPair const& lhs, sOverlapPair const& rhs)
+        {
+            return (lhs.m_proxyA != rhs.m_proxyA) ? (lhs.m_proxyA < rhs.m_proxyA) : (lhs.m_proxyB < rhs.m_proxyB);
+        };
+
+        std::sort(a.begin(), a.end(), isPairLess);
+        std::sort(b.begin(), b.end(), isPairLess);
+
+        return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](sOverlapPair const& lhs, sOverlapPair const& rhs)
+        {
+            return lhs.m_proxyA == rhs.m_proxyA && lhs.m_proxyB == rhs.m_proxyB;
+        });
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void MakeRandomBoxes(std::mt19937& rng,
+                         int const     numBoxes,
+                         float const   worldSize,
+                         std::vector<AABB2Class>& out_boxes)
+    {
+        std::uniform_real_distribution<float> positionDist(0.0f, worldSize);
+        std::uniform_real_distribution<float> sizeDist(4.0f, 12.0f);
+
+        out_boxes.clear();
+
+        for (int index = 0; index < numBoxes; ++index)
+        {
+            float const minX = positionDist(rng);
+            float const minY = positionDist(rng);
+            out_boxes.emplace_back(minX, minY, minX + sizeDist(rng), minY + sizeDist(rng));
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------
+    void MoveBoxes(std::mt19937&            rng,
+                   float const              maxStep,
+                   std::vector<AABB2Class>& boxes)
+    {
+        std::uniform_real_distribution<float> stepDist(-maxStep, maxStep);
+
+        for (AABB2Class& box : boxes)
+        {
+            box.AABB2_Translate(Vector2Class(stepDist(rng), stepDist(rng)));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2SweepAndPrune_Basics()
+{
+#if defined(ENABLE_TestSet_AABB2SweepAndPrune_Basics)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2SweepAndPrune_Basics)(start)\n");
+    printf("####################################################################################################\n");
+
+    AABB2SweepAndPrune broadphase;
+
+    int const boxA = broadphase.AddProxy(AABB2Class(0.0f, 0.0f, 10.0f, 10.0f));
+    int const boxB = broadphase.AddProxy(AABB2Class(5.0f, 5.0f, 15.0f, 15.0f));
+    int const boxC = broadphase.AddProxy(AABB2Class(50.0f, 50.0f, 60.0f, 60.0f));
+
+    TimeAction("Update (3 proxies, first frame)", [&broadphase] { broadphase.Update(); });
+    VerifyTestResult(broadphase.GetNumProxies() == 3, "SweepAndPrune should track 3 proxies after AddProxy");
+    VerifyTestResult(broadphase.IsOverlapping(boxA, boxB) && broadphase.GetNumOverlapPairs() == 1,
+                     "SweepAndPrune should report exactly the A-B overlap");
+    VerifyTestResult(broadphase.GetAddedPairs().size() == 1 && broadphase.GetRemovedPairs().empty(),
+                     "SweepAndPrune should emit one add event for the new A-B pair");
+
+    // Move C onto B; A-B persists, B-C starts
+    broadphase.SetProxyBounds(boxC, AABB2Class(14.0f, 14.0f, 24.0f, 24.0f));
+    broadphase.Update();
+    VerifyTestResult(broadphase.IsOverlapping(boxB, boxC) && !broadphase.IsOverlapping(boxA, boxC),
+                     "SweepAndPrune should detect B-C overlap after C moves onto B");
+    VerifyTestResult(broadphase.GetAddedPairs().size() == 1 && broadphase.GetAddedPairs()[0].m_proxyA == boxB,
+                     "SweepAndPrune should only emit the new B-C pair as added");
+
+    // Move A away; A-B ends
+    broadphase.SetProxyBounds(boxA, AABB2Class(-30.0f, -30.0f, -20.0f, -20.0f));
+    broadphase.Update();
+    VerifyTestResult(!broadphase.IsOverlapping(boxA, boxB) && broadphase.GetRemovedPairs().size() == 1,
+                     "SweepAndPrune should emit a remove event when A leaves B");
+
+    // Touching edges count as overlapping, matching inclusive IsPointInside
+    broadphase.SetProxyBounds(boxA, AABB2Class(-10.0f, 0.0f, 5.0f, 10.0f));
+    broadphase.Update();
+    VerifyTestResult(broadphase.IsOverlapping(boxA, boxB), "SweepAndPrune should treat touching edges as overlapping");
+
+    // Move in and back out within a single update: no net event
+    broadphase.SetProxyBounds(boxA, AABB2Class(-30.0f, -30.0f, -20.0f, -20.0f));
+    broadphase.Update();
+    broadphase.SetProxyBounds(boxA, AABB2Class(100.0f, 100.0f, 110.0f, 110.0f));
+    broadphase.SetProxyBounds(boxA, AABB2Class(-30.0f, -30.0f, -20.0f, -20.0f));
+    broadphase.Update();
+    VerifyTestResult(broadphase.GetAddedPairs().empty() && broadphase.GetRemovedPairs().empty(),
+                     "SweepAndPrune should not emit events when bounds end where they started");
+
+    // Removing a proxy removes all of its pairs
+    broadphase.RemoveProxy(boxB);
+    broadphase.Update();
+    VerifyTestResult(broadphase.GetNumOverlapPairs() == 0 && broadphase.GetRemovedPairs().size() == 1,
+                     "RemoveProxy should remove every pair the proxy was part of");
+    VerifyTestResult(broadphase.GetNumProxies() == 2, "RemoveProxy should decrement the proxy count");
+
+    int const boxD = broadphase.AddProxy(AABB2Class(15.0f, 15.0f, 16.0f, 16.0f));
+    broadphase.Update();
+    VerifyTestResult(boxD == boxB && broadphase.IsOverlapping(boxC, boxD),
+                     "AddProxy should recycle freed IDs after an Update and pair them correctly");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2SweepAndPrune_Basics)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 11; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2SweepAndPrune_AgainstReference()
+{
+#if defined(ENABLE_TestSet_AABB2SweepAndPrune_AgainstReference)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2SweepAndPrune_AgainstReference)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr   numBoxes  = 600;
+    int constexpr   numFrames = 60;
+    float constexpr worldSize = 200.0f;
+
+    std::mt19937            rng(1234u);
+    std::vector<AABB2Class> boxes;
+    MakeRandomBoxes(rng, numBoxes, worldSize, boxes);
+
+    AABB2SweepAndPrune broadphase;
+
+    for (AABB2Class const& box : boxes)
+    {
+        broadphase.AddProxy(box);
+    }
+
+    broadphase.Update();
+
+    std::vector<sOverlapPair> expectedPairs;
+    std::vector<sOverlapPair> actualPairs;
+    std::vector<sOverlapPair> previousPairs;
+
+    AABB2SweepAndPrune::FindOverlapPairsSortAndSweep(boxes, expectedPairs);
+    broadphase.GetOverlapPairs(actualPairs);
+    VerifyTestResult(ArePairListsEqual(actualPairs, expectedPairs),
+                     "Initial SweepAndPrune pairs should match sort-and-sweep rebuild");
+
+    bool bAllFramesMatch = true;
+    bool bAllEventsMatch = true;
+
+    for (int frame = 0; frame < numFrames; ++frame)
+    {
+        previousPairs = actualPairs;
+
+        // Alternate between small and large steps so both coherent and incoherent motion are covered
+        MoveBoxes(rng, (frame % 2 == 0) ? 0.5f : 8.0f, boxes);
+
+        for (int index = 0; index < numBoxes; ++index)
+        {
+            broadphase.SetProxyBounds(index, boxes[index]);
+        }
+
+        broadphase.Update();
+
+        AABB2SweepAndPrune::FindOverlapPairsSortAndSweep(boxes, expectedPairs);
+        broadphase.GetOverlapPairs(actualPairs);
+        bAllFramesMatch = bAllFramesMatch && ArePairListsEqual(actualPairs, expectedPairs);
+
+        // previous + added - removed must reproduce the current set
+        std::vector<sOverlapPair> replayedPairs;
+
+        for (sOverlapPair const& pair : previousPairs)
+        {
+            bool const bWasRemoved = std::any_of(broadphase.GetRemovedPairs().begin(), broadphase.GetRemovedPairs().end(), [&pair](sOverlapPair const& removed)
+            {
+                return removed.m_proxyA == pair.m_proxyA && removed.m_proxyB == pair.m_proxyB;
+            });
+
+            if (!bWasRemoved)
+            {
+                replayedPairs.push_back(pair);
+            }
+        }
+
+        replayedPairs.insert(replayedPairs.end(), broadphase.GetAddedPairs().begin(), broadphase.GetAddedPairs().end());
+        bAllEventsMatch = bAllEventsMatch && ArePairListsEqual(replayedPairs, actualPairs);
+    }
+
+    VerifyTestResult(bAllFramesMatch, "SweepAndPrune pairs should match sort-and-sweep rebuild on every frame");
+    VerifyTestResult(bAllEventsMatch, "SweepAndPrune add/remove events should exactly describe each frame's pair changes");
+
+    // Remove half the proxies and compare again
+    std::vector<AABB2Class> survivingBoxes;
+    std::vector<int>        survivingIDs;
+
+    for (int index = 0; index < numBoxes; ++index)
+    {
+        if (index % 2 == 0)
+        {
+            broadphase.RemoveProxy(index);
+        }
+        else
+        {
+            survivingBoxes.push_back(boxes[index]);
+            survivingIDs.push_back(index);
+        }
+    }
+
+    broadphase.Update();
+    AABB2SweepAndPrune::FindOverlapPairsSortAndSweep(survivingBoxes, expectedPairs);
+
+    for (sOverlapPair& pair : expectedPairs)
+    {
+        pair = {survivingIDs[pair.m_proxyA], survivingIDs[pair.m_proxyB]};
+    }
+
+    broadphase.GetOverlapPairs(actualPairs);
+    VerifyTestResult(ArePairListsEqual(actualPairs, expectedPairs),
+                     "SweepAndPrune pairs should match rebuild after removing half the proxies");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2SweepAndPrune_AgainstReference)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 4; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_AABB2SweepAndPrune_Performance()
+{
+#if defined(ENABLE_TestSet_AABB2SweepAndPrune_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2SweepAndPrune_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    printf("  Running broadphase benchmarks with %d boxes over %d frames...\n",
+           SWEEP_AND_PRUNE_PERFORMANCE_NUM_BOXES, SWEEP_AND_PRUNE_PERFORMANCE_NUM_FRAMES);
+
+    struct sCoherenceCase
+    {
+        char const* m_name;
+        float       m_maxStep;     // Max per-frame translation, in world units (boxes are 4-12 units wide)
+    };
+
+    sCoherenceCase constexpr cases[] =
+    {
+        {"High coherence (step 0.1)", 0.1f},
+        {"Medium coherence (step 2)", 2.0f},
+        {"Low coherence (step 40)", 40.0f},
+    };
+
+    PerformanceTimer timer;
+    size_t           totalPairs = 0;
+
+    for (sCoherenceCase const& coherenceCase : cases)
+    {
+        std::mt19937            rng(42u);
+        std::vector<AABB2Class> boxes;
+        MakeRandomBoxes(rng, SWEEP_AND_PRUNE_PERFORMANCE_NUM_BOXES, 1000.0f, boxes);
+
+        std::vector<std::vector<AABB2Class>> frames;
+        frames.reserve(SWEEP_AND_PRUNE_PERFORMANCE_NUM_FRAMES);
+
+        for (int frame = 0; frame < SWEEP_AND_PRUNE_PERFORMANCE_NUM_FRAMES; ++frame)
+        {
+            MoveBoxes(rng, coherenceCase.m_maxStep, boxes);
+            frames.push_back(boxes);
+        }
+
+        // Incremental sweep-and-prune
+        AABB2SweepAndPrune broadphase;
+
+        for (AABB2Class const& box : frames[0])
+        {
+            broadphase.AddProxy(box);
+        }
+
+        broadphase.Update();
+
+        timer.Start();
+        for (std::vector<AABB2Class> const& frameBoxes : frames)
+        {
+            for (int index = 0; index < static_cast<int>(frameBoxes.size()); ++index)
+            {
+                broadphase.SetProxyBounds(index, frameBoxes[index]);
+            }
+
+            broadphase.Update();
+            totalPairs += broadphase.GetAddedPairs().size();
+        }
+        timer.Stop();
+        double const incrementalTime = timer.GetElapsedMicroseconds();
+
+        // Full rebuild every frame
+        std::vector<sOverlapPair> pairs;
+
+        timer.Start();
+        for (std::vector<AABB2Class> const& frameBoxes : frames)
+        {
+            AABB2SweepAndPrune::FindOverlapPairsSortAndSweep(frameBoxes, pairs);
+            totalPairs += pairs.size();
+        }
+        timer.Stop();
+        double const rebuildTime = timer.GetElapsedMicroseconds();
+
+        printf("    %s: incremental %.3f us/frame, full rebuild %.3f us/frame (%.2fx)\n",
+               coherenceCase.m_name,
+               incrementalTime / SWEEP_AND_PRUNE_PERFORMANCE_NUM_FRAMES,
+               rebuildTime / SWEEP_AND_PRUNE_PERFORMANCE_NUM_FRAMES,
+               rebuildTime / incrementalTime);
+    }
+
+    VerifyTestResult(totalPairs > 0, "SweepAndPrune performance tests completed");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_AABB2SweepAndPrune_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_AABB2SweepAndPrune()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_AABB2SweepAndPrune)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_AABB2SweepAndPrune_Basics, "AABB2SweepAndPrune - Basics");
+    RunTestSet(true, TestSet_AABB2SweepAndPrune_AgainstReference, "AABB2SweepAndPrune - Against Reference");
+    RunTestSet(false, TestSet_AABB2SweepAndPrune_Performance, "AABB2SweepAndPrune - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_AABB2SweepAndPrune)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
@@ -0,0 +1,30 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_AABB2SweepAndPrune.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_AABB2SweepAndPrune();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_AABB2SweepAndPrune_Basics();
+int TestSet_AABB2SweepAndPrune_AgainstReference();
+int TestSet_AABB2SweepAndPrune_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_AABB2SweepAndPrune_Basics
+#define ENABLE_TestSet_AABB2SweepAndPrune_AgainstReference
+#define ENABLE_TestSet_AABB2SweepAndPrune_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define SWEEP_AND_PRUNE_PERFORMANCE_NUM_BOXES 4096
+#define SWEEP_AND_PRUNE_PERFORMANCE_NUM_FRAMES 100
@@ -0,0 +1,333 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_SkylinePacker.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Math/UnitTests_SkylinePacker.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Math/AABB2Utils.hpp"
+#include "Game/Math/SkylinePacker.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // Glyph- and sprite-like sizes: mostly small, occasionally wide or tall
+    void MakeRandomRectDimensions(std::mt19937&         rng,
+                                  int const             numRects,
+                                  std::vector<IntVec2>& out_dimensions)
+    {
+        std::uniform_int_distribution<int> sizeDist(4, 32);
+        std::uniform_int_distribution<int> stretchDist(0, 9);
+
+        out_dimensions.clear();
+
+        for (int index = 0; index < numRects; ++index)
+        {
+            int const stretch = stretchDist(rng);
+            int const width   = sizeDist(rng) * (stretch == 0 ? 3 : 1);
+            int const height  = sizeDist(rng) * (stretch == 1 ? 3 : 1);
+            out_dimensions.emplace_back(width, height);
+        }
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Rasterizes every packed rect, grown by the padding, into a coverage grid; any texel written
+    // twice means two rects (or a rect and a neighbor's padding) overlap
+    bool AreRectsDisjointAndInside(std::vector<sPackedRect> const& rects,
+                                   IntVec2 const&                  atlasDimensions,
+                                   int const                       padding)
+    {
+        std::vector<unsigned char> coverage(static_cast<size_t>(atlasDimensions.x + padding) * (atlasDimensions.y + padding), 0);
+
+        for (sPackedRect const& rect : rects)
+        {
+            if (!rect.m_isPacked)
+            {
+                continue;
+            }
+
+            int const minX = static_cast<int>(rect.m_placement.AABB2_Mins.x);
+            int const minY = static_cast<int>(rect.m_placement.AABB2_Mins.y);
+            int const maxX = static_cast<int>(rect.m_placement.AABB2_Maxs.x);
+            int const maxY = static_cast<int>(rect.m_placement.AABB2_Maxs.y);
+
+            if (minX < 0 || minY < 0 || maxX > atlasDimensions.x || maxY > atlasDimensions.y)
+            {
+                return false;
+            }
+
+            for (int y = minY; y < maxY + padding; ++y)
+            {
+                for (int x = minX; x < maxX + padding; ++x)
+                {
+                    unsigned char& texel = coverage[static_cast<size_t>(y) * (atlasDimensions.x + padding) + x];
+
+                    if (texel != 0)
+                    {
+                        return false;
+                    }
+
+                    texel = 1;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    bool DoUVsMatchPlacements(std::vector<sPackedRect> const& rects,
+                              IntVec2 const&                  atlasDimensions)
+    {
+        AABB2Class const atlasBounds(IntVec2(0, 0), atlasDimensions);
+
+        for (sPackedRect const& rect : rects)
+        {
+            if (rect.m_isPacked && !IsMostlyEqual(GetBoxAtUVs(atlasBounds, rect.m_uvs.AABB2_Mins, rect.m_uvs.AABB2_Maxs), rect.m_placement))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // Atlas width for roughly square packing of the given rects at the target occupancy
+    int GetAtlasWidthFor(std::vector<IntVec2> const& dimensions,
+                         float const                 targetOccupancy)
+    {
+        double totalArea = 0.0;
+
+        for (IntVec2 const& rectDimensions : dimensions)
+        {
+            totalArea += static_cast<double>(rectDimensions.x) * rectDimensions.y;
+        }
+
+        return static_cast<int>(std::ceil(std::sqrt(totalArea / targetOccupancy)));
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_SkylinePacker_Basics()
+{
+#if defined(ENABLE_TestSet_SkylinePacker_Basics)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_SkylinePacker_Basics)(start)\n");
+    printf("####################################################################################################\n");
+
+    // GetBoxAtUVs, as sketched in TestSet_AABB2_UnimplementedMethods
+    AABB2Class const box(10.0f, 20.0f, 50.0f, 80.0f);
+    AABB2Class const subBox = GetBoxAtUVs(box, Vector2Class(0.25f, 0.25f), Vector2Class(0.75f, 0.75f));
+    VerifyTestResult(IsMostlyEqual(subBox, 20.0f, 35.0f, 40.0f, 65.0f), "GetBoxAtUVs should return correct sub-box");
+    VerifyTestResult(IsMostlyEqual(GetUVsForBox(box, subBox), 0.25f, 0.25f, 0.75f, 0.75f), "GetUVsForBox should invert GetBoxAtUVs");
+
+    SkylinePacker packer(IntVec2(64, 64));
+    sPackedRect   rectA;
+    sPackedRect   rectB;
+    sPackedRect   rectC;
+
+    bool const bPackedA = TimeFunction("Insert (first rect)", [&packer, &rectA]() { return packer.Insert(IntVec2(32, 16), rectA); });
+    VerifyTestResult(bPackedA && rectA.m_isPacked && IsMostlyEqual(rectA.m_placement, 0.0f, 0.0f, 32.0f, 16.0f),
+                     "Insert should place the first rect at the atlas mins");
+    VerifyTestResult(IsMostlyEqual(rectA.m_uvs, 0.0f, 0.0f, 0.5f, 0.25f), "Insert should report the placement in atlas UV space");
+
+    packer.Insert(IntVec2(32, 32), rectB);
+    VerifyTestResult(IsMostlyEqual(rectB.m_placement, 32.0f, 0.0f, 64.0f, 32.0f),
+                     "Insert should pick the position with the lowest top edge");
+
+    packer.Insert(IntVec2(32, 8), rectC);
+    VerifyTestResult(IsMostlyEqual(rectC.m_placement, 0.0f, 16.0f, 32.0f, 24.0f),
+                     "Insert should stack on the skyline when that gives the lowest top edge");
+
+    sPackedRect rejected;
+    bool const  bTooWide  = packer.Insert(IntVec2(65, 1), rejected);
+    bool const  bZeroSize = packer.Insert(IntVec2(0, 5), rejected);
+    VerifyTestResult(!bTooWide && !bZeroSize && !rejected.m_isPacked && packer.GetNumPacked() == 3,
+                     "Insert should reject rects that cannot fit or have no area");
+
+    // 16 8x8 rects tile a 32x32 atlas exactly
+    SkylinePacker tilePacker(IntVec2(32, 32));
+    int           numTiles = 0;
+
+    for (int tile = 0; tile < 17; ++tile)
+    {
+        sPackedRect rect;
+        numTiles += tilePacker.Insert(IntVec2(8, 8), rect) ? 1 : 0;
+    }
+
+    VerifyTestResult(numTiles == 16 && IsMostlyEqual(tilePacker.GetOccupancy(), 1.0f) && tilePacker.GetSkylineHeight() == 32,
+                     "Packer should tile equal rects with full occupancy and reject the overflow");
+
+    tilePacker.Reset();
+    VerifyTestResult(tilePacker.GetNumPacked() == 0 && tilePacker.GetSkylineHeight() == 0 && tilePacker.GetOccupancy() == 0.0f,
+                     "Reset should empty the packer");
+
+    SkylinePacker paddedPacker(IntVec2(64, 64), 2);
+    sPackedRect   paddedA;
+    sPackedRect   paddedB;
+    paddedPacker.Insert(IntVec2(10, 10), paddedA);
+    paddedPacker.Insert(IntVec2(10, 10), paddedB);
+    VerifyTestResult(IsMostlyEqual(paddedB.m_placement, 12.0f, 0.0f, 22.0f, 10.0f), "Padding should separate neighboring rects");
+
+    // InsertAll reports results in input order
+    IntVec2 const            bulkDimensions[] = {IntVec2(8, 4), IntVec2(8, 16), IntVec2(100, 100), IntVec2(16, 8)};
+    std::vector<sPackedRect> bulkRects;
+    SkylinePacker            bulkPacker(IntVec2(32, 32));
+    int const                numBulkPacked = bulkPacker.InsertAll(bulkDimensions, bulkRects);
+    VerifyTestResult(numBulkPacked == 3 && bulkRects.size() == 4 && !bulkRects[2].m_isPacked &&
+                     IsMostlyEqual(bulkRects[1].m_placement, 0.0f, 0.0f, 8.0f, 16.0f) &&
+                     IsMostlyEqual(bulkRects[3].m_placement.GetDimensions(), 16.0f, 8.0f),
+                     "InsertAll should pack tallest first and report results in input order");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_SkylinePacker_Basics)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 11; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_SkylinePacker_Occupancy()
+{
+#if defined(ENABLE_TestSet_SkylinePacker_Occupancy)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_SkylinePacker_Occupancy)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numRects = 2000;
+    int constexpr padding  = 1;
+
+    std::mt19937         rng(99u);
+    std::vector<IntVec2> dimensions;
+    MakeRandomRectDimensions(rng, numRects, dimensions);
+
+    // Wide enough for a roughly square result and tall enough that everything fits
+    int const     atlasWidth = GetAtlasWidthFor(dimensions, 0.75f);
+    IntVec2 const atlasDimensions(atlasWidth, atlasWidth * 4);
+
+    SkylinePacker            incrementalPacker(atlasDimensions, padding);
+    std::vector<sPackedRect> incrementalRects(numRects);
+    int                      numIncrementalPacked = 0;
+
+    for (int index = 0; index < numRects; ++index)
+    {
+        numIncrementalPacked += incrementalPacker.Insert(dimensions[index], incrementalRects[index]) ? 1 : 0;
+    }
+
+    SkylinePacker            bulkPacker(atlasDimensions, padding);
+    std::vector<sPackedRect> bulkRects;
+    int const                numBulkPacked = bulkPacker.InsertAll(dimensions, bulkRects);
+
+    printf("  %d rects in a %d-wide atlas: incremental occupancy %.1f%% (height %d), sorted bulk occupancy %.1f%% (height %d)\n",
+           numRects, atlasWidth,
+           incrementalPacker.GetOccupancy() * 100.0f, incrementalPacker.GetSkylineHeight(),
+           bulkPacker.GetOccupancy() * 100.0f, bulkPacker.GetSkylineHeight());
+
+    VerifyTestResult(numIncrementalPacked == numRects && numBulkPacked == numRects, "Every rect should fit in the oversized atlas");
+    VerifyTestResult(AreRectsDisjointAndInside(incrementalRects, atlasDimensions, padding) &&
+                     AreRectsDisjointAndInside(bulkRects, atlasDimensions, padding),
+                     "Packed rects and their padding should never overlap or leave the atlas");
+    VerifyTestResult(DoUVsMatchPlacements(incrementalRects, atlasDimensions) && DoUVsMatchPlacements(bulkRects, atlasDimensions),
+                     "Every UV box should map back onto its placement through GetBoxAtUVs");
+    VerifyTestResult(incrementalPacker.GetOccupancy() >= 0.6f, "Incremental packing should reach at least 60% occupancy");
+    VerifyTestResult(bulkPacker.GetOccupancy() >= 0.8f && bulkPacker.GetOccupancy() >= incrementalPacker.GetOccupancy(),
+                     "Sorted bulk packing should reach at least 80% occupancy and beat incremental packing");
+
+    // Fill a fixed-size atlas until it overflows; unpacked rects must be reported, not misplaced
+    IntVec2 const            smallAtlas(256, 256);
+    SkylinePacker            overflowPacker(smallAtlas, padding);
+    std::vector<sPackedRect> overflowRects;
+    int const                numOverflowPacked = overflowPacker.InsertAll(dimensions, overflowRects);
+    VerifyTestResult(numOverflowPacked > 0 && numOverflowPacked < numRects && AreRectsDisjointAndInside(overflowRects, smallAtlas, padding),
+                     "InsertAll should pack what fits into a full atlas and leave the rest unpacked");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_SkylinePacker_Occupancy)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 6; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_SkylinePacker_Performance()
+{
+#if defined(ENABLE_TestSet_SkylinePacker_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_SkylinePacker_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    std::mt19937     rng(42u);
+    PerformanceTimer timer;
+    int              totalPacked = 0;
+
+    for (int numRects = SKYLINE_PACKER_PERFORMANCE_MIN_RECTS; numRects <= SKYLINE_PACKER_PERFORMANCE_MAX_RECTS; numRects *= 10)
+    {
+        std::vector<IntVec2> dimensions;
+        MakeRandomRectDimensions(rng, numRects, dimensions);
+
+        int const     atlasWidth = GetAtlasWidthFor(dimensions, 0.75f);
+        IntVec2 const atlasDimensions(atlasWidth, atlasWidth * 4);
+
+        SkylinePacker incrementalPacker(atlasDimensions, 1);
+        sPackedRect   rect;
+
+        timer.Start();
+        for (IntVec2 const& rectDimensions : dimensions)
+        {
+            totalPacked += incrementalPacker.Insert(rectDimensions, rect) ? 1 : 0;
+        }
+        timer.Stop();
+        double const incrementalTime = timer.GetElapsedMicroseconds();
+
+        SkylinePacker            bulkPacker(atlasDimensions, 1);
+        std::vector<sPackedRect> bulkRects;
+
+        timer.Start();
+        totalPacked += bulkPacker.InsertAll(dimensions, bulkRects);
+        timer.Stop();
+        double const bulkTime = timer.GetElapsedMicroseconds();
+
+        printf("  %6d rects (%5d-wide atlas): incremental %9.3f ms (%.2f M rects/s, %.1f%%), bulk %9.3f ms (%.2f M rects/s, %.1f%%)\n",
+               numRects, atlasWidth,
+               incrementalTime / 1000.0, numRects / incrementalTime, incrementalPacker.GetOccupancy() * 100.0f,
+               bulkTime / 1000.0, numRects / bulkTime, bulkPacker.GetOccupancy() * 100.0f);
+    }
+
+    VerifyTestResult(totalPacked > 0, "SkylinePacker performance tests completed");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_SkylinePacker_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_SkylinePacker()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_SkylinePacker)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_SkylinePacker_Basics, "SkylinePacker - Basics");
+    RunTestSet(true, TestSet_SkylinePacker_Occupancy, "SkylinePacker - Occupancy");
+    RunTestSet(false, TestSet_SkylinePacker_Performance, "SkylinePacker - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_SkylinePacker)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
@@ -0,0 +1,30 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_SkylinePacker.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_SkylinePacker();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_SkylinePacker_Basics();
+int TestSet_SkylinePacker_Occupancy();
+int TestSet_SkylinePacker_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_SkylinePacker_Basics
+#define ENABLE_TestSet_SkylinePacker_Occupancy
+#define ENABLE_TestSet_SkylinePacker_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define SKYLINE_PACKER_PERFORMANCE_MIN_RECTS 1000
+#define SKYLINE_PACKER_PERFORMANCE_MAX_RECTS 100000
@@ -0,0 +1,449 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_VecN.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Math/UnitTests_VecN.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Math/VecN.hpp"
+#include "Game/Math/VecNExpression.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    // Runs one check for every vector type: the five engine shapes plus sizes with no engine type,
+    // so each behaviour is written once instead of once per type
+    //
+    template <typename Check>
+    bool CheckAllVecNTypes(Check const check)
+    {
+        return check(VecN2()) && check(VecN3()) && check(VecN4()) && check(IntVecN2()) && check(IntVecN3()) && check(VecN<double, 6>());
+    }
+
+    //------------------------------------------------------------------------------------------------
+    // (1, 2, 3, ...) times scale
+    //
+    template <typename VecType>
+    VecType MakeCounting(typename VecType::ComponentType const scale)
+    {
+        VecType result;
+        for (int index = 0; index < VecType::NUM_COMPONENTS; ++index)
+        {
+            result[index] = static_cast<typename VecType::ComponentType>((index + 1) * scale);
+        }
+        return result;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    template <int N>
+    bool IsMostlyEqual(VecN<float, N> const& a,
+                       VecN<float, N> const& b)
+    {
+        for (int index = 0; index < N; ++index)
+        {
+            if (!::IsMostlyEqual(a[index], b[index]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    template <int N>
+    VecNArray<float, N> MakeRandomArray(size_t const   count,
+                                        unsigned const seed)
+    {
+        std::mt19937                          random(seed);
+        std::uniform_real_distribution<float> component(-100.0f, 100.0f);
+        VecNArray<float, N>                   result(count);
+
+        for (size_t elementIndex = 0; elementIndex < count; ++elementIndex)
+        {
+            for (int index = 0; index < N; ++index)
+            {
+                result[elementIndex][index] = component(random);
+            }
+        }
+
+        return result;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    template <int N>
+    struct sPerformanceResult
+    {
+        double m_fusedMicroseconds      = 0.0;
+        double m_unfusedMicroseconds    = 0.0;
+        double m_perElementMicroseconds = 0.0;
+        float  m_checksum               = 0.0f;
+    };
+
+    //------------------------------------------------------------------------------------------------
+    // out = a + b * s - c three ways: one fused expression, one pass per operator through temporary
+    // arrays, and a loop of VecN operators per element
+    //
+    template <int N>
+    sPerformanceResult<N> RunExpressionBenchmark(size_t const count,
+                                                 int const    numIterations)
+    {
+        VecNArray<float, N> const a = MakeRandomArray<N>(count, 1);
+        VecNArray<float, N> const b = MakeRandomArray<N>(count, 2);
+        VecNArray<float, N> const c = MakeRandomArray<N>(count, 3);
+        VecNArray<float, N>       out(count);
+
+        sPerformanceResult<N> result;
+        PerformanceTimer      timer;
+
+        timer.Start();
+        for (int iteration = 0; iteration < numIterations; ++iteration)
+        {
+            float const scale = 1.0f + static_cast<float>(iteration) * 0.01f;
+            out               = a + b * scale - c;
+            result.m_checksum += out[iteration][0];
+        }
+        timer.Stop();
+        result.m_fusedMicroseconds = timer.GetElapsedMicroseconds() / numIterations;
+
+        timer.Start();
+        for (int iteration = 0; iteration < numIterations; ++iteration)
+        {
+            float const               scale  = 1.0f + static_cast<float>(iteration) * 0.01f;
+            VecNArray<float, N> const scaled = b * scale;
+            VecNArray<float, N> const sum    = a + scaled;
+            out                              = sum - c;
+            result.m_checksum               += out[iteration][0];
+        }
+        timer.Stop();
+        result.m_unfusedMicroseconds = timer.GetElapsedMicroseconds() / numIterations;
+
+        timer.Start();
+        for (int iteration = 0; iteration < numIterations; ++iteration)
+        {
+            float const scale = 1.0f + static_cast<float>(iteration) * 0.01f;
+            for (size_t elementIndex = 0; elementIndex < count; ++elementIndex)
+            {
+                out[elementIndex] = a[elementIndex] + b[elementIndex] * scale - c[elementIndex];
+            }
+            result.m_checksum += out[iteration][0];
+        }
+        timer.Stop();
+        result.m_perElementMicroseconds = timer.GetElapsedMicroseconds() / numIterations;
+
+        return result;
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_VecN_Basics()
+{
+#if defined(ENABLE_TestSet_VecN_Basics)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_VecN_Basics)(start)\n");
+    printf("####################################################################################################\n");
+
+    bool const isConstructed = CheckAllVecNTypes([](auto const zero)
+    {
+        using VecType = std::decay_t<decltype(zero)>;
+        using T       = typename VecType::ComponentType;
+
+        VecType const counting = MakeCounting<VecType>(T(1));
+        VecType const uniform  = VecType::MakeUniform(T(7));
+        bool          isValid  = counting[0] == T(1) && counting[1] == T(2) && counting != zero;
+
+        for (int index = 0; index < VecType::NUM_COMPONENTS; ++index)
+        {
+            isValid = isValid && zero[index] == T(0) && uniform[index] == T(7);
+        }
+
+        return isValid && sizeof(VecType) == sizeof(T) * VecType::NUM_COMPONENTS;
+    });
+
+    VecN3 const fromComponents(1.0f, 2, 3.5);
+    IntVecN2    fromFloats(2.9f, -1.0f);
+
+    VerifyTestResult(isConstructed, "VecN should default to zero, index its components and have no padding");
+    VerifyTestResult(fromComponents.z == 3.5f && fromComponents.y == 2.0f && fromFloats == IntVecN2(2, -1), "VecN should construct from mixed arithmetic components");
+
+    bool const isArithmeticCorrect = CheckAllVecNTypes([](auto const zero)
+    {
+        using VecType = std::decay_t<decltype(zero)>;
+        using T       = typename VecType::ComponentType;
+
+        VecType const a = MakeCounting<VecType>(T(1));
+        VecType const b = MakeCounting<VecType>(T(2));
+
+        return a + a == b && b - a == a && -a + a == zero && a * T(2) == b && T(2) * a == b && b / T(2) == a &&
+               a * b == MakeCounting<VecType>(T(1)) * MakeCounting<VecType>(T(2)) && (a * b)[1] == T(8);
+    });
+
+    VerifyTestResult(isArithmeticCorrect, "Every VecN type should share the same operators");
+
+    bool const isCompoundCorrect = CheckAllVecNTypes([](auto const zero)
+    {
+        using VecType = std::decay_t<decltype(zero)>;
+        using T       = typename VecType::ComponentType;
+
+        VecType value = MakeCounting<VecType>(T(1));
+        value        += value;
+        bool isValid  = value == MakeCounting<VecType>(T(2));
+        value        *= T(3);
+        isValid       = isValid && value == MakeCounting<VecType>(T(6));
+        value        /= T(2);
+        isValid       = isValid && value == MakeCounting<VecType>(T(3));
+        value        -= MakeCounting<VecType>(T(3));
+
+        return isValid && value == zero;
+    });
+
+    VerifyTestResult(isCompoundCorrect, "Compound assignment should match the binary operators");
+
+    bool const isLengthCorrect = CheckAllVecNTypes([](auto const zero)
+    {
+        using VecType = std::decay_t<decltype(zero)>;
+        using T       = typename VecType::ComponentType;
+
+        VecType a = zero;
+        a[0]      = T(-3);
+        a[1]      = T(4);
+
+        VecType const b = MakeCounting<VecType>(T(1));
+
+        return a.GetLengthSquared() == T(25) && IsMostlyEqual(static_cast<float>(a.GetLength()), 5.0f) && a.GetTaxicabLength() == T(7) &&
+               DotProduct(a, b) == T(5) && GetDistanceSquared(zero, a) == T(25) && IsMostlyEqual(static_cast<float>(GetDistance(a, zero)), 5.0f);
+    });
+
+    VerifyTestResult(isLengthCorrect, "Lengths, dot products and distances should agree for every VecN type");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_VecN_Basics)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 5; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_VecN_FloatVectors()
+{
+#if defined(ENABLE_TestSet_VecN_FloatVectors)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_VecN_FloatVectors)(start)\n");
+    printf("####################################################################################################\n");
+
+    VecN3 direction(0.0f, 3.0f, 4.0f);
+    direction.Normalize();
+
+    VerifyTestResult(IsMostlyEqual(direction, VecN3(0.0f, 0.6f, 0.8f)) && VecN2().GetNormalized() == VecN2(), "Normalizing should give a unit vector, and leave zero alone");
+
+    VecN4 stretched(1.0f, 1.0f, 1.0f, 1.0f);
+    stretched.SetLength(4.0f);
+
+    VerifyTestResult(IsMostlyEqual(stretched, VecN4::MakeUniform(2.0f)) && IsMostlyEqual(stretched.GetLength(), 4.0f), "SetLength should keep the direction");
+
+    // Float4 goes through SSE; the same values as doubles go through the generic loop
+    VecN4 const          a(1.5f, -2.0f, 3.25f, 8.0f);
+    VecN4 const          b(0.5f, 4.0f, -1.0f, 2.0f);
+    VecN<double, 4> const wideA(1.5, -2.0, 3.25, 8.0);
+    VecN<double, 4> const wideB(0.5, 4.0, -1.0, 2.0);
+    VecN<double, 4> const wideResult = (wideA + wideB) * wideB - wideA / 2.0 * 3.0;
+    VecN4 const           result     = (a + b) * b - a / 2.0f * 3.0f;
+
+    bool isMatching = alignof(VecN4) == 16;
+    for (int index = 0; index < 4; ++index)
+    {
+        isMatching = isMatching && result[index] == static_cast<float>(wideResult[index]);
+    }
+
+    VerifyTestResult(isMatching, "SSE float4 operators should match the generic ones");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_VecN_FloatVectors)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 3; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_VecN_EngineInterop()
+{
+#if defined(ENABLE_TestSet_VecN_EngineInterop)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_VecN_EngineInterop)(start)\n");
+    printf("####################################################################################################\n");
+
+    Vec3 const    vec3    = ToVec3(ToVecN(Vec3(1.0f, 2.0f, 3.0f)));
+    Vec4 const    vec4    = ToVec4(ToVecN(Vec4(1.0f, 2.0f, 3.0f, 4.0f)));
+    IntVec2 const intVec2 = ToIntVec2(ToVecN(IntVec2(-5, 6)));
+    IntVec3 const intVec3 = ToIntVec3(ToVecN(IntVec3(7, -8, 9)));
+
+    VerifyTestResult(vec3.z == 3.0f && vec4.w == 4.0f && intVec2.x == -5 && intVec2.y == 6 && intVec3.y == -8 && intVec3.z == 9,
+                     "Engine vectors should convert to VecN and back unchanged");
+
+    Vector2Class const a(3.0f, -4.0f);
+    Vector2Class const b(-1.5f, 2.0f);
+
+    VerifyTestResult(IsMostlyEqual(ToVec2(ToVecN(a) + ToVecN(b) * 2.0f), a + b * 2.0f) && IsMostlyEqual(ToVecN(a).GetLength(), a.GetLength()) &&
+                     IsMostlyEqual(ToVec2(ToVecN(a).GetNormalized()), a.GetNormalized()),
+                     "VecN2 should compute what Vec2 computes");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_VecN_EngineInterop)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 2; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_VecN_Expressions()
+{
+#if defined(ENABLE_TestSet_VecN_Expressions)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_VecN_Expressions)(start)\n");
+    printf("####################################################################################################\n");
+
+    size_t constexpr count = 1001;
+
+    VecNArray<float, 2> const a = MakeRandomArray<2>(count, 4);
+    VecNArray<float, 2> const b = MakeRandomArray<2>(count, 5);
+    VecNArray<float, 2> const c = MakeRandomArray<2>(count, 6);
+
+    {
+        VecNArray<float, 2> const fused   = a + b * 1.5f - c;
+        bool                      isMatch = fused.GetCount() == count;
+
+        for (size_t index = 0; index < count && isMatch; ++index)
+        {
+            isMatch = IsMostlyEqual(fused[index], a[index] + b[index] * 1.5f - c[index]);
+        }
+
+        VerifyTestResult(isMatch, "A fused expression should match the same operators applied per element");
+    }
+
+    {
+        VecN2 const         offset(10.0f, -20.0f);
+        VecNArray<float, 2> result(count);
+        result = -(a - offset) / 2.0f + a * b;
+
+        bool isMatch = true;
+        for (size_t index = 0; index < count && isMatch; ++index)
+        {
+            isMatch = IsMostlyEqual(result[index], -(a[index] - offset) / 2.0f + a[index] * b[index]);
+        }
+
+        VerifyTestResult(isMatch, "Negation, division, broadcast vectors and component-wise products should fuse too");
+    }
+
+    // Assigning into an operand of the same expression
+    {
+        VecNArray<float, 2> values = a;
+        values += b * 2.0f;
+        values  = values * values;
+
+        bool isMatch = true;
+        for (size_t index = 0; index < count && isMatch; ++index)
+        {
+            VecN2 const expected = a[index] + b[index] * 2.0f;
+            isMatch              = IsMostlyEqual(values[index], expected * expected);
+        }
+
+        VerifyTestResult(isMatch, "An array should be safe to assign from an expression that reads it");
+    }
+
+    {
+        VecNArray<int, 3> ints(4);
+        for (int index = 0; index < 4; ++index)
+        {
+            ints[index] = IntVecN3(index, -index, index * 2);
+        }
+
+        VecNArray<int, 3> const result = ints * 3 - ints / 2 + IntVecN3(1, 1, 1);
+
+        VerifyTestResult(result[3] == IntVecN3(9 - 1 + 1, -9 + 1 + 1, 18 - 3 + 1) && result[0] == IntVecN3(1, 1, 1), "Integer expressions should follow integer arithmetic");
+    }
+
+    {
+        std::vector<VecN4>  external(count);
+        VecNArray<float, 4> wide = MakeRandomArray<4>(count, 7);
+        EvaluateVecNExpression(std::span<VecN4>(external), wide * 0.5f + VecN4(1.0f, 2.0f, 3.0f, 4.0f));
+
+        VecNArray<float, 4> resized;
+        resized = wide - wide;
+
+        VerifyTestResult(IsMostlyEqual(external[17], wide[17] * 0.5f + VecN4(1.0f, 2.0f, 3.0f, 4.0f)) && resized.GetCount() == count && resized[count - 1] == VecN4(),
+                         "Expressions should evaluate into any span, and assignment should size the array");
+    }
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_VecN_Expressions)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 5; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_VecN_Performance()
+{
+#if defined(ENABLE_TestSet_VecN_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_VecN_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    size_t constexpr count         = VECN_PERFORMANCE_NUM_ELEMENTS;
+    int constexpr    numIterations = VECN_PERFORMANCE_NUM_ITERATIONS;
+
+    printf("  out = a + b * s - c over %d elements, %d iterations...\n", static_cast<int>(count), numIterations);
+
+    sPerformanceResult<2> const result2 = RunExpressionBenchmark<2>(count, numIterations);
+    sPerformanceResult<4> const result4 = RunExpressionBenchmark<4>(count, numIterations);
+
+    printf("    VecN2 fused:          %9.1f us\n", result2.m_fusedMicroseconds);
+    printf("    VecN2 temporaries:    %9.1f us (fused %.2fx)\n", result2.m_unfusedMicroseconds, result2.m_unfusedMicroseconds / result2.m_fusedMicroseconds);
+    printf("    VecN2 per element:    %9.1f us (fused %.2fx)\n", result2.m_perElementMicroseconds, result2.m_perElementMicroseconds / result2.m_fusedMicroseconds);
+    printf("    VecN4 fused:          %9.1f us\n", result4.m_fusedMicroseconds);
+    printf("    VecN4 temporaries:    %9.1f us (fused %.2fx)\n", result4.m_unfusedMicroseconds, result4.m_unfusedMicroseconds / result4.m_fusedMicroseconds);
+    printf("    VecN4 per element:    %9.1f us (fused %.2fx)\n", result4.m_perElementMicroseconds, result4.m_perElementMicroseconds / result4.m_fusedMicroseconds);
+    printf("    (checksum %.1f)\n", result2.m_checksum + result4.m_checksum);
+
+    VerifyTestResult(true, "VecN performance tests completed");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_VecN_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_VecN()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_VecN)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_VecN_Basics, "VecN - Basics");
+    RunTestSet(true, TestSet_VecN_FloatVectors, "VecN - Float Vectors");
+    RunTestSet(true, TestSet_VecN_EngineInterop, "VecN - Engine Interop");
+    RunTestSet(true, TestSet_VecN_Expressions, "VecN - Expressions");
+    RunTestSet(false, TestSet_VecN_Performance, "VecN - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_VecN)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
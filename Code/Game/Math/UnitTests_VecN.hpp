@@ -0,0 +1,34 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_VecN.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_VecN();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_VecN_Basics();
+int TestSet_VecN_FloatVectors();
+int TestSet_VecN_EngineInterop();
+int TestSet_VecN_Expressions();
+int TestSet_VecN_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_VecN_Basics
+#define ENABLE_TestSet_VecN_FloatVectors
+#define ENABLE_TestSet_VecN_EngineInterop
+#define ENABLE_TestSet_VecN_Expressions
+#define ENABLE_TestSet_VecN_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define VECN_PERFORMANCE_NUM_ELEMENTS   1000000
+#define VECN_PERFORMANCE_NUM_ITERATIONS 20
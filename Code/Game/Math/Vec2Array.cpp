@@ -0,0 +1,65 @@
+//----------------------------------------------------------------------------------------------------
+// Vec2Array.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Math/Vec2Array.hpp"
+
+//----------------------------------------------------------------------------------------------------
+Vec2Array::Vec2Array(std::span<Vec2 const> const points)
+{
+    Reserve(static_cast<int>(points.size()));
+
+    for (Vec2 const& point : points)
+    {
+        PushBack(point);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void Vec2Array::Reserve(int const capacity)
+{
+    m_xs.reserve(capacity);
+    m_ys.reserve(capacity);
+}
+
+//----------------------------------------------------------------------------------------------------
+void Vec2Array::Resize(int const count)
+{
+    m_xs.resize(count);
+    m_ys.resize(count);
+}
+
+//----------------------------------------------------------------------------------------------------
+void Vec2Array::Clear()
+{
+    m_xs.clear();
+    m_ys.clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+void Vec2Array::PushBack(Vec2 const& point)
+{
+    m_xs.push_back(point.x);
+    m_ys.push_back(point.y);
+}
+
+//----------------------------------------------------------------------------------------------------
+void Vec2Array::Set(int const   index,
+                    Vec2 const& point)
+{
+    m_xs[index] = point.x;
+    m_ys[index] = point.y;
+}
+
+//----------------------------------------------------------------------------------------------------
+Vec2 Vec2Array::Get(int const index) const
+{
+    return Vec2(m_xs[index], m_ys[index]);
+}
+
+//----------------------------------------------------------------------------------------------------
+int Vec2Array::GetCount() const
+{
+    return static_cast<int>(m_xs.size());
+}
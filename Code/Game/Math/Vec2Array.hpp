@@ -0,0 +1,38 @@
+//----------------------------------------------------------------------------------------------------
+// Vec2Array.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <span>
+#include <vector>
+
+#include "Engine/Math/Vec2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Structure-of-arrays storage for many Vec2s: x and y each live in their own contiguous stream,
+// so bulk kernels process four points per SSE instruction.
+//
+class Vec2Array
+{
+public:
+    Vec2Array() = default;
+    explicit Vec2Array(std::span<Vec2 const> points);
+
+    void Reserve(int capacity);
+    void Resize(int count);
+    void Clear();
+    void PushBack(Vec2 const& point);
+    void Set(int index, Vec2 const& point);
+    Vec2 Get(int index) const;
+    int  GetCount() const;
+
+    float*       GetXs() { return m_xs.data(); }
+    float*       GetYs() { return m_ys.data(); }
+    float const* GetXs() const { return m_xs.data(); }
+    float const* GetYs() const { return m_ys.data(); }
+
+private:
+    std::vector<float> m_xs;
+    std::vector<float> m_ys;
+};
@@ -0,0 +1,343 @@
+//----------------------------------------------------------------------------------------------------
+// VecN.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cmath>
+#include <type_traits>
+#include <xmmintrin.h>
+
+#include "Engine/Math/IntVec2.hpp"
+#include "Engine/Math/IntVec3.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Engine/Math/Vec4.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Component storage. Sizes 2 to 4 get the named members the engine types have; other sizes are a
+// plain array. Float4 is 16-byte aligned so it moves through SSE registers whole. No size has
+// padding between components, so an array of VecN<T, N> is also an array of T.
+//
+template <typename T, int N>
+struct sVecNStorage
+{
+    T m_components[N] = {};
+
+    T&       operator[](int const index) { return m_components[index]; }
+    T const& operator[](int const index) const { return m_components[index]; }
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+struct sVecNStorage<T, 2>
+{
+    T x = T();
+    T y = T();
+
+    T&       operator[](int const index) { return this->*COMPONENTS[index]; }
+    T const& operator[](int const index) const { return this->*COMPONENTS[index]; }
+
+    static constexpr T sVecNStorage::* COMPONENTS[2] = {&sVecNStorage::x, &sVecNStorage::y};
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+struct sVecNStorage<T, 3>
+{
+    T x = T();
+    T y = T();
+    T z = T();
+
+    T&       operator[](int const index) { return this->*COMPONENTS[index]; }
+    T const& operator[](int const index) const { return this->*COMPONENTS[index]; }
+
+    static constexpr T sVecNStorage::* COMPONENTS[3] = {&sVecNStorage::x, &sVecNStorage::y, &sVecNStorage::z};
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+struct alignas(std::is_same_v<T, float> ? 16 : alignof(T)) sVecNStorage<T, 4>
+{
+    T x = T();
+    T y = T();
+    T z = T();
+    T w = T();
+
+    T&       operator[](int const index) { return this->*COMPONENTS[index]; }
+    T const& operator[](int const index) const { return this->*COMPONENTS[index]; }
+
+    static constexpr T sVecNStorage::* COMPONENTS[4] = {&sVecNStorage::x, &sVecNStorage::y, &sVecNStorage::z, &sVecNStorage::w};
+};
+
+//----------------------------------------------------------------------------------------------------
+// The operators every vector type shares, written once for any component type and size. Vec2, Vec3,
+// Vec4, IntVec2 and IntVec3 correspond to VecN2, VecN3, VecN4, IntVecN2 and IntVecN3 below, with
+// the same layout, and convert with ToVecN and ToVec2 and friends.
+//
+// Lengths of integer vectors are floats, as IntVec2::GetLength is; normalizing needs floating point
+// components. Float4 arithmetic is one SSE instruction per operator.
+//
+template <typename T, int N>
+struct VecN : sVecNStorage<T, N>
+{
+    static_assert(std::is_arithmetic_v<T> && N > 0, "VecN needs arithmetic components");
+
+    using ComponentType = T;
+    using LengthType    = std::conditional_t<std::is_floating_point_v<T>, T, float>;
+
+    static int constexpr NUM_COMPONENTS = N;
+
+    VecN() = default;
+
+    template <typename... Components>
+        requires (sizeof...(Components) == N && N > 1 && (std::is_arithmetic_v<Components> && ...))
+    VecN(Components const... components)
+    {
+        T const values[N] = {static_cast<T>(components)...};
+
+        for (int index = 0; index < N; ++index)
+        {
+            (*this)[index] = values[index];
+        }
+    }
+
+    static VecN MakeUniform(T const value)
+    {
+        VecN result;
+        for (int index = 0; index < N; ++index)
+        {
+            result[index] = value;
+        }
+        return result;
+    }
+
+    // Accessors (const methods)
+    T          GetLengthSquared() const;
+    LengthType GetLength() const;
+    T          GetTaxicabLength() const;
+    VecN       GetNormalized() const;       // Zero stays zero
+
+    // Mutators (non-const methods)
+    void Normalize();
+    void SetLength(LengthType length);
+
+    // Operators (const)
+    bool operator==(VecN const& other) const;
+    bool operator!=(VecN const& other) const { return !(*this == other); }
+    VecN operator+(VecN const& other) const;
+    VecN operator-(VecN const& other) const;
+    VecN operator-() const;
+    VecN operator*(T scale) const;
+    VecN operator*(VecN const& other) const;    // Component-wise
+    VecN operator/(T inverseScale) const;
+
+    // Operators (self-mutating / non-const)
+    void operator+=(VecN const& other) { *this = *this + other; }
+    void operator-=(VecN const& other) { *this = *this - other; }
+    void operator*=(T const scale) { *this = *this * scale; }
+    void operator/=(T const inverseScale) { *this = *this / inverseScale; }
+
+    friend VecN operator*(T const scale, VecN const& vec) { return vec * scale; }
+
+private:
+    static bool constexpr IS_SSE = std::is_same_v<T, float> && N == 4;
+
+    __m128 Load() const { return _mm_load_ps(&(*this)[0]); }
+    static VecN Store(__m128 const values)
+    {
+        VecN result;
+        _mm_store_ps(&result[0], values);
+        return result;
+    }
+
+    template <typename Operation>
+    VecN Map(Operation operation) const
+    {
+        VecN result;
+        for (int index = 0; index < N; ++index)
+        {
+            result[index] = operation(index);
+        }
+        return result;
+    }
+};
+
+//----------------------------------------------------------------------------------------------------
+using VecN2    = VecN<float, 2>;
+using VecN3    = VecN<float, 3>;
+using VecN4    = VecN<float, 4>;
+using IntVecN2 = VecN<int, 2>;
+using IntVecN3 = VecN<int, 3>;
+
+static_assert(sizeof(VecN2) == sizeof(Vec2) && sizeof(VecN3) == sizeof(Vec3) && sizeof(VecN4) == sizeof(Vec4), "VecN must match the engine layouts");
+static_assert(sizeof(IntVecN2) == sizeof(IntVec2) && sizeof(IntVecN3) == sizeof(IntVec3), "VecN must match the engine layouts");
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, int N>
+T DotProduct(VecN<T, N> const& a,
+             VecN<T, N> const& b)
+{
+    T result = T();
+    for (int index = 0; index < N; ++index)
+    {
+        result += a[index] * b[index];
+    }
+    return result;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, int N>
+T GetDistanceSquared(VecN<T, N> const& a,
+                     VecN<T, N> const& b)
+{
+    return (b - a).GetLengthSquared();
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, int N>
+typename VecN<T, N>::LengthType GetDistance(VecN<T, N> const& a,
+                                            VecN<T, N> const& b)
+{
+    return (b - a).GetLength();
+}
+
+//----------------------------------------------------------------------------------------------------
+inline VecN2    ToVecN(Vec2 const& vec) { return VecN2(vec.x, vec.y); }
+inline VecN3    ToVecN(Vec3 const& vec) { return VecN3(vec.x, vec.y, vec.z); }
+inline VecN4    ToVecN(Vec4 const& vec) { return VecN4(vec.x, vec.y, vec.z, vec.w); }
+inline IntVecN2 ToVecN(IntVec2 const& vec) { return IntVecN2(vec.x, vec.y); }
+inline IntVecN3 ToVecN(IntVec3 const& vec) { return IntVecN3(vec.x, vec.y, vec.z); }
+
+inline Vec2    ToVec2(VecN2 const& vec) { return Vec2(vec.x, vec.y); }
+inline Vec3    ToVec3(VecN3 const& vec) { return Vec3(vec.x, vec.y, vec.z); }
+inline Vec4    ToVec4(VecN4 const& vec) { return Vec4(vec.x, vec.y, vec.z, vec.w); }
+inline IntVec2 ToIntVec2(IntVecN2 const& vec) { return IntVec2(vec.x, vec.y); }
+inline IntVec3 ToIntVec3(IntVecN3 const& vec) { return IntVec3(vec.x, vec.y, vec.z); }
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, int N>
+T VecN<T, N>::GetLengthSquared() const
+{
+    return DotProduct(*this, *this);
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, int N>
+typename VecN<T, N>::LengthType VecN<T, N>::GetLength() const
+{
+    return std::sqrt(static_cast<LengthType>(GetLengthSquared()));
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, int N>
+T VecN<T, N>::GetTaxicabLength() const
+{
+    T result = T();
+    for (int index = 0; index < N; ++index)
+    {
+        result += ((*this)[index] < T()) ? -(*this)[index] : (*this)[index];
+    }
+    return result;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, int N>
+VecN<T, N> VecN<T, N>::GetNormalized() const
+{
+    static_assert(std::is_floating_point_v<T>, "Only floating point vectors can be normalized");
+
+    T const length = GetLength();
+
+    return (length > T()) ? *this * (T(1) / length) : VecN();
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, int N>
+void VecN<T, N>::Normalize()
+{
+    *this = GetNormalized();
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, int N>
+void VecN<T, N>::SetLength(LengthType const length)
+{
+    *this = GetNormalized() * length;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, int N>
+bool VecN<T, N>::operator==(VecN const& other) const
+{
+    for (int index = 0; index < N; ++index)
+    {
+        if ((*this)[index] != other[index])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, int N>
+VecN<T, N> VecN<T, N>::operator+(VecN const& other) const
+{
+    if constexpr (IS_SSE)
+    {
+        return Store(_mm_add_ps(Load(), other.Load()));
+    }
+    return Map([&](int const index) { return static_cast<T>((*this)[index] + other[index]); });
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, int N>
+VecN<T, N> VecN<T, N>::operator-(VecN const& other) const
+{
+    if constexpr (IS_SSE)
+    {
+        return Store(_mm_sub_ps(Load(), other.Load()));
+    }
+    return Map([&](int const index) { return static_cast<T>((*this)[index] - other[index]); });
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, int N>
+VecN<T, N> VecN<T, N>::operator-() const
+{
+    return Map([&](int const index) { return static_cast<T>(-(*this)[index]); });
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, int N>
+VecN<T, N> VecN<T, N>::operator*(T const scale) const
+{
+    if constexpr (IS_SSE)
+    {
+        return Store(_mm_mul_ps(Load(), _mm_set1_ps(scale)));
+    }
+    return Map([&](int const index) { return static_cast<T>((*this)[index] * scale); });
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, int N>
+VecN<T, N> VecN<T, N>::operator*(VecN const& other) const
+{
+    if constexpr (IS_SSE)
+    {
+        return Store(_mm_mul_ps(Load(), other.Load()));
+    }
+    return Map([&](int const index) { return static_cast<T>((*this)[index] * other[index]); });
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, int N>
+VecN<T, N> VecN<T, N>::operator/(T const inverseScale) const
+{
+    if constexpr (IS_SSE)
+    {
+        return Store(_mm_div_ps(Load(), _mm_set1_ps(inverseScale)));
+    }
+    return Map([&](int const index) { return static_cast<T>((*this)[index] / inverseScale); });
+}
@@ -0,0 +1,360 @@
+//----------------------------------------------------------------------------------------------------
+// VecNExpression.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "Game/Math/VecN.hpp"
+
+//----------------------------------------------------------------------------------------------------
+int constexpr VECN_EXPRESSION_BLOCK_SIZE = 8;       // Components evaluated together
+
+//----------------------------------------------------------------------------------------------------
+// Expression templates over arrays of VecN. Arithmetic on VecNArrays builds a small tree of
+// expression objects instead of computing anything; assigning the tree to an array evaluates it in
+// one pass, so out = a + b * s - c reads each input once, writes the output once and allocates no
+// temporary arrays. Expressions are read by flat component index (element * N + component), so
+// the loop is over plain components, which the compiler vectorizes.
+//
+// Operands are VecNArrays, other expressions, VecN<T, N> (the same vector for every element) and
+// scalars. Every operator is component-wise. Array operands must all have the same count.
+//
+// Expressions hold pointers into the arrays they read, so build and assign them in one statement.
+// Assigning to an array that is also an operand is safe: element i is only read to produce
+// element i.
+//
+struct sVecNExpressionTag
+{
+};
+
+template <typename X>
+bool constexpr IS_VECN_EXPRESSION = std::is_base_of_v<sVecNExpressionTag, X>;
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, int N>
+class VecNArrayExpression : public sVecNExpressionTag
+{
+public:
+    using ComponentType = T;
+
+    static int constexpr NUM_COMPONENTS = N;
+
+    explicit VecNArrayExpression(std::span<VecN<T, N> const> const elements)
+        : m_components(reinterpret_cast<T const*>(elements.data())),
+          m_count(elements.size())
+    {
+    }
+
+    T      Get(size_t const componentIndex) const { return m_components[componentIndex]; }
+    size_t GetCount() const { return m_count; }
+
+private:
+    T const* m_components;
+    size_t   m_count;
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, int N>
+class VecNScalarExpression : public sVecNExpressionTag
+{
+public:
+    using ComponentType = T;
+
+    static int constexpr NUM_COMPONENTS = N;
+
+    explicit VecNScalarExpression(T const value) : m_value(value) {}
+
+    T      Get(size_t) const { return m_value; }
+    size_t GetCount() const { return 0; }   // Matches any count
+
+private:
+    T m_value;
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, int N>
+class VecNBroadcastExpression : public sVecNExpressionTag
+{
+public:
+    using ComponentType = T;
+
+    static int constexpr NUM_COMPONENTS = N;
+
+    explicit VecNBroadcastExpression(VecN<T, N> const& value) : m_value(value) {}
+
+    T      Get(size_t const componentIndex) const { return m_value[static_cast<int>(componentIndex % N)]; }
+    size_t GetCount() const { return 0; }   // Matches any count
+
+private:
+    VecN<T, N> m_value;
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename Operation, typename Left, typename Right>
+class VecNBinaryExpression : public sVecNExpressionTag
+{
+public:
+    using ComponentType = typename Left::ComponentType;
+
+    static int constexpr NUM_COMPONENTS = Left::NUM_COMPONENTS;
+
+    VecNBinaryExpression(Left const& left, Right const& right)
+        : m_left(left),
+          m_right(right)
+    {
+        assert(left.GetCount() == 0 || right.GetCount() == 0 || left.GetCount() == right.GetCount());
+    }
+
+    ComponentType Get(size_t const componentIndex) const
+    {
+        return static_cast<ComponentType>(Operation::Apply(m_left.Get(componentIndex), m_right.Get(componentIndex)));
+    }
+
+    size_t GetCount() const { return (m_left.GetCount() != 0) ? m_left.GetCount() : m_right.GetCount(); }
+
+private:
+    Left  m_left;
+    Right m_right;
+};
+
+//----------------------------------------------------------------------------------------------------
+template <typename Operand>
+class VecNNegateExpression : public sVecNExpressionTag
+{
+public:
+    using ComponentType = typename Operand::ComponentType;
+
+    static int constexpr NUM_COMPONENTS = Operand::NUM_COMPONENTS;
+
+    explicit VecNNegateExpression(Operand const& operand) : m_operand(operand) {}
+
+    ComponentType Get(size_t const componentIndex) const { return static_cast<ComponentType>(-m_operand.Get(componentIndex)); }
+    size_t        GetCount() const { return m_operand.GetCount(); }
+
+private:
+    Operand m_operand;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sVecNAdd
+{
+    template <typename T>
+    static T Apply(T const a, T const b) { return a + b; }
+};
+
+struct sVecNSubtract
+{
+    template <typename T>
+    static T Apply(T const a, T const b) { return a - b; }
+};
+
+struct sVecNMultiply
+{
+    template <typename T>
+    static T Apply(T const a, T const b) { return a * b; }
+};
+
+struct sVecNDivide
+{
+    template <typename T>
+    static T Apply(T const a, T const b) { return a / b; }
+};
+
+//----------------------------------------------------------------------------------------------------
+// Writes expression component by component into out, which must hold as many elements as the
+// expression's arrays
+//
+template <typename T, int N, typename Expression>
+void EvaluateVecNExpression(std::span<VecN<T, N>> const out,
+                            Expression const&           expression)
+{
+    static_assert(std::is_same_v<typename Expression::ComponentType, T> && Expression::NUM_COMPONENTS == N, "Expression and output must be the same VecN type");
+    assert(expression.GetCount() == 0 || expression.GetCount() == out.size());
+
+    T* const     components    = reinterpret_cast<T*>(out.data());
+    size_t const numComponents = out.size() * N;
+    size_t       index         = 0;
+
+    // A block is read in full before it is written, so the compiler can pack it into SIMD registers
+    // without proving the output does not overlap the inputs
+    for (; index + VECN_EXPRESSION_BLOCK_SIZE <= numComponents; index += VECN_EXPRESSION_BLOCK_SIZE)
+    {
+        T values[VECN_EXPRESSION_BLOCK_SIZE];
+
+        for (int lane = 0; lane < VECN_EXPRESSION_BLOCK_SIZE; ++lane)
+        {
+            values[lane] = expression.Get(index + lane);
+        }
+        for (int lane = 0; lane < VECN_EXPRESSION_BLOCK_SIZE; ++lane)
+        {
+            components[index + lane] = values[lane];
+        }
+    }
+
+    for (; index < numComponents; ++index)
+    {
+        components[index] = expression.Get(index);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Contiguous VecNs that arithmetic operators combine into fused expressions
+//
+template <typename T, int N>
+class VecNArray
+{
+public:
+    using ComponentType = T;
+
+    static int constexpr NUM_COMPONENTS = N;
+
+    VecNArray() = default;
+    explicit VecNArray(size_t const count) : m_elements(count) {}
+    explicit VecNArray(std::span<VecN<T, N> const> const elements) : m_elements(elements.begin(), elements.end()) {}
+
+    template <typename Expression>
+        requires IS_VECN_EXPRESSION<Expression>
+    VecNArray(Expression const& expression)
+        : m_elements(expression.GetCount())
+    {
+        EvaluateVecNExpression(std::span<VecN<T, N>>(m_elements), expression);
+    }
+
+    // Resizes to the expression's count first, unless it has no arrays in it
+    template <typename Expression>
+        requires IS_VECN_EXPRESSION<Expression>
+    VecNArray& operator=(Expression const& expression)
+    {
+        if (expression.GetCount() != 0 && expression.GetCount() != m_elements.size())
+        {
+            m_elements.resize(expression.GetCount());
+        }
+
+        EvaluateVecNExpression(std::span<VecN<T, N>>(m_elements), expression);
+        return *this;
+    }
+
+    template <typename Operand>
+    VecNArray& operator+=(Operand const& operand) { return *this = *this + operand; }
+
+    template <typename Operand>
+    VecNArray& operator-=(Operand const& operand) { return *this = *this - operand; }
+
+    template <typename Operand>
+    VecNArray& operator*=(Operand const& operand) { return *this = *this * operand; }
+
+    template <typename Operand>
+    VecNArray& operator/=(Operand const& operand) { return *this = *this / operand; }
+
+    void   Resize(size_t const count) { m_elements.resize(count); }
+    size_t GetCount() const { return m_elements.size(); }
+
+    VecN<T, N>*       GetData() { return m_elements.data(); }
+    VecN<T, N> const* GetData() const { return m_elements.data(); }
+
+    VecN<T, N>&       operator[](size_t const index) { return m_elements[index]; }
+    VecN<T, N> const& operator[](size_t const index) const { return m_elements[index]; }
+
+    std::span<VecN<T, N>>       GetElements() { return m_elements; }
+    std::span<VecN<T, N> const> GetElements() const { return m_elements; }
+
+private:
+    std::vector<VecN<T, N>> m_elements;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Turning operands into expressions, given the VecN type of the side that is an array or expression
+//
+template <typename X>
+struct sVecNOperandTraits
+{
+    static bool constexpr IS_OPERAND = IS_VECN_EXPRESSION<X>;
+};
+
+template <typename T, int N>
+struct sVecNOperandTraits<VecNArray<T, N>>
+{
+    static bool constexpr IS_OPERAND = true;
+};
+
+template <typename X>
+bool constexpr IS_VECN_OPERAND = sVecNOperandTraits<X>::IS_OPERAND;
+
+//----------------------------------------------------------------------------------------------------
+template <typename T, int N, typename Expression>
+    requires IS_VECN_EXPRESSION<Expression>
+Expression const& MakeVecNOperand(Expression const& expression)
+{
+    return expression;
+}
+
+template <typename T, int N>
+VecNArrayExpression<T, N> MakeVecNOperand(VecNArray<T, N> const& array)
+{
+    return VecNArrayExpression<T, N>(array.GetElements());
+}
+
+template <typename T, int N>
+VecNBroadcastExpression<T, N> MakeVecNOperand(VecN<T, N> const& value)
+{
+    return VecNBroadcastExpression<T, N>(value);
+}
+
+template <typename T, int N, typename Scalar>
+    requires std::is_arithmetic_v<Scalar>
+VecNScalarExpression<T, N> MakeVecNOperand(Scalar const value)
+{
+    return VecNScalarExpression<T, N>(static_cast<T>(value));
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename Operation, typename Left, typename Right>
+auto MakeVecNBinaryExpression(Left const& left,
+                              Right const& right)
+{
+    using Operand = std::conditional_t<IS_VECN_OPERAND<Left>, Left, Right>;
+    using T       = typename Operand::ComponentType;
+
+    int constexpr N = Operand::NUM_COMPONENTS;
+
+    using LeftExpression  = std::decay_t<decltype(MakeVecNOperand<T, N>(left))>;
+    using RightExpression = std::decay_t<decltype(MakeVecNOperand<T, N>(right))>;
+
+    return VecNBinaryExpression<Operation, LeftExpression, RightExpression>(MakeVecNOperand<T, N>(left), MakeVecNOperand<T, N>(right));
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename Left, typename Right>
+    requires (IS_VECN_OPERAND<Left> || IS_VECN_OPERAND<Right>)
+auto operator+(Left const& left, Right const& right) { return MakeVecNBinaryExpression<sVecNAdd>(left, right); }
+
+template <typename Left, typename Right>
+    requires (IS_VECN_OPERAND<Left> || IS_VECN_OPERAND<Right>)
+auto operator-(Left const& left, Right const& right) { return MakeVecNBinaryExpression<sVecNSubtract>(left, right); }
+
+template <typename Left, typename Right>
+    requires (IS_VECN_OPERAND<Left> || IS_VECN_OPERAND<Right>)
+auto operator*(Left const& left, Right const& right) { return MakeVecNBinaryExpression<sVecNMultiply>(left, right); }
+
+template <typename Left, typename Right>
+    requires (IS_VECN_OPERAND<Left> || IS_VECN_OPERAND<Right>)
+auto operator/(Left const& left, Right const& right) { return MakeVecNBinaryExpression<sVecNDivide>(left, right); }
+
+template <typename Operand>
+    requires IS_VECN_OPERAND<Operand>
+auto operator-(Operand const& operand)
+{
+    using T = typename Operand::ComponentType;
+
+    int constexpr N = Operand::NUM_COMPONENTS;
+
+    using Expression = std::decay_t<decltype(MakeVecNOperand<T, N>(operand))>;
+
+    return VecNNegateExpression<Expression>(MakeVecNOperand<T, N>(operand));
+}
@@ -8,13 +8,13 @@
 //----------------------------------------------------------------------------------------------------
 void PerformanceTimer::Start()
 {
-    start = std::chrono::high_resolution_clock::now();
+    start = PerformanceClock::now();
 }
 
 //----------------------------------------------------------------------------------------------------
 void PerformanceTimer::Stop()
 {
-    end = std::chrono::high_resolution_clock::now();
+    end = PerformanceClock::now();
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -7,6 +7,11 @@
 
 #include <chrono>
 
+//----------------------------------------------------------------------------------------------------
+// The clock behind every timing we report; timestamps meant to be compared with them use it too
+//
+using PerformanceClock = std::chrono::high_resolution_clock;
+
 //----------------------------------------------------------------------------------------------------
 struct PerformanceTimer
 {
@@ -15,6 +20,6 @@ struct PerformanceTimer
     double GetElapsedMilliseconds() const;
     double GetElapsedMicroseconds() const;
 
-    std::chrono::high_resolution_clock::time_point start;
-    std::chrono::high_resolution_clock::time_point end;
+    PerformanceClock::time_point start;
+    PerformanceClock::time_point end;
 };
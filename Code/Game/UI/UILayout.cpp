@@ -0,0 +1,285 @@
+//----------------------------------------------------------------------------------------------------
+// UILayout.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/UI/UILayout.hpp"
+
+#include "Game/Math/AABB2Utils.hpp"
+
+//----------------------------------------------------------------------------------------------------
+UILayout::UILayout(AABB2 const&             rootBounds,
+                   sUILayoutNodeDesc const& rootDesc)
+    : m_rootBounds(rootBounds)
+{
+    sNode root;
+    root.m_desc = rootDesc;
+
+    m_nodes.push_back(root);
+    m_rects.push_back(rootBounds);
+}
+
+//----------------------------------------------------------------------------------------------------
+int UILayout::AddNode(int const                parentID,
+                      sUILayoutNodeDesc const& desc)
+{
+    int const nodeID = static_cast<int>(m_nodes.size());
+
+    sNode node;
+    node.m_desc   = desc;
+    node.m_parent = parentID;
+
+    m_nodes.push_back(node);
+    m_rects.emplace_back();
+
+    sNode& parent = m_nodes[parentID];
+
+    if (parent.m_lastChild >= 0)
+    {
+        m_nodes[parent.m_lastChild].m_nextSibling = nodeID;
+    }
+    else
+    {
+        parent.m_firstChild = nodeID;
+    }
+
+    parent.m_lastChild = nodeID;
+
+    MarkDirty(nodeID);
+
+    return nodeID;
+}
+
+//----------------------------------------------------------------------------------------------------
+void UILayout::SetRootBounds(AABB2 const& rootBounds)
+{
+    if (rootBounds == m_rootBounds)
+    {
+        return;
+    }
+
+    m_rootBounds = rootBounds;
+    MarkDirty(0);
+}
+
+//----------------------------------------------------------------------------------------------------
+void UILayout::SetSize(int const   nodeID,
+                       float const size)
+{
+    if (m_nodes[nodeID].m_desc.m_size != size)
+    {
+        m_nodes[nodeID].m_desc.m_size = size;
+        MarkParentDirty(nodeID);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void UILayout::SetAnchorUVs(int const    nodeID,
+                            AABB2 const& anchorUVs)
+{
+    if (!(m_nodes[nodeID].m_desc.m_anchorUVs == anchorUVs))
+    {
+        m_nodes[nodeID].m_desc.m_anchorUVs = anchorUVs;
+        MarkParentDirty(nodeID);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void UILayout::SetOffset(int const   nodeID,
+                         Vec2 const& offset)
+{
+    if (m_nodes[nodeID].m_desc.m_offset != offset)
+    {
+        m_nodes[nodeID].m_desc.m_offset = offset;
+        MarkParentDirty(nodeID);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void UILayout::SetPadding(int const   nodeID,
+                          Vec2 const& padding)
+{
+    if (m_nodes[nodeID].m_desc.m_padding != padding)
+    {
+        m_nodes[nodeID].m_desc.m_padding = padding;
+        MarkDirty(nodeID);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void UILayout::SetAspectRatio(int const   nodeID,
+                              float const aspectRatio)
+{
+    if (m_nodes[nodeID].m_desc.m_aspectRatio != aspectRatio)
+    {
+        m_nodes[nodeID].m_desc.m_aspectRatio = aspectRatio;
+        MarkDirty(nodeID);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void UILayout::SetChildStacking(int const               nodeID,
+                                eUILayoutStacking const stacking)
+{
+    if (m_nodes[nodeID].m_desc.m_childStacking != stacking)
+    {
+        m_nodes[nodeID].m_desc.m_childStacking = stacking;
+        MarkDirty(nodeID);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+int UILayout::Update()
+{
+    m_numLaidOut = 0;
+
+    sNode const& root = m_nodes[0];
+
+    if (root.m_isDirty)
+    {
+        LayoutNode(0, m_rootBounds);
+    }
+    else if (root.m_hasDirtyDescendant)
+    {
+        LayoutChildren(0);
+    }
+
+    return m_numLaidOut;
+}
+
+//----------------------------------------------------------------------------------------------------
+int UILayout::UpdateAll()
+{
+    for (sNode& node : m_nodes)
+    {
+        node.m_isDirty = true;
+    }
+
+    return Update();
+}
+
+//----------------------------------------------------------------------------------------------------
+sUILayoutNodeDesc const& UILayout::GetDesc(int const nodeID) const
+{
+    return m_nodes[nodeID].m_desc;
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2 const& UILayout::GetRect(int const nodeID) const
+{
+    return m_rects[nodeID];
+}
+
+//----------------------------------------------------------------------------------------------------
+std::span<AABB2 const> UILayout::GetRects() const
+{
+    return m_rects;
+}
+
+//----------------------------------------------------------------------------------------------------
+int UILayout::GetNumNodes() const
+{
+    return static_cast<int>(m_nodes.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+void UILayout::MarkDirty(int const nodeID)
+{
+    m_nodes[nodeID].m_isDirty = true;
+
+    // Stop at the first ancestor that is already marked; everything above it is marked too
+    for (int ancestor = m_nodes[nodeID].m_parent; ancestor >= 0 && !m_nodes[ancestor].m_hasDirtyDescendant; ancestor = m_nodes[ancestor].m_parent)
+    {
+        m_nodes[ancestor].m_hasDirtyDescendant = true;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// The root's slot is the root bounds, so its own slotting parameters have no effect
+//
+void UILayout::MarkParentDirty(int const nodeID)
+{
+    int const parentID = m_nodes[nodeID].m_parent;
+
+    if (parentID >= 0)
+    {
+        MarkDirty(parentID);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void UILayout::LayoutNode(int const    nodeID,
+                          AABB2 const& slot)
+{
+    sNode&                   node = m_nodes[nodeID];
+    sUILayoutNodeDesc const& desc = node.m_desc;
+
+    AABB2 rect = slot;
+
+    if (desc.m_aspectRatio > 0.f)
+    {
+        ReduceToAspectRatio(rect, desc.m_aspectRatio);
+    }
+
+    AABB2 contentRect = rect;
+    AddPadding(contentRect, -desc.m_padding.x, -desc.m_padding.y);
+
+    node.m_slot        = slot;
+    node.m_contentRect = contentRect;
+    node.m_isDirty     = false;
+    m_rects[nodeID]    = rect;
+    ++m_numLaidOut;
+
+    LayoutChildren(nodeID);
+}
+
+//----------------------------------------------------------------------------------------------------
+void UILayout::LayoutChildren(int const nodeID)
+{
+    eUILayoutStacking const stacking      = m_nodes[nodeID].m_desc.m_childStacking;
+    AABB2 const             contentRect   = m_nodes[nodeID].m_contentRect;
+    AABB2                   remainingRect = contentRect;
+
+    m_nodes[nodeID].m_hasDirtyDescendant = false;
+
+    for (int childID = m_nodes[nodeID].m_firstChild; childID >= 0; childID = m_nodes[childID].m_nextSibling)
+    {
+        sNode const& child = m_nodes[childID];
+        AABB2 const  slot  = ComputeChildSlot(stacking, contentRect, remainingRect, child.m_desc);
+
+        if (child.m_isDirty || !(slot == child.m_slot))
+        {
+            LayoutNode(childID, slot);
+        }
+        else if (child.m_hasDirtyDescendant)
+        {
+            LayoutChildren(childID);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB2 UILayout::ComputeChildSlot(eUILayoutStacking const  stacking,
+                                 AABB2 const&             contentRect,
+                                 AABB2&                   remainingRect,
+                                 sUILayoutNodeDesc const& childDesc) const
+{
+    switch (stacking)
+    {
+    case eUILayoutStacking::TOP_TO_BOTTOM:
+        return ChopOffTop(remainingRect, childDesc.m_size);
+
+    case eUILayoutStacking::LEFT_TO_RIGHT:
+        return ChopOffLeft(remainingRect, childDesc.m_size);
+
+    case eUILayoutStacking::OVERLAY:
+    default:
+    {
+        AABB2 slot = GetBoxAtUVs(contentRect, childDesc.m_anchorUVs.m_mins, childDesc.m_anchorUVs.m_maxs);
+        slot.Translate(childDesc.m_offset);
+        ClampWithin(slot, contentRect);
+
+        return slot;
+    }
+    }
+}
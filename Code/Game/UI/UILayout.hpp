@@ -0,0 +1,88 @@
+//----------------------------------------------------------------------------------------------------
+// UILayout.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <span>
+#include <vector>
+
+#include "Engine/Math/AABB2.hpp"
+
+//----------------------------------------------------------------------------------------------------
+enum class eUILayoutStacking : unsigned char
+{
+    OVERLAY,            // Every child is placed within the full content rect by its anchors
+    TOP_TO_BOTTOM,      // Children chop m_size off the top of the remaining content rect
+    LEFT_TO_RIGHT,      // Children chop m_size off the left of the remaining content rect
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sUILayoutNodeDesc
+{
+    eUILayoutStacking m_childStacking = eUILayoutStacking::OVERLAY;
+    float             m_size          = 0.f;                    // Extent along a stacking parent's axis
+    AABB2             m_anchorUVs     = AABB2::ZERO_TO_ONE;     // Slot within an OVERLAY parent, in UVs
+    Vec2              m_offset        = Vec2(0.f, 0.f);         // Shift within an OVERLAY parent, clamped to it
+    Vec2              m_padding       = Vec2(0.f, 0.f);         // Inset between this node's rect and its children
+    float             m_aspectRatio   = 0.f;                    // If > 0, shrink to width / height within the slot
+};
+
+//----------------------------------------------------------------------------------------------------
+// Widget layout tree built on the AABB2 chop, padding, aspect and clamp primitives.
+//
+// Setters only flag nodes: a change to a node's own padding, aspect or stacking dirties the node,
+// a change to how it is slotted (size, anchors, offset) dirties its parent, and every ancestor
+// is marked as having a dirty descendant. Update then walks only the flagged paths, recomputes
+// the child slots of each node it reaches, and descends into a child only when its slot changed
+// or it is flagged itself, so untouched subtrees are never visited.
+//
+// Rects are stored contiguously by node ID for the renderer. Node 0 is the root.
+//
+class UILayout
+{
+public:
+    explicit UILayout(AABB2 const& rootBounds, sUILayoutNodeDesc const& rootDesc = sUILayoutNodeDesc());
+
+    int  AddNode(int parentID, sUILayoutNodeDesc const& desc);     // Appended as the parent's last child
+    void SetRootBounds(AABB2 const& rootBounds);
+    void SetSize(int nodeID, float size);
+    void SetAnchorUVs(int nodeID, AABB2 const& anchorUVs);
+    void SetOffset(int nodeID, Vec2 const& offset);
+    void SetPadding(int nodeID, Vec2 const& padding);
+    void SetAspectRatio(int nodeID, float aspectRatio);
+    void SetChildStacking(int nodeID, eUILayoutStacking stacking);
+
+    int Update();       // Re-lays out dirty subtrees only; returns the number of nodes laid out
+    int UpdateAll();    // Re-lays out every node from scratch
+
+    sUILayoutNodeDesc const& GetDesc(int nodeID) const;
+    AABB2 const&             GetRect(int nodeID) const;
+    std::span<AABB2 const>   GetRects() const;
+    int                      GetNumNodes() const;
+
+private:
+    struct sNode
+    {
+        sUILayoutNodeDesc m_desc;
+        AABB2             m_slot;
+        AABB2             m_contentRect;
+        int               m_parent             = -1;
+        int               m_firstChild         = -1;
+        int               m_lastChild          = -1;
+        int               m_nextSibling        = -1;
+        bool              m_isDirty            = true;
+        bool              m_hasDirtyDescendant = false;
+    };
+
+    void  MarkDirty(int nodeID);
+    void  MarkParentDirty(int nodeID);
+    void  LayoutNode(int nodeID, AABB2 const& slot);
+    void  LayoutChildren(int nodeID);
+    AABB2 ComputeChildSlot(eUILayoutStacking stacking, AABB2 const& contentRect, AABB2& remainingRect, sUILayoutNodeDesc const& childDesc) const;
+
+    AABB2              m_rootBounds;
+    std::vector<sNode> m_nodes;
+    std::vector<AABB2> m_rects;
+    int                m_numLaidOut = 0;
+};
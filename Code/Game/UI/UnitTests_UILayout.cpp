@@ -0,0 +1,348 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_UILayout.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/UI/UnitTests_UILayout.hpp"
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Game/GameCommon.hpp"
+#include "Game/Math/AABB2Utils.hpp"
+#include "Game/UI/UILayout.hpp"
+
+//----------------------------------------------------------------------------------------------------
+namespace
+{
+    //------------------------------------------------------------------------------------------------
+    sUILayoutNodeDesc MakeStackedDesc(float const             size,
+                                      eUILayoutStacking const childStacking = eUILayoutStacking::OVERLAY,
+                                      Vector2Class const&     padding       = Vector2Class(0.0f, 0.0f),
+                                      float const             aspectRatio   = 0.0f)
+    {
+        sUILayoutNodeDesc desc;
+        desc.m_size          = size;
+        desc.m_childStacking = childStacking;
+        desc.m_padding       = padding;
+        desc.m_aspectRatio   = aspectRatio;
+
+        return desc;
+    }
+
+    //------------------------------------------------------------------------------------------------
+    bool AreRectListsEqual(std::span<AABB2Class const> a,
+                           std::span<AABB2Class const> b)
+    {
+        if (a.size() != b.size())
+        {
+            return false;
+        }
+
+        for (size_t index = 0; index < a.size(); ++index)
+        {
+            if (!(a[index] == b[index]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+// The AABB2 primitives sketched in TestSet_AABB2_UnimplementedMethods, as free functions
+//
+int TestSet_UILayout_Primitives()
+{
+#if defined(ENABLE_TestSet_UILayout_Primitives)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_UILayout_Primitives)(start)\n");
+    printf("####################################################################################################\n");
+
+    AABB2Class wideBox(0.0f, 0.0f, 40.0f, 20.0f); // 2:1 ratio
+    ReduceToAspectRatio(wideBox, 1.0f);
+    Vector2Class const dims = wideBox.AABB2_GetDimensions();
+    VerifyTestResult(IsMostlyEqual(dims.x, dims.y) && dims.x <= 20.0f && dims.y <= 20.0f,
+                     "ReduceToAspectRatio should create square by reducing larger dimension");
+
+    AABB2Class smallBox(0.0f, 0.0f, 10.0f, 20.0f); // 1:2 ratio
+    EnlargeToAspectRatio(smallBox, 1.0f);
+    Vector2Class const enlargedDims = smallBox.AABB2_GetDimensions();
+    VerifyTestResult(IsMostlyEqual(enlargedDims.x, enlargedDims.y) && enlargedDims.x >= 20.0f,
+                     "EnlargeToAspectRatio should create square by enlarging smaller dimension");
+
+    AABB2Class paddedBox(10.0f, 20.0f, 30.0f, 40.0f);
+    AddPadding(paddedBox, 5.0f, 10.0f);
+    VerifyTestResult(IsMostlyEqual(paddedBox, 5.0f, 10.0f, 35.0f, 50.0f), "AddPadding should add specified padding to all sides");
+
+    AABB2Class const constrainBox(0.0f, 0.0f, 100.0f, 100.0f);
+    AABB2Class       clampedBox(-10.0f, -10.0f, 110.0f, 110.0f);
+    ClampWithin(clampedBox, constrainBox);
+    AABB2Class       shiftedBox(90.0f, -5.0f, 120.0f, 5.0f);
+    ClampWithin(shiftedBox, constrainBox);
+    VerifyTestResult(IsMostlyEqual(clampedBox, 0.0f, 0.0f, 100.0f, 100.0f) && IsMostlyEqual(shiftedBox, 70.0f, 0.0f, 100.0f, 10.0f),
+                     "ClampWithin should constrain box to be within container, sliding it when it fits");
+
+    AABB2Class       chopBox(10.0f, 20.0f, 30.0f, 50.0f);
+    AABB2Class const topSlice = ChopOffTop(chopBox, 10.0f);
+    VerifyTestResult(IsMostlyEqual(chopBox, 10.0f, 20.0f, 30.0f, 40.0f) && IsMostlyEqual(topSlice, 10.0f, 40.0f, 30.0f, 50.0f),
+                     "ChopOffTop should reduce maxs.y by specified amount and return the slice");
+
+    AABB2Class       sideBox(0.0f, 0.0f, 10.0f, 10.0f);
+    AABB2Class const leftSlice   = ChopOffLeft(sideBox, 3.0f);
+    AABB2Class const rightSlice  = ChopOffRight(sideBox, 3.0f);
+    AABB2Class const bottomSlice = ChopOffBottom(sideBox, 20.0f);
+    VerifyTestResult(IsMostlyEqual(leftSlice, 0.0f, 0.0f, 3.0f, 10.0f) && IsMostlyEqual(rightSlice, 7.0f, 0.0f, 10.0f, 10.0f) &&
+                     IsMostlyEqual(bottomSlice, 3.0f, 0.0f, 7.0f, 10.0f) && IsMostlyEqual(sideBox, 3.0f, 10.0f, 7.0f, 10.0f),
+                     "ChopOff should never take more than what is left of the box");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_UILayout_Primitives)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 6; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_UILayout_Basics()
+{
+#if defined(ENABLE_TestSet_UILayout_Basics)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_UILayout_Basics)(start)\n");
+    printf("####################################################################################################\n");
+
+    UILayout layout(AABB2Class(0.0f, 0.0f, 100.0f, 100.0f), MakeStackedDesc(0.0f, eUILayoutStacking::TOP_TO_BOTTOM, Vector2Class(5.0f, 5.0f)));
+
+    int const header = layout.AddNode(0, MakeStackedDesc(10.0f, eUILayoutStacking::LEFT_TO_RIGHT));
+    int const icon   = layout.AddNode(header, MakeStackedDesc(10.0f, eUILayoutStacking::OVERLAY, Vector2Class(0.0f, 0.0f), 1.0f));
+    int const title  = layout.AddNode(header, MakeStackedDesc(40.0f));
+    int const body   = layout.AddNode(0, MakeStackedDesc(50.0f, eUILayoutStacking::OVERLAY, Vector2Class(1.0f, 1.0f)));
+
+    sUILayoutNodeDesc popupDesc;
+    popupDesc.m_anchorUVs = AABB2Class(0.25f, 0.25f, 0.75f, 0.75f);
+    popupDesc.m_offset    = Vector2Class(30.0f, 0.0f);
+    int const popup       = layout.AddNode(body, popupDesc);
+    int const square      = layout.AddNode(body, MakeStackedDesc(0.0f, eUILayoutStacking::OVERLAY, Vector2Class(0.0f, 0.0f), 1.0f));
+    int const footer      = layout.AddNode(0, MakeStackedDesc(100.0f));
+
+    int const numInitial = TimeFunction("Update (first layout, 8 nodes)", [&layout]() { return layout.Update(); });
+    VerifyTestResult(numInitial == 8 && layout.GetNumNodes() == 8 && layout.GetRects().size() == 8,
+                     "The first Update should lay out every node into the contiguous rect array");
+
+    VerifyTestResult(IsMostlyEqual(layout.GetRect(header), 5.0f, 85.0f, 95.0f, 95.0f) &&
+                     IsMostlyEqual(layout.GetRect(body), 5.0f, 35.0f, 95.0f, 85.0f),
+                     "Top-to-bottom children should chop their size off the padded content rect");
+    VerifyTestResult(IsMostlyEqual(layout.GetRect(icon), 5.0f, 85.0f, 15.0f, 95.0f) &&
+                     IsMostlyEqual(layout.GetRect(title), 15.0f, 85.0f, 55.0f, 95.0f),
+                     "Left-to-right children should chop their size off the left");
+    VerifyTestResult(IsMostlyEqual(layout.GetRect(popup), 50.0f, 48.0f, 94.0f, 72.0f),
+                     "Overlay children should be placed by anchors, offset, and clamped within the parent");
+    VerifyTestResult(IsMostlyEqual(layout.GetRect(square), 26.0f, 36.0f, 74.0f, 84.0f),
+                     "A node with an aspect ratio should shrink to it about its slot's center");
+    VerifyTestResult(IsMostlyEqual(layout.GetRect(footer), 5.0f, 5.0f, 95.0f, 35.0f),
+                     "A stacked child larger than the remaining space should get only what is left");
+
+    // A slotting change dirties the parent, which then re-lays out only the children whose slots moved
+    layout.SetSize(header, 20.0f);
+    int const numAfterResize = layout.Update();
+    VerifyTestResult(numAfterResize == 8 && IsMostlyEqual(layout.GetRect(header), 5.0f, 75.0f, 95.0f, 95.0f) &&
+                     IsMostlyEqual(layout.GetRect(icon), 5.0f, 80.0f, 15.0f, 90.0f),
+                     "Resizing the header should move every slot below the root");
+
+    layout.SetOffset(popup, Vector2Class(0.0f, 0.0f));
+    int const numAfterOffset = layout.Update();
+    VerifyTestResult(numAfterOffset == 2 && IsMostlyEqual(layout.GetRect(popup), 28.0f, 38.0f, 72.0f, 62.0f),
+                     "Moving an overlay child should only re-lay out it and its parent, not its sibling");
+
+    layout.SetPadding(title, Vector2Class(1.0f, 1.0f));
+    int const numAfterPadding = layout.Update();
+    int const numUnchanged    = layout.Update();
+    layout.SetSize(icon, 10.0f);
+    int const numSameValue    = layout.Update();
+    VerifyTestResult(numAfterPadding == 1 && numUnchanged == 0 && numSameValue == 0,
+                     "Update should skip everything when nothing changed");
+
+    layout.SetRootBounds(AABB2Class(0.0f, 0.0f, 200.0f, 100.0f));
+    VerifyTestResult(layout.Update() == 6 && IsMostlyEqual(layout.GetRect(footer), 5.0f, 5.0f, 195.0f, 25.0f) &&
+                     IsMostlyEqual(layout.GetRect(icon), 5.0f, 80.0f, 15.0f, 90.0f),
+                     "Widening the root should skip the header's children, whose left-stacked slots did not move");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_UILayout_Basics)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 10; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_UILayout_IncrementalMatchesFull()
+{
+#if defined(ENABLE_TestSet_UILayout_IncrementalMatchesFull)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_UILayout_IncrementalMatchesFull)(start)\n");
+    printf("####################################################################################################\n");
+
+    int constexpr numNodes  = 400;
+    int constexpr numFrames = 200;
+
+    std::mt19937                          rng(5150u);
+    std::uniform_real_distribution<float> sizeDist(2.0f, 30.0f);
+    std::uniform_real_distribution<float> unitDist(0.0f, 1.0f);
+    std::uniform_int_distribution<int>    stackingDist(0, 2);
+    std::uniform_int_distribution<int>    mutationDist(0, 5);
+
+    UILayout layout(AABB2Class(0.0f, 0.0f, 800.0f, 600.0f), MakeStackedDesc(0.0f, eUILayoutStacking::TOP_TO_BOTTOM));
+
+    for (int index = 1; index < numNodes; ++index)
+    {
+        std::uniform_int_distribution<int> parentDist(0, index - 1);
+        sUILayoutNodeDesc                  desc = MakeStackedDesc(sizeDist(rng), static_cast<eUILayoutStacking>(stackingDist(rng)),
+                                                                  Vector2Class(unitDist(rng), unitDist(rng)), (index % 5 == 0) ? 1.5f : 0.0f);
+        float const                        u    = unitDist(rng) * 0.5f;
+        float const                        v    = unitDist(rng) * 0.5f;
+        desc.m_anchorUVs                        = AABB2Class(u, v, u + 0.5f, v + 0.5f);
+        layout.AddNode(parentDist(rng), desc);
+    }
+
+    layout.Update();
+
+    std::uniform_int_distribution<int> nodeDist(0, numNodes - 1);
+    bool                               bAllFramesMatch   = true;
+    long long                          numIncremental    = 0;
+    long long                          numFull           = 0;
+
+    for (int frame = 0; frame < numFrames; ++frame)
+    {
+        int const nodeID = nodeDist(rng);
+
+        switch (mutationDist(rng))
+        {
+        case 0: layout.SetSize(nodeID, sizeDist(rng)); break;
+        case 1: layout.SetPadding(nodeID, Vector2Class(unitDist(rng) * 3.0f, unitDist(rng) * 3.0f)); break;
+        case 2: layout.SetAspectRatio(nodeID, (unitDist(rng) < 0.5f) ? 0.0f : 0.5f + unitDist(rng)); break;
+        case 3: layout.SetOffset(nodeID, Vector2Class(unitDist(rng) * 100.0f - 50.0f, unitDist(rng) * 100.0f - 50.0f)); break;
+        case 4: layout.SetChildStacking(nodeID, static_cast<eUILayoutStacking>(stackingDist(rng))); break;
+        default: layout.SetRootBounds(AABB2Class(0.0f, 0.0f, 800.0f + unitDist(rng) * 10.0f, 600.0f)); break;
+        }
+
+        numIncremental += layout.Update();
+
+        UILayout reference = layout;
+        numFull           += reference.UpdateAll();
+        bAllFramesMatch    = bAllFramesMatch && AreRectListsEqual(layout.GetRects(), reference.GetRects());
+    }
+
+    printf("  Incremental updates laid out %lld nodes over %d frames; full layouts %lld\n", numIncremental, numFrames, numFull);
+
+    VerifyTestResult(bAllFramesMatch, "Incremental Update should produce exactly the same rects as a full layout every frame");
+    VerifyTestResult(numIncremental < numFull, "Incremental Update should lay out fewer nodes than full layouts");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_UILayout_IncrementalMatchesFull)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 2; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+int TestSet_UILayout_Performance()
+{
+#if defined(ENABLE_TestSet_UILayout_Performance)
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_UILayout_Performance)(start)\n");
+    printf("####################################################################################################\n");
+
+    // Rows of fixed-size widgets, a third of them square icons
+    UILayout         layout(AABB2Class(0.0f, 0.0f, 1920.0f, 1080.0f), MakeStackedDesc(0.0f, eUILayoutStacking::TOP_TO_BOTTOM, Vector2Class(4.0f, 4.0f)));
+    std::vector<int> leaves;
+
+    for (int row = 0; row < UI_LAYOUT_PERFORMANCE_NUM_ROWS; ++row)
+    {
+        int const rowID = layout.AddNode(0, MakeStackedDesc(10.0f, eUILayoutStacking::LEFT_TO_RIGHT, Vector2Class(0.5f, 0.5f)));
+
+        for (int widget = 0; widget < UI_LAYOUT_PERFORMANCE_WIDGETS_PER_ROW; ++widget)
+        {
+            float const aspectRatio = (widget % 3 == 0) ? 1.0f : 0.0f;
+            leaves.push_back(layout.AddNode(rowID, MakeStackedDesc(18.0f, eUILayoutStacking::OVERLAY, Vector2Class(1.0f, 1.0f), aspectRatio)));
+        }
+    }
+
+    layout.Update();
+
+    printf("  %d widgets, one leaf resized per frame for %d frames...\n", layout.GetNumNodes(), UI_LAYOUT_PERFORMANCE_NUM_FRAMES);
+
+    std::mt19937                       rng(42u);
+    std::uniform_int_distribution<int> leafDist(0, static_cast<int>(leaves.size()) - 1);
+    std::vector<int>                   changedLeaves;
+
+    for (int frame = 0; frame < UI_LAYOUT_PERFORMANCE_NUM_FRAMES; ++frame)
+    {
+        changedLeaves.push_back(leaves[leafDist(rng)]);
+    }
+
+    PerformanceTimer timer;
+    long long        numIncremental = 0;
+    long long        numFull        = 0;
+
+    UILayout incrementalLayout = layout;
+    timer.Start();
+    for (int const leafID : changedLeaves)
+    {
+        incrementalLayout.SetSize(leafID, (incrementalLayout.GetDesc(leafID).m_size == 18.0f) ? 22.0f : 18.0f);
+        numIncremental += incrementalLayout.Update();
+    }
+    timer.Stop();
+    double const incrementalTime = timer.GetElapsedMicroseconds();
+
+    UILayout fullLayout = layout;
+    timer.Start();
+    for (int const leafID : changedLeaves)
+    {
+        fullLayout.SetSize(leafID, (fullLayout.GetDesc(leafID).m_size == 18.0f) ? 22.0f : 18.0f);
+        numFull += fullLayout.UpdateAll();
+    }
+    timer.Stop();
+    double const fullTime = timer.GetElapsedMicroseconds();
+
+    printf("    Incremental: %8.3f us/frame, %.1f nodes laid out per frame\n",
+           incrementalTime / UI_LAYOUT_PERFORMANCE_NUM_FRAMES, static_cast<double>(numIncremental) / UI_LAYOUT_PERFORMANCE_NUM_FRAMES);
+    printf("    Full:        %8.3f us/frame, %.1f nodes laid out per frame (%.2fx)\n",
+           fullTime / UI_LAYOUT_PERFORMANCE_NUM_FRAMES, static_cast<double>(numFull) / UI_LAYOUT_PERFORMANCE_NUM_FRAMES, fullTime / incrementalTime);
+
+    VerifyTestResult(AreRectListsEqual(incrementalLayout.GetRects(), fullLayout.GetRects()),
+                     "UILayout performance tests completed with matching rects");
+
+    printf("####################################################################################################\n");
+    printf("(TestSet_UILayout_Performance)(end)\n");
+    printf("####################################################################################################\n");
+
+#endif
+    return 1; // Number of tests expected
+}
+
+//-----------------------------------------------------------------------------------------------
+void RunTests_UILayout()
+{
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_UILayout)(Start)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+
+    RunTestSet(true, TestSet_UILayout_Primitives, "UILayout - Primitives");
+    RunTestSet(true, TestSet_UILayout_Basics, "UILayout - Basics");
+    RunTestSet(true, TestSet_UILayout_IncrementalMatchesFull, "UILayout - Incremental Matches Full");
+    RunTestSet(false, TestSet_UILayout_Performance, "UILayout - Performance Tests");
+
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("(UnitTests_UILayout)(End)\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////////////\n");
+}
@@ -0,0 +1,33 @@
+//----------------------------------------------------------------------------------------------------
+// UnitTests_UILayout.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+void RunTests_UILayout();
+
+//----------------------------------------------------------------------------------------------------
+// Forward declarations for all test sets
+//
+int TestSet_UILayout_Primitives();
+int TestSet_UILayout_Basics();
+int TestSet_UILayout_IncrementalMatchesFull();
+int TestSet_UILayout_Performance();
+
+//----------------------------------------------------------------------------------------------------
+// YOU MAY COMMENT THESE OUT TEMPORARILY to disable certain test sets while you work.
+// For every assignment submission, all test sets must be enabled.
+//
+#define ENABLE_TestSet_UILayout_Primitives
+#define ENABLE_TestSet_UILayout_Basics
+#define ENABLE_TestSet_UILayout_IncrementalMatchesFull
+#define ENABLE_TestSet_UILayout_Performance
+
+//----------------------------------------------------------------------------------------------------
+// Performance test configuration
+//
+#define UI_LAYOUT_PERFORMANCE_NUM_ROWS 100
+#define UI_LAYOUT_PERFORMANCE_WIDGETS_PER_ROW 99
+#define UI_LAYOUT_PERFORMANCE_NUM_FRAMES 1000